@@ -1,4 +1,5 @@
 #include "ColPackHeaders.h"
+#include "PD2SMPGCColoring.h"
 #include <cstring>
 #include <unordered_set>
 using namespace ColPack;
@@ -6,6 +7,7 @@ void usage();
 void general_coloring(int argc, char* argv[]);
 void partial_coloring(int argc, char* argv[]);
 void bicoloring(int argc, char* argv[]);
+void parallel_partial_coloring(int argc, char* argv[]);
 
 
 const unordered_set<string> GENERAL_COLORING({
@@ -19,7 +21,11 @@ const unordered_set<string> BICOLORING({
         "IMPLICIT_COVERING__STAR_BICOLORING",
         "EXPLICIT_COVERING__STAR_BICOLORING",
         "EXPLICIT_COVERING__MODIFIED_STAR_BICOLORING",
-        "IMPLICIT_COVERING__GREEDY_STAR_BICOLORING"});
+        "IMPLICIT_COVERING__GREEDY_STAR_BICOLORING",
+        "EXPLICIT_COVERING__STAR_BICOLORING_OMP",
+        "MATCHING_COVERING__STAR_BICOLORING",
+        "KONIG_COVERING__STAR_BICOLORING",
+        "DEGREE_GREEDY_COVERING__STAR_BICOLORING"});
 const unordered_set<string> PARTIAL_COLORING({
         "COLUMN_PARTIAL_DISTANCE_TWO",
         "ROW_PARTIAL_DISTANCE_TWO"});
@@ -38,6 +44,8 @@ int main(int argc, char* argv[]) {
         partial_coloring(argc, argv);
     else if( BICOLORING.count(method)       ) 
         bicoloring(argc,argv);
+    else if( method.substr(0,8)=="PD2_OMP_" )
+        parallel_partial_coloring(argc,argv);
     else{
         usage();
         exit(1);
@@ -52,6 +60,8 @@ void general_coloring(int argc, char* argv[]){
     vector<string> methds;
     vector<string> orders(1,"RANDOM"); 
     bool   bVerbose(false);
+    bool   bBest(false);
+    int    nT(0);
     for(int i=1; i<argc; i++){
         if( !strcmp(argv[i], "-f") ){
             for(int j=i+1; j<argc; j++, i++){
@@ -59,6 +69,12 @@ void general_coloring(int argc, char* argv[]){
                 fnames.push_back( argv[j]);
             }
         }
+        else if(!strcmp(argv[i],"-best")){
+            bBest=true;
+        }
+        else if(!strcmp(argv[i],"-nT")){
+            nT = atoi(argv[++i]);
+        }
         else if(!strcmp(argv[i],"-m")){
             for(int j=i+1; j<argc; j++, i++){
                 if(argv[j][0]=='-') break;
@@ -85,6 +101,20 @@ void general_coloring(int argc, char* argv[]){
     for(auto fname : fnames){
         GraphColoringInterface *g = new GraphColoringInterface(SRC_FILE, fname.c_str(), "AUTO_DETECTED");
         for(auto m : methds){
+            if(bBest){
+                // all the orderings at once, the coloring with the fewest colors is kept
+                vector<int> counts;
+                g->ColorBest(orders, m, nT, 0, &counts);
+                if(bVerbose) {
+                    printf("\ngraph: %s\nmethd: %s\nGeneral Graph Coloring, best of %d orderings\n",fname.c_str(), m.c_str(), (int)orders.size());
+                    for(size_t k=0; k<orders.size(); k++)
+                        printf("  %s: %d\n", orders[k].c_str(), counts[k]);
+                    printf("best order: %s\n", g->GetVertexOrderingVariant().c_str());
+                    printf("number of colors: ");
+                }
+                printf("%d\n",g->GetVertexColorCount());
+                continue;
+            }
             for(auto o : orders){
                 if(bVerbose) printf("\ngraph: %s\norder: %s\nmethd: %s\nGeneral Graph Coloring\n",fname.c_str(), o.c_str(), m.c_str());
                 g->Coloring(o.c_str(), m.c_str());
@@ -221,7 +251,66 @@ void bicoloring(int argc, char* argv[]){
     }
     return;
 }
- 
+
+
+void parallel_partial_coloring(int argc, char* argv[]){
+    vector<string> fnames;
+    vector<string> methds;
+    vector<string> orders(1,"NATURAL"); 
+    bool   bVerbose(false);
+    int    nT(1);
+    int    side(PD2SMPGC::R);
+
+    for(int i=1; i<argc; i++){
+        if( !strcmp(argv[i], "-f") ){
+            for(int j=i+1; j<argc; j++, i++){
+                if(argv[j][0]=='-') break;
+                fnames.push_back( argv[j]);
+            }
+        }
+        else if(!strcmp(argv[i],"-m")){
+            for(int j=i+1; j<argc; j++, i++){
+                if(argv[j][0]=='-') break;
+                if(string(argv[j]).substr(0,8)=="PD2_OMP_") 
+                    methds.push_back( argv[j]);
+            }
+        }
+        else if(!strcmp(argv[i], "-o")){
+            orders.clear();
+            for(int j=i+1; j<argc; j++, i++){
+                if(argv[j][0]=='-') break;
+                orders.push_back( argv[j]);
+            }
+        }
+        else if(!strcmp(argv[i],"-nT")){
+            nT = atoi(argv[++i]);
+        }
+        else if(!strcmp(argv[i],"-side")){
+            ++i;
+            side = (argv[i][0]=='L' || argv[i][0]=='l')?PD2SMPGC::L:PD2SMPGC::R;
+        }
+        else if(!strcmp(argv[i],"-v")){
+            bVerbose=true;
+        }
+        else{
+            printf("\nWarning: unknown input argument\"%s\".\n", argv[i]);
+        }
+    }   
+
+    for(auto fname : fnames){
+        for(auto o : orders){
+            PD2SMPGCColoring *g = new PD2SMPGCColoring(fname, "MM", nullptr, o);
+            for(auto m : methds){
+                if(bVerbose) printf("\ngraph: %s\norder: %s\nmethd: %s\nside: %c\nParallel Partial Distance Two Bipartite Graph Coloring\n",fname.c_str(), o.c_str(), m.c_str(), side==PD2SMPGC::L?'L':'R');
+                g->Coloring(nT, m, side);
+                if(bVerbose) printf("number of colors: ");
+                printf("%d\n",g->get_num_colors());
+            }
+            delete g;
+        }
+    }
+    return;
+}
 
 
 void usage(){
@@ -244,19 +333,21 @@ void usage(){
             "       -o orders   Indicates the orderings. Could be 'RANDOM','NATURAL','LARGEST_FIRST','SMALLEST_LAST','DYNAMIC_LARGEST_FIRST','INCIDENCE_DEGREE'... . There could be some specific ordering for specific methods\n"
             "       -m methods  Indicates the methods. Could be 'DISTANCE_ONE','ACYCLIC','STAR','DISTNACE_TWO','ROW_PARTIAL_DISTANCE_TWO','D1_OMP_GMMP','PD2_OMP_GMMP',...\n"
             "       -nT         Indicates number of threads used of parallel graph coloring\n"
+            "       -best       For general coloring, color with all the orderings concurrently (-nT threads) and keep the fewest colors\n"
             "       -side       Indiecate Row (L) or Column (R) side of coloring for parallel partial colroing.\n"
             "\n"
             "DESCRIPTION\n"
             "       if the method is one of 'DISTANCE_ONE','ACYCLIC','STAR','DISTANCE_TWO','ROW_PARTIAL_DISTANCE_TWO' The method belongs to gereral coloring on general graphs.\n" 
             "       if the method is one of 'ROW_PARTIAL_DISTANCE_TWO','COLUMN_PARTIAL_DISTANCE_TWO' The method belongs to partial coloring on bipartite graphs.\n" 
-            "       if the method is one of 'IMPLICIT_COVERING__STAR_BICOLORING','EXPLICIT_COVERING__STAR_BICOLORING',EXPLICIT_COVERING__MODIFIED_STAR_BICOLORING','IMPLICIT_COVERING__GREEDY_STAR_BICOLORING'. The method belongs to bicoloring on bipartite graphs.\n" 
+            "       if the method is one of 'IMPLICIT_COVERING__STAR_BICOLORING','EXPLICIT_COVERING__STAR_BICOLORING',EXPLICIT_COVERING__MODIFIED_STAR_BICOLORING','IMPLICIT_COVERING__GREEDY_STAR_BICOLORING','EXPLICIT_COVERING__STAR_BICOLORING_OMP','MATCHING_COVERING__STAR_BICOLORING','KONIG_COVERING__STAR_BICOLORING','DEGREE_GREEDY_COVERING__STAR_BICOLORING'. The method belongs to bicoloring on bipartite graphs.\n" 
             "       if the method is one of 'D1_OMP_GM3P, D1_OMP_GM3P_LF, D1_OMP_GMMP, D1_OMP_GMMP_LF,D1_OMP_SERIAL, D1_OMP_SERIAL_LF, D1_OMP_JP, D1_OMP_JP_LF ,D1_OMP_MTJP, D1_OMP_MTJP_LF, D1_OMP_HBJP_GM3P, D1_OMP_HBJP_GM3P_.., D1_OMP_HBJP_GMMP.., D1_OMP_HBJP_.... ,D1_OMP_HBMTP_GM3P, D1_OMP_HBMTJP_GM3P_.., D1_OMP_HBMTJP_GMMP.., D1_OMP_HBMTJP_.... ,D2_OMP_GM3P, D2_OMP_GM3P_LF ,D2_OMP_GMMP, D2_OMP_GMMP_LF ,D2_OMP_SERIAL, D2_OMP_SERIAL_LF' the method belongs to parallel general graph coloring\n"
             "\n"
             "EXAMPLE\n"
             "./ColPack -f ../Graphs/bcsstk01.mtx -o LARGEST_FIRST RANDOM -m DISTANCE_ONE -v\n"
             "./ColPack -f ../Graphs/bcsstk01.mtx -o SMALLEST_LAST LARGEST_FIRST -m ACYCLIC -v\n"
+            "./ColPack -f ../Graphs/bcsstk01.mtx -o NATURAL LARGEST_FIRST SMALLEST_LAST RANDOM RANDOM -m STAR -best -nT 4 -v\n"
             "./ColPack -f ../Graphs/bcsstk01.mtx -o RANDOM -m D1_OMP_GMMP -v -np 2\n"
-            "./ColPack -f ../Graphs/bcsstk01.mtx -o RANDOM -m PD2_OMP_GMMP -v -np 4\n"
+            "./ColPack -f ../Graphs/bcsstk01.mtx -o RANDOM -m PD2_OMP_GMMP -v -nT 4 -side L\n"
             "\n"
            ); 
 }
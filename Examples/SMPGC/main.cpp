@@ -13,6 +13,8 @@ int main(int argc, char* argv[]) {
     vector<string> options(1,"GM3P");
     vector<int>    switch_iters(1,0);
     vector<string> pf_names(1,".");
+    vector<string> partitions(1,"EQUAL");
+    double balance_tol(SMPGC::BALANCE_TOLERANCE);
     int   bCheck(0);
 
     for(int i=1; i<argc; i++){
@@ -51,6 +53,16 @@ int main(int argc, char* argv[]) {
                 switch_iters.push_back( atoi(argv[j]));
             }
         }
+        else if(!strcmp(argv[i], "-ptt")||!strcmp(argv[i],"--ptt")) {
+            partitions.clear(); 
+            for(int j=i+1; j<argc; j++, i++){
+                if(argv[j][0]=='-') break;
+                partitions.push_back( argv[j]);
+            }
+        }
+        else if(!strcmp(argv[i], "-tol")||!strcmp(argv[i],"--tol")) {
+            if(i+1<argc) balance_tol = atof(argv[++i]);
+        }
         else if(!strcmp(argv[i],"-checkd1")||!strcmp(argv[i],"--checkd1")) bCheck|=1;
         else if(!strcmp(argv[i],"-checkd2")||!strcmp(argv[i],"--checkd2")) bCheck|=2;
 
@@ -63,6 +75,7 @@ int main(int argc, char* argv[]) {
     for(auto & fname : fnames){
         double iotime,ordtime;
         SMPGCColoring *g = new SMPGCColoring(fname,"MM",bVerbose?(&iotime):nullptr, "NATURAL", nullptr);
+        g->set_balance_tolerance(balance_tol);
         if(bVerbose) {
                 printf("%s\n",fname.c_str());
                 printf("iotime"); if(iotime>60) { printf(" %d min",((int)iotime)/60); iotime= ((int)(iotime)%60)+(iotime- (int)(iotime)); }  printf(" %g sec\n",iotime);  
@@ -74,11 +87,17 @@ int main(int argc, char* argv[]) {
                 printf("global order %s ordtime",o.c_str()); if(ordtime>60) { printf(" %d min",((int)ordtime)/60); ordtime= ((int)(ordtime)%60)+(ordtime- (int)(ordtime)); }  printf(" %g sec\n",ordtime);  
             }
 
-            for(auto& m : methds) {
-                for(auto nT : nTs) 
-                    for(auto switch_iter : switch_iters)
-                        g->Coloring(nT, m, switch_iter);
-            }//end for methods
+            for(auto& p : partitions) {
+                if     (p=="EQUAL")  g->set_partition(SMPGC::PARTITION_EQUAL);
+                else if(p=="DEGREE") g->set_partition(SMPGC::PARTITION_DEGREE);
+                else if(p=="STEAL")  g->set_partition(SMPGC::PARTITION_STEALING);
+                else { printf("Error! partition \"%s\" is not supported.\n", p.c_str()); exit(1); }
+                for(auto& m : methds) {
+                    for(auto nT : nTs) 
+                        for(auto switch_iter : switch_iters)
+                            g->Coloring(nT, m, switch_iter);
+                }//end for methods
+            }//end for partitions
         }//end for orders
         delete g;
     }//end for files
@@ -93,12 +112,18 @@ void usage(){
             "                RANDOM\n"
             "                LARGEST_FIRST\n"
             "                SMALLEST_LAST\n"
-            "-m <methods> :  D1_OMP_<GM3P/GMMP/SERIAL/JP/MTJP>[_<LF/SL/NT/RD/NONE>]\n" 
-            "                D1_OMP_HB[MT]JP_<GM3P/GMMP/SERIAL>[_<LF/SL/NT/RD/NONE>]\n"
+            "-m <methods> :  D1_OMP_<GM3P/GMMP/SERIAL/JP/MTJP/BAL>[_<LF/SL/NT/RD/NONE>]\n" 
+            "                D1_OMP_HB[MT]JP_<GM3P/GMMP/SERIAL/STREAM>[-<LF/SL/NT/RD/NONE>]\n"
             "                D2_OMP_<GM3P/GMMP/SERIAL>[_<LF/SL/NT/RD/NONE>]\n"
+            "                STAR_OMP_<GM3P/GMMP>[_<LF/SL/NT/RD/NONE>]\n"
             "\n"
             "-nT <threads>:  list of number threads, --nT is also accept.\n"
             "-v           :  verbose for debug infomation\n"
+            "-ptt <parts> :  EQUAL  (default, same number of vertices per thread)\n"
+            "                DEGREE (same estimated work per thread)\n"
+            "                STEAL  (DEGREE plus work stealing)\n"
+            "                used by D1_OMP_GM3P/GMMP and D2_OMP_GM3P/GMMP\n"
+            "-tol <x>     :  allowed excess of a color class over the average size, used by D1_OMP_BAL (default 0.05)\n"
             "(only for HYBRID METHOD)\n"
             "  -sit <switch at the number of iteration,  0 means direct switch>\n"
             "\n"
@@ -108,13 +133,18 @@ void usage(){
             " D1_OMP_SERIAL  D1_OMP_SERIAL_LF   D1_OMP_SERIAL_..\n"
             " D1_OMP_JP      D1_OMP_JP_LF       D1_OMP_JP_..    \n"
             " D1_OMP_MTJP    D1_OMP_MTJP_LF     D1_OMP_MTJP_..  \n"
+            " D1_OMP_BAL     D1_OMP_BAL_LF      D1_OMP_BAL_..   \n"
             "\n"
             " D1_OMP_HBJP_GM3P   D1_OMP_HBJP_GM3P_..   D1_OMP_HBJP_GMMP..   D1_OMP_HBJP_....  \n"
             " D1_OMP_HBMTP_GM3P  D1_OMP_HBMTJP_GM3P_.. D1_OMP_HBMTJP_GMMP.. D1_OMP_HBMTJP_....\n"
+            " D1_OMP_HBJP_STREAM D1_OMP_HBJP_STREAM-.. D1_OMP_HBMTJP_STREAM D1_OMP_HBMTJP_STREAM-..\n"
             "\n"
             " D2_OMP_GM3P    D2_OMP_GM3P_LF     D2_OMP_GM3P_..  \n"
             " D2_OMP_GMMP    D2_OMP_GMMP_LF     D2_OMP_GMMP_..  \n"
             " D2_OMP_SERIAL  D2_OMP_SERIAL_LF   D2_OMP_SERIAL_..\n"
+            "\n"
+            " STAR_OMP_GM3P  STAR_OMP_GM3P_LF   STAR_OMP_GM3P_..\n"
+            " STAR_OMP_GMMP  STAR_OMP_GMMP_LF   STAR_OMP_GMMP_..\n"
            "\n"
             "Example:\n"
             " $./ColPack -f mc10.mtx mc15.mtx -o RANDOM -m D1_OMP_GM3P D2_OMP_GMMP_LF -v --nT 1 2 4 8\n" 
@@ -31,6 +31,7 @@
 #include <iomanip>
 #include <string>
 #include <cstdlib>
+#include <climits>
 #include <cstdarg>
 
 #include <list>
@@ -57,6 +58,7 @@
 
 #include "StringTokenizer.h"
 #include "DisjointSets.h"
+#include "ColorBalance.h"
 
 #include "GraphCore.h"
 #include "GraphInputOutput.h"
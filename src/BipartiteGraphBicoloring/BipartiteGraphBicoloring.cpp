@@ -154,2133 +154,120 @@ namespace ColPack
 	}
 
 
-	//Private Function 3508
-	int BipartiteGraphBicoloring::FixMinimalCoverStarBicoloring()
+	//Private Function 3509
+	void BipartiteGraphBicoloring::GetEdgeIDs(vector<int> & vi_EdgeIDs)
 	{
-		int i, j, k, l, m, n;
-
-		int i_FirstColor, i_SecondColor, i_ThirdColor, i_FourthColor;
-
-		int i_ColorViolationCount, i_PathViolationCount, i_TotalViolationCount;
-
-		vector<int> vi_CandidateColors, vi_VertexColors;
-
-		int i_LeftVertexCount = STEP_DOWN((signed) m_vi_LeftVertices.size());
-		int i_RightVertexCount = STEP_DOWN((signed) m_vi_RightVertices.size());
-
-		int i_LeftVertexCoverSize = (signed) m_vi_CoveredLeftVertices.size();
-		int i_RightVertexCoverSize = (signed) m_vi_CoveredRightVertices.size();
-
-		m_i_VertexColorCount = STEP_UP(i_LeftVertexCoverSize) + STEP_UP(i_RightVertexCoverSize);
-
-		vi_VertexColors.clear();
-		vi_VertexColors.resize((unsigned) i_LeftVertexCount + i_RightVertexCount, _FALSE);
-
-		vi_CandidateColors.clear();
-		vi_CandidateColors.resize((unsigned) m_i_VertexColorCount, _UNKNOWN);
-
-		i_ColorViolationCount = _FALSE;
-
-		for(i=0; i<i_LeftVertexCount; i++)
-		{
-			vi_VertexColors[m_vi_LeftVertexColors[i]] = _TRUE;
-		}
-
-		for(i=0; i<i_RightVertexCount; i++)
-		{
-			if(vi_VertexColors[m_vi_RightVertexColors[i]] == _TRUE)
-			{
-				i_ColorViolationCount++;
-
-#if DEBUG == 3508
-
-				cout<<"Color Violation "<<i_ColorViolationCount<<" | Right Vertex "<<STEP_UP(i)<<" | Conflicting Color "<<m_vi_RightVertexColors[i]<<endl;
-
-#endif
-
-				for(j=m_vi_RightVertices[i]; j<m_vi_RightVertices[STEP_UP(i)]; j++)
-				{
-					for(k=m_vi_LeftVertices[m_vi_Edges[j]]; k<m_vi_LeftVertices[STEP_UP(m_vi_Edges[j])]; k++)
-					{
-						if(m_vi_Edges[k] == i)
-						{
-							continue;
-						}
-
-						vi_CandidateColors[m_vi_RightVertexColors[m_vi_Edges[k]]] = i;
-					}
-				}
-
-				for(j=STEP_UP(i_LeftVertexCoverSize); j<m_i_VertexColorCount; j++)
-				{
-					if(vi_CandidateColors[j] != i)
-					{
-						m_vi_RightVertexColors[i] = j;
-
-						if(m_i_RightVertexColorCount < j)
-						{
-							m_i_RightVertexColorCount = j;
-						}
-
-						break;
-					}
-				}
-
-#if DEBUG == 3508
-
-				cout<<"Fixed Color Violation "<<i_ColorViolationCount<<" | Right Vertex "<<STEP_UP(i)<<" | Changed Right Vertex Color "<<m_vi_RightVertexColors[i]<<endl;
-
-#endif
-
-			}
-		}
-
-		i_PathViolationCount = _FALSE;
-
-		for(i=0; i<i_LeftVertexCount; i++)
-		{
-			i_FirstColor = m_vi_LeftVertexColors[i];
-
-			for(j=m_vi_LeftVertices[i]; j<m_vi_LeftVertices[STEP_UP(i)]; j++)
-			{
-				i_SecondColor = m_vi_RightVertexColors[m_vi_Edges[j]];
-
-				for(k=m_vi_RightVertices[m_vi_Edges[j]]; k<m_vi_RightVertices[STEP_UP(m_vi_Edges[j])]; k++)
-				{
-					if(m_vi_Edges[k] == i)
-					{
-						continue;
-					}
-
-					i_ThirdColor = m_vi_LeftVertexColors[m_vi_Edges[k]];
-
-					if(i_ThirdColor == i_FirstColor)
-					{
-						for(l=m_vi_LeftVertices[m_vi_Edges[k]]; l<m_vi_LeftVertices[STEP_UP(m_vi_Edges[k])]; l++)
-						{
-							if(m_vi_Edges[l] == m_vi_Edges[j])
-							{
-								continue;
-							}
-
-							i_FourthColor = m_vi_RightVertexColors[m_vi_Edges[l]];
-
-							if(i_FourthColor == i_SecondColor)
-							{
-								i_PathViolationCount++;
-
-#if DEBUG == 3508
-
-								cout<<"Path Violation "<<i_PathViolationCount<<" | "<<STEP_UP(i)<<" ["<<i_FirstColor<<"] - "<<STEP_UP(m_vi_Edges[j])<<" ["<<i_SecondColor<<"] - "<<STEP_UP(m_vi_Edges[k])<<" ["<<i_ThirdColor<<"] - "<<STEP_UP(m_vi_Edges[l])<<" ["<<i_FourthColor<<"]"<<endl;
-
-#endif
-
-								for(m=m_vi_RightVertices[m_vi_Edges[l]]; m<m_vi_RightVertices[STEP_UP(m_vi_Edges[l])]; m++)
-								{
-									for(n=m_vi_LeftVertices[m_vi_Edges[m]]; n<m_vi_LeftVertices[STEP_UP(m_vi_Edges[m])]; n++)
-									{
-										if(m_vi_Edges[n] == m_vi_Edges[l])
-										{
-											continue;
-										}
-
-										vi_CandidateColors[m_vi_RightVertexColors[m_vi_Edges[n]]] = m_vi_Edges[l];
-									}
-								}
-
-								for(m=STEP_UP(i_LeftVertexCoverSize); m<m_i_VertexColorCount; m++)
-								{
-									if(vi_CandidateColors[m] != m_vi_Edges[l])
-									{
-										m_vi_RightVertexColors[m_vi_Edges[l]] = m;
-
-										if(m_i_RightVertexColorCount < m)
-										{
-											m_i_RightVertexColorCount = m;
-										}
-
-										break;
-									}
-								}
-
-#if DEBUG == 3508
-
-								cout<<"Fixed Path Violation "<<i_PathViolationCount<<" | "<<STEP_UP(i)<<" ["<<i_FirstColor<<"] - "<<STEP_UP(m_vi_Edges[j])<<" ["<<i_SecondColor<<"] - "<<STEP_UP(m_vi_Edges[k])<<" ["<<i_ThirdColor<<"] - "<<STEP_UP(m_vi_Edges[l])<<" ["<<m_vi_RightVertexColors[m_vi_Edges[l]]<<"]"<<endl;
-
-#endif
-
-							}
-						}
-					}
-				}
-			}
-		}
-
-		i_TotalViolationCount = i_ColorViolationCount + i_PathViolationCount;
-
-#if _DEBUG == 3508
-
-		if(i_TotalViolationCount)
-		{
-			cout<<endl;
-			cout<<"[Total Violations = "<<i_TotalViolationCount<<"]"<<endl;
-			cout<<endl;
-		}
-
-#endif
-
-		return(i_TotalViolationCount);
-	}
-
-
-
-	//Public Constructor 3551
-	BipartiteGraphBicoloring::BipartiteGraphBicoloring()
-	{
-		Clear();
-
-		Seed_init();
-	}
-
-
-	//Public Destructor 3552
-	BipartiteGraphBicoloring::~BipartiteGraphBicoloring()
-	{
-		Clear();
-
-		Seed_reset();
-	}
-
-	void BipartiteGraphBicoloring::Seed_init() {
-		lseed_available = false;
-		i_lseed_rowCount = 0;
-		dp2_lSeed = NULL;
-
-		rseed_available = false;
-		i_rseed_rowCount = 0;
-		dp2_rSeed = NULL;
-	}
-
-	void BipartiteGraphBicoloring::Seed_reset() {
-		if(lseed_available) {
-			lseed_available = false;
-
-			if(i_lseed_rowCount>0) {
-			  free_2DMatrix(dp2_lSeed, i_lseed_rowCount);
-			}
-			else {
-			  cerr<<"ERR: freeing left seed matrix with 0 row"<<endl;
-			  exit(-1);
-			}
-			dp2_lSeed = NULL;
-			i_lseed_rowCount = 0;
-		}
-
-		if(rseed_available) {
-			rseed_available = false;
-
-			if(i_rseed_rowCount>0) {
-			  free_2DMatrix(dp2_rSeed, i_rseed_rowCount);
-			}
-			else {
-			  cerr<<"ERR: freeing right seed matrix with 0 row"<<endl;
-			  exit(-1);
-			}
-			dp2_rSeed = NULL;
-			i_rseed_rowCount = 0;
-		}
-	}
-
-
-	//Virtual Function 3553
-	void BipartiteGraphBicoloring::Clear()
-	{
-		BipartiteGraphOrdering::Clear();
-
-		//m_i_ColoringUnits = _UNKNOWN;
-
-		m_i_LeftVertexColorCount = _UNKNOWN;
-		m_i_RightVertexColorCount = _UNKNOWN;
-
-		m_i_VertexColorCount = _UNKNOWN;
-
-		m_i_ViolationCount = _UNKNOWN;
-
-		m_i_LargestLeftVertexColorClass = _UNKNOWN;
-		m_i_LargestRightVertexColorClass = _UNKNOWN;
-
-		m_i_LargestLeftVertexColorClassSize = _UNKNOWN;
-		m_i_LargestRightVertexColorClassSize = _UNKNOWN;
-
-		m_i_SmallestLeftVertexColorClass = _UNKNOWN;
-		m_i_SmallestRightVertexColorClass = _UNKNOWN;
-
-		m_i_SmallestLeftVertexColorClassSize = _UNKNOWN;
-		m_i_SmallestRightVertexColorClassSize = _UNKNOWN;
-
-		m_i_LargestVertexColorClass = _UNKNOWN;
-		m_i_SmallestVertexColorClass = _UNKNOWN;
-
-		m_i_LargestVertexColorClassSize = _UNKNOWN;
-		m_i_SmallestVertexColorClassSize = _UNKNOWN;
-
-		m_d_AverageLeftVertexColorClassSize = _UNKNOWN;
-		m_d_AverageRightVertexColorClassSize = _UNKNOWN;
-		m_d_AverageVertexColorClassSize = _UNKNOWN;
-
-		m_d_ColoringTime = _UNKNOWN;
-		m_d_CheckingTime = _UNKNOWN;
-
-		m_s_VertexColoringVariant.clear();
-
-		m_vi_LeftVertexColors.clear();
-		m_vi_RightVertexColors.clear();
-
-		m_vi_LeftVertexColorFrequency.clear();
-		m_vi_RightVertexColorFrequency.clear();
-
-		return;
-	}
-
-
-	//Virtual Function 3554
-	void BipartiteGraphBicoloring::Reset()
-	{
-		BipartiteGraphOrdering::Reset();
-
-		//m_i_ColoringUnits = _UNKNOWN;
-
-		m_i_LeftVertexColorCount = _UNKNOWN;
-		m_i_RightVertexColorCount = _UNKNOWN;
-
-		m_i_VertexColorCount = _UNKNOWN;
-
-		m_i_ViolationCount = _UNKNOWN;
-
-		m_i_LargestLeftVertexColorClass = _UNKNOWN;
-		m_i_LargestRightVertexColorClass = _UNKNOWN;
-
-		m_i_LargestLeftVertexColorClassSize = _UNKNOWN;
-		m_i_LargestRightVertexColorClassSize = _UNKNOWN;
-
-		m_i_SmallestLeftVertexColorClass = _UNKNOWN;
-		m_i_SmallestRightVertexColorClass = _UNKNOWN;
-
-		m_i_SmallestLeftVertexColorClassSize = _UNKNOWN;
-		m_i_SmallestRightVertexColorClassSize = _UNKNOWN;
-
-		m_i_LargestVertexColorClass = _UNKNOWN;
-		m_i_SmallestVertexColorClass = _UNKNOWN;
-
-		m_i_LargestVertexColorClassSize = _UNKNOWN;
-		m_i_SmallestVertexColorClassSize = _UNKNOWN;
-
-		m_d_AverageLeftVertexColorClassSize = _UNKNOWN;
-		m_d_AverageRightVertexColorClassSize = _UNKNOWN;
-		m_d_AverageVertexColorClassSize = _UNKNOWN;
-
-		m_d_ColoringTime = _UNKNOWN;
-		m_d_CheckingTime = _UNKNOWN;
-
-		m_s_VertexColoringVariant.clear();
-
-		m_vi_LeftVertexColors.clear();
-		m_vi_RightVertexColors.clear();
-
-		m_vi_LeftVertexColorFrequency.clear();
-		m_vi_RightVertexColorFrequency.clear();
-
-		return;
-	}
-
-
-	//Public Function 3556
-	int BipartiteGraphBicoloring::MinimalCoveringRowMajorStarBicoloring()
-	{
-		if(CheckVertexColoring("MINIMAL_COVER_ROW_STAR"))
-		{
-			return(_TRUE);
-		}
-
-		int i, j, k;
-
-		int _FOUND;
-
-		int i_ColorID, i_StarID;
-
-		int i_EdgeCount;
-
-		int i_FirstNeighborOne, i_FirstNeighborTwo;
-
-		int i_LeftVertexCount, i_RightVertexCount;
-
-		int i_LargerVertexCount;
-
-		int i_LeftVertexCoverSize, i_RightVertexCoverSize;
-
-		int i_PresentVertex, i_NeighboringVertex, i_SecondNeighboringVertex;
-
-		vector<int> vi_CandidateColors;
-
-		vector<int> vi_EdgeStarMap, vi_LeftStarHubMap, vi_RightStarHubMap;
-
-		vector<int> vi_FirstTreated;
-
-		vector<int> vi_FirstNeighborOne, vi_FirstNeighborTwo;
-
-		i_LeftVertexCount  = STEP_DOWN((signed) m_vi_LeftVertices.size());
-		i_RightVertexCount = STEP_DOWN((signed) m_vi_RightVertices.size());
-
-		i_LargerVertexCount = i_LeftVertexCount>i_RightVertexCount?i_LeftVertexCount:i_RightVertexCount;
-
-		i_EdgeCount = (signed) m_vi_Edges.size()/2;
-
-		vi_EdgeStarMap.clear();
-		vi_EdgeStarMap.resize((unsigned) i_EdgeCount, _UNKNOWN);
-
-		m_mimi2_VertexEdgeMap.clear();
-
-		k=_FALSE;
-
-		for(i=0; i<i_LeftVertexCount; i++)
-		{
-			for(j=m_vi_LeftVertices[i]; j<m_vi_LeftVertices[STEP_UP(i)]; j++)
-			{
-				m_mimi2_VertexEdgeMap[i][m_vi_Edges[j]] = k;
-
-				vi_EdgeStarMap[k] = k;
-
-				k++;
-			}
-		}
-
-		Timer m_T_Timer;
-
-		m_T_Timer.Start();
-
-		CoverMinimalVertex();
-
-		m_T_Timer.Stop();
-
-		m_d_CoveringTime = m_T_Timer.GetWallTime();
-
-		PresetCoveredVertexColors();
-
-#if DEBUG == 3556
-
-		cout<<"DEBUG 3556 | Left Star Bicoloring | Left Vertex Cover Size = "<<m_vi_CoveredLeftVertices.size()<<"; Right Vertex Cover Size = "<<m_vi_CoveredRightVertices.size()<<endl;
-
-#endif
-
-#if DEBUG == 3556
-
-		cout<<endl;
-		cout<<"DEBUG 3556 | Left Star Bicoloring | Initial Vertex Colors | Left Vertices"<<endl;
-		cout<<endl;
-
-		for(i=0; i<i_LeftVertexCount; i++)
-		{
-			cout<<STEP_UP(i)<<"\t"<<" : "<<m_vi_LeftVertexColors[i]<<endl;
-		}
-
-		cout<<endl;
-		cout<<"DEBUG 3556 | Left Star Bicoloring | Initial Vertex Colors | Right Vertices"<<endl;
-		cout<<endl;
-
-		for(i=0; i<i_RightVertexCount; i++)
-		{
-			cout<<STEP_UP(i)<<"\t"<<" : "<<m_vi_RightVertexColors[i]<<endl;
-		}
-
-#endif
-
-		i_LeftVertexCoverSize = (signed) m_vi_CoveredLeftVertices.size();
-		i_RightVertexCoverSize = (signed) m_vi_CoveredRightVertices.size();
-
-		m_i_VertexColorCount = STEP_UP(i_LeftVertexCoverSize + i_RightVertexCoverSize);
-
-		vi_CandidateColors.clear();
-		vi_CandidateColors.resize((unsigned) m_i_VertexColorCount, _UNKNOWN);
-
-		vi_LeftStarHubMap.clear();
-		vi_LeftStarHubMap.resize((unsigned) i_EdgeCount, _UNKNOWN);
-
-		vi_RightStarHubMap.clear();
-		vi_RightStarHubMap.resize((unsigned) i_EdgeCount, _UNKNOWN);
-
-		vi_FirstNeighborOne.clear();
-		vi_FirstNeighborOne.resize((unsigned) i_LargerVertexCount, _UNKNOWN);
-
-		vi_FirstNeighborTwo.clear();
-		vi_FirstNeighborTwo.resize((unsigned) i_LargerVertexCount, _UNKNOWN);
-
-		vi_FirstTreated.clear();
-		vi_FirstTreated.resize((unsigned) i_LargerVertexCount, _UNKNOWN);
-
-		m_i_LeftVertexColorCount = _UNKNOWN;
-
-		for(i=0; i<i_LeftVertexCoverSize; i++)
-		{
-			i_PresentVertex = m_vi_CoveredLeftVertices[i];
-
-			for(j=m_vi_LeftVertices[i_PresentVertex]; j<m_vi_LeftVertices[STEP_UP(i_PresentVertex)]; j++)
-			{
-				i_NeighboringVertex = m_vi_Edges[j];
-
-				if(m_vi_RightVertexColors[i_NeighboringVertex] == _FALSE)
-				{
-					for(k=m_vi_RightVertices[i_NeighboringVertex]; k<m_vi_RightVertices[STEP_UP(i_NeighboringVertex)]; k++)
-					{
-						i_SecondNeighboringVertex = m_vi_Edges[k];
-
-						if(m_vi_LeftVertexColors[i_SecondNeighboringVertex] > _FALSE)
-						{
-							vi_CandidateColors[m_vi_LeftVertexColors[i_SecondNeighboringVertex]] = i_PresentVertex;
-						}
-					}
-				}
-			}
-
-			for(j=_TRUE; j<STEP_UP(i_LeftVertexCoverSize); j++)
-			{
-				if(vi_CandidateColors[j] != i_PresentVertex)
-				{
-					m_vi_LeftVertexColors[i_PresentVertex] = j;
-
-					if(m_i_LeftVertexColorCount < j)
-					{
-						m_i_LeftVertexColorCount = j;
-					}
-
-					break;
-				}
-			}
-		}
-
-		m_i_RightVertexColorCount = _UNKNOWN;
-
-		for(i=0; i<i_RightVertexCoverSize; i++)
-		{
-			i_PresentVertex = m_vi_CoveredRightVertices[i];
-
-			for(j=m_vi_RightVertices[i_PresentVertex]; j<m_vi_RightVertices[STEP_UP(i_PresentVertex)]; j++)
-			{
-				i_NeighboringVertex = m_vi_Edges[j];
-
-				i_ColorID = m_vi_LeftVertexColors[i_NeighboringVertex];
-
-				if(i_ColorID == _UNKNOWN)
-				{
-					continue;
-				}
-
-				if(i_ColorID == _FALSE)
-				{
-					for(k=m_vi_LeftVertices[i_NeighboringVertex]; k<m_vi_LeftVertices[STEP_UP(i_NeighboringVertex)]; k++)
-					{
-						i_SecondNeighboringVertex = m_vi_Edges[k];
-
-						if(m_vi_RightVertexColors[i_SecondNeighboringVertex] == _UNKNOWN)
-						{
-							continue;
-						}
-
-						if(m_vi_RightVertexColors[i_SecondNeighboringVertex] != _FALSE)
-						{
-							vi_CandidateColors[m_vi_RightVertexColors[i_SecondNeighboringVertex]] = i_PresentVertex;
-						}
-					}
-				}
-				else
-				{
-					i_FirstNeighborOne = vi_FirstNeighborOne[i_ColorID];
-					i_FirstNeighborTwo = vi_FirstNeighborTwo[i_ColorID];
-
-					if(i_FirstNeighborOne == i_PresentVertex)
-					{
-						if(vi_FirstTreated[i_FirstNeighborTwo] != i_PresentVertex)
-						{
-							for(k=m_vi_LeftVertices[i_FirstNeighborTwo]; k<m_vi_LeftVertices[STEP_UP(i_FirstNeighborTwo)]; k++)
-							{
-								if(m_vi_Edges[k] == i_PresentVertex)
-								{
-									continue;
-								}
-
-								if(m_vi_RightVertexColors[m_vi_Edges[k]] == _UNKNOWN)
-								{
-									continue;
-								}
-
-								vi_CandidateColors[m_vi_RightVertexColors[m_vi_Edges[k]]] = i_PresentVertex;
-							}
-
-							vi_FirstTreated[i_FirstNeighborTwo] = i_PresentVertex;
-						}
-
-						for(k=m_vi_LeftVertices[m_vi_Edges[j]]; k<m_vi_LeftVertices[STEP_UP(m_vi_Edges[j])]; k++)
-						{
-							if(m_vi_Edges[k] == i_PresentVertex)
-							{
-								continue;
-							}
-
-							if(m_vi_RightVertexColors[m_vi_Edges[k]] == _UNKNOWN)
-							{
-								continue;
-							}
-
-							vi_CandidateColors[m_vi_RightVertexColors[m_vi_Edges[k]]] = i_PresentVertex;
-
-						}
-
-						vi_FirstTreated[i_NeighboringVertex] = i_PresentVertex;
-					}
-					else
-					{
-						vi_FirstNeighborOne[i_ColorID] = i_PresentVertex;
-						vi_FirstNeighborTwo[i_ColorID] = i_NeighboringVertex;
-
-						for(k=m_vi_LeftVertices[i_NeighboringVertex]; k<m_vi_LeftVertices[STEP_UP(i_NeighboringVertex)]; k++)
-						{
-							i_SecondNeighboringVertex = m_vi_Edges[k];
-
-							if(i_SecondNeighboringVertex == i_PresentVertex)
-							{
-								continue;
-							}
-
-							if(m_vi_RightVertexColors[i_SecondNeighboringVertex] == _UNKNOWN)
-							{
-								continue;
-							}
-
-							if(vi_RightStarHubMap[vi_EdgeStarMap[m_mimi2_VertexEdgeMap[i_NeighboringVertex][i_SecondNeighboringVertex]]] == i_SecondNeighboringVertex)
-							{
-								vi_CandidateColors[m_vi_RightVertexColors[i_SecondNeighboringVertex]] = i_PresentVertex;
-
-							}
-						}
-					}
-				}
-			}
-
-			for(j=STEP_UP(i_LeftVertexCoverSize); j<m_i_VertexColorCount; j++)
-			{
-				if(vi_CandidateColors[j] != i_PresentVertex)
-				{
-					m_vi_RightVertexColors[i_PresentVertex] = j;
-
-					if(m_i_RightVertexColorCount < j)
-					{
-						m_i_RightVertexColorCount = j;
-					}
-
-					break;
-				}
-			}
-
-			for(j=m_vi_RightVertices[i_PresentVertex]; j<m_vi_RightVertices[STEP_UP(i_PresentVertex)]; j++)
-			{
-				_FOUND = _FALSE;
-
-				i_NeighboringVertex = m_vi_Edges[j];
-
-				if(m_vi_LeftVertexColors[i_NeighboringVertex] == _UNKNOWN)
-				{
-					continue;
-				}
-
-				for(k=m_vi_LeftVertices[i_NeighboringVertex]; k<m_vi_LeftVertices[STEP_UP(i_NeighboringVertex)]; k++)
-				{
-					i_SecondNeighboringVertex = m_vi_Edges[k];
-
-					if(i_SecondNeighboringVertex == i_PresentVertex)
-					{
-						continue;
-					}
-
-					if(m_vi_RightVertexColors[i_SecondNeighboringVertex] == _UNKNOWN)
-					{
-						continue;
-					}
-
-					if(m_vi_RightVertexColors[i_SecondNeighboringVertex] == m_vi_RightVertexColors[i_PresentVertex])
-					{
-						_FOUND = _TRUE;
-
-						i_StarID = vi_EdgeStarMap[m_mimi2_VertexEdgeMap[i_NeighboringVertex][i_SecondNeighboringVertex]];
-
-						vi_LeftStarHubMap[i_StarID] = i_NeighboringVertex;
-
-						vi_EdgeStarMap[m_mimi2_VertexEdgeMap[i_NeighboringVertex][i_PresentVertex]] = i_StarID;
-
-						break;
-					}
-				}
-
-				if (!_FOUND)
-				{
-					i_FirstNeighborOne = vi_FirstNeighborOne[m_vi_LeftVertexColors[i_NeighboringVertex]];
-					i_FirstNeighborTwo = vi_FirstNeighborTwo[m_vi_LeftVertexColors[i_NeighboringVertex]];
-
-					if((i_FirstNeighborOne == i_PresentVertex) && (i_FirstNeighborTwo != i_NeighboringVertex))
-					{
-						i_StarID = vi_EdgeStarMap[m_mimi2_VertexEdgeMap[i_FirstNeighborTwo][i_PresentVertex]];
-
-						vi_RightStarHubMap[i_StarID] = i_PresentVertex;
-
-						vi_EdgeStarMap[m_mimi2_VertexEdgeMap[i_NeighboringVertex][i_PresentVertex]] = i_StarID;
-					}
-				}
-			}
-		}
-
-		m_i_VertexColorCount = m_i_LeftVertexColorCount + m_i_RightVertexColorCount - i_LeftVertexCoverSize;
-
-#if DEBUG == 3556
-
-		cout<<endl;
-		cout<<"DEBUG 3556 | Left Star Bicoloring | Vertex Colors | Left Vertices"<<endl;
-		cout<<endl;
-
-		for(i=0; i<i_LeftVertexCount; i++)
-		{
-			cout<<STEP_UP(i)<<"\t"<<" : "<<m_vi_LeftVertexColors[i]<<endl;
-		}
-
-		cout<<endl;
-		cout<<"DEBUG 3556 | Left Star Bicoloring | Vertex Colors | Right Vertices"<<endl;
-		cout<<endl;
-
-		for(i=0; i<i_RightVertexCount; i++)
-		{
-			cout<<STEP_UP(i)<<"\t"<<" : "<<m_vi_RightVertexColors[i]<<endl;
-		}
-
-#endif
-
-		return(_TRUE);
-	}
-
-
-
-	//Public Function 3557
-	int BipartiteGraphBicoloring::MinimalCoveringColumnMajorStarBicoloring()
-	{
-		if(CheckVertexColoring("MINIMAL_COVER_COLUMN_STAR"))
-		{
-			return(_TRUE);
-		}
-
-		int i, j, k;
-
-		int _FOUND;
-
-		int i_ColorID, i_StarID;
-
-		int i_EdgeCount;
-
-		int i_FirstNeighborOne, i_FirstNeighborTwo;
-
-		int i_LeftVertexCount, i_RightVertexCount;
-
-		int i_LargerVertexCount;
-
-		int i_LeftVertexCoverSize, i_RightVertexCoverSize;
-
-		int i_PresentVertex, i_NeighboringVertex, i_SecondNeighboringVertex;
-
-		vector<int> vi_CandidateColors;
-
-		vector<int> vi_EdgeStarMap, vi_LeftStarHubMap, vi_RightStarHubMap;
-
-		vector<int> vi_FirstTreated;
-
-		vector<int> vi_FirstNeighborOne, vi_FirstNeighborTwo;
-
-		i_LeftVertexCount  = STEP_DOWN((signed) m_vi_LeftVertices.size());
-		i_RightVertexCount = STEP_DOWN((signed) m_vi_RightVertices.size());
-
-		i_LargerVertexCount = i_LeftVertexCount>i_RightVertexCount?i_LeftVertexCount:i_RightVertexCount;
-
-		i_EdgeCount = (signed) m_vi_Edges.size()/2;
-
-		vi_EdgeStarMap.clear();
-		vi_EdgeStarMap.resize((unsigned) i_EdgeCount, _UNKNOWN);
-
-		m_mimi2_VertexEdgeMap.clear();
-
-		k=_FALSE;
-
-		for(i=0; i<i_LeftVertexCount; i++)
-		{
-			for(j=m_vi_LeftVertices[i]; j<m_vi_LeftVertices[STEP_UP(i)]; j++)
-			{
-				m_mimi2_VertexEdgeMap[i][m_vi_Edges[j]] = k;
-
-				vi_EdgeStarMap[k] = k;
-
-				k++;
-			}
-		}
-
-		Timer m_T_Timer;
-
-		m_T_Timer.Start();
-
-		CoverMinimalVertex();
-
-		m_T_Timer.Stop();
-
-		m_d_CoveringTime = m_T_Timer.GetWallTime();
-
-		PresetCoveredVertexColors();
-
-#if DEBUG == 3557
-
-		cout<<"DEBUG 3557 | Right Star Bicoloring | Left Vertex Cover Size = "<<m_vi_CoveredLeftVertices.size()<<"; Right Vertex Cover Size = "<<m_vi_CoveredRightVertices.size()<<endl;
-
-#endif
-
-#if DEBUG == 3557
-
-		cout<<endl;
-		cout<<"DEBUG 3557 | Right Star Bicoloring | Initial Vertex Colors | Left Vertices"<<endl;
-		cout<<endl;
-
-		for(i=0; i<i_LeftVertexCount; i++)
-		{
-			cout<<STEP_UP(i)<<"\t"<<" : "<<m_vi_LeftVertexColors[i]<<endl;
-		}
-
-		cout<<endl;
-		cout<<"DEBUG 3557 | Right Star Bicoloring | Initial Vertex Colors | Right Vertices"<<endl;
-		cout<<endl;
-
-		for(i=0; i<i_RightVertexCount; i++)
-		{
-			cout<<STEP_UP(i)<<"\t"<<" : "<<m_vi_RightVertexColors[i]<<endl;
-		}
-
-#endif
-
-		i_LeftVertexCoverSize = (signed) m_vi_CoveredLeftVertices.size();
-		i_RightVertexCoverSize = (signed) m_vi_CoveredRightVertices.size();
-
-		m_i_VertexColorCount = STEP_UP(i_LeftVertexCoverSize +  i_RightVertexCoverSize);
-
-		vi_CandidateColors.clear();
-		vi_CandidateColors.resize((unsigned) m_i_VertexColorCount, _UNKNOWN);
-
-		vi_LeftStarHubMap.clear();
-		vi_LeftStarHubMap.resize((unsigned) i_EdgeCount, _UNKNOWN);
-
-		vi_RightStarHubMap.clear();
-		vi_RightStarHubMap.resize((unsigned) i_EdgeCount, _UNKNOWN);
-
-		vi_FirstNeighborOne.clear();
-		vi_FirstNeighborOne.resize((unsigned) i_LargerVertexCount, _UNKNOWN);
-
-		vi_FirstNeighborTwo.clear();
-		vi_FirstNeighborTwo.resize((unsigned) i_LargerVertexCount, _UNKNOWN);
-
-		vi_FirstTreated.clear();
-		vi_FirstTreated.resize((unsigned) i_LargerVertexCount, _UNKNOWN);
-
-		m_i_RightVertexColorCount = _UNKNOWN;
-
-		for(i=0; i<i_RightVertexCoverSize; i++)
-		{
-			i_PresentVertex = m_vi_CoveredRightVertices[i];
-
-			for(j=m_vi_RightVertices[i_PresentVertex]; j<m_vi_RightVertices[STEP_UP(i_PresentVertex)]; j++)
-			{
-				i_NeighboringVertex = m_vi_Edges[j];
-
-				if(m_vi_LeftVertexColors[i_NeighboringVertex] == _FALSE)
-				{
-					for(k=m_vi_LeftVertices[i_NeighboringVertex]; k<m_vi_LeftVertices[STEP_UP(i_NeighboringVertex)]; k++)
-					{
-						i_SecondNeighboringVertex = m_vi_Edges[k];
-
-						if(m_vi_RightVertexColors[i_SecondNeighboringVertex] > _FALSE)
-						{
-							vi_CandidateColors[m_vi_RightVertexColors[i_SecondNeighboringVertex]] = i_PresentVertex;
-						}
-					}
-				}
-			}
-
-			for(j=_TRUE; j<STEP_UP(i_RightVertexCoverSize); j++)
-			{
-				if(vi_CandidateColors[j] != i_PresentVertex)
-				{
-					m_vi_RightVertexColors[i_PresentVertex] = j;
-
-					if(m_i_RightVertexColorCount < j)
-					{
-						m_i_RightVertexColorCount = j;
-					}
-
-					break;
-				}
-			}
-		}
-
-#if DEBUG == 3557
-
-		cout<<endl;
-		cout<<"DEBUG 3557 | Right Star Bicoloring | Present Vertex Colors | Left Vertices"<<endl;
-		cout<<endl;
-
-		for(i=0; i<i_LeftVertexCount; i++)
-		{
-			cout<<STEP_UP(i)<<"\t"<<" : "<<m_vi_LeftVertexColors[i]<<endl;
-		}
-
-		cout<<endl;
-		cout<<"DEBUG 3557 | Right Star Bicoloring | Present Vertex Colors | Right Vertices"<<endl;
-		cout<<endl;
-
-		for(i=0; i<i_RightVertexCount; i++)
-		{
-			cout<<STEP_UP(i)<<"\t"<<" : "<<m_vi_RightVertexColors[i]<<endl;
-		}
-
-#endif
-
-		m_i_LeftVertexColorCount = _UNKNOWN;
-
-		for(i=0; i<i_LeftVertexCoverSize; i++)
-		{
-			i_PresentVertex = m_vi_CoveredLeftVertices[i];
-
-			for(j=m_vi_LeftVertices[i_PresentVertex]; j<m_vi_LeftVertices[STEP_UP(i_PresentVertex)]; j++)
-			{
-				i_NeighboringVertex = m_vi_Edges[j];
-
-				i_ColorID = m_vi_RightVertexColors[i_NeighboringVertex];
-
-				if(i_ColorID == _UNKNOWN)
-				{
-					continue;
-				}
-
-				if(i_ColorID == _FALSE)
-				{
-					for(k=m_vi_RightVertices[i_NeighboringVertex]; k<m_vi_RightVertices[STEP_UP(i_NeighboringVertex)]; k++)
-					{
-						i_SecondNeighboringVertex = m_vi_Edges[k];
-
-						if(m_vi_LeftVertexColors[i_SecondNeighboringVertex] == _UNKNOWN)
-						{
-							continue;
-						}
-
-						if(m_vi_LeftVertexColors[i_SecondNeighboringVertex] != _FALSE)
-						{
-							vi_CandidateColors[m_vi_LeftVertexColors[i_SecondNeighboringVertex]] = i_PresentVertex;
-						}
-					}
-				}
-				else
-				{
-					i_FirstNeighborOne = vi_FirstNeighborOne[i_ColorID];
-					i_FirstNeighborTwo = vi_FirstNeighborTwo[i_ColorID];
-
-					if(i_FirstNeighborOne == i_PresentVertex)
-					{
-						if(vi_FirstTreated[i_FirstNeighborTwo] != i_PresentVertex)
-						{
-							for(k=m_vi_RightVertices[i_FirstNeighborTwo]; k<m_vi_RightVertices[STEP_UP(i_FirstNeighborTwo)]; k++)
-							{
-								if(m_vi_Edges[k] == i_PresentVertex)
-								{
-									continue;
-								}
-
-								if(m_vi_LeftVertexColors[m_vi_Edges[k]] == _UNKNOWN)
-								{
-									continue;
-								}
-
-								vi_CandidateColors[m_vi_LeftVertexColors[m_vi_Edges[k]]] = i_PresentVertex;
-
-							}
-
-							vi_FirstTreated[i_FirstNeighborTwo] = i_PresentVertex;
-
-						}
-
-						for(k=m_vi_RightVertices[m_vi_Edges[j]]; k<m_vi_RightVertices[STEP_UP(m_vi_Edges[j])]; k++)
-						{
-							if(m_vi_Edges[k] == i_PresentVertex)
-							{
-								continue;
-							}
-
-							if(m_vi_LeftVertexColors[m_vi_Edges[k]] == _UNKNOWN)
-							{
-								continue;
-							}
-
-							vi_CandidateColors[m_vi_LeftVertexColors[m_vi_Edges[k]]] = i_PresentVertex;
-
-						}
-
-						vi_FirstTreated[i_NeighboringVertex] = i_PresentVertex;
-					}
-					else
-					{
-						vi_FirstNeighborOne[i_ColorID] = i_PresentVertex;
-						vi_FirstNeighborTwo[i_ColorID] = i_NeighboringVertex;
-
-						for(k=m_vi_RightVertices[i_NeighboringVertex]; k<m_vi_RightVertices[STEP_UP(i_NeighboringVertex)]; k++)
-						{
-							i_SecondNeighboringVertex = m_vi_Edges[k];
-
-							if(i_SecondNeighboringVertex == i_PresentVertex)
-							{
-								continue;
-							}
-
-							if(m_vi_LeftVertexColors[i_SecondNeighboringVertex] == _UNKNOWN)
-							{
-								continue;
-							}
-
-							if(vi_LeftStarHubMap[vi_EdgeStarMap[m_mimi2_VertexEdgeMap[i_SecondNeighboringVertex][i_NeighboringVertex]]] == i_SecondNeighboringVertex)
-							{
-								vi_CandidateColors[m_vi_LeftVertexColors[i_SecondNeighboringVertex]] = i_PresentVertex;
-							}
-						}
-					}
-				}
-			}
-
-			for(j=STEP_UP(i_RightVertexCoverSize); j<m_i_VertexColorCount; j++)
-			{
-				if(vi_CandidateColors[j] != i_PresentVertex)
-				{
-					m_vi_LeftVertexColors[i_PresentVertex] = j;
-
-					if(m_i_LeftVertexColorCount < j)
-					{
-						m_i_LeftVertexColorCount = j;
-					}
-
-					break;
-				}
-			}
-
-			for(j=m_vi_LeftVertices[i_PresentVertex]; j<m_vi_LeftVertices[STEP_UP(i_PresentVertex)]; j++)
-			{
-				_FOUND = _FALSE;
-
-				i_NeighboringVertex = m_vi_Edges[j];
-
-				if(m_vi_RightVertexColors[i_NeighboringVertex] == _UNKNOWN)
-				{
-					continue;
-				}
-
-				for(k=m_vi_RightVertices[i_NeighboringVertex]; k<m_vi_RightVertices[STEP_UP(i_NeighboringVertex)]; k++)
-				{
-					i_SecondNeighboringVertex = m_vi_Edges[k];
-
-					if(i_SecondNeighboringVertex == i_PresentVertex)
-					{
-						continue;
-					}
-
-					if(m_vi_LeftVertexColors[i_SecondNeighboringVertex] == _UNKNOWN)
-					{
-						continue;
-					}
-
-					if(m_vi_LeftVertexColors[i_SecondNeighboringVertex] == m_vi_LeftVertexColors[i_PresentVertex])
-					{
-						_FOUND = _TRUE;
-
-						i_StarID = vi_EdgeStarMap[m_mimi2_VertexEdgeMap[i_SecondNeighboringVertex][i_NeighboringVertex]];
-
-						vi_RightStarHubMap[i_StarID] = i_NeighboringVertex;
-
-						vi_EdgeStarMap[m_mimi2_VertexEdgeMap[i_PresentVertex][i_NeighboringVertex]] = i_StarID;
-
-    					break;
-					}
-				}
-
-				if (!_FOUND)
-				{
-					i_FirstNeighborOne = vi_FirstNeighborOne[m_vi_RightVertexColors[i_NeighboringVertex]];
-					i_FirstNeighborTwo = vi_FirstNeighborTwo[m_vi_RightVertexColors[i_NeighboringVertex]];
-
-					if((i_FirstNeighborOne == i_PresentVertex) && (i_FirstNeighborTwo != i_NeighboringVertex))
-					{
-						i_StarID = vi_EdgeStarMap[m_mimi2_VertexEdgeMap[i_PresentVertex][i_FirstNeighborTwo]];
-
-						vi_LeftStarHubMap[i_StarID] = i_PresentVertex;
-
-						vi_EdgeStarMap[m_mimi2_VertexEdgeMap[i_PresentVertex][i_NeighboringVertex]] = i_StarID;
-					}
-				}
-			}
-		}
-
-		m_i_VertexColorCount = m_i_RightVertexColorCount + m_i_LeftVertexColorCount - i_RightVertexCoverSize;
-
-#if DEBUG == 3557
-
-		cout<<endl;
-		cout<<"DEBUG 3557 | Right Star Bicoloring | Vertex Colors | Left Vertices"<<endl;
-		cout<<endl;
-
-		for(i=0; i<i_LeftVertexCount; i++)
-		{
-			cout<<STEP_UP(i)<<"\t"<<" : "<<m_vi_LeftVertexColors[i]<<endl;
-		}
-
-		cout<<endl;
-		cout<<"DEBUG 3557 | Right Star Bicoloring | Vertex Colors | Right Vertices"<<endl;
-		cout<<endl;
-
-		for(i=0; i<i_RightVertexCount; i++)
-		{
-			cout<<STEP_UP(i)<<"\t"<<" : "<<m_vi_RightVertexColors[i]<<endl;
-		}
-
-#endif
-
-		return(_TRUE);
-	}
-
-
-	//Public Function 3558
-	int BipartiteGraphBicoloring::ExplicitCoveringModifiedStarBicoloring()
-	{
-		if(CheckVertexColoring("EXPLICIT_COVER_MODIFIED_STAR"))
-		{
-			return(_TRUE);
-		}
-
-		int i, j, k, l;
-
-		int i_EdgeID, i_NeighboringEdgeID;
-
-		//int i_EdgeCount; //unused variable
-
-		int i_LeftVertexCount, i_RightVertexCount;
-
-		int i_LeftVertexCoverSize, i_RightVertexCoverSize;
-
-		int i_OrderedVertexCount;
-
-		int i_PresentVertex, i_NeighboringVertex, i_SecondNeighboringVertex, i_ThirdNeighboringVertex;
-
-		vector<int> vi_CandidateColors;
-
-		vector<int> vi_EdgeCodes;
-
-		i_LeftVertexCount  = STEP_DOWN((signed) m_vi_LeftVertices.size());
-		i_RightVertexCount = STEP_DOWN((signed) m_vi_RightVertices.size());
-
-		//i_EdgeCount = (signed) m_vi_Edges.size()/2; //unused variable
-
-		m_mimi2_VertexEdgeMap.clear();
-
-		k=_FALSE;
-
-		for(i=0; i<i_LeftVertexCount; i++)
-		{
-			for(j=m_vi_LeftVertices[i]; j<m_vi_LeftVertices[STEP_UP(i)]; j++)
-			{
-				m_mimi2_VertexEdgeMap[i][m_vi_Edges[j]] = k;
-
-				k++;
-			}
-		}
-
-
-		Timer m_T_Timer;
-
-		m_T_Timer.Start();
-
-		CoverVertex(vi_EdgeCodes);
-
-		m_T_Timer.Stop();
-
-		m_d_CoveringTime = m_T_Timer.GetWallTime();
-
-		PresetCoveredVertexColors();
-
-		i_LeftVertexCoverSize = (signed) m_vi_CoveredLeftVertices.size();
-		i_RightVertexCoverSize = (signed) m_vi_CoveredRightVertices.size();
-
-		m_i_VertexColorCount = STEP_UP(i_LeftVertexCoverSize +  i_RightVertexCoverSize);
-
-		vi_CandidateColors.clear();
-		vi_CandidateColors.resize((unsigned) m_i_VertexColorCount, _UNKNOWN);
-
-#if DEBUG == 3558
-
-		int i_EdgeCodeZero, i_EdgeCodeOne, i_EdgeCodeTwo, i_EdgeCodeThree;
-
-		i_EdgeCodeZero = i_EdgeCodeOne = i_EdgeCodeTwo = i_EdgeCodeThree = _FALSE;
-
-		cout<<endl;
-		cout<<"DEBUG 3558 | Bipartite Graph Bicoloring | Edge Codes"<<endl;
-		cout<<endl;
-
-		for(i=0; i<i_LeftVertexCount; i++)
-		{
-			for(j=m_vi_LeftVertices[i]; j<m_vi_LeftVertices[STEP_UP(i)]; j++)
-			{
-				i_EdgeID = m_mimi2_VertexEdgeMap[i][m_vi_Edges[j]];
-
-				cout<<"Edge "<<STEP_UP(i_EdgeID)<<"\t"<<" : "<<vi_EdgeCodes[i_EdgeID]<<endl;
-
-				if(vi_EdgeCodes[i_EdgeID] == 0)
-				{
-					i_EdgeCodeZero++;
-				}
-				else
-				if(vi_EdgeCodes[i_EdgeID] == 1)
-				{
-					i_EdgeCodeOne++;
-				}
-				else
-				if(vi_EdgeCodes[i_EdgeID] == 2)
-				{
-					i_EdgeCodeTwo++;
-				}
-				else
-				if(vi_EdgeCodes[i_EdgeID] == 3)
-				{
-					i_EdgeCodeThree++;
-				}
-			}
-		}
-
-		cout<<endl;
-		cout<<"Code Zero Edges = "<<i_EdgeCodeZero<<"; Code One Edges = "<<i_EdgeCodeOne<<"; Code Two Edges = "<<i_EdgeCodeTwo<<"; Code Three Edges = "<<i_EdgeCodeThree<<endl;
-		cout<<endl;
-
-#endif
-
-#if DEBUG == 3558
-
-		cout<<"DEBUG 3558 | Star Bicoloring | Left Vertex Cover Size = "<<m_vi_CoveredLeftVertices.size()<<"; Right Vertex Cover Size = "<<m_vi_CoveredRightVertices.size()<<endl;
-
-#endif
-
-		i_OrderedVertexCount = (signed) m_vi_OrderedVertices.size();
-
-		m_i_LeftVertexColorCount = m_i_RightVertexColorCount = _UNKNOWN;
-
-		for(i=0; i<i_OrderedVertexCount; i++)
-		{
-
-#if DEBUG == 3558
-
-			cout<<"DEBUG 3558 | Star Bicoloring | Present Vertex | "<<STEP_UP(m_vi_OrderedVertices[i])<<endl;
-
-#endif
-
-			if(m_vi_OrderedVertices[i] < i_LeftVertexCount)
-			{
-				if(m_vi_IncludedLeftVertices[m_vi_OrderedVertices[i]] == _FALSE)
-				{
-					continue;
-				}
-
-				i_PresentVertex = m_vi_OrderedVertices[i];
-
-#if DEBUG == 3558
-
-				cout<<"DEBUG 3558 | Star Bicoloring | Present Left Vertex | "<<STEP_UP(i_PresentVertex)<<endl;
-#endif
-
-				for(j=m_vi_LeftVertices[i_PresentVertex]; j<m_vi_LeftVertices[STEP_UP(i_PresentVertex)]; j++)
-				{
-					i_NeighboringVertex = m_vi_Edges[j];
-
-					i_EdgeID = m_mimi2_VertexEdgeMap[i_PresentVertex][i_NeighboringVertex];
-
-					if (vi_EdgeCodes[i_EdgeID] == 2)
-					{
-						continue;
-					}
-
-					for(k=m_vi_RightVertices[i_NeighboringVertex]; k<m_vi_RightVertices[STEP_UP(i_NeighboringVertex)]; k++)
-					{
-						i_SecondNeighboringVertex = m_vi_Edges[k];
-
-						if(m_vi_LeftVertexColors[i_SecondNeighboringVertex] == _UNKNOWN)
-						{
-							continue;
-						}
-
-						i_NeighboringEdgeID = m_mimi2_VertexEdgeMap[i_SecondNeighboringVertex][i_NeighboringVertex];
-
-						if(vi_EdgeCodes[i_NeighboringEdgeID] != 2)
-						{
-							if(m_vi_RightVertexColors[i_NeighboringVertex] <= _FALSE)
-							{
-								vi_CandidateColors[m_vi_LeftVertexColors[i_SecondNeighboringVertex]] = i_PresentVertex;
-							}
-							else
-							{
-								for(l=m_vi_LeftVertices[i_SecondNeighboringVertex]; l<m_vi_LeftVertices[STEP_UP(i_SecondNeighboringVertex)]; l++)
-								{
-									i_ThirdNeighboringVertex = m_vi_Edges[l];
-
-									if(m_vi_RightVertexColors[i_ThirdNeighboringVertex] == _UNKNOWN)
-									{
-										continue;
-									}
-
-									if(m_vi_RightVertexColors[i_ThirdNeighboringVertex] == m_vi_RightVertexColors[i_NeighboringVertex])
-									{
-										vi_CandidateColors[m_vi_LeftVertexColors[i_SecondNeighboringVertex]] = i_PresentVertex;
-									}
-								}
-							}
-						}
-					}
-				}
-
-				for(j=_TRUE; j<STEP_UP(i_LeftVertexCoverSize); j++)
-				{
-					if(vi_CandidateColors[j] != i_PresentVertex)
-					{
-						m_vi_LeftVertexColors[i_PresentVertex] = j;
-
-						if(m_i_LeftVertexColorCount < j)
-						{
-							m_i_LeftVertexColorCount = j;
-						}
-
-						break;
-					}
-				}
-			}
-			else
-			{
-				if(m_vi_IncludedRightVertices[m_vi_OrderedVertices[i] - i_LeftVertexCount] == _FALSE)
-				{
-					continue;
-				}
-
-				i_PresentVertex = m_vi_OrderedVertices[i] - i_LeftVertexCount;
-
-#if DEBUG == 3558
-
-				cout<<"DEBUG 3558 | Star Bicoloring | Present Right Vertex | "<<STEP_UP(i_PresentVertex)<<endl;
-#endif
-
-				for(j=m_vi_RightVertices[i_PresentVertex]; j<m_vi_RightVertices[STEP_UP(i_PresentVertex)]; j++)
-				{
-					i_NeighboringVertex = m_vi_Edges[j];
-
-					i_EdgeID = m_mimi2_VertexEdgeMap[i_NeighboringVertex][i_PresentVertex];
-
-					if(vi_EdgeCodes[i_EdgeID] == 3)
-					{
-						continue;
-					}
-
-					for(k=m_vi_LeftVertices[i_NeighboringVertex]; k<m_vi_LeftVertices[STEP_UP(i_NeighboringVertex)]; k++)
-					{
-						i_SecondNeighboringVertex = m_vi_Edges[k];
-
-						if(m_vi_RightVertexColors[i_SecondNeighboringVertex] == _UNKNOWN)
-						{
-							continue;
-						}
-
-						i_NeighboringEdgeID = m_mimi2_VertexEdgeMap[i_NeighboringVertex][i_SecondNeighboringVertex];
-
-						if(vi_EdgeCodes[i_NeighboringEdgeID] != 3)
-						{
-							if(m_vi_LeftVertexColors[i_NeighboringVertex] <= _FALSE)
-							{
-								vi_CandidateColors[m_vi_RightVertexColors[i_SecondNeighboringVertex]] = i_PresentVertex;
-							}
-							else
-							{
-								for(l=m_vi_RightVertices[i_SecondNeighboringVertex]; l<m_vi_RightVertices[STEP_UP(i_SecondNeighboringVertex)]; l++)
-								{
-									i_ThirdNeighboringVertex = m_vi_Edges[l];
-
-									if(m_vi_LeftVertexColors[i_ThirdNeighboringVertex] == _UNKNOWN)
-									{
-										continue;
-									}
-
-									if(m_vi_LeftVertexColors[i_ThirdNeighboringVertex] == m_vi_LeftVertexColors[i_NeighboringVertex])
-									{
-										vi_CandidateColors[m_vi_RightVertexColors[i_SecondNeighboringVertex]] = i_PresentVertex;
-									}
-								}
-							}
-						}
-					}
-				}
-
-				for(j=STEP_UP(i_LeftVertexCoverSize); j<m_i_VertexColorCount; j++)
-				{
-					if(vi_CandidateColors[j] != i_PresentVertex)
-					{
-						m_vi_RightVertexColors[i_PresentVertex] = j;
-
-						if(m_i_RightVertexColorCount < j)
-						{
-							m_i_RightVertexColorCount = j;
-						}
-
-						break;
-					}
-				}
-			}
-		}
-
-		i_LeftVertexDefaultColor = _FALSE;
-		i_RightVertexDefaultColor = _FALSE;
-
-		for(i=0; i<i_LeftVertexCount; i++)
-		{
-			if(m_vi_LeftVertexColors[i] == _FALSE)
-			{
-				i_LeftVertexDefaultColor = _TRUE;
-			}
-		}
-
-		for(i=0; i<i_RightVertexCount; i++)
-		{
-			if(m_vi_RightVertexColors[i] == FALSE)
-			{
-				m_vi_RightVertexColors[i] = m_i_VertexColorCount;
-
-				i_RightVertexDefaultColor = _TRUE;
-			}
-		}
-
-		if(m_i_LeftVertexColorCount == _UNKNOWN)
-		{
-			m_i_LeftVertexColorCount = _TRUE;
-		}
-		else
-		{
-			m_i_LeftVertexColorCount = m_i_LeftVertexColorCount + i_LeftVertexDefaultColor;
-		}
-
-		if(m_i_RightVertexColorCount == _UNKNOWN)
-		{
-			m_i_RightVertexColorCount = _TRUE;
-		}
-		else
-		{
-			m_i_RightVertexColorCount = m_i_RightVertexColorCount + i_RightVertexDefaultColor - i_LeftVertexCoverSize;
-		}
-
-		m_i_VertexColorCount = m_i_LeftVertexColorCount + m_i_RightVertexColorCount;
-
-#if DEBUG == 3558
-
-		cout<<endl;
-		cout<<"DEBUG 3558 | Modified Star Bicoloring | Left Vertex Colors"<<endl;
-		cout<<endl;
-
-		for(i=0; i<i_LeftVertexCount; i++)
-		{
-			cout<<STEP_UP(i)<<"\t"<<" : "<<m_vi_LeftVertexColors[i]<<endl;
-		}
-
-		cout<<endl;
-		cout<<"DEBUG 3558 | Modified Star Bicoloring | Right Vertex Colors"<<endl;
-		cout<<endl;
-
-		for(i=0; i<i_RightVertexCount; i++)
-		{
-			cout<<STEP_UP(i)<<"\t"<<" : "<<m_vi_RightVertexColors[i]<<endl;
-		}
-
-		cout<<endl;
-		cout<<"[Total Vertex Colors = "<<m_i_VertexColorCount<<"]"<<endl;
-		cout<<endl;
-
-#endif
-
-		return(_TRUE);
-	}
-
-
-
-	//Public Function 3559
-	int BipartiteGraphBicoloring::ExplicitCoveringStarBicoloring()
-	{
-		if(CheckVertexColoring("EXPLICIT_COVER_STAR"))
-		{
-			return(_TRUE);
-		}
-
-		int i, j, k;
-
-		int _FOUND;
-
-		int i_ColorID, i_StarID;
-
-		int i_EdgeCount;
-
-		int i_OrderedVertexCount;
-
-		int i_FirstNeighborOne, i_FirstNeighborTwo;
-
-		int i_LeftVertexCount, i_RightVertexCount;
-
-		int i_LeftVertexCoverSize, i_RightVertexCoverSize;
-
-		int i_PresentVertex, i_NeighboringVertex, i_SecondNeighboringVertex;
-
-		vector<int> vi_CandidateColors;
-
-		vector<int> vi_EdgeStarMap, vi_LeftStarHubMap, vi_RightStarHubMap;
-
-		vector<int> vi_LeftTreated, vi_RightTreated;
-
-		vector<int> vi_FirstNeighborOne, vi_FirstNeighborTwo;
-
-		i_LeftVertexCount  = STEP_DOWN((signed) m_vi_LeftVertices.size());
-		i_RightVertexCount = STEP_DOWN((signed) m_vi_RightVertices.size());
-
-		i_EdgeCount = (signed) m_vi_Edges.size()/2;
-
-		vi_EdgeStarMap.clear();
-		vi_EdgeStarMap.resize((unsigned) i_EdgeCount, _UNKNOWN);
-
-		m_mimi2_VertexEdgeMap.clear();
-
-		k=_FALSE;
-
-		for(i=0; i<i_LeftVertexCount; i++)
-		{
-			for(j=m_vi_LeftVertices[i]; j<m_vi_LeftVertices[STEP_UP(i)]; j++)
-			{
-				m_mimi2_VertexEdgeMap[i][m_vi_Edges[j]] = k;
-
-				vi_EdgeStarMap[k] = k;
-
-				k++;
-			}
-		}
-
-		Timer m_T_Timer;
-
-		m_T_Timer.Start();
-
-		CoverVertex();
-
-		m_T_Timer.Stop();
-
-		m_d_CoveringTime = m_T_Timer.GetWallTime();
-
-		PresetCoveredVertexColors();
-
-#if DEBUG == 3559
-
-		cout<<"DEBUG 3559 | Combined Star Bicoloring | Left Vertex Cover Size = "<<m_vi_CoveredLeftVertices.size()<<"; Right Vertex Cover Size = "<<m_vi_CoveredRightVertices.size()<<endl;
-
-#endif
-
-		i_LeftVertexCoverSize = (signed) m_vi_CoveredLeftVertices.size();
-		i_RightVertexCoverSize = (signed) m_vi_CoveredRightVertices.size();
-
-		m_i_VertexColorCount = STEP_UP(i_LeftVertexCoverSize +  i_RightVertexCoverSize);
-
-		vi_CandidateColors.clear();
-		vi_CandidateColors.resize((unsigned) m_i_VertexColorCount, _UNKNOWN);
-
-		vi_LeftStarHubMap.clear();
-		vi_LeftStarHubMap.resize((unsigned) i_EdgeCount, _UNKNOWN);
-
-		vi_RightStarHubMap.clear();
-		vi_RightStarHubMap.resize((unsigned) i_EdgeCount, _UNKNOWN);
-
-		vi_FirstNeighborOne.clear();
-		vi_FirstNeighborOne.resize((unsigned) m_i_VertexColorCount, _UNKNOWN);
-
-		vi_FirstNeighborTwo.clear();
-		vi_FirstNeighborTwo.resize((unsigned) m_i_VertexColorCount, _UNKNOWN);
-
-		vi_LeftTreated.clear();
-		vi_LeftTreated.resize((unsigned) i_RightVertexCount, _UNKNOWN);
-
-		vi_RightTreated.clear();
-		vi_RightTreated.resize((unsigned) i_LeftVertexCount, _UNKNOWN);
-
-#if DEBUG == 3559
-
-		cout<<endl;
-		cout<<"DEBUG 3559 | Star Bicoloring | Initial Vertex Colors | Left Vertices"<<endl;
-		cout<<endl;
-
-		for(i=0; i<i_LeftVertexCount; i++)
-		{
-			cout<<STEP_UP(i)<<"\t"<<" : "<<m_vi_LeftVertexColors[i]<<" ["<<m_vi_IncludedLeftVertices[i]<<"]"<<endl;
-		}
-
-		cout<<endl;
-		cout<<"DEBUG 3559 | Star Bicoloring | Initial Vertex Colors | Right Vertices"<<endl;
-		cout<<endl;
-
-		for(i=0; i<i_RightVertexCount; i++)
-		{
-			cout<<STEP_UP(i)<<"\t"<<" : "<<m_vi_RightVertexColors[i]<<" ["<<m_vi_IncludedRightVertices[i]<<"]"<<endl;
-		}
-
-		cout<<endl;
-
-#endif
-
-		i_OrderedVertexCount = (signed) m_vi_OrderedVertices.size();
-
-		for(i=0; i<i_OrderedVertexCount; i++)
-		{
-
-#if DEBUG == 3559
-
-			cout<<"DEBUG 3559 | Star Bicoloring | Present Vertex | "<<STEP_UP(m_vi_OrderedVertices[i])<<endl;
-
-#endif
-
-			if(m_vi_OrderedVertices[i] < i_LeftVertexCount)
-			{
-				if(m_vi_IncludedLeftVertices[m_vi_OrderedVertices[i]] == _FALSE)
-				{
-					continue;
-				}
-
-				i_PresentVertex = m_vi_OrderedVertices[i];
-
-#if DEBUG == 3559
-
-				cout<<"DEBUG 3559 | Star Bicoloring | Present Left Vertex | "<<STEP_UP(i_PresentVertex)<<endl;
-#endif
-
-				for(j=m_vi_LeftVertices[i_PresentVertex]; j<m_vi_LeftVertices[STEP_UP(i_PresentVertex)]; j++)
-				{
-					i_NeighboringVertex = m_vi_Edges[j];
-
-					i_ColorID = m_vi_RightVertexColors[i_NeighboringVertex];
-
-					if(i_ColorID == _UNKNOWN)
-					{
-						continue;
-					}
-
-					if(i_ColorID == _FALSE)
-					{
-						for(k=m_vi_RightVertices[i_NeighboringVertex]; k<m_vi_RightVertices[STEP_UP(i_NeighboringVertex)]; k++)
-						{
-							i_SecondNeighboringVertex = m_vi_Edges[k];
-
-							if(m_vi_LeftVertexColors[i_SecondNeighboringVertex] == _UNKNOWN)
-							{
-								continue;
-							}
-
-							if(m_vi_LeftVertexColors[i_SecondNeighboringVertex] != _FALSE)
-							{
-								vi_CandidateColors[m_vi_LeftVertexColors[i_SecondNeighboringVertex]] = i_PresentVertex;
-							}
-						}
-					}
-					else
-					{
-						i_FirstNeighborOne = vi_FirstNeighborOne[i_ColorID];
-						i_FirstNeighborTwo = vi_FirstNeighborTwo[i_ColorID];
-
-						if(i_FirstNeighborOne == i_PresentVertex)
-						{
-							if(vi_LeftTreated[i_FirstNeighborTwo] != i_PresentVertex)
-							{
-								for(k=m_vi_RightVertices[i_FirstNeighborTwo]; k<m_vi_RightVertices[STEP_UP(i_FirstNeighborTwo)]; k++)
-								{
-									if(m_vi_Edges[k] == i_PresentVertex)
-									{
-										continue;
-									}
-
-									if(m_vi_LeftVertexColors[m_vi_Edges[k]] == _UNKNOWN)
-									{
-										continue;
-									}
-
-									vi_CandidateColors[m_vi_LeftVertexColors[m_vi_Edges[k]]] = i_PresentVertex;
-
-								}
-
-								vi_LeftTreated[i_FirstNeighborTwo] = i_PresentVertex;
-							}
-
-							for(k=m_vi_RightVertices[m_vi_Edges[j]]; k<m_vi_RightVertices[STEP_UP(m_vi_Edges[j])]; k++)
-							{
-								if(m_vi_Edges[k] == i_PresentVertex)
-								{
-									continue;
-								}
-
-								if(m_vi_LeftVertexColors[m_vi_Edges[k]] == _UNKNOWN)
-								{
-									continue;
-								}
-
-								vi_CandidateColors[m_vi_LeftVertexColors[m_vi_Edges[k]]] = i_PresentVertex;
-							}
-
-							vi_LeftTreated[i_NeighboringVertex] = i_PresentVertex;
-						}
-						else
-						{
-							vi_FirstNeighborOne[i_ColorID] = i_PresentVertex;
-							vi_FirstNeighborTwo[i_ColorID] = i_NeighboringVertex;
-
-							for(k=m_vi_RightVertices[i_NeighboringVertex]; k<m_vi_RightVertices[STEP_UP(i_NeighboringVertex)]; k++)
-							{
-								i_SecondNeighboringVertex = m_vi_Edges[k];
-
-								if(i_SecondNeighboringVertex == i_PresentVertex)
-								{
-									continue;
-								}
-
-								if(m_vi_LeftVertexColors[i_SecondNeighboringVertex] == _UNKNOWN)
-								{
-									continue;
-								}
-
-								if(vi_LeftStarHubMap[vi_EdgeStarMap[m_mimi2_VertexEdgeMap[i_SecondNeighboringVertex][i_NeighboringVertex]]] == i_SecondNeighboringVertex)
-								{
-									vi_CandidateColors[m_vi_LeftVertexColors[i_SecondNeighboringVertex]] = i_PresentVertex;
-								}
-							}
-						}
-					}
-				}
-
-				for(j=_TRUE; j<STEP_UP(i_LeftVertexCoverSize); j++)
-				{
-					if(vi_CandidateColors[j] != i_PresentVertex)
-					{
-						m_vi_LeftVertexColors[i_PresentVertex] = j;
-
-						if(m_i_LeftVertexColorCount < j)
-						{
-							m_i_LeftVertexColorCount = j;
-						}
-
-						break;
-					}
-				 }
-
-				for(j=m_vi_LeftVertices[i_PresentVertex]; j<m_vi_LeftVertices[STEP_UP(i_PresentVertex)]; j++)
-				{
-					_FOUND = _FALSE;
-
-					i_NeighboringVertex = m_vi_Edges[j];
-
-					if(m_vi_RightVertexColors[i_NeighboringVertex] == _UNKNOWN)
-					{
-						continue;
-					}
-
-					for(k=m_vi_RightVertices[i_NeighboringVertex]; k<m_vi_RightVertices[STEP_UP(i_NeighboringVertex)]; k++)
-					{
-						i_SecondNeighboringVertex = m_vi_Edges[k];
-
-						if(i_SecondNeighboringVertex == i_PresentVertex)
-						{
-							continue;
-						}
-
-						if(m_vi_LeftVertexColors[i_SecondNeighboringVertex] == _UNKNOWN)
-						{
-							continue;
-						}
-
-						if(m_vi_LeftVertexColors[i_SecondNeighboringVertex] == m_vi_LeftVertexColors[i_PresentVertex])
-						{
-							_FOUND = _TRUE;
-
-							i_StarID = vi_EdgeStarMap[m_mimi2_VertexEdgeMap[i_SecondNeighboringVertex][i_NeighboringVertex]];
-
-							vi_RightStarHubMap[i_StarID] = i_NeighboringVertex;
-
-							vi_EdgeStarMap[m_mimi2_VertexEdgeMap[i_PresentVertex][i_NeighboringVertex]] = i_StarID;
-
-							break;
-						}
-					}
-
-					if (!_FOUND)
-					{
-						i_FirstNeighborOne = vi_FirstNeighborOne[m_vi_RightVertexColors[i_NeighboringVertex]];
-						i_FirstNeighborTwo = vi_FirstNeighborTwo[m_vi_RightVertexColors[i_NeighboringVertex]];
-
-						if((i_FirstNeighborOne == i_PresentVertex) && (i_FirstNeighborTwo != i_NeighboringVertex))
-						{
-							i_StarID = vi_EdgeStarMap[m_mimi2_VertexEdgeMap[i_PresentVertex][i_FirstNeighborTwo]];
-
-							vi_LeftStarHubMap[i_StarID] = i_PresentVertex;
-
-							vi_EdgeStarMap[m_mimi2_VertexEdgeMap[i_PresentVertex][i_NeighboringVertex]] = i_StarID;
-						}
-					}
-				}
-			}
-			else
-			{
-				if(m_vi_IncludedRightVertices[m_vi_OrderedVertices[i] - i_LeftVertexCount] == _FALSE)
-				{
-					continue;
-				}
-
-				i_PresentVertex = m_vi_OrderedVertices[i] - i_LeftVertexCount;
-
-#if DEBUG == 3559
-
-				cout<<"DEBUG 3559 | Star Bicoloring | Present Right Vertex | "<<STEP_UP(i_PresentVertex)<<endl;
-#endif
-
-				for(j=m_vi_RightVertices[i_PresentVertex]; j<m_vi_RightVertices[STEP_UP(i_PresentVertex)]; j++)
-				{
-					i_NeighboringVertex = m_vi_Edges[j];
-
-					i_ColorID = m_vi_LeftVertexColors[i_NeighboringVertex];
-
-					if(i_ColorID == _UNKNOWN)
-					{
-						continue;
-					}
-
-					if(i_ColorID == _FALSE)
-					{
-						for(k=m_vi_LeftVertices[i_NeighboringVertex]; k<m_vi_LeftVertices[STEP_UP(i_NeighboringVertex)]; k++)
-						{
-							i_SecondNeighboringVertex = m_vi_Edges[k];
-
-							if(m_vi_RightVertexColors[i_SecondNeighboringVertex] == _UNKNOWN)
-							{
-								continue;
-							}
-
-							if(m_vi_RightVertexColors[i_SecondNeighboringVertex] != _FALSE)
-							{
-								vi_CandidateColors[m_vi_RightVertexColors[i_SecondNeighboringVertex]] = i_PresentVertex;
-							}
-						}
-					}
-					else
-					{
-						i_FirstNeighborOne = vi_FirstNeighborOne[i_ColorID];
-						i_FirstNeighborTwo = vi_FirstNeighborTwo[i_ColorID];
-
-						if(i_FirstNeighborOne == i_PresentVertex)
-						{
-							if(vi_RightTreated[i_FirstNeighborTwo] != i_PresentVertex)
-							{
-								for(k=m_vi_LeftVertices[i_FirstNeighborTwo]; k<m_vi_LeftVertices[STEP_UP(i_FirstNeighborTwo)]; k++)
-								{
-									if(m_vi_Edges[k] == i_PresentVertex)
-									{
-										continue;
-									}
-
-									if(m_vi_RightVertexColors[m_vi_Edges[k]] == _UNKNOWN)
-									{
-										continue;
-									}
-
-									vi_CandidateColors[m_vi_RightVertexColors[m_vi_Edges[k]]] = i_PresentVertex;
-
-								}
-
-								vi_RightTreated[i_FirstNeighborTwo] = i_PresentVertex;
-							}
-
-							for(k=m_vi_LeftVertices[m_vi_Edges[j]]; k<m_vi_LeftVertices[STEP_UP(m_vi_Edges[j])]; k++)
-							{
-								if(m_vi_Edges[k] == i_PresentVertex)
-								{
-									continue;
-								}
-
-								if(m_vi_RightVertexColors[m_vi_Edges[k]] == _UNKNOWN)
-								{
-									continue;
-								}
-
-								vi_CandidateColors[m_vi_RightVertexColors[m_vi_Edges[k]]] = i_PresentVertex;
-
-							}
-
-							vi_RightTreated[i_NeighboringVertex] = i_PresentVertex;
-						}
-						else
-						{
-							vi_FirstNeighborOne[i_ColorID] = i_PresentVertex;
-							vi_FirstNeighborTwo[i_ColorID] = i_NeighboringVertex;
-
-							for(k=m_vi_LeftVertices[i_NeighboringVertex]; k<m_vi_LeftVertices[STEP_UP(i_NeighboringVertex)]; k++)
-							{
-								i_SecondNeighboringVertex = m_vi_Edges[k];
-
-								if(i_SecondNeighboringVertex == i_PresentVertex)
-								{
-									continue;
-								}
-
-								if(m_vi_RightVertexColors[i_SecondNeighboringVertex] == _UNKNOWN)
-								{
-									continue;
-								}
-
-								if(vi_RightStarHubMap[vi_EdgeStarMap[m_mimi2_VertexEdgeMap[i_NeighboringVertex][i_SecondNeighboringVertex]]] == i_SecondNeighboringVertex)
-								{
-									vi_CandidateColors[m_vi_RightVertexColors[i_SecondNeighboringVertex]] = i_PresentVertex;
-
-								}
-							}
-						}
-					}
-				}
-
-				for(j=STEP_UP(i_LeftVertexCoverSize); j<m_i_VertexColorCount; j++)
-				{
-					if(vi_CandidateColors[j] != i_PresentVertex)
-					{
-						m_vi_RightVertexColors[i_PresentVertex] = j;
-
-						if(m_i_RightVertexColorCount < j)
-						{
-							m_i_RightVertexColorCount = j;
-						}
-
-						break;
-					}
-				}
-
-				for(j=m_vi_RightVertices[i_PresentVertex]; j<m_vi_RightVertices[STEP_UP(i_PresentVertex)]; j++)
-				{
-					_FOUND = _FALSE;
-
-					i_NeighboringVertex = m_vi_Edges[j];
-
-					if(m_vi_LeftVertexColors[i_NeighboringVertex] == _UNKNOWN)
-					{
-						continue;
-					}
-
-					for(k=m_vi_LeftVertices[i_NeighboringVertex]; k<m_vi_LeftVertices[STEP_UP(i_NeighboringVertex)]; k++)
-					{
-						i_SecondNeighboringVertex = m_vi_Edges[k];
-
-						if(i_SecondNeighboringVertex == i_PresentVertex)
-						{
-							continue;
-						}
-
-						if(m_vi_RightVertexColors[i_SecondNeighboringVertex] == _UNKNOWN)
-						{
-							continue;
-						}
-
-						if(m_vi_RightVertexColors[i_SecondNeighboringVertex] == m_vi_RightVertexColors[i_PresentVertex])
-						{
-							_FOUND = _TRUE;
-
-							i_StarID = vi_EdgeStarMap[m_mimi2_VertexEdgeMap[i_NeighboringVertex][i_SecondNeighboringVertex]];
+		int i_LeftVertexCount  = STEP_DOWN((signed) m_vi_LeftVertices.size());
+		int i_RightVertexCount = STEP_DOWN((signed) m_vi_RightVertices.size());
 
-							vi_LeftStarHubMap[i_StarID] = i_NeighboringVertex;
+		int i_EdgeCount = (signed) m_vi_Edges.size()/2;
 
-							vi_EdgeStarMap[m_mimi2_VertexEdgeMap[i_NeighboringVertex][i_PresentVertex]] = i_StarID;
+		vi_EdgeIDs.clear();
+		vi_EdgeIDs.resize(m_vi_Edges.size(), _UNKNOWN);
 
-							break;
-						}
-					}
+		//The rows of each column in row order with their edge IDs (a transpose), then scattered to the order of m_vi_RightVertices
+		vector<int> vi_ColumnCursor(i_RightVertexCount), vi_TransposedRows(i_EdgeCount), vi_TransposedEdgeIDs(i_EdgeCount);
 
-					if (!_FOUND)
-					{
-						i_FirstNeighborOne = vi_FirstNeighborOne[m_vi_LeftVertexColors[i_NeighboringVertex]];
-						i_FirstNeighborTwo = vi_FirstNeighborTwo[m_vi_LeftVertexColors[i_NeighboringVertex]];
+		for(int i=0; i<i_RightVertexCount; i++)
+		{
+			vi_ColumnCursor[i] = m_vi_RightVertices[i] - m_vi_RightVertices[0];
+		}
 
-						if((i_FirstNeighborOne == i_PresentVertex) && (i_FirstNeighborTwo != i_NeighboringVertex))
-						{
-							i_StarID = vi_EdgeStarMap[m_mimi2_VertexEdgeMap[i_FirstNeighborTwo][i_PresentVertex]];
+		for(int i=0; i<i_LeftVertexCount; i++)
+		{
+			for(int j=m_vi_LeftVertices[i]; j<m_vi_LeftVertices[STEP_UP(i)]; j++)
+			{
+				vi_EdgeIDs[j] = j - m_vi_LeftVertices[0];
 
-							vi_RightStarHubMap[i_StarID] = i_PresentVertex;
+				vi_TransposedRows[vi_ColumnCursor[m_vi_Edges[j]]] = i;
+				vi_TransposedEdgeIDs[vi_ColumnCursor[m_vi_Edges[j]]] = vi_EdgeIDs[j];
 
-							vi_EdgeStarMap[m_mimi2_VertexEdgeMap[i_NeighboringVertex][i_PresentVertex]] = i_StarID;
-						}
-					}
-				}
+				vi_ColumnCursor[m_vi_Edges[j]]++;
 			}
 		}
 
-		i_LeftVertexDefaultColor = _FALSE;
-		i_RightVertexDefaultColor = _FALSE;
+		vector<int> vi_RowEdgeID(i_LeftVertexCount, _UNKNOWN);
 
-		for(i=0; i<i_LeftVertexCount; i++)
+		for(int i=0; i<i_RightVertexCount; i++)
 		{
-			if(m_vi_LeftVertexColors[i] == _FALSE)
+			for(int j=m_vi_RightVertices[i]; j<m_vi_RightVertices[STEP_UP(i)]; j++)
 			{
-				i_LeftVertexDefaultColor = _TRUE;
+				vi_RowEdgeID[vi_TransposedRows[j - m_vi_RightVertices[0]]] = vi_TransposedEdgeIDs[j - m_vi_RightVertices[0]];
 			}
-		}
 
-		for(i=0; i<i_RightVertexCount; i++)
-		{
-			if(m_vi_RightVertexColors[i] == FALSE)
+			for(int j=m_vi_RightVertices[i]; j<m_vi_RightVertices[STEP_UP(i)]; j++)
 			{
-				m_vi_RightVertexColors[i] = m_i_VertexColorCount;
-
-				i_RightVertexDefaultColor = _TRUE;
+				vi_EdgeIDs[j] = vi_RowEdgeID[m_vi_Edges[j]];
 			}
 		}
 
-		if(m_i_LeftVertexColorCount == _UNKNOWN)
-		{
-			m_i_LeftVertexColorCount = _TRUE;
-		}
-		else
-		{
-			m_i_LeftVertexColorCount = m_i_LeftVertexColorCount + i_LeftVertexDefaultColor;
-		}
-
-		if(m_i_RightVertexColorCount == _UNKNOWN)
-		{
-			m_i_RightVertexColorCount = _TRUE;
-		}
-		else
-		{
-			m_i_RightVertexColorCount = m_i_RightVertexColorCount + i_RightVertexDefaultColor - i_LeftVertexCoverSize;
-		}
-
-		m_i_VertexColorCount = m_i_LeftVertexColorCount + m_i_RightVertexColorCount;
-
-#if DEBUG == 3559
-
-		cout<<endl;
-		cout<<"DEBUG 3559 | Right Star Bicoloring | Vertex Colors | Left Vertices"<<endl;
-		cout<<endl;
-
-		for(i=0; i<i_LeftVertexCount; i++)
-		{
-			cout<<STEP_UP(i)<<"\t"<<" : "<<m_vi_LeftVertexColors[i]<<endl;
-		}
-
-		cout<<endl;
-		cout<<"DEBUG 3559 | Right Star Bicoloring | Vertex Colors | Right Vertices"<<endl;
-		cout<<endl;
-
-		for(i=0; i<i_RightVertexCount; i++)
-		{
-			cout<<STEP_UP(i)<<"\t"<<" : "<<m_vi_RightVertexColors[i]<<endl;
-		}
-
-#endif
-
-		return(_TRUE);
+		return;
+	}
 
-}
 
-	//Public Function 3560
-	int BipartiteGraphBicoloring::MinimalCoveringStarBicoloring()
+	//Private Function 3510
+	int BipartiteGraphBicoloring::StarBicoloring(vector<int> & vi_CandidateVertices, bool b_SkipCoveredVertices)
 	{
-		if(CheckVertexColoring("MINIMAL_COVER_STAR"))
-		{
-			return(_TRUE);
-		}
-
 		int i, j, k;
 
 		int _FOUND;
 
 		int i_ColorID, i_StarID;
 
-		int i_EdgeCount;
-
-		int i_OrderedVertexCount;
+		int i_EdgeCount, i_IncludedEdgeCount;
 
 		int i_FirstNeighborOne, i_FirstNeighborTwo;
 
 		int i_LeftVertexCount, i_RightVertexCount;
 
-		int i_LeftVertexCoverSize, i_RightVertexCoverSize;
+		int i_CandidateVertexCount;
 
 		int i_PresentVertex, i_NeighboringVertex, i_SecondNeighboringVertex;
 
+		int i_PresentEdge;
+
+		vector<int> vi_EdgeIDs;
+
+		vector<int> vi_IncludedEdges;
+
 		vector<int> vi_CandidateColors;
 
 		vector<int> vi_EdgeStarMap, vi_LeftStarHubMap, vi_RightStarHubMap;
 
 		vector<int> vi_LeftTreated, vi_RightTreated;
 
-		vector<int> vi_FirstNeighborOne, vi_FirstNeighborTwo;
+		vector<int> vi_FirstNeighborOne, vi_FirstNeighborTwo, vi_FirstNeighborEdge;
 
 		i_LeftVertexCount  = STEP_DOWN((signed) m_vi_LeftVertices.size());
 		i_RightVertexCount = STEP_DOWN((signed) m_vi_RightVertices.size());
 
 		i_EdgeCount = (signed) m_vi_Edges.size()/2;
 
-		vi_EdgeStarMap.clear();
-		vi_EdgeStarMap.resize((unsigned) i_EdgeCount, _UNKNOWN);
-
-		m_mimi2_VertexEdgeMap.clear();
+		//vi_EdgeIDs[j] is the ID of the edge at m_vi_Edges[j], the same from both sides: its position among the edges of the rows
+		GetEdgeIDs(vi_EdgeIDs);
 
-		k=_FALSE;
+		vi_EdgeStarMap.clear();
+		vi_EdgeStarMap.resize((unsigned) i_EdgeCount);
 
-		for(i=0; i<i_LeftVertexCount; i++)
+		for(i=0; i<i_EdgeCount; i++)
 		{
-			for(j=m_vi_LeftVertices[i]; j<m_vi_LeftVertices[STEP_UP(i)]; j++)
-			{
-				m_mimi2_VertexEdgeMap[i][m_vi_Edges[j]] = k;
-
-				vi_EdgeStarMap[k] = k;
-
-				k++;
-			}
+			vi_EdgeStarMap[i] = i;
 		}
 
-		Timer m_T_Timer;
-
-		m_T_Timer.Start();
-
-		CoverMinimalVertex();
-
-		m_T_Timer.Stop();
-
-		m_d_CoveringTime = m_T_Timer.GetWallTime();
-
-		PresetCoveredVertexColors();
-
-#if DEBUG == 3560
-
-		cout<<"DEBUG 3560 | Combined Star Bicoloring | Left Vertex Cover Size = "<<m_vi_CoveredLeftVertices.size()<<"; Right Vertex Cover Size = "<<m_vi_CoveredRightVertices.size()<<endl;
-
-#endif
-
-		i_LeftVertexCoverSize = (signed) m_vi_CoveredLeftVertices.size();
-		i_RightVertexCoverSize = (signed) m_vi_CoveredRightVertices.size();
+		m_i_VertexColorCount = STEP_UP(i_LeftVertexCount +  i_RightVertexCount);
 
-		m_i_VertexColorCount = STEP_UP(i_LeftVertexCoverSize + i_RightVertexCoverSize);
+		vi_IncludedEdges.clear();
+		vi_IncludedEdges.resize((unsigned) i_EdgeCount, _FALSE);
 
 		vi_CandidateColors.clear();
 		vi_CandidateColors.resize((unsigned) m_i_VertexColorCount, _UNKNOWN);
 
+		m_vi_LeftVertexColors.clear();
+		m_vi_LeftVertexColors.resize((unsigned) i_LeftVertexCount, _UNKNOWN);
+
+		m_vi_RightVertexColors.clear();
+		m_vi_RightVertexColors.resize((unsigned) i_RightVertexCount, _UNKNOWN);
+
 		vi_LeftStarHubMap.clear();
 		vi_LeftStarHubMap.resize((unsigned) i_EdgeCount, _UNKNOWN);
 
@@ -2293,60 +280,57 @@ namespace ColPack
 		vi_FirstNeighborTwo.clear();
 		vi_FirstNeighborTwo.resize((unsigned) m_i_VertexColorCount, _UNKNOWN);
 
+		//The edge between vi_FirstNeighborOne and vi_FirstNeighborTwo of the same color
+		vi_FirstNeighborEdge.clear();
+		vi_FirstNeighborEdge.resize((unsigned) m_i_VertexColorCount, _UNKNOWN);
+
 		vi_LeftTreated.clear();
 		vi_LeftTreated.resize((unsigned) i_RightVertexCount, _UNKNOWN);
 
 		vi_RightTreated.clear();
 		vi_RightTreated.resize((unsigned) i_LeftVertexCount, _UNKNOWN);
 
-#if DEBUG == 3560
-
-		cout<<endl;
-		cout<<"DEBUG 3560 | Star Bicoloring | Initial Vertex Colors | Left Vertices"<<endl;
-		cout<<endl;
-
-		for(i=0; i<i_LeftVertexCount; i++)
-		{
-			cout<<STEP_UP(i)<<"\t"<<" : "<<m_vi_LeftVertexColors[i]<<" ["<<m_vi_IncludedLeftVertices[i]<<"]"<<endl;
-		}
-
-		cout<<endl;
-		cout<<"DEBUG 3560 | Star Bicoloring | Initial Vertex Colors | Right Vertices"<<endl;
-		cout<<endl;
-
-		for(i=0; i<i_RightVertexCount; i++)
-		{
-			cout<<STEP_UP(i)<<"\t"<<" : "<<m_vi_RightVertexColors[i]<<" ["<<m_vi_IncludedRightVertices[i]<<"]"<<endl;
-		}
-
-		cout<<endl;
+		i_IncludedEdgeCount = _FALSE;
 
-#endif
+		m_i_LeftVertexColorCount = m_i_RightVertexColorCount = _UNKNOWN;
 
-		i_OrderedVertexCount = (signed) m_vi_OrderedVertices.size();
+		i_CandidateVertexCount = (signed) vi_CandidateVertices.size();
 
-		for(i=0; i<i_OrderedVertexCount; i++)
+		for(i=0; i<i_CandidateVertexCount; i++)
 		{
+			if(i_IncludedEdgeCount >= i_EdgeCount)
+			{
+				break;
+			}
 
-#if DEBUG == 3560
-
-			cout<<"DEBUG 3560 | Star Bicoloring | Present Vertex | "<<STEP_UP(m_vi_OrderedVertices[i])<<endl;
-
-#endif
-
-			if(m_vi_OrderedVertices[i] < i_LeftVertexCount)
+			if(vi_CandidateVertices[i] < i_LeftVertexCount)
 			{
-				if(m_vi_IncludedLeftVertices[m_vi_OrderedVertices[i]] == _FALSE)
+				i_PresentVertex = vi_CandidateVertices[i];
+
+				if(m_vi_LeftVertexColors[i_PresentVertex] != _UNKNOWN)
 				{
 					continue;
 				}
 
-				i_PresentVertex = m_vi_OrderedVertices[i];
+				if(b_SkipCoveredVertices)
+				{
+					_FOUND = _FALSE;
+
+					for(j=m_vi_LeftVertices[i_PresentVertex]; j<m_vi_LeftVertices[STEP_UP(i_PresentVertex)]; j++)
+					{
+						if(vi_IncludedEdges[vi_EdgeIDs[j]] == _FALSE)
+						{
+							_FOUND = _TRUE;
 
-#if DEBUG == 3560
+							break;
+						}
+					}
 
-				cout<<"DEBUG 3560 | Star Bicoloring | Present Left Vertex | "<<STEP_UP(i_PresentVertex)<<endl;
-#endif
+					if(_FOUND == _FALSE)
+					{
+						continue;
+					}
+				}
 
 				for(j=m_vi_LeftVertices[i_PresentVertex]; j<m_vi_LeftVertices[STEP_UP(i_PresentVertex)]; j++)
 				{
@@ -2355,11 +339,6 @@ namespace ColPack
 					i_ColorID = m_vi_RightVertexColors[i_NeighboringVertex];
 
 					if(i_ColorID == _UNKNOWN)
-					{
-						continue;
-					}
-
-					if(i_ColorID == _FALSE)
 					{
 						for(k=m_vi_RightVertices[i_NeighboringVertex]; k<m_vi_RightVertices[STEP_UP(i_NeighboringVertex)]; k++)
 						{
@@ -2370,10 +349,7 @@ namespace ColPack
 								continue;
 							}
 
-							if(m_vi_LeftVertexColors[i_SecondNeighboringVertex] != _FALSE)
-							{
-								vi_CandidateColors[m_vi_LeftVertexColors[i_SecondNeighboringVertex]] = i_PresentVertex;
-							}
+							vi_CandidateColors[m_vi_LeftVertexColors[i_SecondNeighboringVertex]] = i_PresentVertex;
 						}
 					}
 					else
@@ -2387,36 +363,29 @@ namespace ColPack
 							{
 								for(k=m_vi_RightVertices[i_FirstNeighborTwo]; k<m_vi_RightVertices[STEP_UP(i_FirstNeighborTwo)]; k++)
 								{
-									if(m_vi_Edges[k] == i_PresentVertex)
-									{
-										continue;
-									}
+									i_SecondNeighboringVertex = m_vi_Edges[k];
 
-									if(m_vi_LeftVertexColors[m_vi_Edges[k]] == _UNKNOWN)
+									if(m_vi_LeftVertexColors[i_SecondNeighboringVertex] == _UNKNOWN)
 									{
 										continue;
 									}
 
-									vi_CandidateColors[m_vi_LeftVertexColors[m_vi_Edges[k]]] = i_PresentVertex;
-
+									vi_CandidateColors[m_vi_LeftVertexColors[i_SecondNeighboringVertex]] = i_PresentVertex;
 								}
 
 								vi_LeftTreated[i_FirstNeighborTwo] = i_PresentVertex;
 							}
 
-							for(k=m_vi_RightVertices[m_vi_Edges[j]]; k<m_vi_RightVertices[STEP_UP(m_vi_Edges[j])]; k++)
+							for(k=m_vi_RightVertices[i_NeighboringVertex]; k<m_vi_RightVertices[STEP_UP(i_NeighboringVertex)]; k++)
 							{
-								if(m_vi_Edges[k] == i_PresentVertex)
-								{
-									continue;
-								}
+								i_SecondNeighboringVertex = m_vi_Edges[k];
 
-								if(m_vi_LeftVertexColors[m_vi_Edges[k]] == _UNKNOWN)
+								if(m_vi_LeftVertexColors[i_SecondNeighboringVertex] == _UNKNOWN)
 								{
 									continue;
 								}
 
-								vi_CandidateColors[m_vi_LeftVertexColors[m_vi_Edges[k]]] = i_PresentVertex;
+								vi_CandidateColors[m_vi_LeftVertexColors[i_SecondNeighboringVertex]] = i_PresentVertex;
 							}
 
 							vi_LeftTreated[i_NeighboringVertex] = i_PresentVertex;
@@ -2425,22 +394,18 @@ namespace ColPack
 						{
 							vi_FirstNeighborOne[i_ColorID] = i_PresentVertex;
 							vi_FirstNeighborTwo[i_ColorID] = i_NeighboringVertex;
+							vi_FirstNeighborEdge[i_ColorID] = vi_EdgeIDs[j];
 
 							for(k=m_vi_RightVertices[i_NeighboringVertex]; k<m_vi_RightVertices[STEP_UP(i_NeighboringVertex)]; k++)
 							{
 								i_SecondNeighboringVertex = m_vi_Edges[k];
 
-								if(i_SecondNeighboringVertex == i_PresentVertex)
-								{
-									continue;
-								}
-
 								if(m_vi_LeftVertexColors[i_SecondNeighboringVertex] == _UNKNOWN)
 								{
 									continue;
 								}
 
-								if(vi_LeftStarHubMap[vi_EdgeStarMap[m_mimi2_VertexEdgeMap[i_SecondNeighboringVertex][i_NeighboringVertex]]] == i_SecondNeighboringVertex)
+								if(vi_LeftStarHubMap[vi_EdgeStarMap[vi_EdgeIDs[k]]] == i_SecondNeighboringVertex)
 								{
 									vi_CandidateColors[m_vi_LeftVertexColors[i_SecondNeighboringVertex]] = i_PresentVertex;
 								}
@@ -2449,7 +414,7 @@ namespace ColPack
 					}
 				}
 
-				for(j=_TRUE; j<STEP_UP(i_LeftVertexCoverSize); j++)
+				for(j=_TRUE; j<STEP_UP(i_LeftVertexCount); j++)
 				{
 					if(vi_CandidateColors[j] != i_PresentVertex)
 					{
@@ -2460,9 +425,21 @@ namespace ColPack
 							m_i_LeftVertexColorCount = j;
 						}
 
+						for(k=m_vi_LeftVertices[i_PresentVertex]; k<m_vi_LeftVertices[STEP_UP(i_PresentVertex)]; k++)
+						{
+							i_PresentEdge = vi_EdgeIDs[k];
+
+							if(vi_IncludedEdges[i_PresentEdge] == _FALSE)
+							{
+								vi_IncludedEdges[i_PresentEdge] = _TRUE;
+
+								i_IncludedEdgeCount++;
+							}
+						}
+
 						break;
 					}
-				 }
+				}
 
 				for(j=m_vi_LeftVertices[i_PresentVertex]; j<m_vi_LeftVertices[STEP_UP(i_PresentVertex)]; j++)
 				{
@@ -2493,11 +470,11 @@ namespace ColPack
 						{
 							_FOUND = _TRUE;
 
-							i_StarID = vi_EdgeStarMap[m_mimi2_VertexEdgeMap[i_SecondNeighboringVertex][i_NeighboringVertex]];
+							i_StarID = vi_EdgeStarMap[vi_EdgeIDs[k]];
 
 							vi_RightStarHubMap[i_StarID] = i_NeighboringVertex;
 
-							vi_EdgeStarMap[m_mimi2_VertexEdgeMap[i_PresentVertex][i_NeighboringVertex]] = i_StarID;
+							vi_EdgeStarMap[vi_EdgeIDs[j]] = i_StarID;
 
 							break;
 						}
@@ -2510,28 +487,43 @@ namespace ColPack
 
 						if((i_FirstNeighborOne == i_PresentVertex) && (i_FirstNeighborTwo != i_NeighboringVertex))
 						{
-							i_StarID = vi_EdgeStarMap[m_mimi2_VertexEdgeMap[i_PresentVertex][i_FirstNeighborTwo]];
+							i_StarID = vi_EdgeStarMap[vi_FirstNeighborEdge[m_vi_RightVertexColors[i_NeighboringVertex]]];
 
 							vi_LeftStarHubMap[i_StarID] = i_PresentVertex;
 
-							vi_EdgeStarMap[m_mimi2_VertexEdgeMap[i_PresentVertex][i_NeighboringVertex]] = i_StarID;
+							vi_EdgeStarMap[vi_EdgeIDs[j]] = i_StarID;
 						}
 					}
 				}
 			}
 			else
 			{
-				if(m_vi_IncludedRightVertices[m_vi_OrderedVertices[i] - i_LeftVertexCount] == _FALSE)
+				i_PresentVertex = vi_CandidateVertices[i] - i_LeftVertexCount;
+
+				if(m_vi_RightVertexColors[i_PresentVertex] != _UNKNOWN)
 				{
 					continue;
 				}
 
-				i_PresentVertex = m_vi_OrderedVertices[i] - i_LeftVertexCount;
+				if(b_SkipCoveredVertices)
+				{
+					_FOUND = _FALSE;
 
-#if DEBUG == 3560
+					for(j=m_vi_RightVertices[i_PresentVertex]; j<m_vi_RightVertices[STEP_UP(i_PresentVertex)]; j++)
+					{
+						if(vi_IncludedEdges[vi_EdgeIDs[j]] == _FALSE)
+						{
+							_FOUND = _TRUE;
 
-				cout<<"DEBUG 3560 | Star Bicoloring | Present Right Vertex | "<<STEP_UP(i_PresentVertex)<<endl;
-#endif
+							break;
+						}
+					}
+
+					if(_FOUND == _FALSE)
+					{
+						continue;
+					}
+				}
 
 				for(j=m_vi_RightVertices[i_PresentVertex]; j<m_vi_RightVertices[STEP_UP(i_PresentVertex)]; j++)
 				{
@@ -2540,11 +532,6 @@ namespace ColPack
 					i_ColorID = m_vi_LeftVertexColors[i_NeighboringVertex];
 
 					if(i_ColorID == _UNKNOWN)
-					{
-						continue;
-					}
-
-					if(i_ColorID == _FALSE)
 					{
 						for(k=m_vi_LeftVertices[i_NeighboringVertex]; k<m_vi_LeftVertices[STEP_UP(i_NeighboringVertex)]; k++)
 						{
@@ -2555,10 +542,7 @@ namespace ColPack
 								continue;
 							}
 
-							if(m_vi_RightVertexColors[i_SecondNeighboringVertex] != _FALSE)
-							{
-								vi_CandidateColors[m_vi_RightVertexColors[i_SecondNeighboringVertex]] = i_PresentVertex;
-							}
+							vi_CandidateColors[m_vi_RightVertexColors[i_SecondNeighboringVertex]] = i_PresentVertex;
 						}
 					}
 					else
@@ -2572,37 +556,29 @@ namespace ColPack
 							{
 								for(k=m_vi_LeftVertices[i_FirstNeighborTwo]; k<m_vi_LeftVertices[STEP_UP(i_FirstNeighborTwo)]; k++)
 								{
-									if(m_vi_Edges[k] == i_PresentVertex)
-									{
-										continue;
-									}
+									i_SecondNeighboringVertex = m_vi_Edges[k];
 
-									if(m_vi_RightVertexColors[m_vi_Edges[k]] == _UNKNOWN)
+									if(m_vi_RightVertexColors[i_SecondNeighboringVertex] == _UNKNOWN)
 									{
 										continue;
 									}
 
-									vi_CandidateColors[m_vi_RightVertexColors[m_vi_Edges[k]]] = i_PresentVertex;
-
+									vi_CandidateColors[m_vi_RightVertexColors[i_SecondNeighboringVertex]] = i_PresentVertex;
 								}
 
 								vi_RightTreated[i_FirstNeighborTwo] = i_PresentVertex;
 							}
 
-							for(k=m_vi_LeftVertices[m_vi_Edges[j]]; k<m_vi_LeftVertices[STEP_UP(m_vi_Edges[j])]; k++)
+							for(k=m_vi_LeftVertices[i_NeighboringVertex]; k<m_vi_LeftVertices[STEP_UP(i_NeighboringVertex)]; k++)
 							{
-								if(m_vi_Edges[k] == i_PresentVertex)
-								{
-									continue;
-								}
+								i_SecondNeighboringVertex = m_vi_Edges[k];
 
-								if(m_vi_RightVertexColors[m_vi_Edges[k]] == _UNKNOWN)
+								if(m_vi_RightVertexColors[i_SecondNeighboringVertex] == _UNKNOWN)
 								{
 									continue;
 								}
 
-								vi_CandidateColors[m_vi_RightVertexColors[m_vi_Edges[k]]] = i_PresentVertex;
-
+								vi_CandidateColors[m_vi_RightVertexColors[i_SecondNeighboringVertex]] = i_PresentVertex;
 							}
 
 							vi_RightTreated[i_NeighboringVertex] = i_PresentVertex;
@@ -2611,32 +587,27 @@ namespace ColPack
 						{
 							vi_FirstNeighborOne[i_ColorID] = i_PresentVertex;
 							vi_FirstNeighborTwo[i_ColorID] = i_NeighboringVertex;
+							vi_FirstNeighborEdge[i_ColorID] = vi_EdgeIDs[j];
 
 							for(k=m_vi_LeftVertices[i_NeighboringVertex]; k<m_vi_LeftVertices[STEP_UP(i_NeighboringVertex)]; k++)
 							{
 								i_SecondNeighboringVertex = m_vi_Edges[k];
 
-								if(i_SecondNeighboringVertex == i_PresentVertex)
-								{
-									continue;
-								}
-
 								if(m_vi_RightVertexColors[i_SecondNeighboringVertex] == _UNKNOWN)
 								{
 									continue;
 								}
 
-								if(vi_RightStarHubMap[vi_EdgeStarMap[m_mimi2_VertexEdgeMap[i_NeighboringVertex][i_SecondNeighboringVertex]]] == i_SecondNeighboringVertex)
+								if(vi_RightStarHubMap[vi_EdgeStarMap[vi_EdgeIDs[k]]] == i_SecondNeighboringVertex)
 								{
 									vi_CandidateColors[m_vi_RightVertexColors[i_SecondNeighboringVertex]] = i_PresentVertex;
-
 								}
 							}
 						}
 					}
 				}
 
-				for(j=STEP_UP(i_LeftVertexCoverSize); j<m_i_VertexColorCount; j++)
+				for(j=STEP_UP(i_LeftVertexCount); j<m_i_VertexColorCount; j++)
 				{
 					if(vi_CandidateColors[j] != i_PresentVertex)
 					{
@@ -2647,6 +618,18 @@ namespace ColPack
 							m_i_RightVertexColorCount = j;
 						}
 
+						for(k=m_vi_RightVertices[i_PresentVertex]; k<m_vi_RightVertices[STEP_UP(i_PresentVertex)]; k++)
+						{
+							i_PresentEdge = vi_EdgeIDs[k];
+
+							if(vi_IncludedEdges[i_PresentEdge] == _FALSE)
+							{
+								vi_IncludedEdges[i_PresentEdge] = _TRUE;
+
+								i_IncludedEdgeCount++;
+							}
+						}
+
 						break;
 					}
 				}
@@ -2680,11 +663,11 @@ namespace ColPack
 						{
 							_FOUND = _TRUE;
 
-							i_StarID = vi_EdgeStarMap[m_mimi2_VertexEdgeMap[i_NeighboringVertex][i_SecondNeighboringVertex]];
+							i_StarID = vi_EdgeStarMap[vi_EdgeIDs[k]];
 
 							vi_LeftStarHubMap[i_StarID] = i_NeighboringVertex;
 
-							vi_EdgeStarMap[m_mimi2_VertexEdgeMap[i_NeighboringVertex][i_PresentVertex]] = i_StarID;
+							vi_EdgeStarMap[vi_EdgeIDs[j]] = i_StarID;
 
 							break;
 						}
@@ -2697,42 +680,43 @@ namespace ColPack
 
 						if((i_FirstNeighborOne == i_PresentVertex) && (i_FirstNeighborTwo != i_NeighboringVertex))
 						{
-							i_StarID = vi_EdgeStarMap[m_mimi2_VertexEdgeMap[i_FirstNeighborTwo][i_PresentVertex]];
+							i_StarID = vi_EdgeStarMap[vi_FirstNeighborEdge[m_vi_LeftVertexColors[i_NeighboringVertex]]];
 
 							vi_RightStarHubMap[i_StarID] = i_PresentVertex;
 
-							vi_EdgeStarMap[m_mimi2_VertexEdgeMap[i_NeighboringVertex][i_PresentVertex]] = i_StarID;
+							vi_EdgeStarMap[vi_EdgeIDs[j]] = i_StarID;
 						}
 					}
 				}
 			}
 		}
 
-		for(i=0; i<i_RightVertexCount; i++)
+		if(i_IncludedEdgeCount < i_EdgeCount)
 		{
-			if(m_vi_RightVertexColors[i] == FALSE)
-			{
-				m_vi_RightVertexColors[i] = m_i_VertexColorCount;
-			}
-		}
+			cerr<<endl<<"*ERROR: "<<(i_EdgeCount - i_IncludedEdgeCount)<<" edges are not covered by the candidate vertices of the star bicoloring"<<endl;
 
-		FixMinimalCoverStarBicoloring();
+			return(_FALSE);
+		}
 
 		i_LeftVertexDefaultColor = _FALSE;
 		i_RightVertexDefaultColor = _FALSE;
 
 		for(i=0; i<i_LeftVertexCount; i++)
 		{
-			if(m_vi_LeftVertexColors[i] == _FALSE)
+			if(m_vi_LeftVertexColors[i] == _UNKNOWN)
 			{
+				m_vi_LeftVertexColors[i] = _FALSE;
+
 				i_LeftVertexDefaultColor = _TRUE;
 			}
 		}
 
 		for(i=0; i<i_RightVertexCount; i++)
 		{
-			if(m_vi_RightVertexColors[i] == m_i_VertexColorCount)
+			if(m_vi_RightVertexColors[i] == _UNKNOWN)
 			{
+				m_vi_RightVertexColors[i] = m_i_VertexColorCount; // m_i_VertexColorCount == (i_LeftVertexCount +  i_RightVertexCount + 1)
+
 				i_RightVertexDefaultColor = _TRUE;
 			}
 		}
@@ -2752,563 +736,529 @@ namespace ColPack
 		}
 		else
 		{
-			m_i_RightVertexColorCount = m_i_RightVertexColorCount + i_RightVertexDefaultColor - i_LeftVertexCoverSize;
+			m_i_RightVertexColorCount = m_i_RightVertexColorCount + i_RightVertexDefaultColor - i_LeftVertexCount;
 		}
 
 		m_i_VertexColorCount = m_i_LeftVertexColorCount + m_i_RightVertexColorCount;
 
-#if DEBUG == 3560
+		return(_TRUE);
+	}
 
-		cout<<endl;
-		cout<<"DEBUG 3560 | Right Star Bicoloring | Vertex Colors | Left Vertices"<<endl;
-		cout<<endl;
 
-		for(i=0; i<i_LeftVertexCount; i++)
-		{
-			cout<<STEP_UP(i)<<"\t"<<" : "<<m_vi_LeftVertexColors[i]<<endl;
-		}
+	//Private Function 3511
+	void BipartiteGraphBicoloring::GetOrderedCoveredVertices(vector<int> & vi_CandidateVertices, bool b_LeftVertices, bool b_RightVertices)
+	{
+		int i_LeftVertexCount = STEP_DOWN((signed) m_vi_LeftVertices.size());
 
-		cout<<endl;
-		cout<<"DEBUG 3560 | Right Star Bicoloring | Vertex Colors | Right Vertices"<<endl;
-		cout<<endl;
+		int i_OrderedVertexCount = (signed) m_vi_OrderedVertices.size();
 
-		for(i=0; i<i_RightVertexCount; i++)
+		for(int i=0; i<i_OrderedVertexCount; i++)
 		{
-			cout<<STEP_UP(i)<<"\t"<<" : "<<m_vi_RightVertexColors[i]<<endl;
+			if(m_vi_OrderedVertices[i] < i_LeftVertexCount)
+			{
+				if(b_LeftVertices && (m_vi_IncludedLeftVertices[m_vi_OrderedVertices[i]] == _TRUE))
+				{
+					vi_CandidateVertices.push_back(m_vi_OrderedVertices[i]);
+				}
+			}
+			else
+			{
+				if(b_RightVertices && (m_vi_IncludedRightVertices[m_vi_OrderedVertices[i] - i_LeftVertexCount] == _TRUE))
+				{
+					vi_CandidateVertices.push_back(m_vi_OrderedVertices[i]);
+				}
+			}
 		}
 
-#endif
+		return;
+	}
 
-		return(_TRUE);
 
-}
 
+	//Public Constructor 3551
+	BipartiteGraphBicoloring::BipartiteGraphBicoloring()
+	{
+		Clear();
+
+		Seed_init();
+	}
 
 
-	//Public Function 3561
-	int BipartiteGraphBicoloring::ImplicitCoveringConservativeStarBicoloring()
+	//Public Destructor 3552
+	BipartiteGraphBicoloring::~BipartiteGraphBicoloring()
 	{
-		if(CheckVertexColoring("IMPLICIT_COVER_CONSERVATIVE_STAR"))
-		{
-			return(_TRUE);
+		Clear();
+
+		Seed_reset();
+	}
+
+	int BipartiteGraphBicoloring::GetLeftSeedColors(vector<int> &output) {
+		int i_num_of_colors = m_i_LeftVertexColorCount;
+		if (i_LeftVertexDefaultColor == 1) i_num_of_colors--; //color ID 0 is used, ignore it
+
+		output.resize(m_vi_LeftVertexColors.size());
+		for (size_t i=0; i < output.size(); i++) {
+			output[i] = m_vi_LeftVertexColors[i] != 0 ? m_vi_LeftVertexColors[i] - 1 : _UNKNOWN;
 		}
 
-		int i, j, k;
+		return i_num_of_colors;
+	}
 
-		int _FOUND;
+	int BipartiteGraphBicoloring::GetRightSeedColors(vector<int> &output) {
+		int i_num_of_colors = m_i_RightVertexColorCount;
+		if (i_RightVertexDefaultColor == 1) i_num_of_colors--; //color ID 0 is used, ignore it
 
-		int i_ColorID, i_StarID;
+		GetRightVertexColors_Transformed(output);
+		for (size_t i=0; i < output.size(); i++) {
+			output[i] = output[i] != 0 ? output[i] - 1 : _UNKNOWN;
+		}
 
-		int i_EdgeCount, i_IncludedEdgeCount;
+		return i_num_of_colors;
+	}
 
-		int i_FirstNeighborOne, i_FirstNeighborTwo;
+	void BipartiteGraphBicoloring::SetMatrixAllocation(int i_MatrixAllocation) {
+		m_i_MatrixAllocation = i_MatrixAllocation;
+	}
 
-		int i_LeftVertexCount, i_RightVertexCount;
+	int BipartiteGraphBicoloring::GetMatrixAllocation() {
+		return m_i_MatrixAllocation;
+	}
 
-		int i_PresentVertex, i_NeighboringVertex, i_SecondNeighboringVertex;
+	void BipartiteGraphBicoloring::Seed_init() {
+		m_i_MatrixAllocation = MATRIX_ALLOC_ROWS;
 
-		int i_PresentEdge;
+		lseed_available = false;
+		i_lseed_rowCount = 0;
+		dp2_lSeed = NULL;
 
-		vector<int> vi_IncludedEdges;
+		rseed_available = false;
+		i_rseed_rowCount = 0;
+		dp2_rSeed = NULL;
+	}
 
-		vector<int> vi_CandidateColors;
+	void BipartiteGraphBicoloring::Seed_reset() {
+		if(lseed_available) {
+			lseed_available = false;
 
-		vector<int> vi_EdgeStarMap, vi_LeftStarHubMap, vi_RightStarHubMap;
+			if(i_lseed_rowCount>0) {
+			  free_2DMatrix_slab(dp2_lSeed);
+			}
+			else {
+			  cerr<<"ERR: freeing left seed matrix with 0 row"<<endl;
+			  exit(-1);
+			}
+			dp2_lSeed = NULL;
+			i_lseed_rowCount = 0;
+		}
 
-		vector<int> vi_LeftTreated, vi_RightTreated;
+		if(rseed_available) {
+			rseed_available = false;
 
-		vector<int> vi_FirstNeighborOne, vi_FirstNeighborTwo;
+			if(i_rseed_rowCount>0) {
+			  free_2DMatrix_slab(dp2_rSeed);
+			}
+			else {
+			  cerr<<"ERR: freeing right seed matrix with 0 row"<<endl;
+			  exit(-1);
+			}
+			dp2_rSeed = NULL;
+			i_rseed_rowCount = 0;
+		}
+	}
 
-		i_LeftVertexCount  = STEP_DOWN((signed) m_vi_LeftVertices.size());
-		i_RightVertexCount = STEP_DOWN((signed) m_vi_RightVertices.size());
 
-		i_EdgeCount = (signed) m_vi_Edges.size()/2;
+	//Virtual Function 3553
+	void BipartiteGraphBicoloring::Clear()
+	{
+		BipartiteGraphOrdering::Clear();
 
-		vi_EdgeStarMap.clear();
-		vi_EdgeStarMap.resize((unsigned) i_EdgeCount, _UNKNOWN);
+		//m_i_ColoringUnits = _UNKNOWN;
 
-		m_mimi2_VertexEdgeMap.clear();
+		m_i_LeftVertexColorCount = _UNKNOWN;
+		m_i_RightVertexColorCount = _UNKNOWN;
 
-		i_IncludedEdgeCount =_FALSE;
+		m_i_VertexColorCount = _UNKNOWN;
 
-		for(i=0; i<i_LeftVertexCount; i++)
-		{
-			for(j=m_vi_LeftVertices[i]; j<m_vi_LeftVertices[STEP_UP(i)]; j++)
-			{
-				m_mimi2_VertexEdgeMap[i][m_vi_Edges[j]] = i_IncludedEdgeCount;
+		m_i_ViolationCount = _UNKNOWN;
 
-				vi_EdgeStarMap[i_IncludedEdgeCount] = i_IncludedEdgeCount;
+		m_i_ColoringRounds = _FALSE;
 
-				i_IncludedEdgeCount++;
-			}
-		}
+		m_i_LargestLeftVertexColorClass = _UNKNOWN;
+		m_i_LargestRightVertexColorClass = _UNKNOWN;
 
-		m_i_VertexColorCount = STEP_UP(i_LeftVertexCount +  i_RightVertexCount);
+		m_i_LargestLeftVertexColorClassSize = _UNKNOWN;
+		m_i_LargestRightVertexColorClassSize = _UNKNOWN;
+
+		m_i_SmallestLeftVertexColorClass = _UNKNOWN;
+		m_i_SmallestRightVertexColorClass = _UNKNOWN;
+
+		m_i_SmallestLeftVertexColorClassSize = _UNKNOWN;
+		m_i_SmallestRightVertexColorClassSize = _UNKNOWN;
+
+		m_i_LargestVertexColorClass = _UNKNOWN;
+		m_i_SmallestVertexColorClass = _UNKNOWN;
+
+		m_i_LargestVertexColorClassSize = _UNKNOWN;
+		m_i_SmallestVertexColorClassSize = _UNKNOWN;
+
+		m_d_AverageLeftVertexColorClassSize = _UNKNOWN;
+		m_d_AverageRightVertexColorClassSize = _UNKNOWN;
+		m_d_AverageVertexColorClassSize = _UNKNOWN;
 
-		vi_IncludedEdges.clear();
-		vi_IncludedEdges.resize((unsigned) i_EdgeCount, _FALSE);
+		m_d_ColoringTime = _UNKNOWN;
+		m_d_CheckingTime = _UNKNOWN;
 
-		vi_CandidateColors.clear();
-		vi_CandidateColors.resize((unsigned) m_i_VertexColorCount, _UNKNOWN);
+		m_s_VertexColoringVariant.clear();
 
 		m_vi_LeftVertexColors.clear();
-		m_vi_LeftVertexColors.resize((unsigned) i_LeftVertexCount, _UNKNOWN);
-
 		m_vi_RightVertexColors.clear();
-		m_vi_RightVertexColors.resize((unsigned) i_LeftVertexCount, _UNKNOWN);
 
-		vi_LeftStarHubMap.clear();
-		vi_LeftStarHubMap.resize((unsigned) i_EdgeCount, _UNKNOWN);
-
-		vi_RightStarHubMap.clear();
-		vi_RightStarHubMap.resize((unsigned) i_EdgeCount, _UNKNOWN);
+		m_vi_LeftVertexColorFrequency.clear();
+		m_vi_RightVertexColorFrequency.clear();
 
-		vi_FirstNeighborOne.clear();
-		vi_FirstNeighborOne.resize((unsigned) m_i_VertexColorCount, _UNKNOWN);
+		return;
+	}
 
-		vi_FirstNeighborTwo.clear();
-		vi_FirstNeighborTwo.resize((unsigned) m_i_VertexColorCount, _UNKNOWN);
 
-		vi_LeftTreated.clear();
-		vi_LeftTreated.resize((unsigned) i_RightVertexCount, _UNKNOWN);
+	//Virtual Function 3554
+	void BipartiteGraphBicoloring::Reset()
+	{
+		BipartiteGraphOrdering::Reset();
 
-		vi_RightTreated.clear();
-		vi_RightTreated.resize((unsigned) i_LeftVertexCount, _UNKNOWN);
+		//m_i_ColoringUnits = _UNKNOWN;
 
-		i_IncludedEdgeCount = _FALSE;
+		m_i_LeftVertexColorCount = _UNKNOWN;
+		m_i_RightVertexColorCount = _UNKNOWN;
 
-		m_i_LeftVertexColorCount = m_i_RightVertexColorCount = _UNKNOWN;
+		m_i_VertexColorCount = _UNKNOWN;
 
-		for(i=0; i<i_LeftVertexCount + i_RightVertexCount; i++)
-		{
+		m_i_ViolationCount = _UNKNOWN;
 
-	#if DEBUG == 3561
+		m_i_ColoringRounds = _FALSE;
 
-			cout<<"DEBUG 3561 | Star Bicoloring | Present Vertex | "<<STEP_UP(m_vi_OrderedVertices[i])<<endl;
+		m_i_LargestLeftVertexColorClass = _UNKNOWN;
+		m_i_LargestRightVertexColorClass = _UNKNOWN;
 
-	#endif
+		m_i_LargestLeftVertexColorClassSize = _UNKNOWN;
+		m_i_LargestRightVertexColorClassSize = _UNKNOWN;
 
-			if(m_vi_OrderedVertices[i] < i_LeftVertexCount)
-			{
-				i_PresentVertex = m_vi_OrderedVertices[i];
+		m_i_SmallestLeftVertexColorClass = _UNKNOWN;
+		m_i_SmallestRightVertexColorClass = _UNKNOWN;
 
-				_FOUND = _FALSE;
+		m_i_SmallestLeftVertexColorClassSize = _UNKNOWN;
+		m_i_SmallestRightVertexColorClassSize = _UNKNOWN;
 
-				for(j= m_vi_LeftVertices[i_PresentVertex]; j<m_vi_LeftVertices[STEP_UP(i_PresentVertex)]; j++)
-				{
-					i_PresentEdge = m_mimi2_VertexEdgeMap[i_PresentVertex][m_vi_Edges[j]];
+		m_i_LargestVertexColorClass = _UNKNOWN;
+		m_i_SmallestVertexColorClass = _UNKNOWN;
 
-					if(vi_IncludedEdges[i_PresentEdge] == _FALSE)
-					{
-						_FOUND = _TRUE;
+		m_i_LargestVertexColorClassSize = _UNKNOWN;
+		m_i_SmallestVertexColorClassSize = _UNKNOWN;
 
-						break;
-					}
-				}
+		m_d_AverageLeftVertexColorClassSize = _UNKNOWN;
+		m_d_AverageRightVertexColorClassSize = _UNKNOWN;
+		m_d_AverageVertexColorClassSize = _UNKNOWN;
 
-				if(_FOUND == _FALSE)
-				{
+		m_d_ColoringTime = _UNKNOWN;
+		m_d_CheckingTime = _UNKNOWN;
 
-	#if DEBUG == 3561
+		m_s_VertexColoringVariant.clear();
 
-					cout<<"DEBUG 3561 | Star Bicoloring | Ignored Present Left Vertex | "<<STEP_UP(i_PresentVertex)<<endl;
+		m_vi_LeftVertexColors.clear();
+		m_vi_RightVertexColors.clear();
 
-	#endif
+		m_vi_LeftVertexColorFrequency.clear();
+		m_vi_RightVertexColorFrequency.clear();
 
-					continue;
-				}
+		return;
+	}
 
-	#if DEBUG == 3561
 
-				cout<<"DEBUG 3561 | Star Bicoloring | Present Left Vertex | "<<STEP_UP(i_PresentVertex)<<endl;
+	//Public Function 3556
+	int BipartiteGraphBicoloring::MinimalCoveringRowMajorStarBicoloring()
+	{
+		if(CheckVertexColoring("MINIMAL_COVER_ROW_STAR"))
+		{
+			return(_TRUE);
+		}
 
-	#endif
+		vector<int> vi_CandidateVertices;
 
-				for(j=m_vi_LeftVertices[i_PresentVertex]; j<m_vi_LeftVertices[STEP_UP(i_PresentVertex)]; j++)
-				{
-					i_NeighboringVertex = m_vi_Edges[j];
+		Timer m_T_Timer;
 
-					i_ColorID = m_vi_RightVertexColors[i_NeighboringVertex];
+		m_T_Timer.Start();
 
-					if(i_ColorID == _UNKNOWN)
-					{
-						for(k=m_vi_RightVertices[i_NeighboringVertex]; k<m_vi_RightVertices[STEP_UP(i_NeighboringVertex)]; k++)
-						{
-							i_SecondNeighboringVertex = m_vi_Edges[k];
+		CoverMinimalVertex();
 
-							if(m_vi_LeftVertexColors[i_SecondNeighboringVertex] == _UNKNOWN)
-							{
-								continue;
-							}
+		m_T_Timer.Stop();
 
-							vi_CandidateColors[m_vi_LeftVertexColors[i_SecondNeighboringVertex]] = i_PresentVertex;
-						}
+		m_d_CoveringTime = m_T_Timer.GetWallTime();
 
-						continue;
-					}
-					else
-					{
-						i_FirstNeighborOne = vi_FirstNeighborOne[i_ColorID];
-						i_FirstNeighborTwo = vi_FirstNeighborTwo[i_ColorID];
+		//All the covered rows first, then the covered columns
+		GetOrderedCoveredVertices(vi_CandidateVertices, true, false);
+		GetOrderedCoveredVertices(vi_CandidateVertices, false, true);
 
-						if(i_FirstNeighborOne == i_PresentVertex)
-						{
-							if(vi_LeftTreated[i_FirstNeighborTwo] != i_PresentVertex)
-							{
-								for(k=m_vi_RightVertices[i_FirstNeighborTwo]; k<m_vi_RightVertices[STEP_UP(i_FirstNeighborTwo)]; k++)
-								{
-									i_SecondNeighboringVertex = m_vi_Edges[k];
+		return(StarBicoloring(vi_CandidateVertices, false));
+	}
 
-									if(i_SecondNeighboringVertex == i_PresentVertex)
-									{
-										continue;
-									}
 
-									if(m_vi_LeftVertexColors[i_SecondNeighboringVertex] == _UNKNOWN)
-									{
-										continue;
-									}
+	//Public Function 3557
+	int BipartiteGraphBicoloring::MinimalCoveringColumnMajorStarBicoloring()
+	{
+		if(CheckVertexColoring("MINIMAL_COVER_COLUMN_STAR"))
+		{
+			return(_TRUE);
+		}
 
-									vi_CandidateColors[m_vi_LeftVertexColors[i_SecondNeighboringVertex]] = i_PresentVertex;
+		vector<int> vi_CandidateVertices;
 
-	#if DEBUG == 3561
+		Timer m_T_Timer;
 
-									cout<<"DEBUG 3561 | Star Bicoloring | Visited Same Color Neighbor | Preventing Color "<<m_vi_LeftVertexColors[i_SecondNeighboringVertex]<<" of Left Neighboring Vertex "<<STEP_UP(i_SecondNeighboringVertex)<<" coming from Right Neighboring Vertex "<<STEP_UP(i_FirstNeighborTwo)<<endl;
+		m_T_Timer.Start();
 
-	#endif
-								}
+		CoverMinimalVertex();
 
-								vi_LeftTreated[i_FirstNeighborTwo] = i_PresentVertex;
-							}
+		m_T_Timer.Stop();
 
-							for(k=m_vi_RightVertices[m_vi_Edges[j]]; k<m_vi_RightVertices[STEP_UP(m_vi_Edges[j])]; k++)
-							{
-								i_SecondNeighboringVertex = m_vi_Edges[k];
+		m_d_CoveringTime = m_T_Timer.GetWallTime();
 
-								if(i_SecondNeighboringVertex == i_PresentVertex)
-								{
-									continue;
-								}
+		//All the covered columns first, then the covered rows
+		GetOrderedCoveredVertices(vi_CandidateVertices, false, true);
+		GetOrderedCoveredVertices(vi_CandidateVertices, true, false);
 
-								if(m_vi_LeftVertexColors[i_SecondNeighboringVertex] == _UNKNOWN)
-								{
-									continue;
-								}
+		return(StarBicoloring(vi_CandidateVertices, false));
+	}
 
-								vi_CandidateColors[m_vi_LeftVertexColors[i_SecondNeighboringVertex]] = i_PresentVertex;
 
-	#if DEBUG == 3561
+	//Public Function 3558
+	int BipartiteGraphBicoloring::ExplicitCoveringModifiedStarBicoloring()
+	{
+		if(CheckVertexColoring("EXPLICIT_COVER_MODIFIED_STAR"))
+		{
+			return(_TRUE);
+		}
 
-								cout<<"DEBUG 3561 | Star Bicoloring | Restricted Same Color Neighbor | Preventing Color "<<m_vi_LeftVertexColors[i_SecondNeighboringVertex]<<" of Left Neighboring Vertex "<<STEP_UP(i_SecondNeighboringVertex)<<" coming from Right Neighboring Vertex "<<STEP_UP(m_vi_Edges[j])<<endl;
+		int i, j, k, l;
 
-	#endif
-							}
+		int i_EdgeID, i_NeighboringEdgeID;
 
-							vi_LeftTreated[i_NeighboringVertex] = i_PresentVertex;
-						}
-						else
-						{
-							vi_FirstNeighborOne[i_ColorID] = i_PresentVertex;
-							vi_FirstNeighborTwo[i_ColorID] = i_NeighboringVertex;
+		//int i_EdgeCount; //unused variable
 
-							for(k=m_vi_RightVertices[i_NeighboringVertex]; k<m_vi_RightVertices[STEP_UP(i_NeighboringVertex)]; k++)
-							{
+		int i_LeftVertexCount, i_RightVertexCount;
 
-								i_SecondNeighboringVertex = m_vi_Edges[k];
+		int i_LeftVertexCoverSize, i_RightVertexCoverSize;
 
-								if(i_SecondNeighboringVertex == i_PresentVertex)
-								{
-									continue;
-								}
+		int i_OrderedVertexCount;
 
-								if(m_vi_LeftVertexColors[i_SecondNeighboringVertex] == _UNKNOWN)
-								{
-									continue;
-								}
+		int i_PresentVertex, i_NeighboringVertex, i_SecondNeighboringVertex, i_ThirdNeighboringVertex;
 
-								if(vi_LeftStarHubMap[vi_EdgeStarMap[m_mimi2_VertexEdgeMap[i_SecondNeighboringVertex][i_NeighboringVertex]]] == i_SecondNeighboringVertex)
-								{
-									vi_CandidateColors[m_vi_LeftVertexColors[i_SecondNeighboringVertex]] = i_PresentVertex;
+		vector<int> vi_CandidateColors;
 
-	#if DEBUG == 3561
+		vector<int> vi_EdgeCodes;
 
-									cout<<"DEBUG 3561 | Star Bicoloring | Restricted Hub Color Neighbor | Preventing Color "<<m_vi_LeftVertexColors[i_SecondNeighboringVertex]<<" of Left Neighboring Vertex "<<STEP_UP(i_SecondNeighboringVertex)<<" coming from Right Neighboring Vertex "<<STEP_UP(i_NeighboringVertex)<<endl;
+		i_LeftVertexCount  = STEP_DOWN((signed) m_vi_LeftVertices.size());
+		i_RightVertexCount = STEP_DOWN((signed) m_vi_RightVertices.size());
 
-	#endif
-								}
-							}
-						}
-					}
-				}
+		//i_EdgeCount = (signed) m_vi_Edges.size()/2; //unused variable
 
-				for(j=_TRUE; j<STEP_UP(i_LeftVertexCount); j++)
-				{
-					if(vi_CandidateColors[j] != i_PresentVertex)
-					{
-						m_vi_LeftVertexColors[i_PresentVertex] = j;
+		m_mimi2_VertexEdgeMap.clear();
 
-						if(m_i_LeftVertexColorCount < j)
-						{
-							m_i_LeftVertexColorCount = j;
-						}
+		k=_FALSE;
 
-						for(k=m_vi_LeftVertices[i_PresentVertex]; k<m_vi_LeftVertices[STEP_UP(i_PresentVertex)]; k++)
-						{
-							i_PresentEdge = m_mimi2_VertexEdgeMap[i_PresentVertex][m_vi_Edges[k]];
+		for(i=0; i<i_LeftVertexCount; i++)
+		{
+			for(j=m_vi_LeftVertices[i]; j<m_vi_LeftVertices[STEP_UP(i)]; j++)
+			{
+				m_mimi2_VertexEdgeMap[i][m_vi_Edges[j]] = k;
 
-							if(vi_IncludedEdges[i_PresentEdge] == _FALSE)
-							{
-								vi_IncludedEdges[i_PresentEdge] = _TRUE;
+				k++;
+			}
+		}
 
-								i_IncludedEdgeCount++;
-							}
-						}
 
-						break;
-					}
-				}
+		Timer m_T_Timer;
 
-				for(j=m_vi_LeftVertices[i_PresentVertex]; j<m_vi_LeftVertices[STEP_UP(i_PresentVertex)]; j++)
-				{
-					_FOUND = _FALSE;
+		m_T_Timer.Start();
 
-					i_NeighboringVertex = m_vi_Edges[j];
+		CoverVertex(vi_EdgeCodes);
 
-					if(m_vi_RightVertexColors[i_NeighboringVertex] == _UNKNOWN)
-					{
-						continue;
-					}
+		m_T_Timer.Stop();
 
-					for(k=m_vi_RightVertices[i_NeighboringVertex]; k<m_vi_RightVertices[STEP_UP(i_NeighboringVertex)]; k++)
-					{
-						i_SecondNeighboringVertex = m_vi_Edges[k];
+		m_d_CoveringTime = m_T_Timer.GetWallTime();
 
-						if(i_SecondNeighboringVertex == i_PresentVertex)
-						{
-							continue;
-						}
+		PresetCoveredVertexColors();
 
-						if(m_vi_LeftVertexColors[i_SecondNeighboringVertex] == _UNKNOWN)
-						{
-							continue;
-						}
+		i_LeftVertexCoverSize = (signed) m_vi_CoveredLeftVertices.size();
+		i_RightVertexCoverSize = (signed) m_vi_CoveredRightVertices.size();
 
-						if(m_vi_LeftVertexColors[i_SecondNeighboringVertex] == m_vi_LeftVertexColors[i_PresentVertex])
-						{
-							_FOUND = _TRUE;
+		m_i_VertexColorCount = STEP_UP(i_LeftVertexCoverSize +  i_RightVertexCoverSize);
 
-							i_StarID = vi_EdgeStarMap[m_mimi2_VertexEdgeMap[i_SecondNeighboringVertex][i_NeighboringVertex]];
+		vi_CandidateColors.clear();
+		vi_CandidateColors.resize((unsigned) m_i_VertexColorCount, _UNKNOWN);
 
-							vi_RightStarHubMap[i_StarID] = i_NeighboringVertex;
+#if DEBUG == 3558
 
-							vi_EdgeStarMap[m_mimi2_VertexEdgeMap[i_PresentVertex][i_NeighboringVertex]] = i_StarID;
+		int i_EdgeCodeZero, i_EdgeCodeOne, i_EdgeCodeTwo, i_EdgeCodeThree;
 
-							break;
-						}
-					}
+		i_EdgeCodeZero = i_EdgeCodeOne = i_EdgeCodeTwo = i_EdgeCodeThree = _FALSE;
 
-					if (!_FOUND)
-					{
-						i_FirstNeighborOne = vi_FirstNeighborOne[m_vi_RightVertexColors[i_NeighboringVertex]];
-						i_FirstNeighborTwo = vi_FirstNeighborTwo[m_vi_RightVertexColors[i_NeighboringVertex]];
+		cout<<endl;
+		cout<<"DEBUG 3558 | Bipartite Graph Bicoloring | Edge Codes"<<endl;
+		cout<<endl;
 
-						if((i_FirstNeighborOne == i_PresentVertex) && (i_FirstNeighborTwo != i_NeighboringVertex))
-						{
-							i_StarID = vi_EdgeStarMap[m_mimi2_VertexEdgeMap[i_PresentVertex][i_FirstNeighborTwo]];
+		for(i=0; i<i_LeftVertexCount; i++)
+		{
+			for(j=m_vi_LeftVertices[i]; j<m_vi_LeftVertices[STEP_UP(i)]; j++)
+			{
+				i_EdgeID = m_mimi2_VertexEdgeMap[i][m_vi_Edges[j]];
 
-							vi_LeftStarHubMap[i_StarID] = i_PresentVertex;
+				cout<<"Edge "<<STEP_UP(i_EdgeID)<<"\t"<<" : "<<vi_EdgeCodes[i_EdgeID]<<endl;
 
-							vi_EdgeStarMap[m_mimi2_VertexEdgeMap[i_PresentVertex][i_NeighboringVertex]] = i_StarID;
-						}
-					}
+				if(vi_EdgeCodes[i_EdgeID] == 0)
+				{
+					i_EdgeCodeZero++;
+				}
+				else
+				if(vi_EdgeCodes[i_EdgeID] == 1)
+				{
+					i_EdgeCodeOne++;
+				}
+				else
+				if(vi_EdgeCodes[i_EdgeID] == 2)
+				{
+					i_EdgeCodeTwo++;
+				}
+				else
+				if(vi_EdgeCodes[i_EdgeID] == 3)
+				{
+					i_EdgeCodeThree++;
 				}
 			}
-			else
-			{
-				i_PresentVertex = m_vi_OrderedVertices[i] - i_LeftVertexCount;
+		}
 
-				_FOUND = _FALSE;
+		cout<<endl;
+		cout<<"Code Zero Edges = "<<i_EdgeCodeZero<<"; Code One Edges = "<<i_EdgeCodeOne<<"; Code Two Edges = "<<i_EdgeCodeTwo<<"; Code Three Edges = "<<i_EdgeCodeThree<<endl;
+		cout<<endl;
 
-				for(j= m_vi_RightVertices[i_PresentVertex]; j<m_vi_RightVertices[STEP_UP(i_PresentVertex)]; j++)
-				{
-					i_PresentEdge = m_mimi2_VertexEdgeMap[m_vi_Edges[j]][i_PresentVertex];
+#endif
 
-					if(vi_IncludedEdges[i_PresentEdge] == _FALSE)
-					{
-						_FOUND = _TRUE;
+#if DEBUG == 3558
 
-						break;
-					}
-				}
+		cout<<"DEBUG 3558 | Star Bicoloring | Left Vertex Cover Size = "<<m_vi_CoveredLeftVertices.size()<<"; Right Vertex Cover Size = "<<m_vi_CoveredRightVertices.size()<<endl;
 
-				if(_FOUND == _FALSE)
-				{
+#endif
+
+		i_OrderedVertexCount = (signed) m_vi_OrderedVertices.size();
+
+		m_i_LeftVertexColorCount = m_i_RightVertexColorCount = _UNKNOWN;
+
+		for(i=0; i<i_OrderedVertexCount; i++)
+		{
+
+#if DEBUG == 3558
 
-#if DEBUG == 3561
+			cout<<"DEBUG 3558 | Star Bicoloring | Present Vertex | "<<STEP_UP(m_vi_OrderedVertices[i])<<endl;
 
-					cout<<"DEBUG 3561 | Star Bicoloring | Ignored Present Right Vertex | "<<STEP_UP(i_PresentVertex)<<endl;
 #endif
 
+			if(m_vi_OrderedVertices[i] < i_LeftVertexCount)
+			{
+				if(m_vi_IncludedLeftVertices[m_vi_OrderedVertices[i]] == _FALSE)
+				{
 					continue;
 				}
 
-#if DEBUG == 3561
+				i_PresentVertex = m_vi_OrderedVertices[i];
 
-				cout<<"DEBUG 3561 | Star Bicoloring | Present Right Vertex | "<<STEP_UP(i_PresentVertex)<<endl;
+#if DEBUG == 3558
 
+				cout<<"DEBUG 3558 | Star Bicoloring | Present Left Vertex | "<<STEP_UP(i_PresentVertex)<<endl;
 #endif
 
-				for(j=m_vi_RightVertices[i_PresentVertex]; j<m_vi_RightVertices[STEP_UP(i_PresentVertex)]; j++)
+				for(j=m_vi_LeftVertices[i_PresentVertex]; j<m_vi_LeftVertices[STEP_UP(i_PresentVertex)]; j++)
 				{
 					i_NeighboringVertex = m_vi_Edges[j];
 
-					i_ColorID = m_vi_LeftVertexColors[i_NeighboringVertex];
+					i_EdgeID = m_mimi2_VertexEdgeMap[i_PresentVertex][i_NeighboringVertex];
 
-					if(i_ColorID == _UNKNOWN)
+					if (vi_EdgeCodes[i_EdgeID] == 2)
 					{
-						for(k=m_vi_LeftVertices[i_NeighboringVertex]; k<m_vi_LeftVertices[STEP_UP(i_NeighboringVertex)]; k++)
-						{
-							i_SecondNeighboringVertex = m_vi_Edges[k];
-
-							if(m_vi_RightVertexColors[i_SecondNeighboringVertex] == _UNKNOWN)
-							{
-								continue;
-							}
-
-							vi_CandidateColors[m_vi_RightVertexColors[i_SecondNeighboringVertex]] = i_PresentVertex;
-						}
-
 						continue;
 					}
-					else
+
+					for(k=m_vi_RightVertices[i_NeighboringVertex]; k<m_vi_RightVertices[STEP_UP(i_NeighboringVertex)]; k++)
 					{
+						i_SecondNeighboringVertex = m_vi_Edges[k];
 
-						i_FirstNeighborOne = vi_FirstNeighborOne[i_ColorID];
-						i_FirstNeighborTwo = vi_FirstNeighborTwo[i_ColorID];
+						if(m_vi_LeftVertexColors[i_SecondNeighboringVertex] == _UNKNOWN)
+						{
+							continue;
+						}
 
-						if(i_FirstNeighborOne == i_PresentVertex)
+						i_NeighboringEdgeID = m_mimi2_VertexEdgeMap[i_SecondNeighboringVertex][i_NeighboringVertex];
+
+						if(vi_EdgeCodes[i_NeighboringEdgeID] != 2)
 						{
-							if(vi_RightTreated[i_FirstNeighborTwo] != i_PresentVertex)
+							if(m_vi_RightVertexColors[i_NeighboringVertex] <= _FALSE)
 							{
-								for(k=m_vi_LeftVertices[i_FirstNeighborTwo]; k<m_vi_LeftVertices[STEP_UP(i_FirstNeighborTwo)]; k++)
+								vi_CandidateColors[m_vi_LeftVertexColors[i_SecondNeighboringVertex]] = i_PresentVertex;
+							}
+							else
+							{
+								for(l=m_vi_LeftVertices[i_SecondNeighboringVertex]; l<m_vi_LeftVertices[STEP_UP(i_SecondNeighboringVertex)]; l++)
 								{
-									i_SecondNeighboringVertex = m_vi_Edges[k];
+									i_ThirdNeighboringVertex = m_vi_Edges[l];
 
-									if(i_SecondNeighboringVertex == i_PresentVertex)
+									if(m_vi_RightVertexColors[i_ThirdNeighboringVertex] == _UNKNOWN)
 									{
 										continue;
 									}
 
-									if(m_vi_RightVertexColors[i_SecondNeighboringVertex] == _UNKNOWN)
+									if(m_vi_RightVertexColors[i_ThirdNeighboringVertex] == m_vi_RightVertexColors[i_NeighboringVertex])
 									{
-										continue;
+										vi_CandidateColors[m_vi_LeftVertexColors[i_SecondNeighboringVertex]] = i_PresentVertex;
 									}
-
-									vi_CandidateColors[m_vi_RightVertexColors[i_SecondNeighboringVertex]] = i_PresentVertex;
-
-#if DEBUG == 3561
-
-									cout<<"DEBUG 3561 | Star Bicoloring | Visited Same Color Neighbor | Preventing Color "<<m_vi_RightVertexColors[i_SecondNeighboringVertex]<<" of Right Neighboring Vertex "<<STEP_UP(i_SecondNeighboringVertex)<<" coming from Left Neighboring Vertex "<<STEP_UP(i_FirstNeighborTwo)<<endl;
-
-#endif
-								}
-
-								vi_RightTreated[i_FirstNeighborTwo] = i_PresentVertex;
-							}
-
-							for(k=m_vi_LeftVertices[m_vi_Edges[j]]; k<m_vi_LeftVertices[STEP_UP(m_vi_Edges[j])]; k++)
-							{
-								i_SecondNeighboringVertex = m_vi_Edges[k];
-
-								if(i_SecondNeighboringVertex == i_PresentVertex)
-								{
-									continue;
-								}
-
-								if(m_vi_RightVertexColors[i_SecondNeighboringVertex] == _UNKNOWN)
-								{
-									continue;
-								}
-
-								vi_CandidateColors[m_vi_RightVertexColors[i_SecondNeighboringVertex]] = i_PresentVertex;
-
-#if DEBUG == 3561
-
-								cout<<"DEBUG 3561 | Star Bicoloring | Restricted Same Color Neighbor | Preventing Color "<<m_vi_RightVertexColors[i_SecondNeighboringVertex]<<" of Right Neighboring Vertex "<<STEP_UP(i_SecondNeighboringVertex)<<" coming from Left Neighboring Vertex "<<STEP_UP(m_vi_Edges[j])<<endl;
-
-#endif
-							}
-
-							vi_RightTreated[i_NeighboringVertex] = i_PresentVertex;
-						}
-						else
-						{
-							vi_FirstNeighborOne[i_ColorID] = i_PresentVertex;
-							vi_FirstNeighborTwo[i_ColorID] = i_NeighboringVertex;
-
-							for(k=m_vi_LeftVertices[i_NeighboringVertex]; k<m_vi_LeftVertices[STEP_UP(i_NeighboringVertex)]; k++)
-							{
-								i_SecondNeighboringVertex = m_vi_Edges[k];
-
-								if(i_SecondNeighboringVertex == i_PresentVertex)
-								{
-									continue;
-								}
-
-								if(m_vi_RightVertexColors[i_SecondNeighboringVertex] == _UNKNOWN)
-								{
-									continue;
-								}
-
-								if(vi_RightStarHubMap[vi_EdgeStarMap[m_mimi2_VertexEdgeMap[i_NeighboringVertex][i_SecondNeighboringVertex]]] == i_SecondNeighboringVertex)
-								{
-									vi_CandidateColors[m_vi_RightVertexColors[i_SecondNeighboringVertex]] = i_PresentVertex;
-
-#if DEBUG == 3561
-
-									cout<<"DEBUG 3561 | Star Bicoloring | Restricted Hub Color Neighbor | Preventing Color "<<m_vi_RightVertexColors[i_SecondNeighboringVertex]<<" of Neighboring Vertex "<<STEP_UP(i_SecondNeighboringVertex)<<" coming from Left Neighboring Vertex "<<STEP_UP(i_NeighboringVertex)<<endl;
-
-#endif
 								}
 							}
 						}
 					}
 				}
 
-				for(j=STEP_UP(i_LeftVertexCount); j<m_i_VertexColorCount; j++)
+				for(j=_TRUE; j<STEP_UP(i_LeftVertexCoverSize); j++)
 				{
 					if(vi_CandidateColors[j] != i_PresentVertex)
 					{
-						m_vi_RightVertexColors[i_PresentVertex] = j;
-
-						if(m_i_RightVertexColorCount < j)
-						{
-							m_i_RightVertexColorCount = j;
-						}
+						m_vi_LeftVertexColors[i_PresentVertex] = j;
 
-						for(k=m_vi_RightVertices[i_PresentVertex]; k<m_vi_RightVertices[STEP_UP(i_PresentVertex)]; k++)
+						if(m_i_LeftVertexColorCount < j)
 						{
-							i_PresentEdge = m_mimi2_VertexEdgeMap[m_vi_Edges[k]][i_PresentVertex];
-
-							if(vi_IncludedEdges[i_PresentEdge] == _FALSE)
-							{
-								vi_IncludedEdges[i_PresentEdge] = _TRUE;
-
-								i_IncludedEdgeCount++;
-							}
+							m_i_LeftVertexColorCount = j;
 						}
 
 						break;
 					}
 				}
+			}
+			else
+			{
+				if(m_vi_IncludedRightVertices[m_vi_OrderedVertices[i] - i_LeftVertexCount] == _FALSE)
+				{
+					continue;
+				}
+
+				i_PresentVertex = m_vi_OrderedVertices[i] - i_LeftVertexCount;
+
+#if DEBUG == 3558
+
+				cout<<"DEBUG 3558 | Star Bicoloring | Present Right Vertex | "<<STEP_UP(i_PresentVertex)<<endl;
+#endif
 
 				for(j=m_vi_RightVertices[i_PresentVertex]; j<m_vi_RightVertices[STEP_UP(i_PresentVertex)]; j++)
 				{
-					_FOUND = _FALSE;
-
 					i_NeighboringVertex = m_vi_Edges[j];
 
-					if(m_vi_LeftVertexColors[i_NeighboringVertex] == _UNKNOWN)
+					i_EdgeID = m_mimi2_VertexEdgeMap[i_NeighboringVertex][i_PresentVertex];
+
+					if(vi_EdgeCodes[i_EdgeID] == 3)
 					{
 						continue;
 					}
@@ -3317,51 +1267,55 @@ namespace ColPack
 					{
 						i_SecondNeighboringVertex = m_vi_Edges[k];
 
-						if(i_SecondNeighboringVertex == i_PresentVertex)
-						{
-							continue;
-						}
-
 						if(m_vi_RightVertexColors[i_SecondNeighboringVertex] == _UNKNOWN)
 						{
-							continue;
-						}
-
-						if(m_vi_RightVertexColors[i_SecondNeighboringVertex] == m_vi_RightVertexColors[i_PresentVertex])
-						{
-							_FOUND = _TRUE;
+							continue;
+						}
 
-							i_StarID = vi_EdgeStarMap[m_mimi2_VertexEdgeMap[i_NeighboringVertex][i_SecondNeighboringVertex]];
+						i_NeighboringEdgeID = m_mimi2_VertexEdgeMap[i_NeighboringVertex][i_SecondNeighboringVertex];
 
-							vi_LeftStarHubMap[i_StarID] = i_NeighboringVertex;
+						if(vi_EdgeCodes[i_NeighboringEdgeID] != 3)
+						{
+							if(m_vi_LeftVertexColors[i_NeighboringVertex] <= _FALSE)
+							{
+								vi_CandidateColors[m_vi_RightVertexColors[i_SecondNeighboringVertex]] = i_PresentVertex;
+							}
+							else
+							{
+								for(l=m_vi_RightVertices[i_SecondNeighboringVertex]; l<m_vi_RightVertices[STEP_UP(i_SecondNeighboringVertex)]; l++)
+								{
+									i_ThirdNeighboringVertex = m_vi_Edges[l];
 
-							vi_EdgeStarMap[m_mimi2_VertexEdgeMap[i_NeighboringVertex][i_PresentVertex]] = i_StarID;
+									if(m_vi_LeftVertexColors[i_ThirdNeighboringVertex] == _UNKNOWN)
+									{
+										continue;
+									}
 
-							break;
+									if(m_vi_LeftVertexColors[i_ThirdNeighboringVertex] == m_vi_LeftVertexColors[i_NeighboringVertex])
+									{
+										vi_CandidateColors[m_vi_RightVertexColors[i_SecondNeighboringVertex]] = i_PresentVertex;
+									}
+								}
+							}
 						}
 					}
+				}
 
-					if (!_FOUND)
+				for(j=STEP_UP(i_LeftVertexCoverSize); j<m_i_VertexColorCount; j++)
+				{
+					if(vi_CandidateColors[j] != i_PresentVertex)
 					{
-						i_FirstNeighborOne = vi_FirstNeighborOne[m_vi_LeftVertexColors[i_NeighboringVertex]];
-						i_FirstNeighborTwo = vi_FirstNeighborTwo[m_vi_LeftVertexColors[i_NeighboringVertex]];
+						m_vi_RightVertexColors[i_PresentVertex] = j;
 
-						if((i_FirstNeighborOne == i_PresentVertex) && (i_FirstNeighborTwo != i_NeighboringVertex))
+						if(m_i_RightVertexColorCount < j)
 						{
-							i_StarID = vi_EdgeStarMap[m_mimi2_VertexEdgeMap[i_FirstNeighborTwo][i_PresentVertex]];
-
-							vi_RightStarHubMap[i_StarID] = i_PresentVertex;
-
-							vi_EdgeStarMap[m_mimi2_VertexEdgeMap[i_NeighboringVertex][i_PresentVertex]] = i_StarID;
+							m_i_RightVertexColorCount = j;
 						}
+
+						break;
 					}
 				}
 			}
-
-			if(i_IncludedEdgeCount >= i_EdgeCount)
-			{
-				break;
-			}
 		}
 
 		i_LeftVertexDefaultColor = _FALSE;
@@ -3369,17 +1323,15 @@ namespace ColPack
 
 		for(i=0; i<i_LeftVertexCount; i++)
 		{
-			if(m_vi_LeftVertexColors[i] == _UNKNOWN)
+			if(m_vi_LeftVertexColors[i] == _FALSE)
 			{
-				m_vi_LeftVertexColors[i] = _FALSE;
-
 				i_LeftVertexDefaultColor = _TRUE;
 			}
 		}
 
 		for(i=0; i<i_RightVertexCount; i++)
 		{
-			if(m_vi_RightVertexColors[i] == _UNKNOWN)
+			if(m_vi_RightVertexColors[i] == FALSE)
 			{
 				m_vi_RightVertexColors[i] = m_i_VertexColorCount;
 
@@ -3402,15 +1354,15 @@ namespace ColPack
 		}
 		else
 		{
-			m_i_RightVertexColorCount = m_i_RightVertexColorCount + i_RightVertexDefaultColor - i_LeftVertexCount;
+			m_i_RightVertexColorCount = m_i_RightVertexColorCount + i_RightVertexDefaultColor - i_LeftVertexCoverSize;
 		}
 
 		m_i_VertexColorCount = m_i_LeftVertexColorCount + m_i_RightVertexColorCount;
 
-	#if DEBUG == 3561
+#if DEBUG == 3558
 
 		cout<<endl;
-		cout<<"DEBUG 3561 | Star Bicoloring | Vertex Colors | Left Vertices"<<endl;
+		cout<<"DEBUG 3558 | Modified Star Bicoloring | Left Vertex Colors"<<endl;
 		cout<<endl;
 
 		for(i=0; i<i_LeftVertexCount; i++)
@@ -3419,7 +1371,7 @@ namespace ColPack
 		}
 
 		cout<<endl;
-		cout<<"DEBUG 3561 | Star Bicoloring | Vertex Colors | Right Vertices"<<endl;
+		cout<<"DEBUG 3558 | Modified Star Bicoloring | Right Vertex Colors"<<endl;
 		cout<<endl;
 
 		for(i=0; i<i_RightVertexCount; i++)
@@ -3427,16 +1379,21 @@ namespace ColPack
 			cout<<STEP_UP(i)<<"\t"<<" : "<<m_vi_RightVertexColors[i]<<endl;
 		}
 
+		cout<<endl;
+		cout<<"[Total Vertex Colors = "<<m_i_VertexColorCount<<"]"<<endl;
+		cout<<endl;
+
 #endif
 
 		return(_TRUE);
 	}
 
 
-	//Public Function 3562
-	int BipartiteGraphBicoloring::ImplicitCoveringStarBicoloring()
+
+	//Public Function 3559
+	int BipartiteGraphBicoloring::ExplicitCoveringStarBicoloring()
 	{
-		if(CheckVertexColoring("IMPLICIT_COVER_STAR"))
+		if(CheckVertexColoring("EXPLICIT_COVER_STAR"))
 		{
 			return(_TRUE);
 		}
@@ -3447,17 +1404,17 @@ namespace ColPack
 
 		int i_ColorID, i_StarID;
 
-		int i_EdgeCount, i_IncludedEdgeCount;
+		int i_EdgeCount;
+
+		int i_OrderedVertexCount;
 
 		int i_FirstNeighborOne, i_FirstNeighborTwo;
 
 		int i_LeftVertexCount, i_RightVertexCount;
 
-		int i_PresentVertex, i_NeighboringVertex, i_SecondNeighboringVertex;
-
-		int i_PresentEdge;
+		int i_LeftVertexCoverSize, i_RightVertexCoverSize;
 
-		vector<int> vi_IncludedEdges;
+		int i_PresentVertex, i_NeighboringVertex, i_SecondNeighboringVertex;
 
 		vector<int> vi_CandidateColors;
 
@@ -3477,33 +1434,45 @@ namespace ColPack
 
 		m_mimi2_VertexEdgeMap.clear();
 
-		i_IncludedEdgeCount =_FALSE;
+		k=_FALSE;
 
 		for(i=0; i<i_LeftVertexCount; i++)
 		{
 			for(j=m_vi_LeftVertices[i]; j<m_vi_LeftVertices[STEP_UP(i)]; j++)
 			{
-				m_mimi2_VertexEdgeMap[i][m_vi_Edges[j]] = i_IncludedEdgeCount;
+				m_mimi2_VertexEdgeMap[i][m_vi_Edges[j]] = k;
 
-				vi_EdgeStarMap[i_IncludedEdgeCount] = i_IncludedEdgeCount;
+				vi_EdgeStarMap[k] = k;
 
-				i_IncludedEdgeCount++;
+				k++;
 			}
 		}
 
-		m_i_VertexColorCount = STEP_UP(i_LeftVertexCount +  i_RightVertexCount);
+		Timer m_T_Timer;
 
-		vi_IncludedEdges.clear();
-		vi_IncludedEdges.resize((unsigned) i_EdgeCount, _FALSE);
+		m_T_Timer.Start();
 
-		vi_CandidateColors.clear();
-		vi_CandidateColors.resize((unsigned) m_i_VertexColorCount, _UNKNOWN);
+		CoverVertex();
 
-		m_vi_LeftVertexColors.clear();
-		m_vi_LeftVertexColors.resize((unsigned) i_LeftVertexCount, _UNKNOWN);
+		m_T_Timer.Stop();
 
-		m_vi_RightVertexColors.clear();
-		m_vi_RightVertexColors.resize((unsigned) i_RightVertexCount, _UNKNOWN);
+		m_d_CoveringTime = m_T_Timer.GetWallTime();
+
+		PresetCoveredVertexColors();
+
+#if DEBUG == 3559
+
+		cout<<"DEBUG 3559 | Combined Star Bicoloring | Left Vertex Cover Size = "<<m_vi_CoveredLeftVertices.size()<<"; Right Vertex Cover Size = "<<m_vi_CoveredRightVertices.size()<<endl;
+
+#endif
+
+		i_LeftVertexCoverSize = (signed) m_vi_CoveredLeftVertices.size();
+		i_RightVertexCoverSize = (signed) m_vi_CoveredRightVertices.size();
+
+		m_i_VertexColorCount = STEP_UP(i_LeftVertexCoverSize +  i_RightVertexCoverSize);
+
+		vi_CandidateColors.clear();
+		vi_CandidateColors.resize((unsigned) m_i_VertexColorCount, _UNKNOWN);
 
 		vi_LeftStarHubMap.clear();
 		vi_LeftStarHubMap.resize((unsigned) i_EdgeCount, _UNKNOWN);
@@ -3523,51 +1492,53 @@ namespace ColPack
 		vi_RightTreated.clear();
 		vi_RightTreated.resize((unsigned) i_LeftVertexCount, _UNKNOWN);
 
-		i_IncludedEdgeCount = _FALSE;
+#if DEBUG == 3559
 
-		m_i_LeftVertexColorCount = m_i_RightVertexColorCount = _UNKNOWN;
+		cout<<endl;
+		cout<<"DEBUG 3559 | Star Bicoloring | Initial Vertex Colors | Left Vertices"<<endl;
+		cout<<endl;
 
-		for(i=0; i<i_LeftVertexCount + i_RightVertexCount; i++)
+		for(i=0; i<i_LeftVertexCount; i++)
 		{
+			cout<<STEP_UP(i)<<"\t"<<" : "<<m_vi_LeftVertexColors[i]<<" ["<<m_vi_IncludedLeftVertices[i]<<"]"<<endl;
+		}
 
-#if DEBUG == 3562
-
-			cout<<"DEBUG 3562 | Star Bicoloring | Present Vertex | "<<STEP_UP(m_vi_OrderedVertices[i])<<endl;
-
-#endif
+		cout<<endl;
+		cout<<"DEBUG 3559 | Star Bicoloring | Initial Vertex Colors | Right Vertices"<<endl;
+		cout<<endl;
 
-			if(m_vi_OrderedVertices[i] < i_LeftVertexCount)
-			{
-				i_PresentVertex = m_vi_OrderedVertices[i];
+		for(i=0; i<i_RightVertexCount; i++)
+		{
+			cout<<STEP_UP(i)<<"\t"<<" : "<<m_vi_RightVertexColors[i]<<" ["<<m_vi_IncludedRightVertices[i]<<"]"<<endl;
+		}
 
-				_FOUND = _FALSE;
+		cout<<endl;
 
-				for(j= m_vi_LeftVertices[i_PresentVertex]; j<m_vi_LeftVertices[STEP_UP(i_PresentVertex)]; j++)
-				{
-					i_PresentEdge = m_mimi2_VertexEdgeMap[i_PresentVertex][m_vi_Edges[j]];
+#endif
 
-					if(vi_IncludedEdges[i_PresentEdge] == _FALSE)
-					{
-						_FOUND = _TRUE;
+		i_OrderedVertexCount = (signed) m_vi_OrderedVertices.size();
 
-						break;
-					}
-				}
+		for(i=0; i<i_OrderedVertexCount; i++)
+		{
 
-				if(_FOUND == _FALSE)
-				{
+#if DEBUG == 3559
 
-#if DEBUG == 3562
+			cout<<"DEBUG 3559 | Star Bicoloring | Present Vertex | "<<STEP_UP(m_vi_OrderedVertices[i])<<endl;
 
-					cout<<"DEBUG 3562 | Star Bicoloring | Ignored Present Left Vertex | "<<STEP_UP(i_PresentVertex)<<endl;
 #endif
 
+			if(m_vi_OrderedVertices[i] < i_LeftVertexCount)
+			{
+				if(m_vi_IncludedLeftVertices[m_vi_OrderedVertices[i]] == _FALSE)
+				{
 					continue;
 				}
 
-#if DEBUG == 3562
+				i_PresentVertex = m_vi_OrderedVertices[i];
+
+#if DEBUG == 3559
 
-				cout<<"DEBUG 3562 | Star Bicoloring | Present Left Vertex | "<<STEP_UP(i_PresentVertex)<<endl;
+				cout<<"DEBUG 3559 | Star Bicoloring | Present Left Vertex | "<<STEP_UP(i_PresentVertex)<<endl;
 #endif
 
 				for(j=m_vi_LeftVertices[i_PresentVertex]; j<m_vi_LeftVertices[STEP_UP(i_PresentVertex)]; j++)
@@ -3577,22 +1548,25 @@ namespace ColPack
 					i_ColorID = m_vi_RightVertexColors[i_NeighboringVertex];
 
 					if(i_ColorID == _UNKNOWN)
+					{
+						continue;
+					}
+
+					if(i_ColorID == _FALSE)
 					{
 						for(k=m_vi_RightVertices[i_NeighboringVertex]; k<m_vi_RightVertices[STEP_UP(i_NeighboringVertex)]; k++)
 						{
 							i_SecondNeighboringVertex = m_vi_Edges[k];
 
-							if(i_SecondNeighboringVertex == i_PresentVertex)
+							if(m_vi_LeftVertexColors[i_SecondNeighboringVertex] == _UNKNOWN)
 							{
 								continue;
 							}
 
-							if(m_vi_LeftVertexColors[i_SecondNeighboringVertex] == _UNKNOWN)
+							if(m_vi_LeftVertexColors[i_SecondNeighboringVertex] != _FALSE)
 							{
-								continue;
+								vi_CandidateColors[m_vi_LeftVertexColors[i_SecondNeighboringVertex]] = i_PresentVertex;
 							}
-
-							vi_CandidateColors[m_vi_LeftVertexColors[i_SecondNeighboringVertex]] = i_PresentVertex;
 						}
 					}
 					else
@@ -3606,25 +1580,18 @@ namespace ColPack
 							{
 								for(k=m_vi_RightVertices[i_FirstNeighborTwo]; k<m_vi_RightVertices[STEP_UP(i_FirstNeighborTwo)]; k++)
 								{
-									i_SecondNeighboringVertex = m_vi_Edges[k];
-
-									if(i_SecondNeighboringVertex == i_PresentVertex)
+									if(m_vi_Edges[k] == i_PresentVertex)
 									{
 										continue;
 									}
 
-									if(m_vi_LeftVertexColors[i_SecondNeighboringVertex] == _UNKNOWN)
+									if(m_vi_LeftVertexColors[m_vi_Edges[k]] == _UNKNOWN)
 									{
 										continue;
 									}
 
-									vi_CandidateColors[m_vi_LeftVertexColors[i_SecondNeighboringVertex]] = i_PresentVertex;
-
-#if DEBUG == 3562
-
-									cout<<"DEBUG 3562 | Star Bicoloring | Visited Same Color Neighbor | Preventing Color "<<m_vi_LeftVertexColors[i_SecondNeighboringVertex]<<" of Left Neighboring Vertex "<<STEP_UP(i_SecondNeighboringVertex)<<" coming from Right Neighboring Vertex "<<STEP_UP(i_FirstNeighborTwo)<<endl;
+									vi_CandidateColors[m_vi_LeftVertexColors[m_vi_Edges[k]]] = i_PresentVertex;
 
-#endif
 								}
 
 								vi_LeftTreated[i_FirstNeighborTwo] = i_PresentVertex;
@@ -3632,29 +1599,20 @@ namespace ColPack
 
 							for(k=m_vi_RightVertices[m_vi_Edges[j]]; k<m_vi_RightVertices[STEP_UP(m_vi_Edges[j])]; k++)
 							{
-								i_SecondNeighboringVertex = m_vi_Edges[k];
-
-								if(i_SecondNeighboringVertex == i_PresentVertex)
+								if(m_vi_Edges[k] == i_PresentVertex)
 								{
 									continue;
 								}
 
-								if(m_vi_LeftVertexColors[i_SecondNeighboringVertex] == _UNKNOWN)
+								if(m_vi_LeftVertexColors[m_vi_Edges[k]] == _UNKNOWN)
 								{
 									continue;
 								}
 
-								vi_CandidateColors[m_vi_LeftVertexColors[i_SecondNeighboringVertex]] = i_PresentVertex;
-
-#if DEBUG == 3562
-
-								cout<<"DEBUG 3562 | Star Bicoloring | Restricted Same Color Neighbor | Preventing Color "<<m_vi_LeftVertexColors[i_SecondNeighboringVertex]<<" of Left Neighboring Vertex "<<STEP_UP(i_SecondNeighboringVertex)<<" coming from Right Neighboring Vertex "<<STEP_UP(m_vi_Edges[j])<<endl;
-
-#endif
+								vi_CandidateColors[m_vi_LeftVertexColors[m_vi_Edges[k]]] = i_PresentVertex;
 							}
 
 							vi_LeftTreated[i_NeighboringVertex] = i_PresentVertex;
-
 						}
 						else
 						{
@@ -3667,30 +1625,24 @@ namespace ColPack
 
 								if(i_SecondNeighboringVertex == i_PresentVertex)
 								{
-								  continue;
+									continue;
 								}
 
 								if(m_vi_LeftVertexColors[i_SecondNeighboringVertex] == _UNKNOWN)
 								{
-								  continue;
+									continue;
 								}
 
 								if(vi_LeftStarHubMap[vi_EdgeStarMap[m_mimi2_VertexEdgeMap[i_SecondNeighboringVertex][i_NeighboringVertex]]] == i_SecondNeighboringVertex)
 								{
 									vi_CandidateColors[m_vi_LeftVertexColors[i_SecondNeighboringVertex]] = i_PresentVertex;
-
-#if DEBUG == 3562
-
-									cout<<"DEBUG 3562 | Star Bicoloring | Restricted Hub Color Neighbor | Preventing Color "<<m_vi_LeftVertexColors[i_SecondNeighboringVertex]<<" of Left Neighboring Vertex "<<STEP_UP(i_SecondNeighboringVertex)<<" coming from Right Neighboring Vertex "<<STEP_UP(i_NeighboringVertex)<<endl;
-
-#endif
 								}
 							}
 						}
 					}
 				}
 
-				for(j=_TRUE; j<STEP_UP(i_LeftVertexCount); j++)
+				for(j=_TRUE; j<STEP_UP(i_LeftVertexCoverSize); j++)
 				{
 					if(vi_CandidateColors[j] != i_PresentVertex)
 					{
@@ -3701,21 +1653,9 @@ namespace ColPack
 							m_i_LeftVertexColorCount = j;
 						}
 
-						for(k=m_vi_LeftVertices[i_PresentVertex]; k<m_vi_LeftVertices[STEP_UP(i_PresentVertex)]; k++)
-						{
-							i_PresentEdge = m_mimi2_VertexEdgeMap[i_PresentVertex][m_vi_Edges[k]];
-
-							if(vi_IncludedEdges[i_PresentEdge] == _FALSE)
-							{
-								vi_IncludedEdges[i_PresentEdge] = _TRUE;
-
-								i_IncludedEdgeCount++;
-							}
-						}
-
 						break;
 					}
-				}
+				 }
 
 				for(j=m_vi_LeftVertices[i_PresentVertex]; j<m_vi_LeftVertices[STEP_UP(i_PresentVertex)]; j++)
 				{
@@ -3774,37 +1714,16 @@ namespace ColPack
 			}
 			else
 			{
-				i_PresentVertex = m_vi_OrderedVertices[i] - i_LeftVertexCount;
-
-				_FOUND = _FALSE;
-
-				for(j= m_vi_RightVertices[i_PresentVertex]; j<m_vi_RightVertices[STEP_UP(i_PresentVertex)]; j++)
-				{
-					i_PresentEdge = m_mimi2_VertexEdgeMap[m_vi_Edges[j]][i_PresentVertex];
-
-					if(vi_IncludedEdges[i_PresentEdge] == _FALSE)
-					{
-						_FOUND = _TRUE;
-
-						break;
-					}
-				}
-
-				if(_FOUND == _FALSE)
+				if(m_vi_IncludedRightVertices[m_vi_OrderedVertices[i] - i_LeftVertexCount] == _FALSE)
 				{
-
-#if DEBUG == 3562
-
-					cout<<"DEBUG 3562 | Star Bicoloring | Ignored Present Right Vertex | "<<STEP_UP(i_PresentVertex)<<endl;
-#endif
-
 					continue;
 				}
 
-#if DEBUG == 3562
+				i_PresentVertex = m_vi_OrderedVertices[i] - i_LeftVertexCount;
 
-				cout<<"DEBUG 3562 | Star Bicoloring | Present Right Vertex | "<<STEP_UP(i_PresentVertex)<<endl;
+#if DEBUG == 3559
 
+				cout<<"DEBUG 3559 | Star Bicoloring | Present Right Vertex | "<<STEP_UP(i_PresentVertex)<<endl;
 #endif
 
 				for(j=m_vi_RightVertices[i_PresentVertex]; j<m_vi_RightVertices[STEP_UP(i_PresentVertex)]; j++)
@@ -3813,23 +1732,26 @@ namespace ColPack
 
 					i_ColorID = m_vi_LeftVertexColors[i_NeighboringVertex];
 
-					if(i_ColorID == _UNKNOWN)
+					if(i_ColorID == _UNKNOWN)
+					{
+						continue;
+					}
+
+					if(i_ColorID == _FALSE)
 					{
 						for(k=m_vi_LeftVertices[i_NeighboringVertex]; k<m_vi_LeftVertices[STEP_UP(i_NeighboringVertex)]; k++)
 						{
 							i_SecondNeighboringVertex = m_vi_Edges[k];
 
-							if(i_SecondNeighboringVertex == i_PresentVertex)
+							if(m_vi_RightVertexColors[i_SecondNeighboringVertex] == _UNKNOWN)
 							{
 								continue;
 							}
 
-							if(m_vi_RightVertexColors[i_SecondNeighboringVertex] == _UNKNOWN)
+							if(m_vi_RightVertexColors[i_SecondNeighboringVertex] != _FALSE)
 							{
-								continue;
+								vi_CandidateColors[m_vi_RightVertexColors[i_SecondNeighboringVertex]] = i_PresentVertex;
 							}
-
-							vi_CandidateColors[m_vi_RightVertexColors[i_SecondNeighboringVertex]] = i_PresentVertex;
 						}
 					}
 					else
@@ -3843,25 +1765,18 @@ namespace ColPack
 							{
 								for(k=m_vi_LeftVertices[i_FirstNeighborTwo]; k<m_vi_LeftVertices[STEP_UP(i_FirstNeighborTwo)]; k++)
 								{
-									i_SecondNeighboringVertex = m_vi_Edges[k];
-
-									if(i_SecondNeighboringVertex == i_PresentVertex)
+									if(m_vi_Edges[k] == i_PresentVertex)
 									{
 										continue;
 									}
 
-									if(m_vi_RightVertexColors[i_SecondNeighboringVertex] == _UNKNOWN)
+									if(m_vi_RightVertexColors[m_vi_Edges[k]] == _UNKNOWN)
 									{
 										continue;
 									}
 
-									vi_CandidateColors[m_vi_RightVertexColors[i_SecondNeighboringVertex]] = i_PresentVertex;
-
-#if DEBUG == 3562
-
-									cout<<"DEBUG 3562 | Star Bicoloring | Visited Same Color Neighbor | Preventing Color "<<m_vi_RightVertexColors[i_SecondNeighboringVertex]<<" of Right Neighboring Vertex "<<STEP_UP(i_SecondNeighboringVertex)<<" coming from Left Neighboring Vertex "<<STEP_UP(i_FirstNeighborTwo)<<endl;
+									vi_CandidateColors[m_vi_RightVertexColors[m_vi_Edges[k]]] = i_PresentVertex;
 
-#endif
 								}
 
 								vi_RightTreated[i_FirstNeighborTwo] = i_PresentVertex;
@@ -3869,25 +1784,18 @@ namespace ColPack
 
 							for(k=m_vi_LeftVertices[m_vi_Edges[j]]; k<m_vi_LeftVertices[STEP_UP(m_vi_Edges[j])]; k++)
 							{
-								i_SecondNeighboringVertex = m_vi_Edges[k];
-
-								if(i_SecondNeighboringVertex == i_PresentVertex)
+								if(m_vi_Edges[k] == i_PresentVertex)
 								{
 									continue;
 								}
 
-								if(m_vi_RightVertexColors[i_SecondNeighboringVertex] == _UNKNOWN)
+								if(m_vi_RightVertexColors[m_vi_Edges[k]] == _UNKNOWN)
 								{
 									continue;
 								}
 
-								vi_CandidateColors[m_vi_RightVertexColors[i_SecondNeighboringVertex]] = i_PresentVertex;
-
-#if DEBUG == 3562
-
-								cout<<"DEBUG 3562 | Star Bicoloring | Restricted Same Color Neighbor | Preventing Color "<<m_vi_RightVertexColors[i_SecondNeighboringVertex]<<" of Right Neighboring Vertex "<<STEP_UP(i_SecondNeighboringVertex)<<" coming from Left Neighboring Vertex "<<STEP_UP(m_vi_Edges[j])<<endl;
+								vi_CandidateColors[m_vi_RightVertexColors[m_vi_Edges[k]]] = i_PresentVertex;
 
-#endif
 							}
 
 							vi_RightTreated[i_NeighboringVertex] = i_PresentVertex;
@@ -3915,18 +1823,13 @@ namespace ColPack
 								{
 									vi_CandidateColors[m_vi_RightVertexColors[i_SecondNeighboringVertex]] = i_PresentVertex;
 
-#if DEBUG == 3562
-
-									cout<<"DEBUG 3562 | Star Bicoloring | Restricted Hub Color Neighbor | Preventing Color "<<m_vi_RightVertexColors[i_SecondNeighboringVertex]<<" of Neighboring Vertex "<<STEP_UP(i_SecondNeighboringVertex)<<" coming from Left Neighboring Vertex "<<STEP_UP(i_NeighboringVertex)<<endl;
-
-#endif
 								}
 							}
 						}
 					}
 				}
 
-				for(j=STEP_UP(i_LeftVertexCount); j<m_i_VertexColorCount; j++)
+				for(j=STEP_UP(i_LeftVertexCoverSize); j<m_i_VertexColorCount; j++)
 				{
 					if(vi_CandidateColors[j] != i_PresentVertex)
 					{
@@ -3937,18 +1840,6 @@ namespace ColPack
 							m_i_RightVertexColorCount = j;
 						}
 
-						for(k=m_vi_RightVertices[i_PresentVertex]; k<m_vi_RightVertices[STEP_UP(i_PresentVertex)]; k++)
-						{
-							i_PresentEdge = m_mimi2_VertexEdgeMap[m_vi_Edges[k]][i_PresentVertex];
-
-							if(vi_IncludedEdges[i_PresentEdge] == _FALSE)
-							{
-								vi_IncludedEdges[i_PresentEdge] = _TRUE;
-
-								i_IncludedEdgeCount++;
-							}
-						}
-
 						break;
 					}
 				}
@@ -4008,12 +1899,6 @@ namespace ColPack
 					}
 				}
 			}
-
-			if(i_IncludedEdgeCount >= i_EdgeCount)
-			{
-				break;
-			}
-
 		}
 
 		i_LeftVertexDefaultColor = _FALSE;
@@ -4021,19 +1906,17 @@ namespace ColPack
 
 		for(i=0; i<i_LeftVertexCount; i++)
 		{
-			if(m_vi_LeftVertexColors[i] == _UNKNOWN)
+			if(m_vi_LeftVertexColors[i] == _FALSE)
 			{
-				m_vi_LeftVertexColors[i] = _FALSE;
-
 				i_LeftVertexDefaultColor = _TRUE;
 			}
 		}
 
 		for(i=0; i<i_RightVertexCount; i++)
 		{
-			if(m_vi_RightVertexColors[i] == _UNKNOWN)
+			if(m_vi_RightVertexColors[i] == FALSE)
 			{
-				m_vi_RightVertexColors[i] = m_i_VertexColorCount; // m_i_VertexColorCount == (i_LeftVertexCount +  i_RightVertexCount + 1)
+				m_vi_RightVertexColors[i] = m_i_VertexColorCount;
 
 				i_RightVertexDefaultColor = _TRUE;
 			}
@@ -4054,16 +1937,15 @@ namespace ColPack
 		}
 		else
 		{
-			m_i_RightVertexColorCount = m_i_RightVertexColorCount + i_RightVertexDefaultColor - i_LeftVertexCount;
+			m_i_RightVertexColorCount = m_i_RightVertexColorCount + i_RightVertexDefaultColor - i_LeftVertexCoverSize;
 		}
 
-
 		m_i_VertexColorCount = m_i_LeftVertexColorCount + m_i_RightVertexColorCount;
 
-#if DEBUG == 3562
+#if DEBUG == 3559
 
 		cout<<endl;
-		cout<<"DEBUG 3562 | Star Bicoloring | Vertex Colors | Left Vertices"<<endl;
+		cout<<"DEBUG 3559 | Right Star Bicoloring | Vertex Colors | Left Vertices"<<endl;
 		cout<<endl;
 
 		for(i=0; i<i_LeftVertexCount; i++)
@@ -4072,7 +1954,7 @@ namespace ColPack
 		}
 
 		cout<<endl;
-		cout<<"DEBUG 3562 | Star Bicoloring | Vertex Colors | Right Vertices"<<endl;
+		cout<<"DEBUG 3559 | Right Star Bicoloring | Vertex Colors | Right Vertices"<<endl;
 		cout<<endl;
 
 		for(i=0; i<i_RightVertexCount; i++)
@@ -4083,352 +1965,217 @@ namespace ColPack
 #endif
 
 		return(_TRUE);
+
 }
 
-	//Public Function 3563
-	int BipartiteGraphBicoloring::ImplicitCoveringRestrictedStarBicoloring()
+	//Public Function 3560
+	int BipartiteGraphBicoloring::MinimalCoveringStarBicoloring()
 	{
-		if(CheckVertexColoring("IMPLICIT_COVER_RESTRICTED_STAR"))
+		if(CheckVertexColoring("MINIMAL_COVER_STAR"))
 		{
 			return(_TRUE);
 		}
 
-		int i, j, k;
-
-		int _FOUND;
-
-		int i_ColorID, i_StarID;
-
-		int i_EdgeCount, i_IncludedEdgeCount;
-
-		int i_FirstNeighborOne, i_FirstNeighborTwo;
-
-		int i_LeftVertexCount, i_RightVertexCount;
-
-		int i_PresentVertex, i_NeighboringVertex, i_SecondNeighboringVertex;
-
-		int i_PresentEdge;
-
-		vector<int> vi_IncludedEdges;
-
-		vector<int> vi_CandidateColors;
+		vector<int> vi_CandidateVertices;
 
-		vector<int> vi_EdgeStarMap, vi_LeftStarHubMap, vi_RightStarHubMap;
+		Timer m_T_Timer;
 
-		vector<int> vi_LeftTreated, vi_RightTreated;
+		m_T_Timer.Start();
 
-		vector<int> vi_FirstNeighborOne, vi_FirstNeighborTwo;
+		CoverMinimalVertex();
 
-		i_LeftVertexCount  = STEP_DOWN((signed) m_vi_LeftVertices.size());
-		i_RightVertexCount = STEP_DOWN((signed) m_vi_RightVertices.size());
+		m_T_Timer.Stop();
 
-		i_EdgeCount = (signed) m_vi_Edges.size()/2;
+		m_d_CoveringTime = m_T_Timer.GetWallTime();
 
-		vi_EdgeStarMap.clear();
-		vi_EdgeStarMap.resize((unsigned) i_EdgeCount, _UNKNOWN);
+		GetOrderedCoveredVertices(vi_CandidateVertices, true, true);
 
-		m_mimi2_VertexEdgeMap.clear();
+		return(StarBicoloring(vi_CandidateVertices, false));
+	}
 
-		i_IncludedEdgeCount =_FALSE;
 
-		for(i=0; i<i_LeftVertexCount; i++)
+	//Public Function 3561
+	int BipartiteGraphBicoloring::ImplicitCoveringConservativeStarBicoloring()
+	{
+		if(CheckVertexColoring("IMPLICIT_COVER_CONSERVATIVE_STAR"))
 		{
-			for(j=m_vi_LeftVertices[i]; j<m_vi_LeftVertices[STEP_UP(i)]; j++)
-			{
-				m_mimi2_VertexEdgeMap[i][m_vi_Edges[j]] = i_IncludedEdgeCount;
-
-				vi_EdgeStarMap[i_IncludedEdgeCount] = i_IncludedEdgeCount;
-
-				i_IncludedEdgeCount++;
-			}
+			return(_TRUE);
 		}
 
-		m_i_VertexColorCount = STEP_UP(i_LeftVertexCount +  i_RightVertexCount);
-
-		vi_IncludedEdges.clear();
-		vi_IncludedEdges.resize((unsigned) i_EdgeCount, _FALSE);
-
-		vi_CandidateColors.clear();
-		vi_CandidateColors.resize((unsigned) m_i_VertexColorCount, _UNKNOWN);
-
-		m_vi_LeftVertexColors.clear();
-		m_vi_LeftVertexColors.resize((unsigned) i_LeftVertexCount, _UNKNOWN);
-
-		m_vi_RightVertexColors.clear();
-		m_vi_RightVertexColors.resize((unsigned) i_LeftVertexCount, _UNKNOWN);
-
-		vi_LeftStarHubMap.clear();
-		vi_LeftStarHubMap.resize((unsigned) i_EdgeCount, _UNKNOWN);
-
-		vi_RightStarHubMap.clear();
-		vi_RightStarHubMap.resize((unsigned) i_EdgeCount, _UNKNOWN);
+		int i, j;
 
-		vi_FirstNeighborOne.clear();
-		vi_FirstNeighborOne.resize((unsigned) m_i_VertexColorCount, _UNKNOWN);
+		int i_LeftVertexCount;
 
-		vi_FirstNeighborTwo.clear();
-		vi_FirstNeighborTwo.resize((unsigned) m_i_VertexColorCount, _UNKNOWN);
+		int i_OrderedVertexCount;
 
-		vi_LeftTreated.clear();
-		vi_LeftTreated.resize((unsigned) i_RightVertexCount, _UNKNOWN);
+		int i_PresentVertex;
 
-		vi_RightTreated.clear();
-		vi_RightTreated.resize((unsigned) i_LeftVertexCount, _UNKNOWN);
+		vector<int> vi_CandidateVertices;
 
-		i_IncludedEdgeCount = _FALSE;
+		i_LeftVertexCount  = STEP_DOWN((signed) m_vi_LeftVertices.size());
 
-		m_i_LeftVertexColorCount = m_i_RightVertexColorCount = _UNKNOWN;
+		i_OrderedVertexCount = (signed) m_vi_OrderedVertices.size();
 
-		for(i=0; i<i_LeftVertexCount + i_RightVertexCount; i++)
+		//First pass: the vertices having a neighbor of no larger degree, second pass: all the vertices still having an uncovered edge
+		for(i=0; i<i_OrderedVertexCount; i++)
 		{
-
-#if DEBUG == 3563
-
-			cout<<"DEBUG 3563 | Star Bicoloring | Present Vertex | "<<STEP_UP(m_vi_OrderedVertices[i])<<endl;
-#endif
-
 			if(m_vi_OrderedVertices[i] < i_LeftVertexCount)
 			{
 				i_PresentVertex = m_vi_OrderedVertices[i];
 
-				_FOUND = _FALSE;
-
-				for(j= m_vi_LeftVertices[i_PresentVertex]; j<m_vi_LeftVertices[STEP_UP(i_PresentVertex)]; j++)
+				for(j=m_vi_LeftVertices[i_PresentVertex]; j<m_vi_LeftVertices[STEP_UP(i_PresentVertex)]; j++)
 				{
-					i_PresentEdge = m_mimi2_VertexEdgeMap[i_PresentVertex][m_vi_Edges[j]];
-
-					if(vi_IncludedEdges[i_PresentEdge] == _FALSE)
+					if(m_vi_RightVertices[STEP_UP(m_vi_Edges[j])] - m_vi_RightVertices[m_vi_Edges[j]] <= m_vi_LeftVertices[STEP_UP(i_PresentVertex)] - m_vi_LeftVertices[i_PresentVertex])
 					{
-						_FOUND = _TRUE;
+						vi_CandidateVertices.push_back(m_vi_OrderedVertices[i]);
 
 						break;
 					}
 				}
+			}
+			else
+			{
+				i_PresentVertex = m_vi_OrderedVertices[i] - i_LeftVertexCount;
 
-				if(_FOUND == _FALSE)
-				{
-
-#if DEBUG == 3563
-
-					cout<<"DEBUG 3563 | Star Bicoloring | Ignored Present Left Vertex | "<<STEP_UP(i_PresentVertex)<<endl;
-#endif
-
-					continue;
-				}
-
-#if DEBUG == 3563
-
-				cout<<"DEBUG 3563 | Star Bicoloring | Present Left Vertex | "<<STEP_UP(i_PresentVertex)<<endl;
-
-#endif
-
-				for(j=m_vi_LeftVertices[i_PresentVertex]; j<m_vi_LeftVertices[STEP_UP(i_PresentVertex)]; j++)
+				for(j=m_vi_RightVertices[i_PresentVertex]; j<m_vi_RightVertices[STEP_UP(i_PresentVertex)]; j++)
 				{
-					i_NeighboringVertex = m_vi_Edges[j];
-
-					i_ColorID = m_vi_RightVertexColors[i_NeighboringVertex];
-
-					if(i_ColorID == _UNKNOWN)
+					if(m_vi_LeftVertices[STEP_UP(m_vi_Edges[j])] - m_vi_LeftVertices[m_vi_Edges[j]] < m_vi_RightVertices[STEP_UP(i_PresentVertex)] - m_vi_RightVertices[i_PresentVertex])
 					{
-						for(k=m_vi_RightVertices[i_NeighboringVertex]; k<m_vi_RightVertices[STEP_UP(i_NeighboringVertex)]; k++)
-						{
-							i_SecondNeighboringVertex = m_vi_Edges[k];
-
-							if(m_vi_LeftVertexColors[i_SecondNeighboringVertex] == _UNKNOWN)
-							{
-								continue;
-							}
-
-							vi_CandidateColors[m_vi_LeftVertexColors[i_SecondNeighboringVertex]] = i_PresentVertex;
-						}
+						vi_CandidateVertices.push_back(m_vi_OrderedVertices[i]);
 
-						continue;
+						break;
 					}
-					else
-					{
-						i_FirstNeighborOne = vi_FirstNeighborOne[i_ColorID];
-						i_FirstNeighborTwo = vi_FirstNeighborTwo[i_ColorID];
+				}
+			}
+		}
 
-						if(i_FirstNeighborOne == i_PresentVertex)
-						{
-							if(vi_LeftTreated[i_FirstNeighborTwo] != i_PresentVertex)
-							{
-								for(k=m_vi_RightVertices[i_FirstNeighborTwo]; k<m_vi_RightVertices[STEP_UP(i_FirstNeighborTwo)]; k++)
-								{
-									i_SecondNeighboringVertex = m_vi_Edges[k];
+		vi_CandidateVertices.insert(vi_CandidateVertices.end(), m_vi_OrderedVertices.begin(), m_vi_OrderedVertices.end());
 
-									if(i_SecondNeighboringVertex == i_PresentVertex)
-									{
-										continue;
-									}
+		return(StarBicoloring(vi_CandidateVertices, true));
+	}
 
-									if(m_vi_LeftVertexColors[i_SecondNeighboringVertex] == _UNKNOWN)
-									{
-										continue;
-									}
 
-									vi_CandidateColors[m_vi_LeftVertexColors[i_SecondNeighboringVertex]] = i_PresentVertex;
+	//Public Function 3562
+	int BipartiteGraphBicoloring::ImplicitCoveringStarBicoloring()
+	{
+		if(CheckVertexColoring("IMPLICIT_COVER_STAR"))
+		{
+			return(_TRUE);
+		}
 
-#if DEBUG == 3563
+		return(StarBicoloring(m_vi_OrderedVertices, true));
+	}
 
-									cout<<"DEBUG 3563 | Star Bicoloring | Visited Same Color Neighbor | Preventing Color "<<m_vi_LeftVertexColors[i_SecondNeighboringVertex]<<" of Left Neighboring Vertex "<<STEP_UP(i_SecondNeighboringVertex)<<" coming from Right Neighboring Vertex "<<STEP_UP(i_FirstNeighborTwo)<<endl;
 
-#endif
-								}
+	//Public Function 3563
+	int BipartiteGraphBicoloring::ImplicitCoveringRestrictedStarBicoloring()
+	{
+		if(CheckVertexColoring("IMPLICIT_COVER_RESTRICTED_STAR"))
+		{
+			return(_TRUE);
+		}
 
-								vi_LeftTreated[i_FirstNeighborTwo] = i_PresentVertex;
-							}
+		vector<int> vi_CandidateVertices;
 
-							for(k=m_vi_RightVertices[m_vi_Edges[j]]; k<m_vi_RightVertices[STEP_UP(m_vi_Edges[j])]; k++)
-							{
-								i_SecondNeighboringVertex = m_vi_Edges[k];
+		Timer m_T_Timer;
 
-								if(i_SecondNeighboringVertex == i_PresentVertex)
-								{
-									continue;
-								}
+		m_T_Timer.Start();
+
+		CoverMinimalVertex();
 
-								if(m_vi_LeftVertexColors[i_SecondNeighboringVertex] == _UNKNOWN)
-								{
-									continue;
-								}
+		m_T_Timer.Stop();
 
-								vi_CandidateColors[m_vi_LeftVertexColors[i_SecondNeighboringVertex]] = i_PresentVertex;
+		m_d_CoveringTime = m_T_Timer.GetWallTime();
 
-#if DEBUG == 3563
+		GetOrderedCoveredVertices(vi_CandidateVertices, true, true);
 
-								cout<<"DEBUG 3563 | Star Bicoloring | Restricted Same Color Neighbor | Preventing Color "<<m_vi_LeftVertexColors[i_SecondNeighboringVertex]<<" of Left Neighboring Vertex "<<STEP_UP(i_SecondNeighboringVertex)<<" coming from Right Neighboring Vertex "<<STEP_UP(m_vi_Edges[j])<<endl;
+		return(StarBicoloring(vi_CandidateVertices, true));
+	}
 
-#endif
-							}
 
-							vi_LeftTreated[i_NeighboringVertex] = i_PresentVertex;
-						}
-						else
-						{
-							vi_FirstNeighborOne[i_ColorID] = i_PresentVertex;
-							vi_FirstNeighborTwo[i_ColorID] = i_NeighboringVertex;
+	//Public Function 3564
+	int BipartiteGraphBicoloring::ImplicitCoveringGreedyStarBicoloring()
+	{
+		if(CheckVertexColoring("IMPLICIT_COVER_GREEDY_STAR"))
+		{
+			return(_TRUE);
+		}
 
-							for(k=m_vi_RightVertices[i_NeighboringVertex]; k<m_vi_RightVertices[STEP_UP(i_NeighboringVertex)]; k++)
-							{
-								i_SecondNeighboringVertex = m_vi_Edges[k];
+		int i, j, k, l;
 
-								if(i_SecondNeighboringVertex == i_PresentVertex)
-								{
-									continue;
-								}
+		int _FOUND;
 
-								if(m_vi_LeftVertexColors[i_SecondNeighboringVertex] == _UNKNOWN)
-								{
-									continue;
-								}
+		int i_LeftVertexCount, i_RightVertexCount;
 
-								if(vi_LeftStarHubMap[vi_EdgeStarMap[m_mimi2_VertexEdgeMap[i_SecondNeighboringVertex][i_NeighboringVertex]]] == i_SecondNeighboringVertex)
-								{
-									vi_CandidateColors[m_vi_LeftVertexColors[i_SecondNeighboringVertex]] = i_PresentVertex;
+		int i_OrderedVertexCount;
 
-#if DEBUG == 3563
+		int i_EdgeCount, i_IncludedEdgeCount;
 
-									cout<<"DEBUG 3563 | Star Bicoloring | Restricted Hub Color Neighbor | Preventing Color "<<m_vi_LeftVertexColors[i_SecondNeighboringVertex]<<" of Left Neighboring Vertex "<<STEP_UP(i_SecondNeighboringVertex)<<" coming from Right Neighboring Vertex "<<STEP_UP(i_NeighboringVertex)<<endl;
+		int i_PresentEdge;
 
-#endif
-								}
-							}
-						}
-					}
-				}
+		int i_PresentVertex, i_NeighboringVertex, i_SecondNeighboringVertex, i_ThirdNeighboringVertex;
 
-				for(j=_TRUE; j<STEP_UP(i_LeftVertexCount); j++)
-				{
-					if(vi_CandidateColors[j] != i_PresentVertex)
-					{
-						m_vi_LeftVertexColors[i_PresentVertex] = j;
+		vector<int> vi_CandidateColors;
 
-						if(m_i_LeftVertexColorCount < j)
-						{
-							m_i_LeftVertexColorCount = j;
-						}
+		vector<int> vi_IncludedEdges;
 
-						for(k=m_vi_LeftVertices[i_PresentVertex]; k<m_vi_LeftVertices[STEP_UP(i_PresentVertex)]; k++)
-						{
-							i_PresentEdge = m_mimi2_VertexEdgeMap[i_PresentVertex][m_vi_Edges[k]];
+		i_LeftVertexCount  = STEP_DOWN((signed) m_vi_LeftVertices.size());
+		i_RightVertexCount = STEP_DOWN((signed) m_vi_RightVertices.size());
 
-							if(vi_IncludedEdges[i_PresentEdge] == _FALSE)
-							{
-								vi_IncludedEdges[i_PresentEdge] = _TRUE;
+		i_EdgeCount = (signed) m_vi_Edges.size()/2;
 
-								i_IncludedEdgeCount++;
-							}
-						}
+		m_mimi2_VertexEdgeMap.clear();
 
-						break;
-					}
-				}
+		i_IncludedEdgeCount =_FALSE;
 
-				for(j=m_vi_LeftVertices[i_PresentVertex]; j<m_vi_LeftVertices[STEP_UP(i_PresentVertex)]; j++)
-				{
-					_FOUND = _FALSE;
+		for(i=0; i<i_LeftVertexCount; i++)
+		{
+			for(j=m_vi_LeftVertices[i]; j<m_vi_LeftVertices[STEP_UP(i)]; j++)
+			{
+				m_mimi2_VertexEdgeMap[i][m_vi_Edges[j]] = i_IncludedEdgeCount;
 
-					i_NeighboringVertex = m_vi_Edges[j];
+				i_IncludedEdgeCount++;
+			}
+		}
 
-					if(m_vi_RightVertexColors[i_NeighboringVertex] == _UNKNOWN)
-					{
-						continue;
-					}
+		m_i_VertexColorCount = STEP_UP(i_LeftVertexCount +  i_RightVertexCount);
 
-					for(k=m_vi_RightVertices[i_NeighboringVertex]; k<m_vi_RightVertices[STEP_UP(i_NeighboringVertex)]; k++)
-					{
-						i_SecondNeighboringVertex = m_vi_Edges[k];
+		vi_IncludedEdges.clear();
+		vi_IncludedEdges.resize((unsigned) i_EdgeCount, _FALSE);
 
-						if(i_SecondNeighboringVertex == i_PresentVertex)
-						{
-							continue;
-						}
+		vi_CandidateColors.clear();
+		vi_CandidateColors.resize((unsigned) m_i_VertexColorCount, _UNKNOWN);
 
-						if(m_vi_LeftVertexColors[i_SecondNeighboringVertex] == _UNKNOWN)
-						{
-							continue;
-						}
+		m_vi_LeftVertexColors.clear();
+		m_vi_LeftVertexColors.resize((unsigned) i_LeftVertexCount, _UNKNOWN);
 
-						if(m_vi_LeftVertexColors[i_SecondNeighboringVertex] == m_vi_LeftVertexColors[i_PresentVertex])
-						{
-							_FOUND = _TRUE;
+		m_vi_RightVertexColors.clear();
+		m_vi_RightVertexColors.resize((unsigned) i_RightVertexCount, _UNKNOWN);
 
-							i_StarID = vi_EdgeStarMap[m_mimi2_VertexEdgeMap[i_SecondNeighboringVertex][i_NeighboringVertex]];
+		i_OrderedVertexCount = (signed) m_vi_OrderedVertices.size();
 
-							vi_RightStarHubMap[i_StarID] = i_NeighboringVertex;
+		i_IncludedEdgeCount = _FALSE;
 
-							vi_EdgeStarMap[m_mimi2_VertexEdgeMap[i_PresentVertex][i_NeighboringVertex]] = i_StarID;
+		m_i_LeftVertexColorCount = m_i_RightVertexColorCount = _UNKNOWN;
 
-							break;
-						}
-					}
+		for(i=0; i<i_OrderedVertexCount; i++)
+		{
 
-					if (!_FOUND)
-					{
-						i_FirstNeighborOne = vi_FirstNeighborOne[m_vi_RightVertexColors[i_NeighboringVertex]];
-						i_FirstNeighborTwo = vi_FirstNeighborTwo[m_vi_RightVertexColors[i_NeighboringVertex]];
+#if DEBUG == 3564
 
-						if((i_FirstNeighborOne == i_PresentVertex) && (i_FirstNeighborTwo != i_NeighboringVertex))
-						{
-							i_StarID = vi_EdgeStarMap[m_mimi2_VertexEdgeMap[i_PresentVertex][i_FirstNeighborTwo]];
+			cout<<"DEBUG 3564 | Greedy Star Bicoloring | Present Vertex | "<<STEP_UP(m_vi_OrderedVertices[i])<<endl;
 
-							vi_LeftStarHubMap[i_StarID] = i_PresentVertex;
+#endif
 
-							vi_EdgeStarMap[m_mimi2_VertexEdgeMap[i_PresentVertex][i_NeighboringVertex]] = i_StarID;
-						}
-					}
-				}
-			}
-			else
+			if(m_vi_OrderedVertices[i] < i_LeftVertexCount)
 			{
-				i_PresentVertex = m_vi_OrderedVertices[i] - i_LeftVertexCount;
+				i_PresentVertex = m_vi_OrderedVertices[i];
 
 				_FOUND = _FALSE;
 
-				for(j= m_vi_RightVertices[i_PresentVertex]; j<m_vi_RightVertices[STEP_UP(i_PresentVertex)]; j++)
+				for(j= m_vi_LeftVertices[i_PresentVertex]; j<m_vi_LeftVertices[STEP_UP(i_PresentVertex)]; j++)
 				{
-					i_PresentEdge = m_mimi2_VertexEdgeMap[m_vi_Edges[j]][i_PresentVertex];
+					i_PresentEdge = m_mimi2_VertexEdgeMap[i_PresentVertex][m_vi_Edges[j]];
 
 					if(vi_IncludedEdges[i_PresentEdge] == _FALSE)
 					{
@@ -4441,150 +2188,71 @@ namespace ColPack
 				if(_FOUND == _FALSE)
 				{
 
-#if DEBUG == 3563
+#if DEBUG == 3564
 
-					 cout<<"DEBUG 3563 | Star Bicoloring | Ignored Present Right Vertex | "<<STEP_UP(i_PresentVertex)<<endl;
+					cout<<"DEBUG 3564 | Greedy Star Bicoloring | Ignored Present Left Vertex | "<<STEP_UP(i_PresentVertex)<<endl;
 #endif
 
 					continue;
 				}
 
-#if DEBUG == 3563
-
-				cout<<"DEBUG 3563 | Star Bicoloring | Present Right Vertex | "<<STEP_UP(i_PresentVertex)<<endl;
+#if DEBUG == 3564
 
+				cout<<"DEBUG 3564 | Greedy Star Bicoloring | Present Left Vertex | "<<STEP_UP(i_PresentVertex)<<endl;
 #endif
 
-				for(j=m_vi_RightVertices[i_PresentVertex]; j<m_vi_RightVertices[STEP_UP(i_PresentVertex)]; j++)
+				for(j=m_vi_LeftVertices[i_PresentVertex]; j<m_vi_LeftVertices[STEP_UP(i_PresentVertex)]; j++)
 				{
 					i_NeighboringVertex = m_vi_Edges[j];
 
-					i_ColorID = m_vi_LeftVertexColors[i_NeighboringVertex];
-
-					if(i_ColorID == _UNKNOWN)
+					for(k=m_vi_RightVertices[i_NeighboringVertex]; k<m_vi_RightVertices[STEP_UP(i_NeighboringVertex)]; k++)
 					{
-						for(k=m_vi_LeftVertices[i_NeighboringVertex]; k<m_vi_LeftVertices[STEP_UP(i_NeighboringVertex)]; k++)
-						{
-							i_SecondNeighboringVertex = m_vi_Edges[k];
-
-							if(m_vi_RightVertexColors[i_SecondNeighboringVertex] == _UNKNOWN)
-							{
-								continue;
-							}
+						i_SecondNeighboringVertex = m_vi_Edges[k];
 
-							vi_CandidateColors[m_vi_RightVertexColors[i_SecondNeighboringVertex]] = i_PresentVertex;
+						if(m_vi_LeftVertexColors[i_SecondNeighboringVertex] == _UNKNOWN)
+						{
+							continue;
 						}
 
-						continue;
-					}
-					else
-					{
-						i_FirstNeighborOne = vi_FirstNeighborOne[i_ColorID];
-						i_FirstNeighborTwo = vi_FirstNeighborTwo[i_ColorID];
-
-						if(i_FirstNeighborOne == i_PresentVertex)
+						if(m_vi_RightVertexColors[i_NeighboringVertex] == _UNKNOWN)
 						{
-							if(vi_RightTreated[i_FirstNeighborTwo] != i_PresentVertex)
-							{
-								for(k=m_vi_LeftVertices[i_FirstNeighborTwo]; k<m_vi_LeftVertices[STEP_UP(i_FirstNeighborTwo)]; k++)
-								{
-									i_SecondNeighboringVertex = m_vi_Edges[k];
-
-									if(i_SecondNeighboringVertex == i_PresentVertex)
-									{
-										continue;
-									}
-
-									if(m_vi_RightVertexColors[i_SecondNeighboringVertex] == _UNKNOWN)
-									{
-										continue;
-									}
-
-									vi_CandidateColors[m_vi_RightVertexColors[i_SecondNeighboringVertex]] = i_PresentVertex;
-
-#if DEBUG == 3563
-
-									cout<<"DEBUG 3563 | Star Bicoloring | Visited Same Color Neighbor | Preventing Color "<<m_vi_RightVertexColors[i_SecondNeighboringVertex]<<" of Right Neighboring Vertex "<<STEP_UP(i_SecondNeighboringVertex)<<" coming from Left Neighboring Vertex "<<STEP_UP(i_FirstNeighborTwo)<<endl;
-
-#endif
-								}
-
-								vi_RightTreated[i_FirstNeighborTwo] = i_PresentVertex;
-							}
-
-							for(k=m_vi_LeftVertices[m_vi_Edges[j]]; k<m_vi_LeftVertices[STEP_UP(m_vi_Edges[j])]; k++)
-							{
-								i_SecondNeighboringVertex = m_vi_Edges[k];
-
-								if(i_SecondNeighboringVertex == i_PresentVertex)
-								{
-									continue;
-								}
-
-								if(m_vi_RightVertexColors[i_SecondNeighboringVertex] == _UNKNOWN)
-								{
-									continue;
-								}
-
-								vi_CandidateColors[m_vi_RightVertexColors[i_SecondNeighboringVertex]] = i_PresentVertex;
-
-#if DEBUG == 3563
-
-								cout<<"DEBUG 3563 | Star Bicoloring | Restricted Same Color Neighbor | Preventing Color "<<m_vi_RightVertexColors[i_SecondNeighboringVertex]<<" of Right Neighboring Vertex "<<STEP_UP(i_SecondNeighboringVertex)<<" coming from Left Neighboring Vertex "<<STEP_UP(m_vi_Edges[j])<<endl;
-
-#endif
-							}
-
-							vi_RightTreated[i_NeighboringVertex] = i_PresentVertex;
+							vi_CandidateColors[m_vi_LeftVertexColors[i_SecondNeighboringVertex]] = i_PresentVertex;
 						}
 						else
 						{
-							vi_FirstNeighborOne[i_ColorID] = i_PresentVertex;
-							vi_FirstNeighborTwo[i_ColorID] = i_NeighboringVertex;
 
-							for(k=m_vi_LeftVertices[i_NeighboringVertex]; k<m_vi_LeftVertices[STEP_UP(i_NeighboringVertex)]; k++)
+							for(l=m_vi_LeftVertices[i_SecondNeighboringVertex]; l<m_vi_LeftVertices[STEP_UP(i_SecondNeighboringVertex)]; l++)
 							{
-								i_SecondNeighboringVertex = m_vi_Edges[k];
-
-								if(i_SecondNeighboringVertex == i_PresentVertex)
-								{
-									continue;
-								}
+								i_ThirdNeighboringVertex = m_vi_Edges[l];
 
-								if(m_vi_RightVertexColors[i_SecondNeighboringVertex] == _UNKNOWN)
+								if(m_vi_RightVertexColors[i_ThirdNeighboringVertex] == _UNKNOWN)
 								{
 									continue;
 								}
 
-								if(vi_RightStarHubMap[vi_EdgeStarMap[m_mimi2_VertexEdgeMap[i_NeighboringVertex][i_SecondNeighboringVertex]]] == i_SecondNeighboringVertex)
+								if(m_vi_RightVertexColors[i_ThirdNeighboringVertex] == m_vi_RightVertexColors[i_NeighboringVertex])
 								{
-									vi_CandidateColors[m_vi_RightVertexColors[i_SecondNeighboringVertex]] = i_PresentVertex;
-
-#if DEBUG == 3563
-
-									cout<<"DEBUG 3563 | Star Bicoloring | Restricted Hub Color Neighbor | Preventing Color "<<m_vi_RightVertexColors[i_SecondNeighboringVertex]<<" of Neighboring Vertex "<<STEP_UP(i_SecondNeighboringVertex)<<" coming from Left Neighboring Vertex "<<STEP_UP(i_NeighboringVertex)<<endl;
-
-#endif
+									vi_CandidateColors[m_vi_LeftVertexColors[i_SecondNeighboringVertex]] = i_PresentVertex;
 								}
 							}
 						}
 					}
 				}
 
-				for(j=STEP_UP(i_LeftVertexCount); j<m_i_VertexColorCount; j++)
+				for(j=_TRUE; j<STEP_UP(i_LeftVertexCount); j++)
 				{
 					if(vi_CandidateColors[j] != i_PresentVertex)
 					{
-						m_vi_RightVertexColors[i_PresentVertex] = j;
+						m_vi_LeftVertexColors[i_PresentVertex] = j;
 
-						if(m_i_RightVertexColorCount < j)
+						if(m_i_LeftVertexColorCount < j)
 						{
-							m_i_RightVertexColorCount = j;
+							m_i_LeftVertexColorCount = j;
 						}
 
-						for(k=m_vi_RightVertices[i_PresentVertex]; k<m_vi_RightVertices[STEP_UP(i_PresentVertex)]; k++)
+						for(k=m_vi_LeftVertices[i_PresentVertex]; k<m_vi_LeftVertices[STEP_UP(i_PresentVertex)]; k++)
 						{
-							i_PresentEdge = m_mimi2_VertexEdgeMap[m_vi_Edges[k]][i_PresentVertex];
+							i_PresentEdge = m_mimi2_VertexEdgeMap[i_PresentVertex][m_vi_Edges[k]];
 
 							if(vi_IncludedEdges[i_PresentEdge] == _FALSE)
 							{
@@ -4597,59 +2265,102 @@ namespace ColPack
 						break;
 					}
 				}
+			}
+			else
+			{
+				i_PresentVertex = m_vi_OrderedVertices[i] - i_LeftVertexCount;
 
-				for(j=m_vi_RightVertices[i_PresentVertex]; j<m_vi_RightVertices[STEP_UP(i_PresentVertex)]; j++)
-				{
-					_FOUND = _FALSE;
+				_FOUND = _FALSE;
 
-					i_NeighboringVertex = m_vi_Edges[j];
+				for(j= m_vi_RightVertices[i_PresentVertex]; j<m_vi_RightVertices[STEP_UP(i_PresentVertex)]; j++)
+				{
+					i_PresentEdge = m_mimi2_VertexEdgeMap[m_vi_Edges[j]][i_PresentVertex];
 
-					if(m_vi_LeftVertexColors[i_NeighboringVertex] == _UNKNOWN)
+					if(vi_IncludedEdges[i_PresentEdge] == _FALSE)
 					{
-						continue;
+						_FOUND = _TRUE;
+
+						break;
 					}
+				}
+
+				if(_FOUND == _FALSE)
+				{
+
+#if DEBUG == 3564
+
+					cout<<"DEBUG 3564 | Greedy Star Bicoloring | Ignored Present Right Vertex | "<<STEP_UP(i_PresentVertex)<<endl;
+#endif
+
+					continue;
+				}
+
+#if DEBUG == 3564
+
+				cout<<"DEBUG 3564 | Greedy Star Bicoloring | Present Right Vertex | "<<STEP_UP(i_PresentVertex)<<endl;
+#endif
+
+				for(j=m_vi_RightVertices[i_PresentVertex]; j<m_vi_RightVertices[STEP_UP(i_PresentVertex)]; j++)
+				{
+					i_NeighboringVertex = m_vi_Edges[j];
 
 					for(k=m_vi_LeftVertices[i_NeighboringVertex]; k<m_vi_LeftVertices[STEP_UP(i_NeighboringVertex)]; k++)
 					{
 						i_SecondNeighboringVertex = m_vi_Edges[k];
 
-						if(i_SecondNeighboringVertex == i_PresentVertex)
+						if(m_vi_RightVertexColors[i_SecondNeighboringVertex] == _UNKNOWN)
 						{
 							continue;
 						}
 
-						if(m_vi_RightVertexColors[i_SecondNeighboringVertex] == _UNKNOWN)
+						if(m_vi_LeftVertexColors[i_NeighboringVertex] == _UNKNOWN)
 						{
-							continue;
+							vi_CandidateColors[m_vi_RightVertexColors[i_SecondNeighboringVertex]] = i_PresentVertex;
 						}
-
-						if(m_vi_RightVertexColors[i_SecondNeighboringVertex] == m_vi_RightVertexColors[i_PresentVertex])
+						else
 						{
-							_FOUND = _TRUE;
-
-							i_StarID = vi_EdgeStarMap[m_mimi2_VertexEdgeMap[i_NeighboringVertex][i_SecondNeighboringVertex]];
-
-							vi_LeftStarHubMap[i_StarID] = i_NeighboringVertex;
+							for(l=m_vi_RightVertices[i_SecondNeighboringVertex]; l<m_vi_RightVertices[STEP_UP(i_SecondNeighboringVertex)]; l++)
+							{
+								i_ThirdNeighboringVertex = m_vi_Edges[l];
 
-							vi_EdgeStarMap[m_mimi2_VertexEdgeMap[i_NeighboringVertex][i_PresentVertex]] = i_StarID;
+								if(m_vi_LeftVertexColors[i_ThirdNeighboringVertex] == _UNKNOWN)
+								{
+									continue;
+								}
 
-							break;
+								if(m_vi_LeftVertexColors[i_ThirdNeighboringVertex] == m_vi_LeftVertexColors[i_NeighboringVertex])
+								{
+									vi_CandidateColors[m_vi_RightVertexColors[i_SecondNeighboringVertex]] = i_PresentVertex;
+								}
+							}
 						}
 					}
+				}
 
-					if (!_FOUND)
+				for(j=STEP_UP(i_LeftVertexCount); j<m_i_VertexColorCount; j++)
+				{
+					if(vi_CandidateColors[j] != i_PresentVertex)
 					{
-						i_FirstNeighborOne = vi_FirstNeighborOne[m_vi_LeftVertexColors[i_NeighboringVertex]];
-						i_FirstNeighborTwo = vi_FirstNeighborTwo[m_vi_LeftVertexColors[i_NeighboringVertex]];
+						m_vi_RightVertexColors[i_PresentVertex] = j;
 
-						if((i_FirstNeighborOne == i_PresentVertex) && (i_FirstNeighborTwo != i_NeighboringVertex))
+						if(m_i_RightVertexColorCount < j)
 						{
-							i_StarID = vi_EdgeStarMap[m_mimi2_VertexEdgeMap[i_FirstNeighborTwo][i_PresentVertex]];
+							m_i_RightVertexColorCount = j;
+						}
 
-							vi_RightStarHubMap[i_StarID] = i_PresentVertex;
+						for(k=m_vi_RightVertices[i_PresentVertex]; k<m_vi_RightVertices[STEP_UP(i_PresentVertex)]; k++)
+						{
+							i_PresentEdge = m_mimi2_VertexEdgeMap[m_vi_Edges[k]][i_PresentVertex];
 
-							vi_EdgeStarMap[m_mimi2_VertexEdgeMap[i_NeighboringVertex][i_PresentVertex]] = i_StarID;
+							if(vi_IncludedEdges[i_PresentEdge] == _FALSE)
+							{
+								vi_IncludedEdges[i_PresentEdge] = _TRUE;
+
+								i_IncludedEdgeCount++;
+							}
 						}
+
+						break;
 					}
 				}
 			}
@@ -4701,382 +2412,458 @@ namespace ColPack
 			m_i_RightVertexColorCount = m_i_RightVertexColorCount + i_RightVertexDefaultColor - i_LeftVertexCount;
 		}
 
-
 		m_i_VertexColorCount = m_i_LeftVertexColorCount + m_i_RightVertexColorCount;
 
-#if DEBUG == 3563
+#if DEBUG == 3564
 
 		cout<<endl;
-		cout<<"DEBUG 3563 | Star Bicoloring | Vertex Colors | Left Vertices"<<endl;
+		cout<<"DEBUG 3564 | Greedy Star Bicoloring | Left Vertex Colors"<<endl;
 		cout<<endl;
 
 		for(i=0; i<i_LeftVertexCount; i++)
 		{
-		  cout<<STEP_UP(i)<<"\t"<<" : "<<m_vi_LeftVertexColors[i]<<endl;
+			cout<<STEP_UP(i)<<"\t"<<" : "<<m_vi_LeftVertexColors[i]<<endl;
 		}
 
 		cout<<endl;
-		cout<<"DEBUG 3563 | Star Bicoloring | Vertex Colors | Right Vertices"<<endl;
+		cout<<"DEBUG 3564 | Greedy Star Bicoloring | Right Vertex Colors"<<endl;
 		cout<<endl;
 
 		for(i=0; i<i_RightVertexCount; i++)
 		{
-		  cout<<STEP_UP(i)<<"\t"<<" : "<<m_vi_RightVertexColors[i]<<endl;
+			cout<<STEP_UP(i)<<"\t"<<" : "<<m_vi_RightVertexColors[i]<<endl;
 		}
 
+		cout<<endl;
+		cout<<"[Total Vertex Colors = "<<m_i_VertexColorCount<<"]"<<endl;
+		cout<<endl;
+
 #endif
 
 		return(_TRUE);
 	}
 
 
-	//Public Function 3564
-	int BipartiteGraphBicoloring::ImplicitCoveringGreedyStarBicoloring()
+	//Public Function 3580
+	int BipartiteGraphBicoloring::MatchingCoveringStarBicoloring()
 	{
-		if(CheckVertexColoring("IMPLICIT_COVER_GREEDY_STAR"))
+		if(CheckVertexColoring("MATCHING_COVER_STAR"))
 		{
 			return(_TRUE);
 		}
 
-		int i, j, k, l;
+		vector<int> vi_CandidateVertices;
 
-		int _FOUND;
+		CoverVertex_Matching();
 
-		int i_LeftVertexCount, i_RightVertexCount;
+		GetOrderedCoveredVertices(vi_CandidateVertices, true, true);
 
-		int i_OrderedVertexCount;
+		return(StarBicoloring(vi_CandidateVertices, false));
+	}
 
-		int i_EdgeCount, i_IncludedEdgeCount;
 
-		int i_PresentEdge;
+	//Public Function 3581
+	int BipartiteGraphBicoloring::KonigCoveringStarBicoloring()
+	{
+		if(CheckVertexColoring("KONIG_COVER_STAR"))
+		{
+			return(_TRUE);
+		}
 
-		int i_PresentVertex, i_NeighboringVertex, i_SecondNeighboringVertex, i_ThirdNeighboringVertex;
+		vector<int> vi_CandidateVertices;
 
-		vector<int> vi_CandidateColors;
+		CoverVertex_Konig();
 
-		vector<int> vi_IncludedEdges;
+		GetOrderedCoveredVertices(vi_CandidateVertices, true, true);
 
-		i_LeftVertexCount  = STEP_DOWN((signed) m_vi_LeftVertices.size());
-		i_RightVertexCount = STEP_DOWN((signed) m_vi_RightVertices.size());
+		return(StarBicoloring(vi_CandidateVertices, false));
+	}
 
-		i_EdgeCount = (signed) m_vi_Edges.size()/2;
 
-		m_mimi2_VertexEdgeMap.clear();
+	//Public Function 3582
+	int BipartiteGraphBicoloring::DegreeGreedyCoveringStarBicoloring()
+	{
+		if(CheckVertexColoring("DEGREE_GREEDY_COVER_STAR"))
+		{
+			return(_TRUE);
+		}
 
-		i_IncludedEdgeCount =_FALSE;
+		vector<int> vi_CandidateVertices;
 
-		for(i=0; i<i_LeftVertexCount; i++)
-		{
-			for(j=m_vi_LeftVertices[i]; j<m_vi_LeftVertices[STEP_UP(i)]; j++)
-			{
-				m_mimi2_VertexEdgeMap[i][m_vi_Edges[j]] = i_IncludedEdgeCount;
+		CoverVertex_DegreeGreedy();
 
-				i_IncludedEdgeCount++;
-			}
-		}
+		GetOrderedCoveredVertices(vi_CandidateVertices, true, true);
 
-		m_i_VertexColorCount = STEP_UP(i_LeftVertexCount +  i_RightVertexCount);
+		return(StarBicoloring(vi_CandidateVertices, false));
+	}
 
-		vi_IncludedEdges.clear();
-		vi_IncludedEdges.resize((unsigned) i_EdgeCount, _FALSE);
 
-		vi_CandidateColors.clear();
-		vi_CandidateColors.resize((unsigned) m_i_VertexColorCount, _UNKNOWN);
+	//Public Function 3578
+	int BipartiteGraphBicoloring::ExplicitCoveringStarBicoloring_OMP()
+	{
+		if(CheckVertexColoring("EXPLICIT_COVER_STAR_OMP"))
+		{
+			return(_TRUE);
+		}
 
-		m_vi_LeftVertexColors.clear();
-		m_vi_LeftVertexColors.resize((unsigned) i_LeftVertexCount, _UNKNOWN);
+		int i_LeftVertexCount  = STEP_DOWN((signed) m_vi_LeftVertices.size());
+		int i_RightVertexCount = STEP_DOWN((signed) m_vi_RightVertices.size());
 
-		m_vi_RightVertexColors.clear();
-		m_vi_RightVertexColors.resize((unsigned) i_RightVertexCount, _UNKNOWN);
+		//A nonzero (i, j) is recovered from the row compressed Jacobian if deg(i) >= deg(j), else from the column compressed one
+		vector<int> vi_LeftVertexDegree(i_LeftVertexCount), vi_RightVertexDegree(i_RightVertexCount);
 
-		i_OrderedVertexCount = (signed) m_vi_OrderedVertices.size();
+		vector<int> vi_IncludedLeftVertices(i_LeftVertexCount, _FALSE), vi_IncludedRightVertices(i_RightVertexCount, _FALSE);
 
-		i_IncludedEdgeCount = _FALSE;
+		long long ll_MaxLeftDegree = 0, ll_MaxRightDegree = 0;
 
-		m_i_LeftVertexColorCount = m_i_RightVertexColorCount = _UNKNOWN;
+#ifdef _OPENMP
+		#pragma omp parallel for reduction(max:ll_MaxLeftDegree)
+#endif
+		for(int i=0; i<i_LeftVertexCount; i++)
+		{
+			vi_LeftVertexDegree[i] = m_vi_LeftVertices[STEP_UP(i)] - m_vi_LeftVertices[i];
 
-		for(i=0; i<i_OrderedVertexCount; i++)
+			if(ll_MaxLeftDegree < vi_LeftVertexDegree[i]) ll_MaxLeftDegree = vi_LeftVertexDegree[i];
+		}
+
+#ifdef _OPENMP
+		#pragma omp parallel for reduction(max:ll_MaxRightDegree)
+#endif
+		for(int i=0; i<i_RightVertexCount; i++)
 		{
+			vi_RightVertexDegree[i] = m_vi_RightVertices[STEP_UP(i)] - m_vi_RightVertices[i];
 
-#if DEBUG == 3564
+			if(ll_MaxRightDegree < vi_RightVertexDegree[i]) ll_MaxRightDegree = vi_RightVertexDegree[i];
+		}
 
-			cout<<"DEBUG 3564 | Greedy Star Bicoloring | Present Vertex | "<<STEP_UP(m_vi_OrderedVertices[i])<<endl;
+		//The cover: a row holding a nonzero recovered by rows, a column holding a nonzero recovered by columns
+		Timer m_T_Timer;
 
-#endif
+		m_T_Timer.Start();
 
-			if(m_vi_OrderedVertices[i] < i_LeftVertexCount)
+#ifdef _OPENMP
+		#pragma omp parallel for schedule(dynamic, 64)
+#endif
+		for(int i=0; i<i_LeftVertexCount; i++)
+		{
+			for(int j=m_vi_LeftVertices[i]; j<m_vi_LeftVertices[STEP_UP(i)]; j++)
 			{
-				i_PresentVertex = m_vi_OrderedVertices[i];
+				if(vi_LeftVertexDegree[i] >= vi_RightVertexDegree[m_vi_Edges[j]])
+				{
+					vi_IncludedLeftVertices[i] = _TRUE;
 
-				_FOUND = _FALSE;
+					break;
+				}
+			}
+		}
 
-				for(j= m_vi_LeftVertices[i_PresentVertex]; j<m_vi_LeftVertices[STEP_UP(i_PresentVertex)]; j++)
+#ifdef _OPENMP
+		#pragma omp parallel for schedule(dynamic, 64)
+#endif
+		for(int i=0; i<i_RightVertexCount; i++)
+		{
+			for(int j=m_vi_RightVertices[i]; j<m_vi_RightVertices[STEP_UP(i)]; j++)
+			{
+				if(vi_LeftVertexDegree[m_vi_Edges[j]] < vi_RightVertexDegree[i])
 				{
-					i_PresentEdge = m_mimi2_VertexEdgeMap[i_PresentVertex][m_vi_Edges[j]];
-
-					if(vi_IncludedEdges[i_PresentEdge] == _FALSE)
-					{
-						_FOUND = _TRUE;
+					vi_IncludedRightVertices[i] = _TRUE;
 
-						break;
-					}
+					break;
 				}
+			}
+		}
 
-				if(_FOUND == _FALSE)
-				{
+		m_vi_IncludedLeftVertices = vi_IncludedLeftVertices;
+		m_vi_IncludedRightVertices = vi_IncludedRightVertices;
 
-#if DEBUG == 3564
+		m_vi_CoveredLeftVertices.clear();
+		m_vi_CoveredRightVertices.clear();
 
-					cout<<"DEBUG 3564 | Greedy Star Bicoloring | Ignored Present Left Vertex | "<<STEP_UP(i_PresentVertex)<<endl;
+		for(int i=0; i<i_LeftVertexCount; i++)
+		{
+			if(vi_IncludedLeftVertices[i] == _TRUE) m_vi_CoveredLeftVertices.push_back(i);
+		}
+
+		for(int i=0; i<i_RightVertexCount; i++)
+		{
+			if(vi_IncludedRightVertices[i] == _TRUE) m_vi_CoveredRightVertices.push_back(i);
+		}
+
+		m_T_Timer.Stop();
+
+		m_d_CoveringTime = m_T_Timer.GetWallTime();
+
+		int i_LeftVertexCoverSize = (signed) m_vi_CoveredLeftVertices.size();
+		int i_RightVertexCoverSize = (signed) m_vi_CoveredRightVertices.size();
+
+		//0 based colors of the covered vertices, _UNKNOWN while uncolored
+		vector<int> vi_LeftVertexColors(i_LeftVertexCount, _UNKNOWN), vi_RightVertexColors(i_RightVertexCount, _UNKNOWN);
+
+		//Same first fit bound as PartialDistanceTwoColoring_OMP on each side
+		int i_PaletteSize = (int) STEP_UP(max(min((long long) i_LeftVertexCoverSize, ll_MaxLeftDegree * ll_MaxRightDegree), min((long long) i_RightVertexCoverSize, ll_MaxLeftDegree * ll_MaxRightDegree)));
+
+		//Covered rows and columns in the given order, the columns shifted by the number of rows
+		vector<int> vi_VerticesToBeColored, vi_VerticesNeedNewColor(i_LeftVertexCoverSize + i_RightVertexCoverSize);
+
+		vi_VerticesToBeColored.reserve(i_LeftVertexCoverSize + i_RightVertexCoverSize);
+
+		for(int i=0; i<(signed) m_vi_OrderedVertices.size(); i++)
+		{
+			int v = m_vi_OrderedVertices[i];
+
+			if((v < i_LeftVertexCount) ? (vi_IncludedLeftVertices[v] == _TRUE) : (vi_IncludedRightVertices[v - i_LeftVertexCount] == _TRUE))
+			{
+				vi_VerticesToBeColored.push_back(v);
+			}
+		}
+
+		vi_VerticesToBeColored.resize(i_LeftVertexCoverSize + i_RightVertexCoverSize);
+
+		int i_NumOfVerticesToBeColored = (signed) vi_VerticesToBeColored.size();
+
+		int i_MaxNumThreads;
+#ifdef _OPENMP
+		i_MaxNumThreads = omp_get_max_threads();
+#else
+		i_MaxNumThreads = 1;
 #endif
 
-					continue;
-				}
+		//vi_QueueStart[t+1] is first the size of the conflict queue of thread t, then the prefix sum
+		vector<int> vi_QueueStart(STEP_UP(i_MaxNumThreads), _FALSE);
 
-#if DEBUG == 3564
+		m_i_ColoringRounds = _FALSE;
 
-				cout<<"DEBUG 3564 | Greedy Star Bicoloring | Present Left Vertex | "<<STEP_UP(i_PresentVertex)<<endl;
+		int i_LeftColorMax = _UNKNOWN, i_RightColorMax = _UNKNOWN;
+
+#ifdef _OPENMP
+		#pragma omp parallel reduction(max:i_LeftColorMax, i_RightColorMax)
+#endif
+		{
+			int i_thread_num, i_NumThreads;
+#ifdef _OPENMP
+			i_thread_num = omp_get_thread_num();
+			i_NumThreads = omp_get_num_threads();
+#else
+			i_thread_num = 0;
+			i_NumThreads = 1;
 #endif
+			vector<int> vi_ForbiddenColors(i_PaletteSize, _UNKNOWN);
+			vector<int> vi_Conflicts;
+			int i_Stamp = _UNKNOWN;
 
-				for(j=m_vi_LeftVertices[i_PresentVertex]; j<m_vi_LeftVertices[STEP_UP(i_PresentVertex)]; j++)
+			while(i_NumOfVerticesToBeColored != 0)
+			{
+				//Phase 1: tentative coloring. Two covered rows sharing column j conflict unless both nonzeros in column j are recovered by columns, and conversely
+#ifdef _OPENMP
+				#pragma omp for schedule(dynamic, 64)
+#endif
+				for(int i=0; i<i_NumOfVerticesToBeColored; i++)
 				{
-					i_NeighboringVertex = m_vi_Edges[j];
+					int v = vi_VerticesToBeColored[i];
 
-					for(k=m_vi_RightVertices[i_NeighboringVertex]; k<m_vi_RightVertices[STEP_UP(i_NeighboringVertex)]; k++)
-					{
-						i_SecondNeighboringVertex = m_vi_Edges[k];
+					i_Stamp++;
 
-						if(m_vi_LeftVertexColors[i_SecondNeighboringVertex] == _UNKNOWN)
+					if(v < i_LeftVertexCount)
+					{
+						for(int w=m_vi_LeftVertices[v]; w<m_vi_LeftVertices[STEP_UP(v)]; w++)
 						{
-							continue;
-						}
+							int i_Column = m_vi_Edges[w];
 
-						if(m_vi_RightVertexColors[i_NeighboringVertex] == _UNKNOWN)
-						{
-							vi_CandidateColors[m_vi_LeftVertexColors[i_SecondNeighboringVertex]] = i_PresentVertex;
-						}
-						else
-						{
+							bool b_ByRows = vi_LeftVertexDegree[v] >= vi_RightVertexDegree[i_Column];
 
-							for(l=m_vi_LeftVertices[i_SecondNeighboringVertex]; l<m_vi_LeftVertices[STEP_UP(i_SecondNeighboringVertex)]; l++)
+							for(int x=m_vi_RightVertices[i_Column]; x<m_vi_RightVertices[STEP_UP(i_Column)]; x++)
 							{
-								i_ThirdNeighboringVertex = m_vi_Edges[l];
-
-								if(m_vi_RightVertexColors[i_ThirdNeighboringVertex] == _UNKNOWN)
-								{
-									continue;
-								}
+								int u = m_vi_Edges[x];
 
-								if(m_vi_RightVertexColors[i_ThirdNeighboringVertex] == m_vi_RightVertexColors[i_NeighboringVertex])
+								if((u != v) && (vi_LeftVertexColors[u] != _UNKNOWN) && (b_ByRows || (vi_LeftVertexDegree[u] >= vi_RightVertexDegree[i_Column])))
 								{
-									vi_CandidateColors[m_vi_LeftVertexColors[i_SecondNeighboringVertex]] = i_PresentVertex;
+									vi_ForbiddenColors[vi_LeftVertexColors[u]] = i_Stamp;
 								}
 							}
 						}
-					}
-				}
 
-				for(j=_TRUE; j<STEP_UP(i_LeftVertexCount); j++)
-				{
-					if(vi_CandidateColors[j] != i_PresentVertex)
-					{
-						m_vi_LeftVertexColors[i_PresentVertex] = j;
+						int c = 0;
 
-						if(m_i_LeftVertexColorCount < j)
+						while(vi_ForbiddenColors[c] == i_Stamp)
 						{
-							m_i_LeftVertexColorCount = j;
+							c++;
 						}
 
-						for(k=m_vi_LeftVertices[i_PresentVertex]; k<m_vi_LeftVertices[STEP_UP(i_PresentVertex)]; k++)
+						vi_LeftVertexColors[v] = c;
+
+						if(i_LeftColorMax < c) i_LeftColorMax = c;
+					}
+					else
+					{
+						v -= i_LeftVertexCount;
+
+						for(int w=m_vi_RightVertices[v]; w<m_vi_RightVertices[STEP_UP(v)]; w++)
 						{
-							i_PresentEdge = m_mimi2_VertexEdgeMap[i_PresentVertex][m_vi_Edges[k]];
+							int i_Row = m_vi_Edges[w];
 
-							if(vi_IncludedEdges[i_PresentEdge] == _FALSE)
+							bool b_ByColumns = vi_LeftVertexDegree[i_Row] < vi_RightVertexDegree[v];
+
+							for(int x=m_vi_LeftVertices[i_Row]; x<m_vi_LeftVertices[STEP_UP(i_Row)]; x++)
 							{
-								vi_IncludedEdges[i_PresentEdge] = _TRUE;
+								int u = m_vi_Edges[x];
 
-								i_IncludedEdgeCount++;
+								if((u != v) && (vi_RightVertexColors[u] != _UNKNOWN) && (b_ByColumns || (vi_LeftVertexDegree[i_Row] < vi_RightVertexDegree[u])))
+								{
+									vi_ForbiddenColors[vi_RightVertexColors[u]] = i_Stamp;
+								}
 							}
 						}
 
-						break;
-					}
-				}
-			}
-			else
-			{
-				i_PresentVertex = m_vi_OrderedVertices[i] - i_LeftVertexCount;
-
-				_FOUND = _FALSE;
+						int c = 0;
 
-				for(j= m_vi_RightVertices[i_PresentVertex]; j<m_vi_RightVertices[STEP_UP(i_PresentVertex)]; j++)
-				{
-					i_PresentEdge = m_mimi2_VertexEdgeMap[m_vi_Edges[j]][i_PresentVertex];
+						while(vi_ForbiddenColors[c] == i_Stamp)
+						{
+							c++;
+						}
 
-					if(vi_IncludedEdges[i_PresentEdge] == _FALSE)
-					{
-						_FOUND = _TRUE;
+						vi_RightVertexColors[v] = c;
 
-						break;
+						if(i_RightColorMax < c) i_RightColorMax = c;
 					}
 				}
 
-				if(_FOUND == _FALSE)
-				{
-
-#if DEBUG == 3564
-
-					cout<<"DEBUG 3564 | Greedy Star Bicoloring | Ignored Present Right Vertex | "<<STEP_UP(i_PresentVertex)<<endl;
-#endif
-
-					continue;
-				}
-
-#if DEBUG == 3564
+				//Phase 2: conflict detection, of 2 conflicting vertices with the same color the larger one is recolored
+				vi_Conflicts.clear();
 
-				cout<<"DEBUG 3564 | Greedy Star Bicoloring | Present Right Vertex | "<<STEP_UP(i_PresentVertex)<<endl;
+#ifdef _OPENMP
+				#pragma omp for schedule(dynamic, 64) nowait
 #endif
-
-				for(j=m_vi_RightVertices[i_PresentVertex]; j<m_vi_RightVertices[STEP_UP(i_PresentVertex)]; j++)
+				for(int i=0; i<i_NumOfVerticesToBeColored; i++)
 				{
-					i_NeighboringVertex = m_vi_Edges[j];
+					int v = vi_VerticesToBeColored[i];
 
-					for(k=m_vi_LeftVertices[i_NeighboringVertex]; k<m_vi_LeftVertices[STEP_UP(i_NeighboringVertex)]; k++)
-					{
-						i_SecondNeighboringVertex = m_vi_Edges[k];
+					bool b_Conflict = false;
 
-						if(m_vi_RightVertexColors[i_SecondNeighboringVertex] == _UNKNOWN)
+					if(v < i_LeftVertexCount)
+					{
+						for(int w=m_vi_LeftVertices[v]; (w<m_vi_LeftVertices[STEP_UP(v)]) && !b_Conflict; w++)
 						{
-							continue;
-						}
+							int i_Column = m_vi_Edges[w];
 
-						if(m_vi_LeftVertexColors[i_NeighboringVertex] == _UNKNOWN)
-						{
-							vi_CandidateColors[m_vi_RightVertexColors[i_SecondNeighboringVertex]] = i_PresentVertex;
-						}
-						else
-						{
-							for(l=m_vi_RightVertices[i_SecondNeighboringVertex]; l<m_vi_RightVertices[STEP_UP(i_SecondNeighboringVertex)]; l++)
+							bool b_ByRows = vi_LeftVertexDegree[v] >= vi_RightVertexDegree[i_Column];
+
+							for(int x=m_vi_RightVertices[i_Column]; x<m_vi_RightVertices[STEP_UP(i_Column)]; x++)
 							{
-								i_ThirdNeighboringVertex = m_vi_Edges[l];
+								int u = m_vi_Edges[x];
 
-								if(m_vi_LeftVertexColors[i_ThirdNeighboringVertex] == _UNKNOWN)
+								if((u < v) && (vi_LeftVertexColors[u] == vi_LeftVertexColors[v]) && (b_ByRows || (vi_LeftVertexDegree[u] >= vi_RightVertexDegree[i_Column])))
 								{
-									continue;
-								}
+									b_Conflict = true;
 
-								if(m_vi_LeftVertexColors[i_ThirdNeighboringVertex] == m_vi_LeftVertexColors[i_NeighboringVertex])
-								{
-									vi_CandidateColors[m_vi_RightVertexColors[i_SecondNeighboringVertex]] = i_PresentVertex;
+									break;
 								}
 							}
 						}
 					}
-				}
-
-				for(j=STEP_UP(i_LeftVertexCount); j<m_i_VertexColorCount; j++)
-				{
-					if(vi_CandidateColors[j] != i_PresentVertex)
+					else
 					{
-						m_vi_RightVertexColors[i_PresentVertex] = j;
+						int i_Vertex = v - i_LeftVertexCount;
 
-						if(m_i_RightVertexColorCount < j)
+						for(int w=m_vi_RightVertices[i_Vertex]; (w<m_vi_RightVertices[STEP_UP(i_Vertex)]) && !b_Conflict; w++)
 						{
-							m_i_RightVertexColorCount = j;
-						}
+							int i_Row = m_vi_Edges[w];
 
-						for(k=m_vi_RightVertices[i_PresentVertex]; k<m_vi_RightVertices[STEP_UP(i_PresentVertex)]; k++)
-						{
-							i_PresentEdge = m_mimi2_VertexEdgeMap[m_vi_Edges[k]][i_PresentVertex];
+							bool b_ByColumns = vi_LeftVertexDegree[i_Row] < vi_RightVertexDegree[i_Vertex];
 
-							if(vi_IncludedEdges[i_PresentEdge] == _FALSE)
+							for(int x=m_vi_LeftVertices[i_Row]; x<m_vi_LeftVertices[STEP_UP(i_Row)]; x++)
 							{
-								vi_IncludedEdges[i_PresentEdge] = _TRUE;
+								int u = m_vi_Edges[x];
 
-								i_IncludedEdgeCount++;
+								if((u < i_Vertex) && (vi_RightVertexColors[u] == vi_RightVertexColors[i_Vertex]) && (b_ByColumns || (vi_LeftVertexDegree[i_Row] < vi_RightVertexDegree[u])))
+								{
+									b_Conflict = true;
+
+									break;
+								}
 							}
 						}
+					}
 
-						break;
+					if(b_Conflict)
+					{
+						vi_Conflicts.push_back(v);
 					}
 				}
-			}
 
-			if(i_IncludedEdgeCount >= i_EdgeCount)
-			{
-				break;
-			}
-		}
+				vi_QueueStart[STEP_UP(i_thread_num)] = (signed) vi_Conflicts.size();
 
-		i_LeftVertexDefaultColor = _FALSE;
-		i_RightVertexDefaultColor = _FALSE;
+#ifdef _OPENMP
+				#pragma omp barrier
+				#pragma omp single
+#endif
+				{
+					for(int t=0; t<i_NumThreads; t++)
+					{
+						vi_QueueStart[STEP_UP(t)] += vi_QueueStart[t];
+					}
 
-		for(i=0; i<i_LeftVertexCount; i++)
-		{
-			if(m_vi_LeftVertexColors[i] == _UNKNOWN)
-			{
-				m_vi_LeftVertexColors[i] = _FALSE;
+					m_i_ColoringRounds++;
+				}
 
-				i_LeftVertexDefaultColor = _TRUE;
+				copy(vi_Conflicts.begin(), vi_Conflicts.end(), vi_VerticesNeedNewColor.begin() + vi_QueueStart[i_thread_num]);
+
+#ifdef _OPENMP
+				#pragma omp barrier
+				#pragma omp single
+#endif
+				{
+					vi_VerticesToBeColored.swap(vi_VerticesNeedNewColor);
+
+					i_NumOfVerticesToBeColored = vi_QueueStart[i_NumThreads];
+				}
 			}
 		}
 
-		for(i=0; i<i_RightVertexCount; i++)
+		//Same colors as ImplicitCoveringGreedyStarBicoloring: rows 1, 2, ..., columns from i_LeftVertexCount + 1, the vertices out of the cover get the default colors
+		m_i_VertexColorCount = STEP_UP(i_LeftVertexCount + i_RightVertexCount);
+
+		m_vi_LeftVertexColors.resize((unsigned) i_LeftVertexCount);
+		m_vi_RightVertexColors.resize((unsigned) i_RightVertexCount);
+
+		i_LeftVertexDefaultColor = (i_LeftVertexCoverSize < i_LeftVertexCount) ? _TRUE : _FALSE;
+		i_RightVertexDefaultColor = (i_RightVertexCoverSize < i_RightVertexCount) ? _TRUE : _FALSE;
+
+#ifdef _OPENMP
+		#pragma omp parallel for
+#endif
+		for(int i=0; i<i_LeftVertexCount; i++)
 		{
-			if(m_vi_RightVertexColors[i] == _UNKNOWN)
-			{
-				m_vi_RightVertexColors[i] = m_i_VertexColorCount;
+			m_vi_LeftVertexColors[i] = (vi_LeftVertexColors[i] == _UNKNOWN) ? _FALSE : STEP_UP(vi_LeftVertexColors[i]);
+		}
 
-				i_RightVertexDefaultColor = _TRUE;
-			}
+#ifdef _OPENMP
+		#pragma omp parallel for
+#endif
+		for(int i=0; i<i_RightVertexCount; i++)
+		{
+			m_vi_RightVertexColors[i] = (vi_RightVertexColors[i] == _UNKNOWN) ? m_i_VertexColorCount : STEP_UP(vi_RightVertexColors[i]) + i_LeftVertexCount;
 		}
 
-		if(m_i_LeftVertexColorCount == _UNKNOWN)
+		if(i_LeftColorMax == _UNKNOWN)
 		{
 			m_i_LeftVertexColorCount = _TRUE;
 		}
 		else
 		{
-			m_i_LeftVertexColorCount = m_i_LeftVertexColorCount + i_LeftVertexDefaultColor;
+			m_i_LeftVertexColorCount = STEP_UP(i_LeftColorMax) + i_LeftVertexDefaultColor;
 		}
 
-		if(m_i_RightVertexColorCount == _UNKNOWN)
+		if(i_RightColorMax == _UNKNOWN)
 		{
 			m_i_RightVertexColorCount = _TRUE;
 		}
 		else
 		{
-			m_i_RightVertexColorCount = m_i_RightVertexColorCount + i_RightVertexDefaultColor - i_LeftVertexCount;
+			m_i_RightVertexColorCount = STEP_UP(i_RightColorMax) + i_RightVertexDefaultColor;
 		}
 
 		m_i_VertexColorCount = m_i_LeftVertexColorCount + m_i_RightVertexColorCount;
 
-#if DEBUG == 3564
-
-		cout<<endl;
-		cout<<"DEBUG 3564 | Greedy Star Bicoloring | Left Vertex Colors"<<endl;
-		cout<<endl;
-
-		for(i=0; i<i_LeftVertexCount; i++)
-		{
-			cout<<STEP_UP(i)<<"\t"<<" : "<<m_vi_LeftVertexColors[i]<<endl;
-		}
-
-		cout<<endl;
-		cout<<"DEBUG 3564 | Greedy Star Bicoloring | Right Vertex Colors"<<endl;
-		cout<<endl;
-
-		for(i=0; i<i_RightVertexCount; i++)
-		{
-			cout<<STEP_UP(i)<<"\t"<<" : "<<m_vi_RightVertexColors[i]<<endl;
-		}
-
-		cout<<endl;
-		cout<<"[Total Vertex Colors = "<<m_i_VertexColorCount<<"]"<<endl;
-		cout<<endl;
-
-#endif
-
 		return(_TRUE);
 	}
 
@@ -5193,6 +2980,90 @@ namespace ColPack
 
 
 
+	//Public Function 3566
+	int BipartiteGraphBicoloring::CheckDirectRecovery()
+	{
+		int i_LeftVertexCount  = STEP_DOWN((signed) m_vi_LeftVertices.size());
+		int i_RightVertexCount = STEP_DOWN((signed) m_vi_RightVertices.size());
+
+		int i_EdgeCount = (signed) m_vi_Edges.size()/2;
+
+		if(((signed) m_vi_LeftVertexColors.size() != i_LeftVertexCount) || ((signed) m_vi_RightVertexColors.size() != i_RightVertexCount))
+		{
+			cerr<<endl<<"*ERROR: the graph is not bicolored"<<endl;
+
+			return(_UNKNOWN);
+		}
+
+		//Rows colored 0 and columns colored i_LeftVertexCount + i_RightVertexCount + 1 are left out of the seed matrices
+		int i_RightDefaultColor = STEP_UP(i_LeftVertexCount + i_RightVertexCount);
+
+		vector<int> vi_EdgeIDs;
+
+		GetEdgeIDs(vi_EdgeIDs);
+
+		vector<int> vi_DeterminedEdges(i_EdgeCount, _FALSE);
+
+		vector<int> vi_ColorCount(STEP_UP(i_RightDefaultColor), _FALSE);
+
+		//The nonzeros read from J * S_right: the column color is the only one of its kind in the row
+		for(int i=0; i<i_LeftVertexCount; i++)
+		{
+			for(int j=m_vi_LeftVertices[i]; j<m_vi_LeftVertices[STEP_UP(i)]; j++)
+			{
+				vi_ColorCount[m_vi_RightVertexColors[m_vi_Edges[j]]]++;
+			}
+
+			for(int j=m_vi_LeftVertices[i]; j<m_vi_LeftVertices[STEP_UP(i)]; j++)
+			{
+				if((m_vi_RightVertexColors[m_vi_Edges[j]] != i_RightDefaultColor) && (vi_ColorCount[m_vi_RightVertexColors[m_vi_Edges[j]]] == _TRUE))
+				{
+					vi_DeterminedEdges[vi_EdgeIDs[j]] = _TRUE;
+				}
+			}
+
+			for(int j=m_vi_LeftVertices[i]; j<m_vi_LeftVertices[STEP_UP(i)]; j++)
+			{
+				vi_ColorCount[m_vi_RightVertexColors[m_vi_Edges[j]]] = _FALSE;
+			}
+		}
+
+		//The nonzeros read from S_left * J: the row color is the only one of its kind in the column
+		for(int i=0; i<i_RightVertexCount; i++)
+		{
+			for(int j=m_vi_RightVertices[i]; j<m_vi_RightVertices[STEP_UP(i)]; j++)
+			{
+				vi_ColorCount[m_vi_LeftVertexColors[m_vi_Edges[j]]]++;
+			}
+
+			for(int j=m_vi_RightVertices[i]; j<m_vi_RightVertices[STEP_UP(i)]; j++)
+			{
+				if((m_vi_LeftVertexColors[m_vi_Edges[j]] != _FALSE) && (vi_ColorCount[m_vi_LeftVertexColors[m_vi_Edges[j]]] == _TRUE))
+				{
+					vi_DeterminedEdges[vi_EdgeIDs[j]] = _TRUE;
+				}
+			}
+
+			for(int j=m_vi_RightVertices[i]; j<m_vi_RightVertices[STEP_UP(i)]; j++)
+			{
+				vi_ColorCount[m_vi_LeftVertexColors[m_vi_Edges[j]]] = _FALSE;
+			}
+		}
+
+		m_i_ViolationCount = _FALSE;
+
+		for(int i=0; i<i_EdgeCount; i++)
+		{
+			if(vi_DeterminedEdges[i] == _FALSE)
+			{
+				m_i_ViolationCount++;
+			}
+		}
+
+		return(m_i_ViolationCount);
+	}
+
+
 	//Public Function 3568
 	int BipartiteGraphBicoloring::GetLeftVertexColorCount()
 	{
@@ -5219,6 +3090,12 @@ namespace ColPack
 		return(m_i_ViolationCount);
 	}
 
+	//Public Function 3579
+	int BipartiteGraphBicoloring::GetColoringRounds()
+	{
+		return(m_i_ColoringRounds);
+	}
+
 	int BipartiteGraphBicoloring::GetRightVertexDefaultColor()
 	{
 		return(i_RightVertexDefaultColor);
@@ -5277,6 +3154,36 @@ namespace ColPack
 			return("Implicit Cover Greedy Star");
 		}
 		else
+		if(m_s_VertexColoringVariant.compare("EXPLICIT_COVER_STAR_OMP") == 0)
+		{
+			return("Explicit Cover Star OMP");
+		}
+		else
+		if(m_s_VertexColoringVariant.compare("AUTO_COLUMN_PARTIAL") == 0)
+		{
+			return("Auto Column Partial Distance Two");
+		}
+		else
+		if(m_s_VertexColoringVariant.compare("AUTO_ROW_PARTIAL") == 0)
+		{
+			return("Auto Row Partial Distance Two");
+		}
+		else
+		if(m_s_VertexColoringVariant.compare("MATCHING_COVER_STAR") == 0)
+		{
+			return("Matching Cover Star");
+		}
+		else
+		if(m_s_VertexColoringVariant.compare("KONIG_COVER_STAR") == 0)
+		{
+			return("Konig Cover Star");
+		}
+		else
+		if(m_s_VertexColoringVariant.compare("DEGREE_GREEDY_COVER_STAR") == 0)
+		{
+			return("Degree Greedy Cover Star");
+		}
+		else
 		if(m_s_VertexColoringVariant.compare("IMPLICIT_COVER_ACYCLIC") == 0)
 		{
 			return("Implicit Cover Acyclic");
@@ -5449,7 +3356,7 @@ namespace ColPack
 
 		if(lseed_available) Seed_reset();
 
-		dp2_lSeed = GetLeftSeedMatrix_unmanaged(ip1_SeedRowCount, ip1_SeedColumnCount);
+		dp2_lSeed = NewLeftSeedMatrix(ip1_SeedRowCount, ip1_SeedColumnCount, MATRIX_ALLOC_SLAB);
 		if(dp2_lSeed == NULL) return NULL;
 
 		i_lseed_rowCount = *ip1_SeedRowCount;
@@ -5462,7 +3369,7 @@ namespace ColPack
 
 		if(rseed_available) Seed_reset();
 
-		dp2_rSeed = GetRightSeedMatrix_unmanaged(ip1_SeedRowCount, ip1_SeedColumnCount);
+		dp2_rSeed = NewRightSeedMatrix(ip1_SeedRowCount, ip1_SeedColumnCount, MATRIX_ALLOC_SLAB);
 		if(dp2_rSeed == NULL) return NULL;
 
 		i_rseed_rowCount = *ip1_SeedRowCount;
@@ -5472,6 +3379,14 @@ namespace ColPack
 	}
 
 	double** BipartiteGraphBicoloring::GetLeftSeedMatrix_unmanaged(int* ip1_SeedRowCount, int* ip1_SeedColumnCount) {
+		return NewLeftSeedMatrix(ip1_SeedRowCount, ip1_SeedColumnCount, m_i_MatrixAllocation);
+	}
+
+	double** BipartiteGraphBicoloring::GetLeftSeedMatrix_contiguous(int* ip1_SeedRowCount, int* ip1_SeedColumnCount) {
+		return NewLeftSeedMatrix(ip1_SeedRowCount, ip1_SeedColumnCount, MATRIX_ALLOC_SLAB);
+	}
+
+	double** BipartiteGraphBicoloring::NewLeftSeedMatrix(int* ip1_SeedRowCount, int* ip1_SeedColumnCount, int i_MatrixAllocation) {
 //#define DEBUG asdf
 
 		int i_size = GetLeftVertexCount();
@@ -5486,11 +3401,7 @@ namespace ColPack
 #endif
 
 		// allocate and initialize Seed matrix
-		double** Seed = new double*[(*ip1_SeedRowCount)];
-		for (int i=0; i<(*ip1_SeedRowCount); i++) {
-			Seed[i] = new double[(*ip1_SeedColumnCount)];
-			for(int j=0; j<(*ip1_SeedColumnCount); j++) Seed[i][j]=0.;
-		}
+		double** Seed = new_2DMatrix<double>((*ip1_SeedRowCount), (*ip1_SeedColumnCount), i_MatrixAllocation);
 
 		// populate Seed matrix
 		for (int i=0; i < (*ip1_SeedColumnCount); i++) {
@@ -5508,6 +3419,14 @@ namespace ColPack
 	}
 
 	double** BipartiteGraphBicoloring::GetRightSeedMatrix_unmanaged(int* ip1_SeedRowCount, int* ip1_SeedColumnCount) {
+		return NewRightSeedMatrix(ip1_SeedRowCount, ip1_SeedColumnCount, m_i_MatrixAllocation);
+	}
+
+	double** BipartiteGraphBicoloring::GetRightSeedMatrix_contiguous(int* ip1_SeedRowCount, int* ip1_SeedColumnCount) {
+		return NewRightSeedMatrix(ip1_SeedRowCount, ip1_SeedColumnCount, MATRIX_ALLOC_SLAB);
+	}
+
+	double** BipartiteGraphBicoloring::NewRightSeedMatrix(int* ip1_SeedRowCount, int* ip1_SeedColumnCount, int i_MatrixAllocation) {
 
 		int i_size = GetRightVertexCount();
 		vector<int> RightVertexColors_Transformed;
@@ -5523,11 +3442,7 @@ namespace ColPack
 #endif
 
 		// allocate and initialize Seed matrix
-		double** Seed = new double*[(*ip1_SeedRowCount)];
-		for (int i=0; i<(*ip1_SeedRowCount); i++) {
-			Seed[i] = new double[(*ip1_SeedColumnCount)];
-			for(int j=0; j<(*ip1_SeedColumnCount); j++) Seed[i][j]=0.;
-		}
+		double** Seed = new_2DMatrix<double>((*ip1_SeedRowCount), (*ip1_SeedColumnCount), i_MatrixAllocation);
 
 		// populate Seed matrix
 		for (int i=0; i < (*ip1_SeedRowCount); i++) {
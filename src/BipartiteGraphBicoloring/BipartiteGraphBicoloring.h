@@ -63,6 +63,7 @@ namespace ColPack
 		/// Same as GetLeftSeedMatrix(), except that this Seed matrix is NOT managed by ColPack
 		/** Notes:
 		- This Seed matrix is NOT managed by ColPack. Therefore, the user should free the Seed matrix manually when the matrix is no longer needed.
+		- The Seed matrix is allocated following GetMatrixAllocation(). Free it with free_2DMatrix(Seed, rows, GetMatrixAllocation()).
 		*/
 		double** GetLeftSeedMatrix_unmanaged(int* ip1_SeedRowCount, int* ip1_SeedColumnCount);
 
@@ -100,6 +101,36 @@ namespace ColPack
 		*/
 		void GetSeedMatrix_unmanaged(double*** dp3_LeftSeed, int* ip1_LeftSeedRowCount, int* ip1_LeftSeedColumnCount, double*** dp3_RightSeed, int* ip1_RightSeedRowCount, int* ip1_RightSeedColumnCount);
 
+		/// Same as GetLeftSeedMatrix_unmanaged(), except that the Seed matrix is always allocated as MATRIX_ALLOC_SLAB
+		/** Notes:
+		- Same as SetMatrixAllocation(MATRIX_ALLOC_SLAB) followed by GetLeftSeedMatrix_unmanaged(), kept for compatibility. Free it with free_2DMatrix_slab().
+		*/
+		double** GetLeftSeedMatrix_contiguous(int* ip1_SeedRowCount, int* ip1_SeedColumnCount);
+
+		/// Same as GetRightSeedMatrix_unmanaged(), except that the Seed matrix is always allocated as MATRIX_ALLOC_SLAB
+		/** Notes:
+		- Same as SetMatrixAllocation(MATRIX_ALLOC_SLAB) followed by GetRightSeedMatrix_unmanaged(), kept for compatibility. Free it with free_2DMatrix_slab().
+		*/
+		double** GetRightSeedMatrix_contiguous(int* ip1_SeedRowCount, int* ip1_SeedColumnCount);
+
+		/// Compact form of the Left Seed matrix: the row of the 1 in each column
+		/** Postcondition:
+		- output[v] is the row of the Left Seed matrix holding the 1 of column v, _UNKNOWN if the left (row) vertex v has color 0.
+
+		Return value: number of rows of the Left Seed matrix.
+		*/
+		int GetLeftSeedColors(vector<int> &output);
+
+		/// Compact form of the Right Seed matrix: the column of the 1 in each row
+		/** Postcondition:
+		- output[v] is the column of the Right Seed matrix holding the 1 of row v, _UNKNOWN if the right (column) vertex v has color 0.
+
+		Return value: number of columns of the Right Seed matrix.
+
+		Both vectors are what JacobianRecovery2D::DirectRecover_*_usermem() take instead of the graph.
+		*/
+		int GetRightSeedColors(vector<int> &output);
+
 	protected: //DOCUMENTED
 		/// Whether or not color 0 is used for left vertices
 		/** i_LeftVertexDefaultColor ==
@@ -147,9 +178,15 @@ namespace ColPack
 		int i_rseed_rowCount;
 		double** dp2_rSeed;
 
+		int m_i_MatrixAllocation;
+
 		void Seed_init();
 		void Seed_reset();
 
+		/// Seed matrices of GetLeftSeedMatrix_unmanaged() and GetRightSeedMatrix_unmanaged() allocated with the policy i_MatrixAllocation
+		double** NewLeftSeedMatrix(int* ip1_SeedRowCount, int* ip1_SeedColumnCount, int i_MatrixAllocation);
+		double** NewRightSeedMatrix(int* ip1_SeedRowCount, int* ip1_SeedColumnCount, int i_MatrixAllocation);
+
 	private:
 
 		//Private Function 3501
@@ -161,13 +198,31 @@ namespace ColPack
 		//Private Function 3507
 		int CalculateVertexColorClasses();
 
-		//Private Function 3508
-		int FixMinimalCoverStarBicoloring();
+		//Private Function 3509
+		/// vi_EdgeIDs[j] is the ID of the edge stored at m_vi_Edges[j], its position among the edges of the rows, so the same ID is found from both sides
+		void GetEdgeIDs(vector<int> & vi_EdgeIDs);
+
+		//Private Function 3510
+		/// Star bicoloring core shared by the implicit and minimal covering variants
+		/**
+		 * The vertices of vi_CandidateVertices (rows, then columns shifted by the number of rows, as in m_vi_OrderedVertices)
+		 * are colored in that order, tracking the two colored stars on flat edge IDs. With b_SkipCoveredVertices a
+		 * candidate whose edges are all covered by colored vertices is left uncolored (implicit covering), otherwise every
+		 * candidate is colored (explicit covering). Uncolored vertices get the default colors of ImplicitCoveringStarBicoloring().
+		 * Return _FALSE if the candidates leave an edge uncovered.
+		 */
+		int StarBicoloring(vector<int> & vi_CandidateVertices, bool b_SkipCoveredVertices);
+
+		//Private Function 3511
+		/// Append to vi_CandidateVertices the covered rows and/or columns of the last vertex cover, in the order of m_vi_OrderedVertices
+		void GetOrderedCoveredVertices(vector<int> & vi_CandidateVertices, bool b_LeftVertices, bool b_RightVertices);
 
 	protected:
 
 		int m_i_ViolationCount;
 
+		int m_i_ColoringRounds;
+
 		//int m_i_ColoringUnits; // used in ImplicitCoveringAcyclicBicoloring()
 
 		int m_i_LargestLeftVertexColorClass;
@@ -202,6 +257,10 @@ namespace ColPack
 
 	public:
 
+		/// Allocation policy of the unmanaged Seed matrices: MATRIX_ALLOC_ROWS (default) or MATRIX_ALLOC_SLAB, see MatrixDeallocation.h
+		void SetMatrixAllocation(int i_MatrixAllocation);
+		int GetMatrixAllocation();
+
 		//Public Constructor 3551
 		BipartiteGraphBicoloring();
 
@@ -217,33 +276,75 @@ namespace ColPack
 		//Public Function 3562
 		int ImplicitCoveringStarBicoloring();
 
-		//Public Function 3560
+		//Public Function 3559
 		int ExplicitCoveringStarBicoloring();
 
-		//Public Function 3559
+		//Public Function 3558
 		int ExplicitCoveringModifiedStarBicoloring();
 
 		//Public Function 3564
 		int ImplicitCoveringGreedyStarBicoloring();
 
+		//Public Function 3578
+		/// Speculative OpenMP star bicoloring over an explicit vertex cover
+		/**
+		 * A nonzero (i, j) is recovered from the row compressed Jacobian if row i has at least as many nonzeros as
+		 * column j, from the column compressed one otherwise; the rows and columns holding such nonzeros are the cover.
+		 * Two covered rows sharing a column conflict unless both their nonzeros in it are recovered by columns, and
+		 * conversely, so both sides are colored at once in the rounds of PartialDistanceTwoColoring_OMP (first fit,
+		 * then the larger of 2 conflicting vertices is recolored). The colors follow ImplicitCoveringGreedyStarBicoloring().
+		 */
+		int ExplicitCoveringStarBicoloring_OMP();
+
 		//Public Function 3556
-		int MinimalCoveringRowMajorStarBicoloring();		//????
+		/// Star bicoloring of the minimal vertex cover (CoverMinimalVertex()), all the covered rows before the covered columns
+		int MinimalCoveringRowMajorStarBicoloring();
 
 		//Public Function 3557
-		int MinimalCoveringColumnMajorStarBicoloring();		//????
-
-		//Public Function 3558
-		int ImplicitCoveringConservativeStarBicoloring();	// CRASH
+		/// Star bicoloring of the minimal vertex cover (CoverMinimalVertex()), all the covered columns before the covered rows
+		int MinimalCoveringColumnMajorStarBicoloring();
 
 		//Public Function 3561
-		int MinimalCoveringStarBicoloring();				// CRASH
+		/// Implicit covering star bicoloring that first visits only the vertices having a neighbor of no larger degree
+		/**
+		 * The vertices are visited twice in the given order: first those having a neighbor of no larger degree (a strictly
+		 * smaller one for the columns), so each edge tends to be covered from its denser end, then all of them to cover the
+		 * remaining edges. Vertices whose edges are all covered are skipped.
+		 */
+		int ImplicitCoveringConservativeStarBicoloring();
+
+		//Public Function 3560
+		/// Star bicoloring of the minimal vertex cover (CoverMinimalVertex()) in the given order
+		int MinimalCoveringStarBicoloring();
 
 		//Public Function 3563
-		int ImplicitCoveringRestrictedStarBicoloring();		// CRASH
+		/// Implicit covering star bicoloring restricted to the minimal vertex cover: covered vertices whose edges are all covered are skipped
+		int ImplicitCoveringRestrictedStarBicoloring();
+
+		//Public Function 3580
+		/// Star bicoloring of the 2-approximate matching vertex cover (CoverVertex_Matching()) in the given order
+		int MatchingCoveringStarBicoloring();
+
+		//Public Function 3581
+		/// Star bicoloring of the minimum vertex cover (CoverVertex_Konig()) in the given order
+		int KonigCoveringStarBicoloring();
+
+		//Public Function 3582
+		/// Star bicoloring of the degree greedy vertex cover (CoverVertex_DegreeGreedy()) in the given order
+		int DegreeGreedyCoveringStarBicoloring();
 
 		//Public Function 3565
 		int CheckStarBicoloring();
 
+		//Public Function 3566
+		/// Number of nonzeros that JacobianRecovery2D cannot read directly from S_left * J or J * S_right, 0 for a valid star bicoloring
+		/**
+		 * A nonzero (i, j) is read from J * S_right if column j is colored and no other column of row i has its color, and
+		 * from S_left * J if row i is colored and no other row of column j has its color. Runs in O(|E|); the result is also
+		 * GetViolationCount(). Return _UNKNOWN if the graph is not bicolored.
+		 */
+		int CheckDirectRecovery();
+
 
 		//Public Function 3568
 		int GetLeftVertexColorCount();
@@ -257,6 +358,10 @@ namespace ColPack
 		//Public Function 3571
 		int GetViolationCount();
 
+		//Public Function 3579
+		/// Number of speculative rounds of the last ExplicitCoveringStarBicoloring_OMP(), 0 if none ran
+		int GetColoringRounds();
+
 		int GetRightVertexDefaultColor();
 
 		//Public Function 3572
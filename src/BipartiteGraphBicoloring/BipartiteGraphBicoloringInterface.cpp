@@ -25,6 +25,20 @@ namespace ColPack
 	{
 		BipartiteGraphBicoloring::Clear();
 
+		m_d_ForwardSweepCost = 1.;
+		m_d_ReverseSweepCost = 1.;
+
+		m_s_CompressionBicoloringVariant = "IMPLICIT_COVERING__STAR_BICOLORING";
+
+		m_vs_CompressionCandidates.clear();
+		m_vi_CandidateRowColorCounts.clear();
+		m_vi_CandidateColumnColorCounts.clear();
+		m_vd_CandidateLowerBounds.clear();
+		m_vd_CandidateCosts.clear();
+		m_vd_CandidateTimes.clear();
+
+		m_i_CompressionCandidate = _UNKNOWN;
+
 		return;
 	}
 
@@ -34,6 +48,15 @@ namespace ColPack
 	{
 		BipartiteGraphBicoloring::Reset();
 
+		m_vs_CompressionCandidates.clear();
+		m_vi_CandidateRowColorCounts.clear();
+		m_vi_CandidateColumnColorCounts.clear();
+		m_vd_CandidateLowerBounds.clear();
+		m_vd_CandidateCosts.clear();
+		m_vd_CandidateTimes.clear();
+
+		m_i_CompressionCandidate = _UNKNOWN;
+
 		return;
 	}
 
@@ -85,6 +108,19 @@ namespace ColPack
 		s_BicoloringVariant = toUpper(s_BicoloringVariant);
 		m_T_Timer.Start();
 
+		int i_ColoringStatus;
+		if(s_BicoloringVariant == "AUTO") {
+			i_ColoringStatus = AutoBicoloring(s_OrderingVariant);
+		} else {
+			i_ColoringStatus = BicolorVertices(s_BicoloringVariant);
+		}
+
+		m_T_Timer.Stop();
+		m_d_ColoringTime = m_T_Timer.GetWallTime();
+		return(i_ColoringStatus);
+	}
+
+	int BipartiteGraphBicoloringInterface::BicolorVertices(string s_BicoloringVariant) {
 		int i_ColoringStatus;
 		if(s_BicoloringVariant == "IMPLICIT_COVERING__STAR_BICOLORING") {
 			i_ColoringStatus = ImplicitCoveringStarBicoloring();
@@ -94,18 +130,176 @@ namespace ColPack
 			i_ColoringStatus = ExplicitCoveringModifiedStarBicoloring();
 		} else if (s_BicoloringVariant == "IMPLICIT_COVERING__GREEDY_STAR_BICOLORING") {
 			i_ColoringStatus = ImplicitCoveringGreedyStarBicoloring();
+		} else if (s_BicoloringVariant == "EXPLICIT_COVERING__STAR_BICOLORING_OMP") {
+			i_ColoringStatus = ExplicitCoveringStarBicoloring_OMP();
+		} else if (s_BicoloringVariant == "MATCHING_COVERING__STAR_BICOLORING") {
+			i_ColoringStatus = MatchingCoveringStarBicoloring();
+		} else if (s_BicoloringVariant == "KONIG_COVERING__STAR_BICOLORING") {
+			i_ColoringStatus = KonigCoveringStarBicoloring();
+		} else if (s_BicoloringVariant == "DEGREE_GREEDY_COVERING__STAR_BICOLORING") {
+			i_ColoringStatus = DegreeGreedyCoveringStarBicoloring();
 		} else {
 			cout<<" Unknown Bicoloring Method "<<s_BicoloringVariant<<". Please use a legal Method."<<endl;
-			m_T_Timer.Stop();
-			m_d_ColoringTime = m_T_Timer.GetWallTime();
 			return (_FALSE);
 		}
 
-		m_T_Timer.Stop();
-		m_d_ColoringTime = m_T_Timer.GetWallTime();
 		return(i_ColoringStatus);
 	}
 
+	int BipartiteGraphBicoloringInterface::AutoBicoloring(string s_OrderingVariant) {
+		int i_RowCount = GetRowVertexCount();
+		int i_ColumnCount = GetColumnVertexCount();
+
+		vector<int> vi_RowIndex(m_vi_LeftVertices);
+		vector<int> vi_ColumnIndex(m_vi_Edges.begin() + m_vi_LeftVertices[0], m_vi_Edges.begin() + m_vi_LeftVertices[i_RowCount]);
+
+		for(int i=i_RowCount; i>=0; i--) {
+			vi_RowIndex[i] -= vi_RowIndex[0];
+		}
+
+		BipartiteGraphPartialColoringInterface g_PartialGraph(SRC_WAIT);
+
+		g_PartialGraph.BuildBPGraphFromCSRFormat(vi_RowIndex, vi_ColumnIndex, i_ColumnCount);
+
+		g_PartialGraph.SetCompressionCostModel(m_d_ForwardSweepCost, m_d_ReverseSweepCost);
+
+		int i_PartialStatus = _UNKNOWN, i_BicoloringStatus = _UNKNOWN;
+
+		//Timer reads the processor time of the whole process, which counts both sections, so the bicoloring is timed by the wall clock
+		double d_BicoloringTime = _UNKNOWN;
+
+#ifdef _OPENMP
+		#pragma omp parallel sections
+#endif
+		{
+#ifdef _OPENMP
+			#pragma omp section
+#endif
+			{
+				i_PartialStatus = g_PartialGraph.PartialDistanceTwoColoring(s_OrderingVariant, "AUTO");
+			}
+#ifdef _OPENMP
+			#pragma omp section
+#endif
+			{
+				d_BicoloringTime = Timer::GetWallClock();
+
+				i_BicoloringStatus = BicolorVertices(m_s_CompressionBicoloringVariant);
+
+				d_BicoloringTime = Timer::GetWallClock() - d_BicoloringTime;
+			}
+		}
+
+		int i_PartialCandidate = g_PartialGraph.GetCompressionCandidates(m_vs_CompressionCandidates, m_vi_CandidateRowColorCounts, m_vi_CandidateColumnColorCounts, m_vd_CandidateCosts, m_vd_CandidateLowerBounds, m_vd_CandidateTimes);
+
+		int i_RowColorCount = m_i_LeftVertexColorCount - i_LeftVertexDefaultColor;
+		int i_ColumnColorCount = m_i_RightVertexColorCount - i_RightVertexDefaultColor;
+
+		m_vs_CompressionCandidates.push_back(m_s_CompressionBicoloringVariant);
+		m_vi_CandidateRowColorCounts.push_back(i_RowColorCount);
+		m_vi_CandidateColumnColorCounts.push_back(i_ColumnColorCount);
+		m_vd_CandidateCosts.push_back(i_RowColorCount * m_d_ReverseSweepCost + i_ColumnColorCount * m_d_ForwardSweepCost);
+		m_vd_CandidateLowerBounds.push_back(GetEdgeCount() > 0 ? min(m_d_ForwardSweepCost, m_d_ReverseSweepCost) : 0.);
+		m_vd_CandidateTimes.push_back(m_d_OrderingTime + d_BicoloringTime);
+
+		m_i_CompressionCandidate = STEP_DOWN((signed) m_vs_CompressionCandidates.size());
+
+		if((i_BicoloringStatus == _TRUE) && (m_vd_CandidateCosts[m_i_CompressionCandidate] < m_vd_CandidateCosts[i_PartialCandidate])) {
+			return(i_BicoloringStatus);
+		}
+
+		m_i_CompressionCandidate = i_PartialCandidate;
+
+		//Store the one sided coloring with the conventions of ImplicitCoveringStarBicoloring(): the uncolored rows have
+		//the color 0 and the uncolored columns the color i_RowCount + i_ColumnCount + 1
+		vector<int> vi_VertexColors;
+
+		if(m_vs_CompressionCandidates[i_PartialCandidate] == "COLUMN_PARTIAL_DISTANCE_TWO") {
+			g_PartialGraph.GetRightVertexColors(vi_VertexColors);
+
+			m_vi_LeftVertexColors.assign((unsigned) i_RowCount, _FALSE);
+			m_vi_RightVertexColors.resize((unsigned) i_ColumnCount);
+
+			for(int i=0; i<i_ColumnCount; i++) {
+				m_vi_RightVertexColors[i] = i_RowCount + STEP_UP(vi_VertexColors[i]);
+			}
+
+			i_LeftVertexDefaultColor = _TRUE;
+			i_RightVertexDefaultColor = _FALSE;
+
+			m_i_LeftVertexColorCount = _TRUE;
+			m_i_RightVertexColorCount = g_PartialGraph.GetVertexColorCount();
+
+			m_s_VertexColoringVariant = "AUTO_COLUMN_PARTIAL";
+		}
+		else {
+			g_PartialGraph.GetLeftVertexColors(vi_VertexColors);
+
+			m_vi_LeftVertexColors.resize((unsigned) i_RowCount);
+			m_vi_RightVertexColors.assign((unsigned) i_ColumnCount, i_RowCount + i_ColumnCount + 1);
+
+			for(int i=0; i<i_RowCount; i++) {
+				m_vi_LeftVertexColors[i] = STEP_UP(vi_VertexColors[i]);
+			}
+
+			i_LeftVertexDefaultColor = _FALSE;
+			i_RightVertexDefaultColor = _TRUE;
+
+			m_i_LeftVertexColorCount = g_PartialGraph.GetVertexColorCount();
+			m_i_RightVertexColorCount = _TRUE;
+
+			m_s_VertexColoringVariant = "AUTO_ROW_PARTIAL";
+		}
+
+		m_i_VertexColorCount = m_i_LeftVertexColorCount + m_i_RightVertexColorCount;
+
+		return(i_PartialStatus);
+	}
+
+	void BipartiteGraphBicoloringInterface::SetCompressionCostModel(double d_ForwardSweepCost, double d_ReverseSweepCost, string s_BicoloringVariant) {
+		m_d_ForwardSweepCost = d_ForwardSweepCost;
+		m_d_ReverseSweepCost = d_ReverseSweepCost;
+
+		m_s_CompressionBicoloringVariant = toUpper(s_BicoloringVariant);
+	}
+
+	int BipartiteGraphBicoloringInterface::GetCompressionCandidates(vector<string> &vs_Candidates, vector<int> &vi_RowColorCounts, vector<int> &vi_ColumnColorCounts, vector<double> &vd_Costs, vector<double> &vd_LowerBounds, vector<double> &vd_Times) {
+		vs_Candidates = m_vs_CompressionCandidates;
+		vi_RowColorCounts = m_vi_CandidateRowColorCounts;
+		vi_ColumnColorCounts = m_vi_CandidateColumnColorCounts;
+		vd_Costs = m_vd_CandidateCosts;
+		vd_LowerBounds = m_vd_CandidateLowerBounds;
+		vd_Times = m_vd_CandidateTimes;
+
+		return(m_i_CompressionCandidate);
+	}
+
+	void BipartiteGraphBicoloringInterface::PrintCompressionCandidates() {
+		cout<<endl;
+		cout<<"Compression Candidates | Forward Sweep Cost = "<<m_d_ForwardSweepCost<<"; Reverse Sweep Cost = "<<m_d_ReverseSweepCost<<" | "<<m_s_InputFile<<endl;
+		cout<<endl;
+
+		for(size_t i=0; i<m_vs_CompressionCandidates.size(); i++) {
+			cout<<m_vs_CompressionCandidates[i]<<" : ";
+
+			if(m_vd_CandidateCosts[i] == _UNKNOWN) {
+				cout<<"skipped [Lower Bound = "<<m_vd_CandidateLowerBounds[i]<<"]"<<endl;
+
+				continue;
+			}
+
+			cout<<"[Row Colors = "<<m_vi_CandidateRowColorCounts[i]<<"; Column Colors = "<<m_vi_CandidateColumnColorCounts[i]<<"; Cost = "<<m_vd_CandidateCosts[i]<<"; Lower Bound = "<<m_vd_CandidateLowerBounds[i]<<"; Time = "<<m_vd_CandidateTimes[i]<<"]";
+
+			if((signed) i == m_i_CompressionCandidate) {
+				cout<<" *";
+			}
+
+			cout<<endl;
+		}
+
+		cout<<endl;
+	}
+
 	BipartiteGraphBicoloringInterface::BipartiteGraphBicoloringInterface(int i_type, ...) {
 	  //cout<<"IN GraphColoringInterface(int i_type, ...)"<<endl;
 		Clear();
@@ -197,6 +391,14 @@ namespace ColPack
 			i_ColoringStatus = ExplicitCoveringModifiedStarBicoloring();
 		} else if (s_BicoloringVariant == "IMPLICIT_COVERING__GREEDY_STAR_BICOLORING") {
 			i_ColoringStatus = ImplicitCoveringGreedyStarBicoloring();
+		} else if (s_BicoloringVariant == "EXPLICIT_COVERING__STAR_BICOLORING_OMP") {
+			i_ColoringStatus = ExplicitCoveringStarBicoloring_OMP();
+		} else if (s_BicoloringVariant == "MATCHING_COVERING__STAR_BICOLORING") {
+			i_ColoringStatus = MatchingCoveringStarBicoloring();
+		} else if (s_BicoloringVariant == "KONIG_COVERING__STAR_BICOLORING") {
+			i_ColoringStatus = KonigCoveringStarBicoloring();
+		} else if (s_BicoloringVariant == "DEGREE_GREEDY_COVERING__STAR_BICOLORING") {
+			i_ColoringStatus = DegreeGreedyCoveringStarBicoloring();
 		} else {
 			cout<<" Unknown Bicoloring Method "<<s_BicoloringVariant<<". Please use a legal Method."<<endl;
 			m_T_Timer.Stop();
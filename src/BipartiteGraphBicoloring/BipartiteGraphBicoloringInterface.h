@@ -120,12 +120,23 @@ namespace ColPack
 			- "EXPLICIT_COVERING__STAR_BICOLORING"
 			- "EXPLICIT_COVERING__MODIFIED_STAR_BICOLORING"
 			- "IMPLICIT_COVERING__GREEDY_STAR_BICOLORING"
+			- "AUTO": column, row and bidirectional compression are run concurrently and the cheapest one under
+			  SetCompressionCostModel() is kept, see PrintCompressionCandidates(). A one sided winner leaves the other seed empty.
 
 		Postcondition:
 		- The Bipartite Graph is Bicolored, i.e., m_vi_LeftVertexColors and m_vi_RightVertexColors will be populated.
 		*/
 		int Bicoloring(string s_OrderingVariant = "NATURAL", string s_BicoloringVariant = "IMPLICIT_COVERING__STAR_BICOLORING");
 
+		/// Cost model of the "AUTO" bicoloring: the cost of one forward sweep (J * S_right, one per column color), of one reverse sweep (S_left * J, one per row color), and the bicoloring tried for bidirectional compression
+		void SetCompressionCostModel(double d_ForwardSweepCost, double d_ReverseSweepCost, string s_BicoloringVariant = "IMPLICIT_COVERING__STAR_BICOLORING");
+
+		/// Candidates of the last "AUTO" bicoloring, see BipartiteGraphPartialColoringInterface::GetCompressionCandidates(); return the index of the kept one
+		int GetCompressionCandidates(vector<string> &vs_Candidates, vector<int> &vi_RowColorCounts, vector<int> &vi_ColumnColorCounts, vector<double> &vd_Costs, vector<double> &vd_LowerBounds, vector<double> &vd_Times);
+
+		/// Print the candidates of the last "AUTO" bicoloring with their lower bounds, costs and times, the kept one is marked
+		void PrintCompressionCandidates();
+
 		///Return the Left Seed matrix
 		double** GetLeftSeedMatrix(int* ip1_LeftSeedRowCount, int* ip1_LeftSeedColumnCount);
 
@@ -137,6 +148,32 @@ namespace ColPack
 
 		Timer m_T_Timer;
 
+		double m_d_ForwardSweepCost;
+		double m_d_ReverseSweepCost;
+
+		string m_s_CompressionBicoloringVariant;
+
+		vector<string> m_vs_CompressionCandidates;
+		vector<int> m_vi_CandidateRowColorCounts;
+		vector<int> m_vi_CandidateColumnColorCounts;
+		vector<double> m_vd_CandidateLowerBounds;
+		vector<double> m_vd_CandidateCosts;
+		vector<double> m_vd_CandidateTimes;
+
+		int m_i_CompressionCandidate;
+
+		/// Run the bicoloring s_BicoloringVariant on the ordered graph
+		int BicolorVertices(string s_BicoloringVariant);
+
+		/// "AUTO" of Bicoloring()
+		/**
+		 * The partial distance two colorings ("AUTO" of BipartiteGraphPartialColoringInterface, on a copy of the graph)
+		 * and the bicoloring run concurrently (OpenMP sections). A bicoloring costs at least one sweep. If a one sided
+		 * coloring is the cheapest (the first one on a tie), it is stored here as a bicoloring whose other side is
+		 * entirely uncolored, so the seed matrices and JacobianRecovery2D work unchanged.
+		 */
+		int AutoBicoloring(string s_OrderingVariant);
+
 	public:
 		//Public Destructor 3702
 		~BipartiteGraphBicoloringInterface();
@@ -962,6 +962,164 @@ namespace ColPack
 	  return (_TRUE);
 	}
 
+	int BipartiteGraphInputOutput::BuildBPGraphFromCSRFormat(const vector<int> & vi_RowIndex, const vector<int> & vi_ColumnIndex, int i_ColumnCount) {
+	  int i_RowCount = vi_RowIndex.empty() ? 0 : STEP_DOWN((signed) vi_RowIndex.size());
+	  int i_EdgeCount = vi_RowIndex.empty() ? 0 : vi_RowIndex[i_RowCount];
+
+	  for(int j=0; j<i_EdgeCount; j++) {
+	    if(vi_ColumnIndex[j] < 0 || vi_ColumnIndex[j] >= i_ColumnCount) {
+	      cerr<<endl<<"*ERROR: BuildBPGraphFromCSRFormat(): column index "<<vi_ColumnIndex[j]<<" out of [0, "<<i_ColumnCount<<")"<<endl;
+	      return (_FALSE);
+	    }
+	  }
+
+	  m_vi_Edges.assign(2*i_EdgeCount, _UNKNOWN);
+	  m_vi_LeftVertices.assign(vi_RowIndex.begin(), vi_RowIndex.end());
+	  if(m_vi_LeftVertices.empty()) m_vi_LeftVertices.push_back(_FALSE);
+	  copy(vi_ColumnIndex.begin(), vi_ColumnIndex.begin()+i_EdgeCount, m_vi_Edges.begin());
+
+	  //the column block is the transpose of the row block, bucketed by column
+	  m_vi_RightVertices.assign(STEP_UP(i_ColumnCount), _FALSE);
+	  for(int j=0; j<i_EdgeCount; j++) m_vi_RightVertices[STEP_UP(vi_ColumnIndex[j])]++;
+	  m_vi_RightVertices[0] = i_EdgeCount;
+	  for(int i=0; i<i_ColumnCount; i++) m_vi_RightVertices[STEP_UP(i)] += m_vi_RightVertices[i];
+
+	  vector<int> vi_Tails(m_vi_RightVertices.begin(), m_vi_RightVertices.end()-1);
+	  for(int i=0; i<i_RowCount; i++) {
+	    for(int j=vi_RowIndex[i]; j<vi_RowIndex[STEP_UP(i)]; j++) {
+	      m_vi_Edges[vi_Tails[vi_ColumnIndex[j]]++] = i;
+	    }
+	  }
+
+	  CalculateVertexDegrees();
+
+	  return (_TRUE);
+	}
+
+	int BipartiteGraphInputOutput::UpdateEdges(const vector< pair<int, int> > & vpii_InsertedEdges, const vector< pair<int, int> > & vpii_DeletedEdges, vector<int> & vi_NewEdgeRows, vector<int> & vi_NewEdgeColumns) {
+	  int i_OldRowCount = m_vi_LeftVertices.empty() ? 0 : STEP_DOWN((signed) m_vi_LeftVertices.size());
+	  int i_OldColumnCount = m_vi_RightVertices.empty() ? 0 : STEP_DOWN((signed) m_vi_RightVertices.size());
+	  int i_RowCount = i_OldRowCount, i_ColumnCount = i_OldColumnCount;
+
+	  vi_NewEdgeRows.clear();
+	  vi_NewEdgeColumns.clear();
+
+	  for(size_t i=0; i<vpii_InsertedEdges.size(); i++)
+	    {
+	      if(vpii_InsertedEdges[i].first < 0 || vpii_InsertedEdges[i].second < 0)
+		{
+		  cerr<<endl<<"*ERROR: UpdateEdges(): negative index in the inserted edge ("<<vpii_InsertedEdges[i].first<<", "<<vpii_InsertedEdges[i].second<<")"<<endl;
+
+		  return(_UNKNOWN);
+		}
+
+	      if(i_RowCount <= vpii_InsertedEdges[i].first) i_RowCount = STEP_UP(vpii_InsertedEdges[i].first);
+	      if(i_ColumnCount <= vpii_InsertedEdges[i].second) i_ColumnCount = STEP_UP(vpii_InsertedEdges[i].second);
+	    }
+
+	  // the columns of the inserted and deleted edges, bucketed by row
+	  vector<int> vi_InsertedBegin(STEP_UP(i_RowCount), _FALSE), vi_DeletedBegin(STEP_UP(i_RowCount), _FALSE);
+	  vector<int> vi_Inserted(vpii_InsertedEdges.size()), vi_Deleted(vpii_DeletedEdges.size());
+
+	  for(size_t i=0; i<vpii_InsertedEdges.size(); i++) vi_InsertedBegin[STEP_UP(vpii_InsertedEdges[i].first)]++;
+	  for(size_t i=0; i<vpii_DeletedEdges.size(); i++)
+	    {
+	      int r = vpii_DeletedEdges[i].first, c = vpii_DeletedEdges[i].second;
+	      if(r >= 0 && c >= 0 && r < i_OldRowCount && c < i_OldColumnCount) vi_DeletedBegin[STEP_UP(r)]++;
+	    }
+	  for(int i=0; i<i_RowCount; i++)
+	    {
+	      vi_InsertedBegin[STEP_UP(i)] += vi_InsertedBegin[i];
+	      vi_DeletedBegin[STEP_UP(i)] += vi_DeletedBegin[i];
+	    }
+	  {
+	    vector<int> vi_InsertedTail(vi_InsertedBegin.begin(), vi_InsertedBegin.end() - 1), vi_DeletedTail(vi_DeletedBegin.begin(), vi_DeletedBegin.end() - 1);
+	    for(size_t i=0; i<vpii_InsertedEdges.size(); i++) vi_Inserted[vi_InsertedTail[vpii_InsertedEdges[i].first]++] = vpii_InsertedEdges[i].second;
+	    for(size_t i=0; i<vpii_DeletedEdges.size(); i++)
+	      {
+		int r = vpii_DeletedEdges[i].first, c = vpii_DeletedEdges[i].second;
+		if(r >= 0 && c >= 0 && r < i_OldRowCount && c < i_OldColumnCount) vi_Deleted[vi_DeletedTail[r]++] = c;
+	      }
+	  }
+
+	  vector<int> vi_LeftVertices, vi_RightVertices(STEP_UP(i_ColumnCount), _FALSE), vi_Edges;
+	  vector<bool> vb_NewEdgeColumn(i_ColumnCount, false);
+	  vi_LeftVertices.reserve(STEP_UP(i_RowCount));
+	  vi_LeftVertices.push_back(_FALSE);
+	  vi_Edges.reserve(m_vi_Edges.size() + 2 * vi_Inserted.size());
+
+	  // vi_Mark[c] == 3*i: the edge i-c is to be deleted, vi_Mark[c] == 3*i+1: the edge i-c is in the new graph,
+	  // vi_Mark[c] == 3*i+2: the edge i-c was in the graph and has been deleted
+	  vector<int> vi_Mark(i_ColumnCount, _UNKNOWN);
+
+	  for(int i=0; i<i_RowCount; i++)
+	    {
+	      bool b_NewEdge = false;
+
+	      for(int j=vi_DeletedBegin[i]; j<vi_DeletedBegin[STEP_UP(i)]; j++) vi_Mark[vi_Deleted[j]] = 3 * i;
+
+	      if(i < i_OldRowCount)
+		{
+		  for(int j=m_vi_LeftVertices[i]; j<m_vi_LeftVertices[STEP_UP(i)]; j++)
+		    {
+		      int c = m_vi_Edges[j];
+		      if(vi_Mark[c] == 3 * i) { vi_Mark[c] = 3 * i + 2; continue; }
+		      if(vi_Mark[c] == 3 * i + 1 || vi_Mark[c] == 3 * i + 2) continue;
+		      vi_Mark[c] = 3 * i + 1;
+		      vi_Edges.push_back(c);
+		    }
+		}
+
+	      for(int j=vi_InsertedBegin[i]; j<vi_InsertedBegin[STEP_UP(i)]; j++)
+		{
+		  int c = vi_Inserted[j];
+		  if(vi_Mark[c] == 3 * i + 1) continue;
+		  // an edge of the graph deleted and inserted again in the same batch is not new,
+		  // an edge deleted while not in the graph and then inserted is
+		  if(vi_Mark[c] != 3 * i + 2) { b_NewEdge = true; vb_NewEdgeColumn[c] = true; }
+		  vi_Mark[c] = 3 * i + 1;
+		  vi_Edges.push_back(c);
+		}
+
+	      if(b_NewEdge) vi_NewEdgeRows.push_back(i);
+
+	      vi_LeftVertices.push_back((signed) vi_Edges.size());
+	    }
+
+	  for(int i=0; i<i_ColumnCount; i++)
+	    {
+	      if(vb_NewEdgeColumn[i]) vi_NewEdgeColumns.push_back(i);
+	    }
+
+	  // the columns follow the rows in m_vi_Edges, each column lists its rows in increasing order
+	  int i_EdgeCount = (signed) vi_Edges.size();
+	  for(int j=0; j<i_EdgeCount; j++) vi_RightVertices[STEP_UP(vi_Edges[j])]++;
+	  vi_RightVertices[0] = i_EdgeCount;
+	  for(int i=0; i<i_ColumnCount; i++) vi_RightVertices[STEP_UP(i)] += vi_RightVertices[i];
+	  vi_Edges.resize(2 * i_EdgeCount);
+	  {
+	    vector<int> vi_RightTail(vi_RightVertices.begin(), vi_RightVertices.end() - 1);
+	    for(int i=0; i<i_RowCount; i++)
+	      {
+		for(int j=vi_LeftVertices[i]; j<vi_LeftVertices[STEP_UP(i)]; j++) vi_Edges[vi_RightTail[vi_Edges[j]]++] = i;
+	      }
+	  }
+
+	  m_vi_LeftVertices.swap(vi_LeftVertices);
+	  m_vi_RightVertices.swap(vi_RightVertices);
+	  m_vi_Edges.swap(vi_Edges);
+
+	  // the edge numbering of the map is no longer valid
+	  m_mimi2_VertexEdgeMap.clear();
+
+	  m_i_MaximumLeftVertexDegree = m_i_MaximumRightVertexDegree = m_i_MaximumVertexDegree = _UNKNOWN;
+	  m_i_MinimumLeftVertexDegree = m_i_MinimumRightVertexDegree = m_i_MinimumVertexDegree = _UNKNOWN;
+
+	  CalculateVertexDegrees();
+
+	  return(_TRUE);
+	}
+
 	int BipartiteGraphInputOutput::BuildBPGraphFromADICFormat(std::list<std::set<int> > *  lsi_SparsityPattern, int i_ColumnCount) {
 	  //int i;  //unused variable
 	  //unsigned int j; //unused variable
@@ -38,6 +38,27 @@ namespace ColPack
 		*/
 		int BuildBPGraphFromCSRFormat(int* ip_RowIndex, int i_RowCount, int i_ColumnCount, int* ip_ColumnIndex);
 
+		/// Same as above with the zero-based CSR arrays in vectors (i_RowCount = vi_RowIndex.size()-1), in O(|V| + |E|)
+		/**
+		The neighbors of a row keep their order in vi_ColumnIndex; the neighbors of a column are sorted.
+
+		Return value:
+		- _TRUE upon successful, _FALSE if a column index is out of [0, i_ColumnCount)
+		*/
+		int BuildBPGraphFromCSRFormat(const vector<int> & vi_RowIndex, const vector<int> & vi_ColumnIndex, int i_ColumnCount);
+
+		/// Delete then insert a batch of edges (row, column) in the bipartite graph, in O(|V| + |E| + batch size)
+		/**
+		A row or column index past the last one adds rows or columns, deletions of missing edges are ignored.
+		The remaining neighbors of a row keep their order and the inserted ones are appended; the neighbors of a column are sorted.
+		Postcondition:
+		- vi_NewEdgeRows and vi_NewEdgeColumns hold, in increasing order, the rows and the columns incident to an edge that was not in the graph before
+
+		Return value:
+		- _TRUE upon successful, _UNKNOWN if an edge has a negative end point
+		*/
+		int UpdateEdges(const vector< pair<int, int> > & vpii_InsertedEdges, const vector< pair<int, int> > & vpii_DeletedEdges, vector<int> & vi_NewEdgeRows, vector<int> & vi_NewEdgeColumns);
+
 		/// Read the sparsity pattern of Jacobian matrix represented in ADOLC format (Row Compressed format) and build a corresponding adjacency graph.
 		/** Equivalent to RowCompressedFormat2BipartiteGraph
 		Precondition:
@@ -1664,7 +1664,7 @@ namespace ColPack
 				}
 				else
 				{
-					m_vi_IncludedLeftVertices[i_SelectedVertex - i_LeftVertexCount] = _FALSE;
+					m_vi_IncludedRightVertices[i_SelectedVertex - i_LeftVertexCount] = _FALSE;
 				}
 
 				continue;
@@ -1743,7 +1743,7 @@ namespace ColPack
 						continue;
 					}
 
-					for(j=m_vi_RightVertices[i_NeighboringVertex]; j<m_vi_RightVertices[STEP_UP(i_NeighboringVertex)]; j++)
+					for(j=m_vi_LeftVertices[i_NeighboringVertex]; j<m_vi_LeftVertices[STEP_UP(i_NeighboringVertex)]; j++)
 					{
 						i_SecondNeighboringVertex = m_vi_Edges[j];
 
@@ -2037,5 +2037,580 @@ namespace ColPack
 		output = (m_vi_CoveredRightVertices);
 	}
 
+	//Public Function 3363
+	int BipartiteGraphVertexCover::CoverVertex_Matching()
+	{
+		int i_LeftVertexCount = STEP_DOWN((signed) m_vi_LeftVertices.size());
+		int i_RightVertexCount = STEP_DOWN((signed) m_vi_RightVertices.size());
+
+		vector<int> vi_LeftMate, vi_RightMate;
+
+		double d_StartTime = Timer::GetWallClock();
+
+		MatchVertex_OMP(vi_LeftMate, vi_RightMate);
+
+		m_vi_IncludedLeftVertices.assign((unsigned) i_LeftVertexCount, _FALSE);
+		m_vi_IncludedRightVertices.assign((unsigned) i_RightVertexCount, _FALSE);
+
+		//Both ends of every matched edge: a maximal matching leaves no edge with two free ends
+#ifdef _OPENMP
+		#pragma omp parallel for
+#endif
+		for(int i=0; i<i_LeftVertexCount; i++)
+		{
+			if(vi_LeftMate[i] != _UNKNOWN)
+			{
+				m_vi_IncludedLeftVertices[i] = _TRUE;
+
+				m_vi_IncludedRightVertices[vi_LeftMate[i]] = _TRUE;
+			}
+		}
+
+		SetCoveredVertices();
+
+		m_d_CoveringTime = Timer::GetWallClock() - d_StartTime;
+
+		return(_TRUE);
+	}
+
+
+	//Public Function 3364
+	int BipartiteGraphVertexCover::CoverVertex_Konig()
+	{
+		int i, j;
+
+		int i_LeftVertexCount = STEP_DOWN((signed) m_vi_LeftVertices.size());
+		int i_RightVertexCount = STEP_DOWN((signed) m_vi_RightVertices.size());
+
+		vector<int> vi_LeftMate, vi_RightMate;
+
+		double d_StartTime = Timer::GetWallClock();
+
+		//Hopcroft-Karp, started from the parallel maximal matching
+		MatchVertex_OMP(vi_LeftMate, vi_RightMate);
+
+		vector<int> vi_Distance((unsigned) i_LeftVertexCount);
+		vector<int> vi_Cursor((unsigned) i_LeftVertexCount);
+		vector<int> vi_Queue, vi_Stack;
+
+		vi_Queue.reserve((unsigned) i_LeftVertexCount);
+
+		while(true)
+		{
+			//Layer the free and the matched rows by alternating distance from the free rows
+			vi_Queue.clear();
+
+			for(i=0; i<i_LeftVertexCount; i++)
+			{
+				if(vi_LeftMate[i] == _UNKNOWN)
+				{
+					vi_Distance[i] = _FALSE;
+
+					vi_Queue.push_back(i);
+				}
+				else
+				{
+					vi_Distance[i] = _UNKNOWN;
+				}
+			}
+
+			int i_FreeDistance = _UNKNOWN;
+
+			for(size_t q=0; q<vi_Queue.size(); q++)
+			{
+				int i_PresentVertex = vi_Queue[q];
+
+				if((i_FreeDistance != _UNKNOWN) && (vi_Distance[i_PresentVertex] >= i_FreeDistance))
+				{
+					break;
+				}
+
+				for(j=m_vi_LeftVertices[i_PresentVertex]; j<m_vi_LeftVertices[STEP_UP(i_PresentVertex)]; j++)
+				{
+					int i_MateVertex = vi_RightMate[m_vi_Edges[j]];
+
+					if(i_MateVertex == _UNKNOWN)
+					{
+						i_FreeDistance = STEP_UP(vi_Distance[i_PresentVertex]);
+					}
+					else if(vi_Distance[i_MateVertex] == _UNKNOWN)
+					{
+						vi_Distance[i_MateVertex] = STEP_UP(vi_Distance[i_PresentVertex]);
+
+						vi_Queue.push_back(i_MateVertex);
+					}
+				}
+			}
+
+			if(i_FreeDistance == _UNKNOWN)
+			{
+				break;
+			}
+
+			//Vertex disjoint shortest augmenting paths, iterative depth first search along the layers
+			for(i=0; i<i_LeftVertexCount; i++)
+			{
+				vi_Cursor[i] = m_vi_LeftVertices[i];
+			}
+
+			for(i=0; i<i_LeftVertexCount; i++)
+			{
+				if(vi_LeftMate[i] != _UNKNOWN)
+				{
+					continue;
+				}
+
+				vi_Stack.clear();
+
+				vi_Stack.push_back(i);
+
+				while(!vi_Stack.empty())
+				{
+					int i_PresentVertex = vi_Stack.back();
+
+					if(vi_Cursor[i_PresentVertex] == m_vi_LeftVertices[STEP_UP(i_PresentVertex)])
+					{
+						//Dead end, no later search goes through it in this phase
+						vi_Distance[i_PresentVertex] = _UNKNOWN;
+
+						vi_Stack.pop_back();
+
+						if(!vi_Stack.empty())
+						{
+							vi_Cursor[vi_Stack.back()]++;
+						}
+
+						continue;
+					}
+
+					int i_NeighboringVertex = m_vi_Edges[vi_Cursor[i_PresentVertex]];
+
+					int i_MateVertex = vi_RightMate[i_NeighboringVertex];
+
+					if(i_MateVertex == _UNKNOWN)
+					{
+						if(STEP_UP(vi_Distance[i_PresentVertex]) != i_FreeDistance)
+						{
+							vi_Cursor[i_PresentVertex]++;
+
+							continue;
+						}
+
+						//Flip the path held in the stack
+						for(size_t k=0; k<vi_Stack.size(); k++)
+						{
+							int i_PathVertex = vi_Stack[k];
+
+							vi_LeftMate[i_PathVertex] = m_vi_Edges[vi_Cursor[i_PathVertex]];
+
+							vi_RightMate[vi_LeftMate[i_PathVertex]] = i_PathVertex;
+
+							vi_Distance[i_PathVertex] = _UNKNOWN;
+						}
+
+						break;
+					}
+
+					if((vi_Distance[i_MateVertex] != _UNKNOWN) && (vi_Distance[i_MateVertex] == STEP_UP(vi_Distance[i_PresentVertex])))
+					{
+						vi_Stack.push_back(i_MateVertex);
+					}
+					else
+					{
+						vi_Cursor[i_PresentVertex]++;
+					}
+				}
+			}
+		}
+
+		//König: Z holds the vertices reached from the free rows by alternating paths, the cover is (rows - Z) + (columns in Z)
+		vector<int> vi_ReachedLeftVertices((unsigned) i_LeftVertexCount, _FALSE);
+
+		m_vi_IncludedRightVertices.assign((unsigned) i_RightVertexCount, _FALSE);
+
+		vi_Queue.clear();
+
+		for(i=0; i<i_LeftVertexCount; i++)
+		{
+			if(vi_LeftMate[i] == _UNKNOWN)
+			{
+				vi_ReachedLeftVertices[i] = _TRUE;
+
+				vi_Queue.push_back(i);
+			}
+		}
+
+		for(size_t q=0; q<vi_Queue.size(); q++)
+		{
+			int i_PresentVertex = vi_Queue[q];
+
+			for(j=m_vi_LeftVertices[i_PresentVertex]; j<m_vi_LeftVertices[STEP_UP(i_PresentVertex)]; j++)
+			{
+				int i_NeighboringVertex = m_vi_Edges[j];
+
+				if(m_vi_IncludedRightVertices[i_NeighboringVertex] == _TRUE)
+				{
+					continue;
+				}
+
+				m_vi_IncludedRightVertices[i_NeighboringVertex] = _TRUE;
+
+				//A reached column is matched, else the path would augment
+				int i_MateVertex = vi_RightMate[i_NeighboringVertex];
+
+				if(vi_ReachedLeftVertices[i_MateVertex] == _FALSE)
+				{
+					vi_ReachedLeftVertices[i_MateVertex] = _TRUE;
+
+					vi_Queue.push_back(i_MateVertex);
+				}
+			}
+		}
+
+		m_vi_IncludedLeftVertices.resize((unsigned) i_LeftVertexCount);
+
+#ifdef _OPENMP
+		#pragma omp parallel for
+#endif
+		for(i=0; i<i_LeftVertexCount; i++)
+		{
+			m_vi_IncludedLeftVertices[i] = vi_ReachedLeftVertices[i] == _TRUE ? _FALSE : _TRUE;
+		}
+
+		SetCoveredVertices();
+
+		m_d_CoveringTime = Timer::GetWallClock() - d_StartTime;
+
+		return(_TRUE);
+	}
+
+
+	//Public Function 3365
+	int BipartiteGraphVertexCover::CoverVertex_DegreeGreedy()
+	{
+		int i_LeftVertexCount = STEP_DOWN((signed) m_vi_LeftVertices.size());
+		int i_RightVertexCount = STEP_DOWN((signed) m_vi_RightVertices.size());
+
+		int i_VertexCount = i_LeftVertexCount + i_RightVertexCount;
+
+		double d_StartTime = Timer::GetWallClock();
+
+		//Rows are 0 .. i_LeftVertexCount - 1 and columns follow, vi_Degree counts the uncovered edges of a vertex
+		vector<int> vi_Degree((unsigned) i_VertexCount);
+		vector<int> vi_Included((unsigned) i_VertexCount, _FALSE);
+		vector<int> vi_Selected((unsigned) i_VertexCount, _FALSE);
+
+#ifdef _OPENMP
+		#pragma omp parallel for
+#endif
+		for(int i=0; i<i_VertexCount; i++)
+		{
+			if(i < i_LeftVertexCount)
+			{
+				vi_Degree[i] = m_vi_LeftVertices[STEP_UP(i)] - m_vi_LeftVertices[i];
+			}
+			else
+			{
+				vi_Degree[i] = m_vi_RightVertices[STEP_UP(i - i_LeftVertexCount)] - m_vi_RightVertices[i - i_LeftVertexCount];
+			}
+		}
+
+		vector<int> vi_ActiveVertices, vi_RemainingVertices;
+
+		for(int i=0; i<i_VertexCount; i++)
+		{
+			if(vi_Degree[i] > 0)
+			{
+				vi_ActiveVertices.push_back(i);
+			}
+		}
+
+		//Each round takes every vertex whose uncovered degree beats those of all its uncovered neighbors (ties to the
+		//larger index), an independent set that always holds the vertex of largest uncovered degree
+		while(!vi_ActiveVertices.empty())
+		{
+			int i_ActiveVertexCount = (signed) vi_ActiveVertices.size();
+
+#ifdef _OPENMP
+			#pragma omp parallel for schedule(dynamic, 64)
+#endif
+			for(int i=0; i<i_ActiveVertexCount; i++)
+			{
+				int i_PresentVertex = vi_ActiveVertices[i];
+
+				int i_PresentDegree = vi_Degree[i_PresentVertex];
+
+				const vector<int> & vi_Pointers = i_PresentVertex < i_LeftVertexCount ? m_vi_LeftVertices : m_vi_RightVertices;
+
+				int i_Offset = i_PresentVertex < i_LeftVertexCount ? i_LeftVertexCount : _FALSE;
+
+				int i_Local = i_PresentVertex < i_LeftVertexCount ? i_PresentVertex : i_PresentVertex - i_LeftVertexCount;
+
+				vi_Selected[i_PresentVertex] = _TRUE;
+
+				for(int j=vi_Pointers[i_Local]; j<vi_Pointers[STEP_UP(i_Local)]; j++)
+				{
+					int i_NeighboringVertex = m_vi_Edges[j] + i_Offset;
+
+					if((vi_Included[i_NeighboringVertex] == _TRUE) || (vi_Degree[i_NeighboringVertex] == _FALSE))
+					{
+						continue;
+					}
+
+					if((vi_Degree[i_NeighboringVertex] > i_PresentDegree) || ((vi_Degree[i_NeighboringVertex] == i_PresentDegree) && (i_NeighboringVertex > i_PresentVertex)))
+					{
+						vi_Selected[i_PresentVertex] = _FALSE;
+
+						break;
+					}
+				}
+			}
+
+			//Cover the edges of the selected vertices
+#ifdef _OPENMP
+			#pragma omp parallel for schedule(dynamic, 64)
+#endif
+			for(int i=0; i<i_ActiveVertexCount; i++)
+			{
+				int i_PresentVertex = vi_ActiveVertices[i];
+
+				if(vi_Selected[i_PresentVertex] == _FALSE)
+				{
+					continue;
+				}
+
+				const vector<int> & vi_Pointers = i_PresentVertex < i_LeftVertexCount ? m_vi_LeftVertices : m_vi_RightVertices;
+
+				int i_Offset = i_PresentVertex < i_LeftVertexCount ? i_LeftVertexCount : _FALSE;
+
+				int i_Local = i_PresentVertex < i_LeftVertexCount ? i_PresentVertex : i_PresentVertex - i_LeftVertexCount;
+
+				for(int j=vi_Pointers[i_Local]; j<vi_Pointers[STEP_UP(i_Local)]; j++)
+				{
+					int i_NeighboringVertex = m_vi_Edges[j] + i_Offset;
+
+					//No selected vertex has a selected neighbor, so the inclusions of this round are not seen here
+					if((vi_Included[i_NeighboringVertex] == _TRUE) || (vi_Selected[i_NeighboringVertex] == _TRUE))
+					{
+						continue;
+					}
+
+#ifdef _OPENMP
+					#pragma omp atomic
+#endif
+					vi_Degree[i_NeighboringVertex]--;
+				}
+			}
+
+			vi_RemainingVertices.clear();
+
+			for(int i=0; i<i_ActiveVertexCount; i++)
+			{
+				int i_PresentVertex = vi_ActiveVertices[i];
+
+				if(vi_Selected[i_PresentVertex] == _TRUE)
+				{
+					vi_Included[i_PresentVertex] = _TRUE;
+
+					vi_Selected[i_PresentVertex] = _FALSE;
+
+					vi_Degree[i_PresentVertex] = _FALSE;
+				}
+				else if(vi_Degree[i_PresentVertex] > 0)
+				{
+					vi_RemainingVertices.push_back(i_PresentVertex);
+				}
+			}
+
+			vi_ActiveVertices.swap(vi_RemainingVertices);
+		}
+
+		m_vi_IncludedLeftVertices.assign(vi_Included.begin(), vi_Included.begin() + i_LeftVertexCount);
+		m_vi_IncludedRightVertices.assign(vi_Included.begin() + i_LeftVertexCount, vi_Included.end());
+
+		SetCoveredVertices();
+
+		m_d_CoveringTime = Timer::GetWallClock() - d_StartTime;
+
+		return(_TRUE);
+	}
+
+
+	//Public Function 3366
+	int BipartiteGraphVertexCover::CoverVertex(string s_VertexCoverVariant)
+	{
+		s_VertexCoverVariant = toUpper(s_VertexCoverVariant);
+
+		if(s_VertexCoverVariant == "MATCHING")
+		{
+			return(CoverVertex_Matching());
+		}
+		else if(s_VertexCoverVariant == "KONIG")
+		{
+			return(CoverVertex_Konig());
+		}
+		else if(s_VertexCoverVariant == "DEGREE_GREEDY")
+		{
+			return(CoverVertex_DegreeGreedy());
+		}
+		else if(s_VertexCoverVariant == "MINIMAL")
+		{
+			double d_StartTime = Timer::GetWallClock();
+
+			int i_CoverStatus = CoverMinimalVertex();
+
+			m_d_CoveringTime = Timer::GetWallClock() - d_StartTime;
+
+			return(i_CoverStatus);
+		}
+
+		cerr<<"*ERROR: Unknown vertex cover "<<s_VertexCoverVariant<<", use MATCHING, KONIG, DEGREE_GREEDY or MINIMAL"<<endl;
+
+		return(_FALSE);
+	}
+
+
+	//Public Function 3367
+	int BipartiteGraphVertexCover::GetVertexCoverSize()
+	{
+		return((signed) (m_vi_CoveredLeftVertices.size() + m_vi_CoveredRightVertices.size()));
+	}
+
+
+	//Public Function 3368
+	double BipartiteGraphVertexCover::GetVertexCoveringTime()
+	{
+		return(m_d_CoveringTime);
+	}
+
+
+	//Private Function 3369
+	int BipartiteGraphVertexCover::MatchVertex_OMP(vector<int> & vi_LeftMate, vector<int> & vi_RightMate)
+	{
+		int i_LeftVertexCount = STEP_DOWN((signed) m_vi_LeftVertices.size());
+		int i_RightVertexCount = STEP_DOWN((signed) m_vi_RightVertices.size());
+
+		int i_MatchingSize = _FALSE;
+
+		vi_LeftMate.assign((unsigned) i_LeftVertexCount, _UNKNOWN);
+		vi_RightMate.assign((unsigned) i_RightVertexCount, _UNKNOWN);
+
+		vector<int> vi_Proposer((unsigned) i_RightVertexCount, _UNKNOWN);
+		vector<int> vi_Proposal((unsigned) i_LeftVertexCount, _UNKNOWN);
+
+		//Only the matched columns are passed, so a row never looks twice at the same edge
+		vector<int> vi_Cursor(m_vi_LeftVertices.begin(), m_vi_LeftVertices.end() - 1);
+
+		vector<int> vi_FreeVertices, vi_RemainingVertices;
+
+		for(int i=0; i<i_LeftVertexCount; i++)
+		{
+			if(m_vi_LeftVertices[STEP_UP(i)] > m_vi_LeftVertices[i])
+			{
+				vi_FreeVertices.push_back(i);
+			}
+		}
+
+		//Every free row proposes to its first free column, one proposer per column wins; the matching is maximal once no
+		//free row has a free column left
+		while(!vi_FreeVertices.empty())
+		{
+			int i_FreeVertexCount = (signed) vi_FreeVertices.size();
+
+#ifdef _OPENMP
+			#pragma omp parallel for schedule(dynamic, 64)
+#endif
+			for(int i=0; i<i_FreeVertexCount; i++)
+			{
+				int i_PresentVertex = vi_FreeVertices[i];
+
+				int j = vi_Cursor[i_PresentVertex];
+
+				while((j < m_vi_LeftVertices[STEP_UP(i_PresentVertex)]) && (vi_RightMate[m_vi_Edges[j]] != _UNKNOWN))
+				{
+					j++;
+				}
+
+				vi_Cursor[i_PresentVertex] = j;
+
+				if(j == m_vi_LeftVertices[STEP_UP(i_PresentVertex)])
+				{
+					vi_Proposal[i_PresentVertex] = _UNKNOWN;
+
+					continue;
+				}
+
+				vi_Proposal[i_PresentVertex] = m_vi_Edges[j];
+
+#ifdef _OPENMP
+				#pragma omp atomic write
+#endif
+				vi_Proposer[m_vi_Edges[j]] = i_PresentVertex;
+			}
+
+#ifdef _OPENMP
+			#pragma omp parallel for reduction(+:i_MatchingSize)
+#endif
+			for(int i=0; i<i_FreeVertexCount; i++)
+			{
+				int i_PresentVertex = vi_FreeVertices[i];
+
+				int i_ProposedVertex = vi_Proposal[i_PresentVertex];
+
+				if((i_ProposedVertex != _UNKNOWN) && (vi_Proposer[i_ProposedVertex] == i_PresentVertex))
+				{
+					vi_LeftMate[i_PresentVertex] = i_ProposedVertex;
+
+					vi_RightMate[i_ProposedVertex] = i_PresentVertex;
+
+					i_MatchingSize++;
+				}
+			}
+
+			vi_RemainingVertices.clear();
+
+			for(int i=0; i<i_FreeVertexCount; i++)
+			{
+				if((vi_LeftMate[vi_FreeVertices[i]] == _UNKNOWN) && (vi_Proposal[vi_FreeVertices[i]] != _UNKNOWN))
+				{
+					vi_RemainingVertices.push_back(vi_FreeVertices[i]);
+				}
+			}
+
+			vi_FreeVertices.swap(vi_RemainingVertices);
+		}
+
+		return(i_MatchingSize);
+	}
+
+
+	//Private Function 3370
+	void BipartiteGraphVertexCover::SetCoveredVertices()
+	{
+		int i_LeftVertexCount = (signed) m_vi_IncludedLeftVertices.size();
+		int i_RightVertexCount = (signed) m_vi_IncludedRightVertices.size();
+
+		m_vi_CoveredLeftVertices.clear();
+		m_vi_CoveredRightVertices.clear();
+
+		for(int i=0; i<i_LeftVertexCount; i++)
+		{
+			if(m_vi_IncludedLeftVertices[i] == _TRUE)
+			{
+				m_vi_CoveredLeftVertices.push_back(i);
+			}
+		}
+
+		for(int i=0; i<i_RightVertexCount; i++)
+		{
+			if(m_vi_IncludedRightVertices[i] == _TRUE)
+			{
+				m_vi_CoveredRightVertices.push_back(i);
+			}
+		}
+
+		return;
+	}
+
 
 }
@@ -76,6 +76,52 @@ namespace ColPack
 		//Public Function 3362
 		void PrintBicoloringVertexCover();
 
+		//Public Function 3363
+		/// 2-approximate vertex cover: both ends of every edge of a parallel maximal matching
+		int CoverVertex_Matching();
+
+		//Public Function 3364
+		/// Minimum vertex cover by König's theorem on a Hopcroft-Karp maximum matching
+		/**
+		 * The matching starts from MatchVertex_OMP(), the augmenting phases are serial. With Z the vertices reached from the
+		 * free rows by alternating paths, the cover is the rows not in Z and the columns in Z; its size is the matching size.
+		 */
+		int CoverVertex_Konig();
+
+		//Public Function 3365
+		/// Parallel degree greedy vertex cover
+		/**
+		 * Each round includes every vertex whose number of uncovered edges is larger than those of all its uncovered
+		 * neighbors (ties broken by index), which always holds the vertex the serial greedy would take next.
+		 */
+		int CoverVertex_DegreeGreedy();
+
+		//Public Function 3366
+		/// Run the vertex cover "MATCHING", "KONIG", "DEGREE_GREEDY" or "MINIMAL" (CoverMinimalVertex()) and time it
+		int CoverVertex(string s_VertexCoverVariant);
+
+		//Public Function 3367
+		/// Number of covered rows and columns of the last vertex cover
+		int GetVertexCoverSize();
+
+		//Public Function 3368
+		/// Wall time of the last vertex cover of the functions 3363 to 3366 (Timer::GetWallClock()); the serial covers of the bicolorings measure it with Timer
+		double GetVertexCoveringTime();
+
+	private:
+
+		//Private Function 3369
+		/// Parallel greedy maximal matching: the free rows propose to their first free column, one proposer per column wins
+		/**
+		 * vi_LeftMate[i] is the column matched to row i and vi_RightMate[j] the row matched to column j, _UNKNOWN if
+		 * free. Rounds repeat until no free row has a free column. Return the number of matched edges.
+		 */
+		int MatchVertex_OMP(vector<int> & vi_LeftMate, vector<int> & vi_RightMate);
+
+		//Private Function 3370
+		/// Rebuild m_vi_CoveredLeftVertices and m_vi_CoveredRightVertices from the included flags
+		void SetCoveredVertices();
+
 	};
 }
 #endif
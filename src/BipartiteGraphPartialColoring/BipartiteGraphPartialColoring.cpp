@@ -162,8 +162,17 @@ namespace ColPack
 		Seed_reset();
 	}
 
+	void BipartiteGraphPartialColoring::SetMatrixAllocation(int i_MatrixAllocation) {
+		m_i_MatrixAllocation = i_MatrixAllocation;
+	}
+
+	int BipartiteGraphPartialColoring::GetMatrixAllocation() {
+		return m_i_MatrixAllocation;
+	}
+
 	void BipartiteGraphPartialColoring::Seed_init() {
 		seed_available = false;
+		m_i_MatrixAllocation = MATRIX_ALLOC_ROWS;
 
 		i_seed_rowCount = 0;
 		dp2_Seed = NULL;
@@ -173,7 +182,7 @@ namespace ColPack
 		if(seed_available) {
 			seed_available = false;
 
-			free_2DMatrix(dp2_Seed, i_seed_rowCount);
+			free_2DMatrix_slab(dp2_Seed);
 			dp2_Seed = NULL;
 			i_seed_rowCount = 0;
 		}
@@ -220,6 +229,8 @@ namespace ColPack
 		m_vi_LeftVertexColorFrequency.clear();
 		m_vi_RightVertexColorFrequency.clear();
 
+		m_vi_ConflictsPerRound.clear();
+
 		return;
 	}
 
@@ -264,6 +275,8 @@ namespace ColPack
 		m_vi_LeftVertexColorFrequency.clear();
 		m_vi_RightVertexColorFrequency.clear();
 
+		m_vi_ConflictsPerRound.clear();
+
 		return;
 	}
 
@@ -276,147 +289,7 @@ namespace ColPack
 			return(_TRUE);
 		}
 
-		int i_LeftVertexCount;
-                //int i_CurrentVertex;    //unused variable
-                //int i_RightVertexCount  //unused variable
-
-		bool cont=false;
-		vector<int> vi_forbiddenColors, vi_VerticesToBeColored, vi_verticesNeedNewColor;
-		i_LeftVertexCount = (int) m_vi_LeftVertices.size() - 1;
-		//i_RightVertexCount = (int)m_vi_RightVertices.size () - 1;
-		m_i_LeftVertexColorCount = m_i_RightVertexColorCount = m_i_VertexColorCount = 0;
-
-		// !!! do sections for this part ? forbiddenColors may need to be private for each thread
-		// resize the colors
-		m_vi_LeftVertexColors.resize ( i_LeftVertexCount, _UNKNOWN );
-		// resize the forbidden colors. !!! should be resize to max D2 degree instead
-		vi_forbiddenColors.resize ( i_LeftVertexCount, _UNKNOWN );
-		//Algo 4 - Line 2: U <- V . U is vi_VerticesToBeColored
-		vi_VerticesToBeColored.reserve(i_LeftVertexCount);
-		for(int i=0; i<i_LeftVertexCount; i++) {
-			vi_VerticesToBeColored.push_back(m_vi_OrderedVertices[i]);
-			//vi_VerticesToBeColored.push_back(i);
-		}
-		// !!! pick reasonable amount to reserve
-		vi_verticesNeedNewColor.reserve(i_LeftVertexCount);
-
-		int i_NumOfVerticesToBeColored = vi_VerticesToBeColored.size();
-
-// 		cout<<"m_vi_Edges.size() = "<<m_vi_Edges.size()<<endl;
-// 		cout<<"m_vi_LeftVertexColors.size() = "<<m_vi_LeftVertexColors.size()<<endl;
-
-		//Algo 4 - Line 3: while U != 0 ; do
-		while(i_NumOfVerticesToBeColored!=0) {
-// 		  cout<<"i_NumOfVerticesToBeColored = "<<i_NumOfVerticesToBeColored<<endl;
-			//Phase 1: tentative coloring
-			//Algo 4 - Line 4: for each right vertex v in U (in parallel) do
-#ifdef _OPENMP
-#pragma omp parallel for default(none) schedule(dynamic) shared(cout, i_NumOfVerticesToBeColored, vi_VerticesToBeColored) firstprivate(vi_forbiddenColors)
-#endif
-                    for(int i=0; i<i_NumOfVerticesToBeColored; i++) {
-				int v = vi_VerticesToBeColored[i];
-// 				CoutLock::set(); cout<<"t"<< omp_get_thread_num() <<": i="<<i<<", left vertex v="<<v<<endl;CoutLock::unset();
-				//Algo 4 - Line 5: for each left vertex w in adj (v) do
-				for (int w=m_vi_LeftVertices [v]; w<m_vi_LeftVertices [v+1]; w++ ) {
-// 					CoutLock::set();
-// 					cout<<"\t t"<< omp_get_thread_num() <<": w="<<w<<", right vertex m_vi_Edges [w]="<<m_vi_Edges [w]<<endl;
-// 					CoutLock::unset();
-					//Algo 4 - Line 6: mark color [w] as forbidden to vertex v. NOTE: !!! Not needed
-					//Algo 4 - Line 7: for each right vertex x in adj (w) and x != v do
-					for (int x=m_vi_RightVertices [m_vi_Edges [w]]; x<m_vi_RightVertices [m_vi_Edges [w]+1]; x++ ) {
-						//Algo 4 - Line 8: mark color [x] as forbidden to vertex v
-						if ( m_vi_LeftVertexColors [m_vi_Edges [x]] != _UNKNOWN ) {
-// 							CoutLock::set();
-// 							cout<<"\t\t t"<< omp_get_thread_num() <<": x="<<x<<endl;
-// 							if(x>=m_vi_Edges.size()) {
-// 							  cout<<"ERR: x>=m_vi_Edges.size()"<<endl;
-// 							  PrintBipartiteGraph();
-// 							  Pause();
-// 							}
-// 							cout<<"\t\t left vertex m_vi_Edges [x] = "<<m_vi_Edges [x]<<endl;
-// 							cout<<"\t\t m_vi_LeftVertexColors [m_vi_Edges [x]] = "<<m_vi_LeftVertexColors [m_vi_Edges [x]]<<endl;
-// 							cout<<"\t\t v="<<v<<endl;
-// 							CoutLock::unset();
-							// !!! each thread should has their own vi_forbiddenColors[] vector just to make sure the don't override each other
-							vi_forbiddenColors [m_vi_LeftVertexColors [m_vi_Edges [x]]] = v;
-						}
-					}
-				}
-				//Algo 4 - Line 9: Pick a permissible color c for vertex v using some strategy
-				int i_cadidateColor;
-				// First fit
-				{
-					i_cadidateColor = 0;
-					while(vi_forbiddenColors[i_cadidateColor]==v) i_cadidateColor++;
-				}
-				m_vi_LeftVertexColors[v] = i_cadidateColor;
-				if(m_i_LeftVertexColorCount < i_cadidateColor)	{
-						m_i_LeftVertexColorCount = i_cadidateColor;
-				}
-			}
-
-			//Algo 4 - Line 10: R.clear()   ; R denotes the set of vertices to be recolored
-			vi_verticesNeedNewColor.clear();
-
-			//Phase 2: conflict detection. For each vertex v in U, check and see if v need to be recolored
-			//Algo 4 - Line 11: for each vertex v in U (in parallel) do
-#ifdef _OPENMP
-#pragma omp parallel for default(none) schedule(dynamic) shared(i_NumOfVerticesToBeColored, vi_VerticesToBeColored,vi_verticesNeedNewColor, cout) private(cont)
-#endif
-                        for(int i=0; i<i_NumOfVerticesToBeColored; i++) {
-				//Algo 4 - Line 12: cont  <- true ; cont is used to break from the outer loop below
-				cont = true;
-				int v = vi_VerticesToBeColored[i];
-				//Algo 4 - Line 13: for each vertex w in adj (v) and cont = true do
-				for (int w=m_vi_LeftVertices [v]; (w<m_vi_LeftVertices [v+1]) && (cont == true); w++ ) {
-					//Algo 4 - Line 14: if color [v] = color [w] and f (v) > f (w) then . NOTE: !!! Not needed
-						//Algo 4 - Line 15: add [v] to R ; break . NOTE: !!! Not needed
-					//Algo 4 - Line 16: for each vertex x in adj (w) and v != x do
-					for (int x=m_vi_RightVertices [m_vi_Edges [w]]; x<m_vi_RightVertices [m_vi_Edges [w]+1]; x++ ) {
-					  //cout<<" m_vi_LeftVertexColors [m_vi_Edges [x]="<<x<<"]"<< m_vi_LeftVertexColors [m_vi_Edges [x]] <<endl;
-					  // cout<<" m_vi_LeftVertexColors [v="<<v<<"]"<< m_vi_LeftVertexColors [v] <<endl;
-					  //cout<<"f(v="<<v<<")="<<f(v)<<endl;
-					  //cout<<"f(m_vi_Edges [x]="<<x<<")="<<f(m_vi_Edges [x])<<endl;
-						//Algo 4 - Line 17: if color [v] = color [x] and f (v) > f (x) then
-					  if ( m_vi_LeftVertexColors [m_vi_Edges [x]] == m_vi_LeftVertexColors[v] && f(v) > f(m_vi_Edges [x]) ) {
-							//Algo 4 - Line 18: add [v] to R ; cont <- false; break
-#ifdef _OPENMP
-#pragma omp critical
-#endif
-                                              {
-								vi_verticesNeedNewColor.push_back(v);
-							}
-							cont = false;
-							break;
-						}
-					}
-				}
-			}
-
-			//Algo 4 - Line 19: U <- R , i.e., vi_VerticesToBeColored <- vi_verticesNeedNewColor
-			vi_VerticesToBeColored.clear();
-			i_NumOfVerticesToBeColored = vi_verticesNeedNewColor.size();
-
-			vi_VerticesToBeColored.reserve(vi_verticesNeedNewColor.size());
-			for(size_t i=0; i<vi_verticesNeedNewColor.size(); i++) {
-			  vi_VerticesToBeColored.push_back(vi_verticesNeedNewColor[i]);
-			}
-
-			/*
-			vi_VerticesToBeColored.resize(vi_verticesNeedNewColor.size());
-#pragma omp parallel for default(none) schedule(static) shared(i_NumOfVerticesToBeColored,vi_VerticesToBeColored,vi_verticesNeedNewColor)
-			for(int i=0; i<i_NumOfVerticesToBeColored; i++) {
-				vi_VerticesToBeColored[i]=vi_verticesNeedNewColor[i];
-			}
-			//*/
-
-		}
-
-		// Note that m_i_LeftVertexColorCount has not been updated yet
-		m_i_VertexColorCount = m_i_LeftVertexColorCount;
-
-		return _TRUE;
-
+		return PartialDistanceTwoColoring_OMP(false);
 	}
 
 	int BipartiteGraphPartialColoring::PartialDistanceTwoRowColoring() {
@@ -447,6 +320,8 @@ namespace ColPack
 
 		m_i_LeftVertexColorCount = m_i_RightVertexColorCount = m_i_VertexColorCount = 0;
 
+		m_vi_ConflictsPerRound.clear();
+
 		for ( i=0; i<i_LeftVertexCount; ++i )
 		{
 			i_CurrentVertex = m_vi_OrderedVertices[i];
@@ -491,127 +366,207 @@ namespace ColPack
 		  return(_TRUE);
 		}
 
-		int i_LeftVertexCount, i_RightVertexCount;
-                //int i_CurrentVertex;  //unused variable
-		bool cont=false;
-		vector<int> vi_forbiddenColors, vi_VerticesToBeColored, vi_verticesNeedNewColor;
-		i_LeftVertexCount = (int) m_vi_LeftVertices.size() - 1;
-		i_RightVertexCount = (int)m_vi_RightVertices.size () - 1;
+		return PartialDistanceTwoColoring_OMP(true);
+	}
+
+	//Private Function 2403
+	int BipartiteGraphPartialColoring::PartialDistanceTwoColoring_OMP(bool b_ColumnColoring)
+	{
+		//The colored side and the side through which the distance two neighbors are reached
+		vector<int> & vi_ColoredVertices = b_ColumnColoring ? m_vi_RightVertices : m_vi_LeftVertices;
+		vector<int> & vi_OtherVertices = b_ColumnColoring ? m_vi_LeftVertices : m_vi_RightVertices;
+		vector<int> & vi_VertexColors = b_ColumnColoring ? m_vi_RightVertexColors : m_vi_LeftVertexColors;
+
+		int i_LeftVertexCount = STEP_DOWN((signed) m_vi_LeftVertices.size());
+		int i_VertexCount = STEP_DOWN((signed) vi_ColoredVertices.size());
+		int i_OtherVertexCount = STEP_DOWN((signed) vi_OtherVertices.size());
+
+		//The column ordering holds the columns shifted by the number of rows
+		int i_Offset = b_ColumnColoring ? i_LeftVertexCount : _FALSE;
+
 		m_i_LeftVertexColorCount = m_i_RightVertexColorCount = m_i_VertexColorCount = 0;
 
-		// !!! do sections for this part ? forbiddenColors may need to be private for each thread
-		// resize the colors
-		m_vi_RightVertexColors.resize ( i_RightVertexCount, _UNKNOWN );
-		// resize the forbidden colors. !!! should be resize to max D2 degree instead
-		vi_forbiddenColors.resize ( i_RightVertexCount, _UNKNOWN );
-		//Algo 4 - Line 2: U <- V . U is vi_VerticesToBeColored
-		vi_VerticesToBeColored.reserve(i_RightVertexCount);
-		for(int i=0; i<i_RightVertexCount; i++) {
-			vi_VerticesToBeColored.push_back(m_vi_OrderedVertices[i] - i_LeftVertexCount);
-			//vi_VerticesToBeColored.push_back(i);
-		}
-		// !!! pick reasonable amount to reserve
-		vi_verticesNeedNewColor.reserve(i_RightVertexCount);
-
-		int i_NumOfVerticesToBeColored = vi_VerticesToBeColored.size();
-
-		//Algo 4 - Line 3: while U != 0 ; do
-		while(i_NumOfVerticesToBeColored!=0) {
-		  //cout<<"i_NumOfVerticesToBeColored = "<<i_NumOfVerticesToBeColored<<endl;
-			//Phase 1: tentative coloring
-			//Algo 4 - Line 4: for each right vertex v in U (in parallel) do
+		m_vi_ConflictsPerRound.clear();
+
+		vi_VertexColors.assign(i_VertexCount, _UNKNOWN);
+
+		if(i_VertexCount <= 0)
+		{
+			return(_TRUE);
+		}
+
+		//A vertex has at most (max degree) x (max degree on the other side) distance two neighbors, so first fit picks a color below that
+		long long ll_MaxDegree = 0, ll_MaxOtherDegree = 0;
+
+		for(int i=0; i<i_VertexCount; i++)
+		{
+			if(ll_MaxDegree < vi_ColoredVertices[STEP_UP(i)] - vi_ColoredVertices[i]) ll_MaxDegree = vi_ColoredVertices[STEP_UP(i)] - vi_ColoredVertices[i];
+		}
+
+		for(int i=0; i<i_OtherVertexCount; i++)
+		{
+			if(ll_MaxOtherDegree < vi_OtherVertices[STEP_UP(i)] - vi_OtherVertices[i]) ll_MaxOtherDegree = vi_OtherVertices[STEP_UP(i)] - vi_OtherVertices[i];
+		}
+
+		int i_PaletteSize = (int) STEP_UP(min((long long) i_VertexCount, ll_MaxDegree * ll_MaxOtherDegree));
+
+		int i_MaxNumThreads;
+#ifdef _OPENMP
+		i_MaxNumThreads = omp_get_max_threads();
+#else
+		i_MaxNumThreads = 1;
+#endif
+
+		vector<int> vi_VerticesToBeColored(i_VertexCount), vi_VerticesNeedNewColor(i_VertexCount);
+
+		for(int i=0; i<i_VertexCount; i++)
+		{
+			vi_VerticesToBeColored[i] = m_vi_OrderedVertices[i] - i_Offset;
+		}
+
+		int i_NumOfVerticesToBeColored = i_VertexCount;
+
+		//vi_QueueStart[t+1] is first the size of the conflict queue of thread t, then the prefix sum
+		vector<int> vi_QueueStart(STEP_UP(i_MaxNumThreads), _FALSE);
+
+#ifdef _OPENMP
+		#pragma omp parallel
+#endif
+		{
+			int i_thread_num, i_NumThreads;
+#ifdef _OPENMP
+			i_thread_num = omp_get_thread_num();
+			i_NumThreads = omp_get_num_threads();
+#else
+			i_thread_num = 0;
+			i_NumThreads = 1;
+#endif
+			//Marks hold a per thread stamp, one per colored vertex, so they are never reset between vertices or rounds
+			vector<int> vi_ForbiddenColors(i_PaletteSize, _UNKNOWN);
+			vector<int> vi_Conflicts;
+			int i_Stamp = _UNKNOWN;
+
+			while(i_NumOfVerticesToBeColored != 0)
+			{
+				//Phase 1: tentative coloring
 #ifdef _OPENMP
-#pragma omp parallel for default(none) schedule(dynamic) shared(i_NumOfVerticesToBeColored, vi_VerticesToBeColored) firstprivate(vi_forbiddenColors)
+				#pragma omp for schedule(dynamic, 64)
 #endif
-                    for(int i=0; i<i_NumOfVerticesToBeColored; i++) {
-				int v = vi_VerticesToBeColored[i];
-				//Algo 4 - Line 5: for each left vertex w in adj (v) do
-				for (int w=m_vi_RightVertices [v]; w<m_vi_RightVertices [v+1]; w++ ) {
-					//Algo 4 - Line 6: mark color [w] as forbidden to vertex v. NOTE: !!! Not needed
-					//Algo 4 - Line 7: for each right vertex x in adj (w) and x != v do
-					for (int x=m_vi_LeftVertices [m_vi_Edges [w]]; x<m_vi_LeftVertices [m_vi_Edges [w]+1]; x++ ) {
-						//Algo 4 - Line 8: mark color [x] as forbidden to vertex v
-						if ( m_vi_RightVertexColors [m_vi_Edges [x]] != _UNKNOWN ) {
-							// !!! each thread should has their own vi_forbiddenColors[] vector just to make sure the don't override each other
-							vi_forbiddenColors [m_vi_RightVertexColors [m_vi_Edges [x]]] = v;
+				for(int i=0; i<i_NumOfVerticesToBeColored; i++)
+				{
+					int v = vi_VerticesToBeColored[i];
+
+					i_Stamp++;
+
+					for(int w=vi_ColoredVertices[v]; w<vi_ColoredVertices[STEP_UP(v)]; w++)
+					{
+						for(int x=vi_OtherVertices[m_vi_Edges[w]]; x<vi_OtherVertices[STEP_UP(m_vi_Edges[w])]; x++)
+						{
+							int i_Color = vi_VertexColors[m_vi_Edges[x]];
+
+							if((i_Color != _UNKNOWN) && (m_vi_Edges[x] != v))
+							{
+								vi_ForbiddenColors[i_Color] = i_Stamp;
+							}
 						}
 					}
+
+					int c = 0;
+
+					while(vi_ForbiddenColors[c] == i_Stamp)
+					{
+						c++;
+					}
+
+					vi_VertexColors[v] = c;
 				}
-				//Algo 4 - Line 9: Pick a permissible color c for vertex v using some strategy
-				int i_cadidateColor;
-				// First fit
-				{
-					i_cadidateColor = 0;
-					while(vi_forbiddenColors[i_cadidateColor]==v) i_cadidateColor++;
-				}
-				m_vi_RightVertexColors[v] = i_cadidateColor;
-				if(m_i_RightVertexColorCount < i_cadidateColor)	{
-						m_i_RightVertexColorCount = i_cadidateColor;
-				}
-			}
 
-			//Algo 4 - Line 10: R.clear()   ; R denotes the set of vertices to be recolored
-			vi_verticesNeedNewColor.clear();
+				//Phase 2: conflict detection, of 2 vertices with the same color the larger one is recolored
+				vi_Conflicts.clear();
 
-			//Phase 2: conflict detection. For each vertex v in U, check and see if v need to be recolored
-			//Algo 4 - Line 11: for each vertex v in U (in parallel) do
 #ifdef _OPENMP
-#pragma omp parallel for default(none) schedule(dynamic) shared(i_NumOfVerticesToBeColored, vi_VerticesToBeColored,vi_verticesNeedNewColor, cout) private(cont)
+				#pragma omp for schedule(dynamic, 64) nowait
 #endif
-                        for(int i=0; i<i_NumOfVerticesToBeColored; i++) {
-				//Algo 4 - Line 12: cont  <- true ; cont is used to break from the outer loop below
-				cont = true;
-				int v = vi_VerticesToBeColored[i];
-				//Algo 4 - Line 13: for each vertex w in adj (v) and cont = true do
-				for (int w=m_vi_RightVertices [v]; (w<m_vi_RightVertices [v+1]) && (cont == true); w++ ) {
-					//Algo 4 - Line 14: if color [v] = color [w] and f (v) > f (w) then . NOTE: !!! Not needed
-						//Algo 4 - Line 15: add [v] to R ; break . NOTE: !!! Not needed
-					//Algo 4 - Line 16: for each vertex x in adj (w) and v != x do
-					for (int x=m_vi_LeftVertices [m_vi_Edges [w]]; x<m_vi_LeftVertices [m_vi_Edges [w]+1]; x++ ) {
-					  //cout<<" m_vi_RightVertexColors [m_vi_Edges [x]="<<x<<"]"<< m_vi_RightVertexColors [m_vi_Edges [x]] <<endl;
-					  // cout<<" m_vi_RightVertexColors [v="<<v<<"]"<< m_vi_RightVertexColors [v] <<endl;
-					  //cout<<"f(v="<<v<<")="<<f(v)<<endl;
-					  //cout<<"f(m_vi_Edges [x]="<<x<<")="<<f(m_vi_Edges [x])<<endl;
-						//Algo 4 - Line 17: if color [v] = color [x] and f (v) > f (x) then
-					  if ( m_vi_RightVertexColors [m_vi_Edges [x]] == m_vi_RightVertexColors[v] && f(v) > f(m_vi_Edges [x]) ) {
-							//Algo 4 - Line 18: add [v] to R ; cont <- false; break
-#ifdef _OPENMP
-#pragma omp critical
-#endif
-                                              {
-								vi_verticesNeedNewColor.push_back(v);
+				for(int i=0; i<i_NumOfVerticesToBeColored; i++)
+				{
+					int v = vi_VerticesToBeColored[i];
+
+					bool b_Conflict = false;
+
+					for(int w=vi_ColoredVertices[v]; (w<vi_ColoredVertices[STEP_UP(v)]) && !b_Conflict; w++)
+					{
+						for(int x=vi_OtherVertices[m_vi_Edges[w]]; x<vi_OtherVertices[STEP_UP(m_vi_Edges[w])]; x++)
+						{
+							if((vi_VertexColors[m_vi_Edges[x]] == vi_VertexColors[v]) && (v > m_vi_Edges[x]))
+							{
+								b_Conflict = true;
+
+								break;
 							}
-							cont = false;
-							break;
 						}
 					}
+
+					if(b_Conflict)
+					{
+						vi_Conflicts.push_back(v);
+					}
 				}
-			}
 
-			//Algo 4 - Line 19: U <- R , i.e., vi_VerticesToBeColored <- vi_verticesNeedNewColor
-			vi_VerticesToBeColored.clear();
-			i_NumOfVerticesToBeColored = vi_verticesNeedNewColor.size();
+				vi_QueueStart[STEP_UP(i_thread_num)] = (signed) vi_Conflicts.size();
 
-			vi_VerticesToBeColored.reserve(vi_verticesNeedNewColor.size());
-			for(size_t i=0; i<vi_verticesNeedNewColor.size(); i++) {
-			  vi_VerticesToBeColored.push_back(vi_verticesNeedNewColor[i]);
-			}
+#ifdef _OPENMP
+				#pragma omp barrier
+				#pragma omp single
+#endif
+				{
+					for(int t=0; t<i_NumThreads; t++)
+					{
+						vi_QueueStart[STEP_UP(t)] += vi_QueueStart[t];
+					}
 
-			/*
-			vi_VerticesToBeColored.resize(vi_verticesNeedNewColor.size());
-#pragma omp parallel for default(none) schedule(static) shared(i_NumOfVerticesToBeColored,vi_VerticesToBeColored,vi_verticesNeedNewColor)
-			for(int i=0; i<i_NumOfVerticesToBeColored; i++) {
-				vi_VerticesToBeColored[i]=vi_verticesNeedNewColor[i];
+					m_vi_ConflictsPerRound.push_back(vi_QueueStart[i_NumThreads]);
+				}
+
+				copy(vi_Conflicts.begin(), vi_Conflicts.end(), vi_VerticesNeedNewColor.begin() + vi_QueueStart[i_thread_num]);
+
+#ifdef _OPENMP
+				#pragma omp barrier
+				#pragma omp single
+#endif
+				{
+					vi_VerticesToBeColored.swap(vi_VerticesNeedNewColor);
+
+					i_NumOfVerticesToBeColored = vi_QueueStart[i_NumThreads];
+				}
 			}
-			// */
+		}
+
+		//The largest color of the final coloring, a tentative color replaced in a later round is not counted
+		int i_VertexColorCount = _UNKNOWN;
 
+#ifdef _OPENMP
+		#pragma omp parallel for reduction(max:i_VertexColorCount)
+#endif
+		for(int i=0; i<i_VertexCount; i++)
+		{
+			if(i_VertexColorCount < vi_VertexColors[i])
+			{
+				i_VertexColorCount = vi_VertexColors[i];
+			}
 		}
 
-		//note that m_i_RightVertexColorCount has not been updated yet
-		m_i_VertexColorCount = m_i_RightVertexColorCount;
+		if(b_ColumnColoring)
+		{
+			m_i_RightVertexColorCount = i_VertexColorCount;
+		}
+		else
+		{
+			m_i_LeftVertexColorCount = i_VertexColorCount;
+		}
 
-		return _TRUE;
+		m_i_VertexColorCount = i_VertexColorCount;
 
+		return(_TRUE);
 	}
 
 	int BipartiteGraphPartialColoring::PartialDistanceTwoColumnColoring() {
@@ -645,6 +600,8 @@ namespace ColPack
 
 		m_i_LeftVertexColorCount = m_i_RightVertexColorCount = m_i_VertexColorCount = 0;
 
+		m_vi_ConflictsPerRound.clear();
+
 		//cout<<" i_RightVertexCount = " <<i_RightVertexCount<<endl;
 		for ( i=0; i<i_RightVertexCount; ++i )
 		{
@@ -887,6 +844,12 @@ namespace ColPack
 		cout<<"[Total Row Colors = "<<STEP_UP(m_i_VertexColorCount)<<"; Violation Count = "<<m_i_ViolationCount<<"]"<<endl;
 		cout<<"[Row Vertex Count = "<<STEP_DOWN(m_vi_LeftVertices.size())<<"; Column Vertex Count = "<<STEP_DOWN(m_vi_RightVertices.size())<<endl;
 		cout<<"[Ordering Time = "<<m_d_OrderingTime<<"; Coloring Time = "<<m_d_ColoringTime<<"; Checking Time = "<<m_d_CheckingTime<<"]"<<endl;
+		if(!m_vi_ConflictsPerRound.empty())
+		{
+			cout<<"[Speculative Rounds = "<<m_vi_ConflictsPerRound.size()<<"; Conflicts per Round =";
+			for(size_t i=0; i<m_vi_ConflictsPerRound.size(); i++) cout<<" "<<m_vi_ConflictsPerRound[i];
+			cout<<"]"<<endl;
+		}
 		cout<<endl;
 	}
 
@@ -908,6 +871,12 @@ namespace ColPack
 		cout<<"[Total Column Colors = "<<STEP_UP(m_i_VertexColorCount)<<"; Violation Count = "<<m_i_ViolationCount<<"]"<<endl;
 		cout<<"[Row Vertex Count = "<<STEP_DOWN(m_vi_LeftVertices.size())<<"; Column Vertex Count = "<<STEP_DOWN(m_vi_RightVertices.size())<<endl;
 		cout<<"[Ordering Time = "<<m_d_OrderingTime<<"; Coloring Time = "<<m_d_ColoringTime<<"; Checking Time = "<<m_d_CheckingTime<<"]"<<endl;
+		if(!m_vi_ConflictsPerRound.empty())
+		{
+			cout<<"[Speculative Rounds = "<<m_vi_ConflictsPerRound.size()<<"; Conflicts per Round =";
+			for(size_t i=0; i<m_vi_ConflictsPerRound.size(); i++) cout<<" "<<m_vi_ConflictsPerRound[i];
+			cout<<"]"<<endl;
+		}
 		cout<<endl;
 	}
 
@@ -982,7 +951,7 @@ namespace ColPack
 
 		if(seed_available) Seed_reset();
 
-		dp2_Seed = GetLeftSeedMatrix_unmanaged(i_SeedRowCount, i_SeedColumnCount);
+		dp2_Seed = NewLeftSeedMatrix(i_SeedRowCount, i_SeedColumnCount, MATRIX_ALLOC_SLAB);
 		i_seed_rowCount = *i_SeedRowCount;
 		seed_available = true;
 
@@ -993,7 +962,7 @@ namespace ColPack
 
 		if(seed_available) Seed_reset();
 
-		dp2_Seed = GetRightSeedMatrix_unmanaged(i_SeedRowCount, i_SeedColumnCount);
+		dp2_Seed = NewRightSeedMatrix(i_SeedRowCount, i_SeedColumnCount, MATRIX_ALLOC_SLAB);
 		i_seed_rowCount = *i_SeedRowCount;
 		seed_available = true;
 
@@ -1001,19 +970,23 @@ namespace ColPack
 	}
 
 	double** BipartiteGraphPartialColoring::GetLeftSeedMatrix_unmanaged(int* i_SeedRowCount, int* i_SeedColumnCount) {
+		return NewLeftSeedMatrix(i_SeedRowCount, i_SeedColumnCount, m_i_MatrixAllocation);
+	}
+
+	double** BipartiteGraphPartialColoring::GetLeftSeedMatrix_contiguous(int* i_SeedRowCount, int* i_SeedColumnCount) {
+		return NewLeftSeedMatrix(i_SeedRowCount, i_SeedColumnCount, MATRIX_ALLOC_SLAB);
+	}
+
+	double** BipartiteGraphPartialColoring::NewLeftSeedMatrix(int* i_SeedRowCount, int* i_SeedColumnCount, int i_MatrixAllocation) {
 
 		int i_size = m_vi_LeftVertexColors.size();
 		int i_num_of_colors = GetLeftVertexColorCount();
 		(*i_SeedRowCount) = i_num_of_colors;
 		(*i_SeedColumnCount) = i_size;
 		if(i_num_of_colors == 0 || i_size == 0) return NULL;
-		double** Seed = new double*[i_num_of_colors];
 
 		// allocate and initialize Seed matrix
-		for (int i=0; i<i_num_of_colors; i++) {
-			Seed[i] = new double[i_size];
-			for(int j=0; j<i_size; j++) Seed[i][j]=0.;
-		}
+		double** Seed = new_2DMatrix<double>(i_num_of_colors, i_size, i_MatrixAllocation);
 
 		// populate Seed matrix
 		for (int i=0; i < i_size; i++) {
@@ -1024,19 +997,23 @@ namespace ColPack
 	}
 
 	double** BipartiteGraphPartialColoring::GetRightSeedMatrix_unmanaged(int* i_SeedRowCount, int* i_SeedColumnCount) {
+		return NewRightSeedMatrix(i_SeedRowCount, i_SeedColumnCount, m_i_MatrixAllocation);
+	}
+
+	double** BipartiteGraphPartialColoring::GetRightSeedMatrix_contiguous(int* i_SeedRowCount, int* i_SeedColumnCount) {
+		return NewRightSeedMatrix(i_SeedRowCount, i_SeedColumnCount, MATRIX_ALLOC_SLAB);
+	}
+
+	double** BipartiteGraphPartialColoring::NewRightSeedMatrix(int* i_SeedRowCount, int* i_SeedColumnCount, int i_MatrixAllocation) {
 
 		int i_size = m_vi_RightVertexColors.size();
 		int i_num_of_colors = GetRightVertexColorCount();
 		(*i_SeedRowCount) = i_size;
 		(*i_SeedColumnCount) = i_num_of_colors;
 		if(i_num_of_colors == 0 || i_size == 0) return NULL;
-		double** Seed = new double*[i_size];
 
 		// allocate and initialize Seed matrix
-		for (int i=0; i<i_size; i++) {
-			Seed[i] = new double[i_num_of_colors];
-			for(int j=0; j<i_num_of_colors; j++) Seed[i][j]=0.;
-		}
+		double** Seed = new_2DMatrix<double>(i_size, i_num_of_colors, i_MatrixAllocation);
 
 		// populate Seed matrix
 		for (int i=0; i < i_size; i++) {
@@ -1051,6 +1028,18 @@ namespace ColPack
 		return Seed;
 	}
 
+	int BipartiteGraphPartialColoring::GetLeftSeedColors(vector<int> &output) {
+		output = m_vi_LeftVertexColors;
+
+		return GetLeftVertexColorCount();
+	}
+
+	int BipartiteGraphPartialColoring::GetRightSeedColors(vector<int> &output) {
+		output = m_vi_RightVertexColors;
+
+		return GetRightVertexColorCount();
+	}
+
 	void BipartiteGraphPartialColoring::PrintPartialColoringMetrics() {
 		if ( m_s_VertexColoringVariant == "COLUMN_PARTIAL_DISTANCE_TWO") {
 			PrintColumnPartialColoringMetrics();
@@ -1094,6 +1083,37 @@ namespace ColPack
 		return NULL;
 	}
 
+	double** BipartiteGraphPartialColoring::GetSeedMatrix_contiguous(int* i_SeedRowCount, int* i_SeedColumnCount) {
+
+		if ( m_s_VertexColoringVariant == "COLUMN_PARTIAL_DISTANCE_TWO") {
+			return GetRightSeedMatrix_contiguous(i_SeedRowCount, i_SeedColumnCount);
+		}
+		else if (m_s_VertexColoringVariant == "ROW_PARTIAL_DISTANCE_TWO") {
+			return GetLeftSeedMatrix_contiguous(i_SeedRowCount, i_SeedColumnCount);
+		}
+		else { // Unrecognized Coloring Method
+			cerr<<" Unknown Partial Distance Two Coloring Method "<<m_s_VertexColoringVariant
+				<<". Please use a legal Method before calling GetSeedMatrix_contiguous()."<<endl;
+		}
+		return NULL;
+	}
+
+	int BipartiteGraphPartialColoring::GetSeedColors(vector<int> &output) {
+
+		if ( m_s_VertexColoringVariant == "COLUMN_PARTIAL_DISTANCE_TWO") {
+			return GetRightSeedColors(output);
+		}
+		else if (m_s_VertexColoringVariant == "ROW_PARTIAL_DISTANCE_TWO") {
+			return GetLeftSeedColors(output);
+		}
+		else { // Unrecognized Coloring Method
+			cerr<<" Unknown Partial Distance Two Coloring Method "<<m_s_VertexColoringVariant
+				<<". Please use a legal Method before calling GetSeedColors()."<<endl;
+		}
+		output.clear();
+		return 0;
+	}
+
 	void BipartiteGraphPartialColoring::GetVertexPartialColors(vector<int> &output)
 	{
 		if ( m_s_VertexColoringVariant == "COLUMN_PARTIAL_DISTANCE_TWO") {
@@ -1143,5 +1163,405 @@ namespace ColPack
 	void BipartiteGraphPartialColoring::SetVertexColoringVariant(string s_VertexColoringVariant) {
 	  m_s_VertexColoringVariant = s_VertexColoringVariant;
 	}
+
+	//Public Function 2470
+	int BipartiteGraphPartialColoring::IteratedGreedyRecoloring(string s_ClassOrder, double d_TimeBudget, int i_MaxIterations)
+	{
+		bool b_ColumnColoring;
+
+		if(m_s_VertexColoringVariant.compare("COLUMN_PARTIAL_DISTANCE_TWO") == 0)
+		{
+			b_ColumnColoring = true;
+		}
+		else
+		if(m_s_VertexColoringVariant.compare("ROW_PARTIAL_DISTANCE_TWO") == 0)
+		{
+			b_ColumnColoring = false;
+		}
+		else
+		{
+			cerr<<endl<<"*ERROR: IteratedGreedyRecoloring() needs a row or column partial distance two coloring"<<endl;
+
+			return(_FALSE);
+		}
+
+		if((s_ClassOrder != "REVERSE") && (s_ClassOrder != "LARGEST_FIRST"))
+		{
+			cerr<<endl<<"*ERROR: Unknown color class order "<<s_ClassOrder<<". Please use REVERSE or LARGEST_FIRST."<<endl;
+
+			return(_FALSE);
+		}
+
+		//The colored side and the side through which the distance two neighbors are reached
+		vector<int> & vi_ColoredVertices = b_ColumnColoring ? m_vi_RightVertices : m_vi_LeftVertices;
+		vector<int> & vi_OtherVertices = b_ColumnColoring ? m_vi_LeftVertices : m_vi_RightVertices;
+		vector<int> & vi_VertexColors = b_ColumnColoring ? m_vi_RightVertexColors : m_vi_LeftVertexColors;
+		int & i_SideVertexColorCount = b_ColumnColoring ? m_i_RightVertexColorCount : m_i_LeftVertexColorCount;
+
+		int i_VertexCount = STEP_DOWN((signed) vi_ColoredVertices.size());
+
+		int i_VertexColorCount = _UNKNOWN;
+
+		if((i_VertexCount <= 0) || ((signed) vi_VertexColors.size() != i_VertexCount))
+		{
+			cerr<<endl<<"*ERROR: IteratedGreedyRecoloring() needs a colored graph"<<endl;
+
+			return(_FALSE);
+		}
+
+		for(int i=0; i<i_VertexCount; i++)
+		{
+			if(i_VertexColorCount < vi_VertexColors[i])
+			{
+				i_VertexColorCount = vi_VertexColors[i];
+			}
+		}
+
+		double d_StartTime = Timer::GetWallClock();
+
+		vector<int> vi_NewVertexColors(i_VertexCount);
+
+		for(int i_Iteration=0; i_Iteration<i_MaxIterations; i_Iteration++)
+		{
+			int i_ColorCount = STEP_UP(i_VertexColorCount);
+
+			vector<int> vi_ColorClassSizes(i_ColorCount, _FALSE);
+
+			vector<int> vi_ColorClassStart(STEP_UP(i_ColorCount), _FALSE);
+
+			vector<int> vi_ColorClassMembers(i_VertexCount);
+
+			vector<int> vi_ClassOrder(i_ColorCount);
+
+			for(int i=0; i<i_VertexCount; i++)
+			{
+				vi_ColorClassSizes[vi_VertexColors[i]]++;
+			}
+
+			for(int i=0; i<i_ColorCount; i++)
+			{
+				vi_ColorClassStart[STEP_UP(i)] = vi_ColorClassStart[i] + vi_ColorClassSizes[i];
+
+				vi_ClassOrder[i] = STEP_DOWN(i_ColorCount) - i;
+			}
+
+			{
+				vector<int> vi_ColorClassTail(vi_ColorClassStart.begin(), vi_ColorClassStart.end() - 1);
+
+				for(int i=0; i<i_VertexCount; i++)
+				{
+					vi_ColorClassMembers[vi_ColorClassTail[vi_VertexColors[i]]++] = i;
+				}
+			}
+
+			if(s_ClassOrder == "LARGEST_FIRST")
+			{
+				for(int i=1; i<i_ColorCount; i++)
+				{
+					int i_Color = vi_ClassOrder[i];
+
+					int j = i;
+
+					while((j > 0) && (vi_ColorClassSizes[vi_ClassOrder[STEP_DOWN(j)]] < vi_ColorClassSizes[i_Color]))
+					{
+						vi_ClassOrder[j] = vi_ClassOrder[STEP_DOWN(j)];
+
+						j--;
+					}
+
+					vi_ClassOrder[j] = i_Color;
+				}
+			}
+
+			//First fit in color class order never increases the number of colors.
+			//Vertices of one class share no neighbor on the other side, so a class is recolored in parallel.
+			int i_NewVertexColorCount = _UNKNOWN;
+
+			for(int i=0; i<i_VertexCount; i++)
+			{
+				vi_NewVertexColors[i] = _UNKNOWN;
+			}
+
+			#pragma omp parallel reduction(max:i_NewVertexColorCount)
+			{
+				vector<int> vi_ForbiddenColors(i_ColorCount, _UNKNOWN);
+
+				for(int i=0; i<i_ColorCount; i++)
+				{
+					#pragma omp for schedule(dynamic, 64)
+					for(int k=vi_ColorClassStart[vi_ClassOrder[i]]; k<vi_ColorClassStart[STEP_UP(vi_ClassOrder[i])]; k++)
+					{
+						int i_CurrentVertex = vi_ColorClassMembers[k];
+
+						for(int w=vi_ColoredVertices[i_CurrentVertex]; w<vi_ColoredVertices[STEP_UP(i_CurrentVertex)]; w++)
+						{
+							for(int x=vi_OtherVertices[m_vi_Edges[w]]; x<vi_OtherVertices[STEP_UP(m_vi_Edges[w])]; x++)
+							{
+								if(vi_NewVertexColors[m_vi_Edges[x]] != _UNKNOWN)
+								{
+									vi_ForbiddenColors[vi_NewVertexColors[m_vi_Edges[x]]] = i_CurrentVertex;
+								}
+							}
+						}
+
+						int c = 0;
+
+						while(vi_ForbiddenColors[c] == i_CurrentVertex)
+						{
+							c++;
+						}
+
+						vi_NewVertexColors[i_CurrentVertex] = c;
+
+						if(i_NewVertexColorCount < c)
+						{
+							i_NewVertexColorCount = c;
+						}
+					}
+				}
+			}
+
+			vi_VertexColors.swap(vi_NewVertexColors);
+
+			i_VertexColorCount = i_NewVertexColorCount;
+
+			if(Timer::GetWallClock() - d_StartTime >= d_TimeBudget)
+			{
+				break;
+			}
+		}
+
+		i_SideVertexColorCount = i_VertexColorCount;
+
+		m_i_VertexColorCount = i_VertexColorCount;
+
+		return(_TRUE);
+	}
+
+
+	//Public Function 2471
+	int BipartiteGraphPartialColoring::UpdateColoring(const vector< pair<int, int> > & vpii_InsertedEdges, const vector< pair<int, int> > & vpii_DeletedEdges)
+	{
+		bool b_ColumnColoring;
+
+		if(m_s_VertexColoringVariant.compare("COLUMN_PARTIAL_DISTANCE_TWO") == 0)
+		{
+			b_ColumnColoring = true;
+		}
+		else
+		if(m_s_VertexColoringVariant.compare("ROW_PARTIAL_DISTANCE_TWO") == 0)
+		{
+			b_ColumnColoring = false;
+		}
+		else
+		{
+			cerr<<endl<<"*ERROR: UpdateColoring() needs a row or column partial distance two coloring"<<endl;
+
+			return(_UNKNOWN);
+		}
+
+		int i_OldLeftVertexCount = STEP_DOWN((signed) m_vi_LeftVertices.size());
+		int i_OldRightVertexCount = STEP_DOWN((signed) m_vi_RightVertices.size());
+		int i_OldVertexCount = b_ColumnColoring ? i_OldRightVertexCount : i_OldLeftVertexCount;
+
+		vector<int> & vi_VertexColors = b_ColumnColoring ? m_vi_RightVertexColors : m_vi_LeftVertexColors;
+		int & i_SideVertexColorCount = b_ColumnColoring ? m_i_RightVertexColorCount : m_i_LeftVertexColorCount;
+
+		if((signed) vi_VertexColors.size() != i_OldVertexCount)
+		{
+			cerr<<endl<<"*ERROR: UpdateColoring() needs a colored graph"<<endl;
+
+			return(_UNKNOWN);
+		}
+
+		vector<int> vi_NewEdgeRows, vi_NewEdgeColumns;
+
+		if(UpdateEdges(vpii_InsertedEdges, vpii_DeletedEdges, vi_NewEdgeRows, vi_NewEdgeColumns) == _UNKNOWN)
+		{
+			return(_UNKNOWN);
+		}
+
+		//The colored side and the side through which the distance two neighbors are reached
+		vector<int> & vi_ColoredVertices = b_ColumnColoring ? m_vi_RightVertices : m_vi_LeftVertices;
+		vector<int> & vi_OtherVertices = b_ColumnColoring ? m_vi_LeftVertices : m_vi_RightVertices;
+		vector<int> & vi_NewEdgeEndPoints = b_ColumnColoring ? vi_NewEdgeColumns : vi_NewEdgeRows;
+
+		int i_LeftVertexCount = STEP_DOWN((signed) m_vi_LeftVertices.size());
+		int i_VertexCount = STEP_DOWN((signed) vi_ColoredVertices.size());
+
+		vi_VertexColors.resize((unsigned) i_VertexCount, _UNKNOWN);
+
+		//The column ordering holds the columns shifted by the number of rows
+		if((signed) m_vi_OrderedVertices.size() == i_OldVertexCount)
+		{
+			int i_Offset = b_ColumnColoring ? i_LeftVertexCount : _FALSE;
+
+			if(b_ColumnColoring)
+			{
+				for(int i=0; i<i_OldVertexCount; i++)
+				{
+					m_vi_OrderedVertices[i] += i_LeftVertexCount - i_OldLeftVertexCount;
+				}
+			}
+
+			for(int i=i_OldVertexCount; i<i_VertexCount; i++)
+			{
+				m_vi_OrderedVertices.push_back(i + i_Offset);
+			}
+		}
+
+		vector<int> vi_ForbiddenColors(STEP_UP(i_VertexCount), _UNKNOWN);
+
+		vector<int> vi_VerticesToBeRecolored;
+
+		//A new conflict is between 2 vertices sharing a neighbor through a new edge, one of them is checked here
+		for(int i=0; i<(signed) vi_NewEdgeEndPoints.size(); i++)
+		{
+			int i_CurrentVertex = vi_NewEdgeEndPoints[i];
+
+			int i_Color = vi_VertexColors[i_CurrentVertex];
+
+			if(i_Color == _UNKNOWN)
+			{
+				continue;
+			}
+
+			bool b_Conflict = false;
+
+			for(int w=vi_ColoredVertices[i_CurrentVertex]; (w<vi_ColoredVertices[STEP_UP(i_CurrentVertex)]) && !b_Conflict; w++)
+			{
+				for(int x=vi_OtherVertices[m_vi_Edges[w]]; x<vi_OtherVertices[STEP_UP(m_vi_Edges[w])]; x++)
+				{
+					if((m_vi_Edges[x] != i_CurrentVertex) && (vi_VertexColors[m_vi_Edges[x]] == i_Color))
+					{
+						b_Conflict = true;
+
+						break;
+					}
+				}
+			}
+
+			if(b_Conflict)
+			{
+				vi_VertexColors[i_CurrentVertex] = _UNKNOWN;
+
+				vi_VerticesToBeRecolored.push_back(i_CurrentVertex);
+			}
+		}
+
+		for(int i=i_OldVertexCount; i<i_VertexCount; i++)
+		{
+			vi_VerticesToBeRecolored.push_back(i);
+		}
+
+		for(int i=0; i<(signed) vi_VerticesToBeRecolored.size(); i++)
+		{
+			int i_CurrentVertex = vi_VerticesToBeRecolored[i];
+
+			for(int w=vi_ColoredVertices[i_CurrentVertex]; w<vi_ColoredVertices[STEP_UP(i_CurrentVertex)]; w++)
+			{
+				for(int x=vi_OtherVertices[m_vi_Edges[w]]; x<vi_OtherVertices[STEP_UP(m_vi_Edges[w])]; x++)
+				{
+					if(vi_VertexColors[m_vi_Edges[x]] != _UNKNOWN)
+					{
+						vi_ForbiddenColors[vi_VertexColors[m_vi_Edges[x]]] = i_CurrentVertex;
+					}
+				}
+			}
+
+			int c = 0;
+
+			while(vi_ForbiddenColors[c] == i_CurrentVertex)
+			{
+				c++;
+			}
+
+			vi_VertexColors[i_CurrentVertex] = c;
+
+			if(i_SideVertexColorCount < c)
+			{
+				i_SideVertexColorCount = c;
+			}
+		}
+
+		m_i_VertexColorCount = i_SideVertexColorCount;
+
+		Seed_reset();
+
+		return((signed) vi_VerticesToBeRecolored.size());
+	}
+
+
+	//Public Function 2472
+	int BipartiteGraphPartialColoring::GetColoringRounds()
+	{
+		return((signed) m_vi_ConflictsPerRound.size());
+	}
+
+
+	//Public Function 2473
+	void BipartiteGraphPartialColoring::GetConflictsPerRound(vector<int> &output)
+	{
+		output = m_vi_ConflictsPerRound;
+	}
+
+
+	//Public Function 2474
+	int BipartiteGraphPartialColoring::SetVertexColors(const vector<int> & vi_VertexColors, string s_VertexColoringVariant)
+	{
+		bool b_ColumnColoring;
+
+		if(s_VertexColoringVariant.compare("COLUMN_PARTIAL_DISTANCE_TWO") == 0)
+		{
+			b_ColumnColoring = true;
+		}
+		else
+		if(s_VertexColoringVariant.compare("ROW_PARTIAL_DISTANCE_TWO") == 0)
+		{
+			b_ColumnColoring = false;
+		}
+		else
+		{
+			cerr<<endl<<"*ERROR: SetVertexColors(): unknown coloring variant "<<s_VertexColoringVariant<<endl;
+
+			return(_FALSE);
+		}
+
+		int i_VertexCount = b_ColumnColoring ? GetColumnVertexCount() : GetRowVertexCount();
+
+		if((signed) vi_VertexColors.size() != i_VertexCount)
+		{
+			cerr<<endl<<"*ERROR: SetVertexColors(): "<<vi_VertexColors.size()<<" colors for "<<i_VertexCount<<" vertices"<<endl;
+
+			return(_FALSE);
+		}
+
+		m_vi_LeftVertexColors.clear();
+		m_vi_RightVertexColors.clear();
+		m_vi_ConflictsPerRound.clear();
+
+		m_i_LeftVertexColorCount = m_i_RightVertexColorCount = m_i_VertexColorCount = _UNKNOWN;
+
+		vector<int> & vi_SideVertexColors = b_ColumnColoring ? m_vi_RightVertexColors : m_vi_LeftVertexColors;
+		int & i_SideVertexColorCount = b_ColumnColoring ? m_i_RightVertexColorCount : m_i_LeftVertexColorCount;
+
+		vi_SideVertexColors = vi_VertexColors;
+
+		for(int i=0; i<i_VertexCount; i++)
+		{
+			if(i_SideVertexColorCount < vi_SideVertexColors[i])
+			{
+				i_SideVertexColorCount = vi_SideVertexColors[i];
+			}
+		}
+
+		m_i_VertexColorCount = i_SideVertexColorCount;
+
+		m_s_VertexColoringVariant = s_VertexColoringVariant;
+
+		Seed_reset();
+
+		return(_TRUE);
+	}
 }
 
@@ -55,6 +55,7 @@ namespace ColPack
 		/// Same as GetLeftSeedMatrix(), except that this Seed matrix is NOT managed by ColPack
 		/** Notes:
 		- This Seed matrix is NOT managed by ColPack. Therefore, the user should free the Seed matrix manually when the matrix is no longer needed.
+		- The Seed matrix is allocated following GetMatrixAllocation(). Free it with free_2DMatrix(Seed, rows, GetMatrixAllocation()).
 		*/
 		double** GetLeftSeedMatrix_unmanaged(int* i_SeedRowCount, int* i_SeedColumnCount);
 
@@ -78,6 +79,44 @@ namespace ColPack
 		*/
 		double** GetRightSeedMatrix_unmanaged(int* i_SeedRowCount, int* i_SeedColumnCount);
 
+		/// Based on m_s_VertexColoringVariant, either GetLeftSeedMatrix_contiguous() or GetRightSeedMatrix_contiguous() will be called.
+		double** GetSeedMatrix_contiguous(int* i_SeedRowCount, int* i_SeedColumnCount);
+
+		/// Same as GetLeftSeedMatrix_unmanaged(), except that the Seed matrix is always allocated as MATRIX_ALLOC_SLAB
+		/** Notes:
+		- Same as SetMatrixAllocation(MATRIX_ALLOC_SLAB) followed by GetLeftSeedMatrix_unmanaged(), kept for compatibility. Free it with free_2DMatrix_slab().
+		*/
+		double** GetLeftSeedMatrix_contiguous(int* i_SeedRowCount, int* i_SeedColumnCount);
+
+		/// Same as GetRightSeedMatrix_unmanaged(), except that the Seed matrix is always allocated as MATRIX_ALLOC_SLAB
+		/** Notes:
+		- Same as SetMatrixAllocation(MATRIX_ALLOC_SLAB) followed by GetRightSeedMatrix_unmanaged(), kept for compatibility. Free it with free_2DMatrix_slab().
+		*/
+		double** GetRightSeedMatrix_contiguous(int* i_SeedRowCount, int* i_SeedColumnCount);
+
+		/// Based on m_s_VertexColoringVariant, either GetLeftSeedColors() or GetRightSeedColors() will be called.
+		int GetSeedColors(vector<int> &output);
+
+		/// Compact form of the Left Seed matrix: the row of the 1 in each column
+		/** Postcondition:
+		- output[v] is the row of the Left Seed matrix holding the 1 of column v, i.e. the color of the left (row) vertex v.
+
+		Return value: number of rows of the Left Seed matrix.
+
+		This vector is what JacobianRecovery1D::RecoverD2Row_*_usermem() take instead of the graph.
+		*/
+		int GetLeftSeedColors(vector<int> &output);
+
+		/// Compact form of the Right Seed matrix: the column of the 1 in each row
+		/** Postcondition:
+		- output[v] is the column of the Right Seed matrix holding the 1 of row v, i.e. the color of the right (column) vertex v.
+
+		Return value: number of columns of the Right Seed matrix.
+
+		This vector is what JacobianRecovery1D::RecoverD2Cln_*_usermem() take instead of the graph.
+		*/
+		int GetRightSeedColors(vector<int> &output);
+
 	private:
 
 		//Private Function 2401
@@ -86,6 +125,16 @@ namespace ColPack
 		//Private Function 2402
 		int CheckVertexColoring(string s_VertexColoringVariant);
 
+		//Private Function 2403
+		/// Speculative row (b_ColumnColoring == false) or column partial distance two coloring shared by the _OMP variants
+		/**
+		 * One parallel region runs all the rounds: tentative first fit coloring of the queue, then conflict detection
+		 * (of 2 vertices sharing a color, the larger index is recolored). Each thread keeps its forbidden color marker,
+		 * sized to the palette bound, and its conflict queue for the whole run; the queues are merged by prefix sum
+		 * and the number of colors is a max reduction over the final colors, so nothing is serialized.
+		 */
+		int PartialDistanceTwoColoring_OMP(bool b_ColumnColoring);
+
 	protected:
 
 		int m_i_LeftVertexColorCount;
@@ -123,15 +172,27 @@ namespace ColPack
 		vector<int> m_vi_LeftVertexColorFrequency;
 		vector<int> m_vi_RightVertexColorFrequency;
 
+		vector<int> m_vi_ConflictsPerRound;
+
 		bool seed_available;
 		int i_seed_rowCount;
 		double** dp2_Seed;
 
+		int m_i_MatrixAllocation;
+
 		void Seed_init();
 		void Seed_reset();
 
+		/// Seed matrices of GetLeftSeedMatrix_unmanaged() and GetRightSeedMatrix_unmanaged() allocated with the policy i_MatrixAllocation
+		double** NewLeftSeedMatrix(int* i_SeedRowCount, int* i_SeedColumnCount, int i_MatrixAllocation);
+		double** NewRightSeedMatrix(int* i_SeedRowCount, int* i_SeedColumnCount, int i_MatrixAllocation);
+
 	public:
 
+		/// Allocation policy of the unmanaged Seed matrices: MATRIX_ALLOC_ROWS (default) or MATRIX_ALLOC_SLAB, see MatrixDeallocation.h
+		void SetMatrixAllocation(int i_MatrixAllocation);
+		int GetMatrixAllocation();
+
 		//Public Constructor 2451
 		BipartiteGraphPartialColoring();
 
@@ -196,6 +257,47 @@ namespace ColPack
 		double GetVertexColoringTime();
 
 		void SetVertexColoringVariant(string s_VertexColoringVariant);
+
+		//Public Function 2470
+		/// Try to lower the number of colors of the current row or column partial distance two coloring
+		/**
+		 * Iterated greedy: each iteration recolors the vertices first fit, class by class, the classes taken
+		 * in s_ClassOrder ("REVERSE": highest color first, "LARGEST_FIRST": largest class first).
+		 * The number of colors never increases. The vertices of one class are recolored in parallel (OpenMP).
+		 * Iterations stop after i_MaxIterations or when d_TimeBudget seconds of wall clock time are used up.
+		 */
+		int IteratedGreedyRecoloring(string s_ClassOrder = "REVERSE", double d_TimeBudget = 1.0, int i_MaxIterations = 100);
+
+		//Public Function 2471
+		/// Apply a batch of edge (row, column) deletions and insertions to the graph (see UpdateEdges()) and recolor only the vertices in violation
+		/**
+		 * Works on the current row or column partial distance two coloring. Deleting edges never breaks it, so only the
+		 * colored side vertices incident to a new edge are checked: the ones sharing a color with a distance two neighbor lose it,
+		 * then they and the new vertices of the colored side are colored first fit, in that order.
+		 * The other vertices keep their colors and the number of colors only grows if a recolored vertex needs a new one.
+		 * The vertex ordering is kept, the new vertices are appended to it.
+		 * Return the number of recolored vertices, or _UNKNOWN if the graph is not colored or the update is rejected.
+		 */
+		int UpdateColoring(const vector< pair<int, int> > & vpii_InsertedEdges, const vector< pair<int, int> > & vpii_DeletedEdges);
+
+		//Public Function 2472
+		/// Number of speculative rounds of the last PartialDistanceTwoRowColoring_OMP() or PartialDistanceTwoColumnColoring_OMP(), 0 for the serial colorings
+		int GetColoringRounds();
+
+		//Public Function 2473
+		/// output[r] is the number of conflicts detected (vertices to recolor) in round r of the last _OMP coloring
+		void GetConflictsPerRound(vector<int> &output);
+
+		//Public Function 2474
+		/// Take a row or column partial distance two coloring computed elsewhere (e.g. by PD2SMPGCColoring)
+		/**
+		 * s_VertexColoringVariant is "ROW_PARTIAL_DISTANCE_TWO" (vi_VertexColors are the row colors) or
+		 * "COLUMN_PARTIAL_DISTANCE_TWO" (vi_VertexColors are the column colors). The coloring is not checked,
+		 * use CheckPartialDistanceTwoRowColoring() or CheckPartialDistanceTwoColumnColoring() for that.
+		 * Afterwards GetSeedMatrix() and JacobianRecovery1D work as after PartialDistanceTwoColoring().
+		 * Return _FALSE if the variant is unknown or the number of colors does not match the number of vertices.
+		 */
+		int SetVertexColors(const vector<int> & vi_VertexColors, string s_VertexColoringVariant);
 	};
 }
 #endif
@@ -24,6 +24,18 @@ namespace ColPack
 	{
 		BipartiteGraphPartialColoring::Clear();
 
+		m_d_ForwardSweepCost = 1.;
+		m_d_ReverseSweepCost = 1.;
+
+		m_vs_CompressionCandidates.clear();
+		m_vi_CandidateRowColorCounts.clear();
+		m_vi_CandidateColumnColorCounts.clear();
+		m_vd_CandidateLowerBounds.clear();
+		m_vd_CandidateCosts.clear();
+		m_vd_CandidateTimes.clear();
+
+		m_i_CompressionCandidate = _UNKNOWN;
+
 		return;
 	}
 
@@ -33,6 +45,15 @@ namespace ColPack
 	{
 		BipartiteGraphPartialColoring::Reset();
 
+		m_vs_CompressionCandidates.clear();
+		m_vi_CandidateRowColorCounts.clear();
+		m_vi_CandidateColumnColorCounts.clear();
+		m_vd_CandidateLowerBounds.clear();
+		m_vd_CandidateCosts.clear();
+		m_vd_CandidateTimes.clear();
+
+		m_i_CompressionCandidate = _UNKNOWN;
+
 		return;
 	}
 
@@ -63,6 +84,10 @@ namespace ColPack
 	}
 
 	int BipartiteGraphPartialColoringInterface::PartialDistanceTwoColoring(string s_OrderingVariant, string s_ColoringVariant) {
+		if(toUpper(s_ColoringVariant) == "AUTO") {
+			return(AutoPartialDistanceTwoColoring(s_OrderingVariant));
+		}
+
 		m_T_Timer.Start();
 		int i_OrderingStatus = OrderVertices(s_OrderingVariant, s_ColoringVariant);
 		m_T_Timer.Stop();
@@ -98,6 +123,179 @@ namespace ColPack
 	}
 
 
+	int BipartiteGraphPartialColoringInterface::AutoPartialDistanceTwoColoring(string s_OrderingVariant) {
+		int i_RowCount = GetRowVertexCount();
+		int i_ColumnCount = GetColumnVertexCount();
+
+		int i_MaximumRowDegree = _FALSE, i_MaximumColumnDegree = _FALSE;
+
+		for(int i=0; i<i_RowCount; i++) {
+			i_MaximumRowDegree = max(i_MaximumRowDegree, m_vi_LeftVertices[STEP_UP(i)] - m_vi_LeftVertices[i]);
+		}
+
+		for(int i=0; i<i_ColumnCount; i++) {
+			i_MaximumColumnDegree = max(i_MaximumColumnDegree, m_vi_RightVertices[STEP_UP(i)] - m_vi_RightVertices[i]);
+		}
+
+		double d_ColumnLowerBound = i_MaximumRowDegree * m_d_ForwardSweepCost;
+		double d_RowLowerBound = i_MaximumColumnDegree * m_d_ReverseSweepCost;
+
+		//At least one side passes: a bound is at most one color per vertex of its own side,
+		//so the column bound exceeding i_RowCount reverse sweeps puts the row bound below i_ColumnCount forward sweeps
+		bool b_ColumnCandidate = d_ColumnLowerBound <= i_RowCount * m_d_ReverseSweepCost;
+		bool b_RowCandidate = d_RowLowerBound <= i_ColumnCount * m_d_ForwardSweepCost;
+
+		//The row coloring needs its own graph when both sides run
+		BipartiteGraphPartialColoringInterface g_RowGraph(SRC_WAIT);
+
+		BipartiteGraphPartialColoringInterface * p_RowColoring = this;
+
+		if(b_ColumnCandidate && b_RowCandidate) {
+			vector<int> vi_RowIndex(m_vi_LeftVertices);
+			vector<int> vi_ColumnIndex(m_vi_Edges.begin() + m_vi_LeftVertices[0], m_vi_Edges.begin() + m_vi_LeftVertices[i_RowCount]);
+
+			for(int i=i_RowCount; i>=0; i--) {
+				vi_RowIndex[i] -= vi_RowIndex[0];
+			}
+
+			g_RowGraph.BuildBPGraphFromCSRFormat(vi_RowIndex, vi_ColumnIndex, i_ColumnCount);
+
+			p_RowColoring = &g_RowGraph;
+		}
+
+		int i_ColumnStatus = _UNKNOWN, i_RowStatus = _UNKNOWN;
+
+		//Timer reads the processor time of the whole process, which counts both sections, so each one is timed by the wall clock
+		double d_ColumnTime = _UNKNOWN, d_RowTime = _UNKNOWN;
+
+#ifdef _OPENMP
+		#pragma omp parallel sections
+#endif
+		{
+#ifdef _OPENMP
+			#pragma omp section
+#endif
+			{
+				if(b_ColumnCandidate) {
+					d_ColumnTime = Timer::GetWallClock();
+					i_ColumnStatus = PartialDistanceTwoColoring(s_OrderingVariant, "COLUMN_PARTIAL_DISTANCE_TWO");
+					d_ColumnTime = Timer::GetWallClock() - d_ColumnTime;
+				}
+			}
+#ifdef _OPENMP
+			#pragma omp section
+#endif
+			{
+				if(b_RowCandidate) {
+					d_RowTime = Timer::GetWallClock();
+					i_RowStatus = p_RowColoring->PartialDistanceTwoColoring(s_OrderingVariant, "ROW_PARTIAL_DISTANCE_TWO");
+					d_RowTime = Timer::GetWallClock() - d_RowTime;
+				}
+			}
+		}
+
+		m_vs_CompressionCandidates.assign(1, "COLUMN_PARTIAL_DISTANCE_TWO");
+		m_vs_CompressionCandidates.push_back("ROW_PARTIAL_DISTANCE_TWO");
+
+		m_vi_CandidateRowColorCounts.assign(2, _FALSE);
+		m_vi_CandidateColumnColorCounts.assign(2, _FALSE);
+
+		m_vd_CandidateLowerBounds.assign(1, d_ColumnLowerBound);
+		m_vd_CandidateLowerBounds.push_back(d_RowLowerBound);
+
+		m_vd_CandidateCosts.assign(2, _UNKNOWN);
+		m_vd_CandidateTimes.assign(2, _UNKNOWN);
+
+		if(b_ColumnCandidate) {
+			m_vi_CandidateColumnColorCounts[0] = GetVertexColorCount();
+			m_vd_CandidateCosts[0] = m_vi_CandidateColumnColorCounts[0] * m_d_ForwardSweepCost;
+			m_vd_CandidateTimes[0] = d_ColumnTime;
+		}
+		else {
+			m_vi_CandidateColumnColorCounts[0] = _UNKNOWN;
+		}
+
+		if(b_RowCandidate) {
+			m_vi_CandidateRowColorCounts[1] = p_RowColoring->GetVertexColorCount();
+			m_vd_CandidateCosts[1] = m_vi_CandidateRowColorCounts[1] * m_d_ReverseSweepCost;
+			m_vd_CandidateTimes[1] = d_RowTime;
+		}
+		else {
+			m_vi_CandidateRowColorCounts[1] = _UNKNOWN;
+		}
+
+		m_i_CompressionCandidate = 0;
+
+		if(!b_ColumnCandidate || (b_RowCandidate && (m_vd_CandidateCosts[1] < m_vd_CandidateCosts[0]))) {
+			m_i_CompressionCandidate = 1;
+
+			if(p_RowColoring != this) {
+				vector<int> vi_RowColors;
+
+				p_RowColoring->GetLeftVertexColors(vi_RowColors);
+
+				SetVertexColors(vi_RowColors, "ROW_PARTIAL_DISTANCE_TWO");
+
+				p_RowColoring->GetOrderedVertices(m_vi_OrderedVertices);
+
+				m_s_VertexOrderingVariant = p_RowColoring->m_s_VertexOrderingVariant;
+
+				m_d_OrderingTime = p_RowColoring->m_d_OrderingTime;
+				m_d_ColoringTime = p_RowColoring->m_d_ColoringTime;
+			}
+
+			return(i_RowStatus);
+		}
+
+		return(i_ColumnStatus);
+	}
+
+
+	void BipartiteGraphPartialColoringInterface::SetCompressionCostModel(double d_ForwardSweepCost, double d_ReverseSweepCost) {
+		m_d_ForwardSweepCost = d_ForwardSweepCost;
+		m_d_ReverseSweepCost = d_ReverseSweepCost;
+	}
+
+
+	int BipartiteGraphPartialColoringInterface::GetCompressionCandidates(vector<string> &vs_Candidates, vector<int> &vi_RowColorCounts, vector<int> &vi_ColumnColorCounts, vector<double> &vd_Costs, vector<double> &vd_LowerBounds, vector<double> &vd_Times) {
+		vs_Candidates = m_vs_CompressionCandidates;
+		vi_RowColorCounts = m_vi_CandidateRowColorCounts;
+		vi_ColumnColorCounts = m_vi_CandidateColumnColorCounts;
+		vd_Costs = m_vd_CandidateCosts;
+		vd_LowerBounds = m_vd_CandidateLowerBounds;
+		vd_Times = m_vd_CandidateTimes;
+
+		return(m_i_CompressionCandidate);
+	}
+
+
+	void BipartiteGraphPartialColoringInterface::PrintCompressionCandidates() {
+		cout<<endl;
+		cout<<"Compression Candidates | Forward Sweep Cost = "<<m_d_ForwardSweepCost<<"; Reverse Sweep Cost = "<<m_d_ReverseSweepCost<<" | "<<m_s_InputFile<<endl;
+		cout<<endl;
+
+		for(size_t i=0; i<m_vs_CompressionCandidates.size(); i++) {
+			cout<<m_vs_CompressionCandidates[i]<<" : ";
+
+			if(m_vd_CandidateCosts[i] == _UNKNOWN) {
+				cout<<"skipped [Lower Bound = "<<m_vd_CandidateLowerBounds[i]<<"]"<<endl;
+
+				continue;
+			}
+
+			cout<<"[Row Colors = "<<m_vi_CandidateRowColorCounts[i]<<"; Column Colors = "<<m_vi_CandidateColumnColorCounts[i]<<"; Cost = "<<m_vd_CandidateCosts[i]<<"; Lower Bound = "<<m_vd_CandidateLowerBounds[i]<<"; Time = "<<m_vd_CandidateTimes[i]<<"]";
+
+			if((signed) i == m_i_CompressionCandidate) {
+				cout<<" *";
+			}
+
+			cout<<endl;
+		}
+
+		cout<<endl;
+	}
+
+
 	BipartiteGraphPartialColoringInterface::BipartiteGraphPartialColoringInterface(int i_type, ...) {
 	  //cout<<"IN GraphColoringInterface(int i_type, ...)"<<endl;
 		Clear();
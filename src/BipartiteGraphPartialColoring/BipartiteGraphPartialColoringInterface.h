@@ -92,12 +92,22 @@ namespace ColPack
 		- s_ColoringVariant can be either
 			- "COLUMN_PARTIAL_DISTANCE_TWO" (default)
 			- "ROW_PARTIAL_DISTANCE_TWO"
+			- "AUTO": both are run concurrently and the cheaper one under SetCompressionCostModel() is kept, see PrintCompressionCandidates()
 
 		Postcondition:
 		- The Bipartite Graph is (Partial-Distance-Two) colored, i.e., either m_vi_LeftVertexColors or m_vi_RightVertexColors will be populated.
 		*/
 		int PartialDistanceTwoColoring(string s_OrderingVariant = "NATURAL", string s_ColoringVariant = "COLUMN_PARTIAL_DISTANCE_TWO");
 
+		/// Cost model of the "AUTO" coloring: the cost of one forward sweep (J * S, one per column color) and of one reverse sweep (S^T * J, one per row color). Both default to 1.
+		void SetCompressionCostModel(double d_ForwardSweepCost, double d_ReverseSweepCost);
+
+		/// Candidates of the last "AUTO" coloring: name, number of row and column colors, cost (_UNKNOWN if skipped), lower bound of the cost and wall time; return the index of the kept one
+		int GetCompressionCandidates(vector<string> &vs_Candidates, vector<int> &vi_RowColorCounts, vector<int> &vi_ColumnColorCounts, vector<double> &vd_Costs, vector<double> &vd_LowerBounds, vector<double> &vd_Times);
+
+		/// Print the candidates of the last "AUTO" coloring with their lower bounds, costs and times, the kept one is marked
+		void PrintCompressionCandidates();
+
 		/// Generate and return the seed matrix (OpenMP enabled)
 		/**	This function will
 		- 1. Color the graph by (Row or Column)-Partial-Distance-2-Coloring  with the specified ordering
@@ -136,6 +146,27 @@ namespace ColPack
 
 		Timer m_T_Timer;
 
+		double m_d_ForwardSweepCost;
+		double m_d_ReverseSweepCost;
+
+		vector<string> m_vs_CompressionCandidates;
+		vector<int> m_vi_CandidateRowColorCounts;
+		vector<int> m_vi_CandidateColumnColorCounts;
+		vector<double> m_vd_CandidateLowerBounds;
+		vector<double> m_vd_CandidateCosts;
+		vector<double> m_vd_CandidateTimes;
+
+		int m_i_CompressionCandidate;
+
+		/// "AUTO" of PartialDistanceTwoColoring()
+		/**
+		 * A row with k nonzeros needs k column colors and a column with k nonzeros k row colors, so the largest degrees
+		 * bound the costs from below; a side whose bound exceeds the cost of one color per vertex on the other side is
+		 * skipped. The column coloring runs on this object and the row coloring on a copy of the graph, concurrently
+		 * (OpenMP sections), then the cheaper one is kept here, the column one on a tie.
+		 */
+		int AutoPartialDistanceTwoColoring(string s_OrderingVariant);
+
 	public:
 
 		//Public Destructor 2602
@@ -77,6 +77,88 @@ namespace ColPack
 	}
 
 
+	//Private Function 1402
+	//Same as above with stamps and edge IDs: i_EdgeID is the ID of the edge between i_AdjacentVertex and a vertex of the color of i_Vertex
+	int GraphColoring::UpdateSet(int i_Stamp, int i_AdjacentVertex, int i_EdgeID, vector<int> & vi_FirstSeenOne, vector<int> & vi_FirstSeenEdge)
+	{
+		int i_ColorID;
+
+		i_ColorID = m_vi_VertexColors[i_AdjacentVertex];
+
+		if(vi_FirstSeenOne[i_ColorID] != i_Stamp)
+		{
+			vi_FirstSeenOne[i_ColorID] = i_Stamp;
+			vi_FirstSeenEdge[i_ColorID] = i_EdgeID;
+
+			return(_UNKNOWN);
+		}
+
+		return(vi_FirstSeenEdge[i_ColorID]);
+	}
+
+
+	//Private Function 1405
+	//Fill m_ws_Workspace.vi_EdgeID in O(|E|) without a map: the edge {i, m_vi_Edges[j]}, i < m_vi_Edges[j], is numbered in the order of its slot j
+	//and the number is carried to the other slot of the edge through the list of the lower neighbors of every vertex
+	int GraphColoring::BuildEdgeIDs()
+	{
+		int i, j, k;
+
+		int i_VertexCount, i_EdgeCount, i_EdgeNumber;
+
+		vector<int> & vi_EdgeID = m_ws_Workspace.vi_EdgeID;
+		vector<int> & vi_LowerNeighbor = m_ws_Workspace.vi_LowerNeighbor;
+		vector<int> & vi_LowerEdgeID = m_ws_Workspace.vi_LowerEdgeID;
+		vector<int> & vi_LowerCount = m_ws_Workspace.vi_LowerCount;
+		vector<int> & vi_NeighborSlot = m_ws_Workspace.vi_NeighborSlot;
+
+		i_VertexCount = STEP_DOWN((signed) m_vi_Vertices.size());
+
+		i_EdgeCount = (signed) m_vi_Edges.size();
+
+		ColoringWorkspace::Reserve(vi_EdgeID, i_EdgeCount);
+		ColoringWorkspace::Reserve(vi_LowerNeighbor, i_EdgeCount);
+		ColoringWorkspace::Reserve(vi_LowerEdgeID, i_EdgeCount);
+		ColoringWorkspace::Reserve(vi_NeighborSlot, i_VertexCount);
+		vi_LowerCount.assign((unsigned) i_VertexCount, _FALSE);
+
+		i_EdgeNumber = _FALSE;
+
+		for(i=0; i<i_VertexCount; i++)
+		{
+			for(j=m_vi_Vertices[i]; j<m_vi_Vertices[STEP_UP(i)]; j++)
+			{
+				if(i < m_vi_Edges[j])
+				{
+					vi_EdgeID[j] = i_EdgeNumber;
+
+					k = m_vi_Vertices[m_vi_Edges[j]] + vi_LowerCount[m_vi_Edges[j]]++;
+
+					vi_LowerNeighbor[k] = i;
+					vi_LowerEdgeID[k] = i_EdgeNumber;
+
+					i_EdgeNumber++;
+				}
+			}
+		}
+
+		for(i=0; i<i_VertexCount; i++)
+		{
+			for(j=m_vi_Vertices[i]; j<m_vi_Vertices[STEP_UP(i)]; j++)
+			{
+				vi_NeighborSlot[m_vi_Edges[j]] = j;
+			}
+
+			for(k=m_vi_Vertices[i]; k<m_vi_Vertices[i] + vi_LowerCount[i]; k++)
+			{
+				vi_EdgeID[vi_NeighborSlot[vi_LowerNeighbor[k]]] = vi_LowerEdgeID[k];
+			}
+		}
+
+		return(_TRUE);
+	}
+
+
 	//Private Function 1403
 	int GraphColoring::SearchDepthFirst(int i_RootVertex, int i_ParentVertex, int i_Vertex, vector<int> & vi_TouchedVertices)
 	{
@@ -182,6 +264,12 @@ namespace ColPack
 		m_vi_VertexColorFrequency.clear();
 		m_vi_VertexColorFrequency.resize((unsigned) i_TotalVertexColors, _FALSE);
 
+		m_i_LargestColorClass = _UNKNOWN;
+		m_i_SmallestColorClass = _UNKNOWN;
+
+		m_i_LargestColorClassSize = _UNKNOWN;
+		m_i_SmallestColorClassSize = _UNKNOWN;
+
 		int i_VertexCount = STEP_DOWN((signed) m_vi_Vertices.size());
 
 		for(int i = 0; i < i_VertexCount; i++)
@@ -214,7 +302,7 @@ namespace ColPack
 			}
 		}
 
-		m_d_AverageColorClassSize = i_TotalVertexColors / i_VertexCount;
+		m_d_AverageColorClassSize = (double) i_VertexCount / i_TotalVertexColors;
 
 		return(_TRUE);
 	}
@@ -225,6 +313,8 @@ namespace ColPack
 	{
 		Clear();
 
+		m_d_ColorBalanceTolerance = 0.05;
+
 		Seed_init();
 	}
 
@@ -309,7 +399,9 @@ namespace ColPack
 
 		int i_VertexCount;
 
-		vector<int> vi_CandidateColors;
+		int i_Stamp;
+
+		vector<int> & vi_CandidateColors = m_ws_Workspace.vi_CandidateColors;
 
 		m_i_VertexColorCount = _UNKNOWN;
 
@@ -318,13 +410,14 @@ namespace ColPack
 		m_vi_VertexColors.clear();
 		m_vi_VertexColors.resize((unsigned) i_VertexCount, _UNKNOWN);
 
-		vi_CandidateColors.clear();
-		vi_CandidateColors.resize((unsigned) i_VertexCount, _UNKNOWN);
+		ColoringWorkspace::Reserve(vi_CandidateColors, i_VertexCount);
 
 		for(i=0; i<i_VertexCount; i++)
 		{
 			i_PresentVertex = m_vi_OrderedVertices[i];
 
+			i_Stamp = m_ws_Workspace.NextStamp();
+
 #if VERBOSE == _TRUE
 
 			cout<<"DEBUG 1454 | Distance One Coloring | Coloring Vertex "<<STEP_UP(i_PresentVertex)<<"/"<<i_VertexCount<<endl;
@@ -338,13 +431,13 @@ namespace ColPack
 					continue;
 				}
 
-				vi_CandidateColors[m_vi_VertexColors[m_vi_Edges[j]]] = i_PresentVertex;
+				vi_CandidateColors[m_vi_VertexColors[m_vi_Edges[j]]] = i_Stamp;
 
 			}
 
 			for(j=0; j<i_VertexCount; j++)
 			{
-				if(vi_CandidateColors[j] != i_PresentVertex)
+				if(vi_CandidateColors[j] != i_Stamp)
 				{
 					m_vi_VertexColors[i_PresentVertex] = j;
 
@@ -363,24 +456,21 @@ namespace ColPack
 	}
 
 
-	//Public Function 1455
-	int GraphColoring::DistanceTwoColoring()
+	//Public Function 1479
+	int GraphColoring::DistanceOneColoring_Balanced()
 	{
-		/*
-                 if(CheckVertexColoring("DISTANCE TWO"))
-		{
-			return(_TRUE);
-		}
-                */
-
-		int i, j, k;
+		int i, j;
 
 		int i_PresentVertex;
 
+		int i_SelectedColor;
+
 		int i_VertexCount;
 
 		vector<int> vi_CandidateColors;
 
+		vector<int> vi_ColorClassSizes;
+
 		m_i_VertexColorCount = _UNKNOWN;
 
 		i_VertexCount = STEP_DOWN((signed) m_vi_Vertices.size());
@@ -391,151 +481,490 @@ namespace ColPack
 		vi_CandidateColors.clear();
 		vi_CandidateColors.resize((unsigned) i_VertexCount, _UNKNOWN);
 
+		vi_ColorClassSizes.clear();
+		vi_ColorClassSizes.resize((unsigned) i_VertexCount, _FALSE);
+
 		for(i=0; i<i_VertexCount; i++)
 		{
 			i_PresentVertex = m_vi_OrderedVertices[i];
 
-#if VERBOSE == _TRUE
-
-			cout<<"DEBUG 1455 | Distance Two Coloring | Coloring Vertex "<<STEP_UP(i_PresentVertex)<<"/"<<i_VertexCount<<endl;
-
-#endif
 			for(j=m_vi_Vertices[i_PresentVertex]; j<m_vi_Vertices[STEP_UP(i_PresentVertex)]; j++)
 			{
-/*
 				if(m_vi_VertexColors[m_vi_Edges[j]] == _UNKNOWN)
 				{
 					continue;
 				}
+
 				vi_CandidateColors[m_vi_VertexColors[m_vi_Edges[j]]] = i_PresentVertex;
-//*/
-				if(m_vi_VertexColors[m_vi_Edges[j]] != _UNKNOWN) vi_CandidateColors[m_vi_VertexColors[m_vi_Edges[j]]] = i_PresentVertex;
+			}
 
-				for(k=m_vi_Vertices[m_vi_Edges[j]]; k<m_vi_Vertices[STEP_UP(m_vi_Edges[j])]; k++)
+			//Pick the least used permissible color; a new color is opened only when all used colors are forbidden
+			i_SelectedColor = STEP_UP(m_i_VertexColorCount);
+
+			for(j=0; j<=m_i_VertexColorCount; j++)
+			{
+				if(vi_CandidateColors[j] == i_PresentVertex)
 				{
-					//is this "if" statement really necessary? because the i_PresentVertex is not colored anyway
-					// say it another way, the second if statement will take care of the i_PresentVertex
-/*
-					if(m_vi_Edges[k] == i_PresentVertex)
-					{
-						continue;
-					}
-//*/
+					continue;
+				}
 
-					if(m_vi_VertexColors[m_vi_Edges[k]] != _UNKNOWN)
-					{
-						vi_CandidateColors[m_vi_VertexColors[m_vi_Edges[k]]] = i_PresentVertex;
-					}
+				if((i_SelectedColor > m_i_VertexColorCount) || (vi_ColorClassSizes[j] < vi_ColorClassSizes[i_SelectedColor]))
+				{
+					i_SelectedColor = j;
 				}
 			}
 
-			for(j=0; j<i_VertexCount; j++)
-			{
-				if(vi_CandidateColors[j] != i_PresentVertex)
-				{
-					m_vi_VertexColors[i_PresentVertex] = j;
+			m_vi_VertexColors[i_PresentVertex] = i_SelectedColor;
 
-					if(m_i_VertexColorCount < j)
-					{
-						m_i_VertexColorCount = j;
-					}
+			vi_ColorClassSizes[i_SelectedColor]++;
 
-					break;
-				}
+			if(m_i_VertexColorCount < i_SelectedColor)
+			{
+				m_i_VertexColorCount = i_SelectedColor;
 			}
 		}
 
+		m_s_VertexColoringVariant = "DISTANCE_ONE_BALANCED";
+
+		return(RebalanceVertexColors());
+	}
+
+
+	//Public Function 1480
+	int GraphColoring::RebalanceVertexColors()
+	{
+		RebalanceColorClasses(m_vi_Vertices, m_vi_Edges, STEP_UP(m_i_VertexColorCount), m_d_ColorBalanceTolerance, m_vi_VertexColors);
+
 		return(_TRUE);
 	}
 
 
-	//Public Function 1456
-	int GraphColoring::NaiveStarColoring()
+	//Public Function 1481
+	void GraphColoring::SetColorBalanceTolerance(double d_ColorBalanceTolerance)
 	{
-		//if(CheckVertexColoring("NAIVE STAR"))
-		//{
-		//	return(_TRUE);
-		//}
+		m_d_ColorBalanceTolerance = d_ColorBalanceTolerance;
+	}
 
-		int i, j, k, l;
 
-		int i_PresentVertex;
+	//Public Function 1482
+	double GraphColoring::GetColorBalanceTolerance()
+	{
+		return(m_d_ColorBalanceTolerance);
+	}
 
-		int i_VertexCount;
 
-		vector<int> vi_CandidateColors;
+	//Public Function 1483
+	int GraphColoring::IteratedGreedyRecoloring(string s_ColoringVariant, string s_ClassOrder, double d_TimeBudget, int i_MaxIterations)
+	{
+		int i_VertexCount = STEP_DOWN((signed) m_vi_Vertices.size());
 
-		m_i_VertexColorCount = _UNKNOWN;
+		if((i_VertexCount <= 0) || ((signed) m_vi_VertexColors.size() != i_VertexCount) || (m_i_VertexColorCount < 0))
+		{
+			cerr<<endl<<"*ERROR: IteratedGreedyRecoloring() needs a colored graph"<<endl;
 
-		i_VertexCount = STEP_DOWN((signed) m_vi_Vertices.size());
+			return(_FALSE);
+		}
 
-		m_vi_VertexColors.clear();
-		m_vi_VertexColors.resize((unsigned) i_VertexCount, _UNKNOWN);
+		int i_Distance;
 
-		vi_CandidateColors.clear();
-		vi_CandidateColors.resize((unsigned) i_VertexCount, _UNKNOWN);
+		if((s_ColoringVariant == "DISTANCE_ONE") || (s_ColoringVariant == "DISTANCE_ONE_OMP") || (s_ColoringVariant == "DISTANCE_ONE_BALANCED"))
+		{
+			i_Distance = 1;
+		}
+		else
+		if(s_ColoringVariant == "DISTANCE_TWO")
+		{
+			i_Distance = 2;
+		}
+		else
+		if((s_ColoringVariant == "STAR") || (s_ColoringVariant == "RESTRICTED_STAR"))
+		{
+			i_Distance = _UNKNOWN;
+		}
+		else
+		{
+			cerr<<endl<<"*ERROR: Unknown Coloring Method "<<s_ColoringVariant<<" for IteratedGreedyRecoloring(). Please use DISTANCE_ONE, DISTANCE_TWO, STAR or RESTRICTED_STAR."<<endl;
 
-		for(i=0; i<i_VertexCount; i++)
+			return(_FALSE);
+		}
+
+		if((s_ClassOrder != "REVERSE") && (s_ClassOrder != "LARGEST_FIRST"))
 		{
-			i_PresentVertex = m_vi_OrderedVertices[i];
+			cerr<<endl<<"*ERROR: Unknown color class order "<<s_ClassOrder<<". Please use REVERSE or LARGEST_FIRST."<<endl;
 
-#if VERBOSE == _TRUE
+			return(_FALSE);
+		}
 
-		cout<<"DEBUG 1456 | Naive Star Coloring | Coloring Vertex "<<STEP_UP(i_PresentVertex)<<"/"<<i_VertexCount<<endl;
+		//Wall clock time: Timer measures the CPU time of all the OpenMP threads
+		double d_StartTime = Timer::GetWallClock();
 
-#endif
+		//Star colorings are recomputed from scratch, so the best one is kept aside together with the ordering and the variant
+		vector<int> vi_BestVertexColors;
 
-			for(j=m_vi_Vertices[i_PresentVertex]; j<m_vi_Vertices[STEP_UP(i_PresentVertex)]; j++)
+		int i_BestVertexColorCount = m_i_VertexColorCount;
+
+		vector<int> vi_InputOrderedVertices;
+
+		string s_InputColoringVariant = m_s_VertexColoringVariant;
+
+		if(i_Distance == _UNKNOWN)
+		{
+			vi_BestVertexColors = m_vi_VertexColors;
+
+			vi_InputOrderedVertices = m_vi_OrderedVertices;
+		}
+
+		vector<int> vi_NewVertexColors(i_VertexCount);
+
+		for(int i_Iteration=0; i_Iteration<i_MaxIterations; i_Iteration++)
+		{
+			int i_ColorCount = STEP_UP(m_i_VertexColorCount);
+
+			vector<int> vi_ColorClassSizes(i_ColorCount, _FALSE);
+
+			vector<int> vi_ColorClassStart(STEP_UP(i_ColorCount), _FALSE);
+
+			vector<int> vi_ColorClassMembers(i_VertexCount);
+
+			vector<int> vi_ClassOrder(i_ColorCount);
+
+			for(int i=0; i<i_VertexCount; i++)
 			{
-				if(m_vi_VertexColors[m_vi_Edges[j]] != _UNKNOWN)
+				vi_ColorClassSizes[m_vi_VertexColors[i]]++;
+			}
+
+			for(int i=0; i<i_ColorCount; i++)
+			{
+				vi_ColorClassStart[STEP_UP(i)] = vi_ColorClassStart[i] + vi_ColorClassSizes[i];
+
+				vi_ClassOrder[i] = STEP_DOWN(i_ColorCount) - i;
+			}
+
+			{
+				vector<int> vi_ColorClassTail(vi_ColorClassStart.begin(), vi_ColorClassStart.end() - 1);
+
+				for(int i=0; i<i_VertexCount; i++)
 				{
-					vi_CandidateColors[m_vi_VertexColors[m_vi_Edges[j]]] = i_PresentVertex;
+					vi_ColorClassMembers[vi_ColorClassTail[m_vi_VertexColors[i]]++] = i;
 				}
+			}
 
-				for(k=m_vi_Vertices[m_vi_Edges[j]]; k<m_vi_Vertices[STEP_UP(m_vi_Edges[j])]; k++)
+			if(s_ClassOrder == "LARGEST_FIRST")
+			{
+				for(int i=1; i<i_ColorCount; i++)
 				{
-					if(m_vi_Edges[k] == i_PresentVertex)
-					{
-						continue;
-					}
+					int i_Color = vi_ClassOrder[i];
 
-					if(m_vi_VertexColors[m_vi_Edges[k]] == _UNKNOWN)
+					int j = i;
+
+					while((j > 0) && (vi_ColorClassSizes[vi_ClassOrder[STEP_DOWN(j)]] < vi_ColorClassSizes[i_Color]))
 					{
-						continue;
+						vi_ClassOrder[j] = vi_ClassOrder[STEP_DOWN(j)];
+
+						j--;
 					}
 
-					if(m_vi_VertexColors[m_vi_Edges[j]] == _UNKNOWN)
+					vi_ClassOrder[j] = i_Color;
+				}
+			}
+
+			if(i_Distance == _UNKNOWN)
+			{
+				//Color the graph again with the vertices grouped by color class
+				int k = 0;
+
+				for(int i=0; i<i_ColorCount; i++)
+				{
+					for(int j=vi_ColorClassStart[vi_ClassOrder[i]]; j<vi_ColorClassStart[STEP_UP(vi_ClassOrder[i])]; j++)
 					{
-						vi_CandidateColors[m_vi_VertexColors[m_vi_Edges[k]]] = i_PresentVertex;
+						m_vi_OrderedVertices[k++] = vi_ColorClassMembers[j];
 					}
-					else
+				}
+
+				if(s_ColoringVariant == "STAR")
+				{
+					StarColoring();
+				}
+				else
+				{
+					RestrictedStarColoring();
+				}
+
+				if(m_i_VertexColorCount < i_BestVertexColorCount)
+				{
+					i_BestVertexColorCount = m_i_VertexColorCount;
+
+					vi_BestVertexColors = m_vi_VertexColors;
+				}
+			}
+			else
+			{
+				//Greedy in color class order. A vertex of the i-th class has only neighbors from the first i classes
+				//already recolored, so it gets a color below i and the color count never grows.
+				//Members of a class are not distance-i_Distance neighbors of each other, so a class is recolored in parallel.
+				int i_NewVertexColorCount = _UNKNOWN;
+
+				for(int i=0; i<i_VertexCount; i++)
+				{
+					vi_NewVertexColors[i] = _UNKNOWN;
+				}
+
+				#pragma omp parallel reduction(max:i_NewVertexColorCount)
+				{
+					vector<int> vi_ForbiddenColors(i_ColorCount, _UNKNOWN);
+
+					for(int i=0; i<i_ColorCount; i++)
 					{
-						for(l=m_vi_Vertices[m_vi_Edges[k]]; l<m_vi_Vertices[STEP_UP(m_vi_Edges[k])]; l++)
+						#pragma omp for schedule(dynamic, 64)
+						for(int k=vi_ColorClassStart[vi_ClassOrder[i]]; k<vi_ColorClassStart[STEP_UP(vi_ClassOrder[i])]; k++)
 						{
-							if(m_vi_Edges[l] == m_vi_Edges[j])
+							int i_PresentVertex = vi_ColorClassMembers[k];
+
+							for(int j=m_vi_Vertices[i_PresentVertex]; j<m_vi_Vertices[STEP_UP(i_PresentVertex)]; j++)
 							{
-								continue;
+								int i_D1Neighbor = m_vi_Edges[j];
+
+								if(vi_NewVertexColors[i_D1Neighbor] != _UNKNOWN)
+								{
+									vi_ForbiddenColors[vi_NewVertexColors[i_D1Neighbor]] = i_PresentVertex;
+								}
+
+								if(i_Distance == 1)
+								{
+									continue;
+								}
+
+								for(int l=m_vi_Vertices[i_D1Neighbor]; l<m_vi_Vertices[STEP_UP(i_D1Neighbor)]; l++)
+								{
+									if((m_vi_Edges[l] != i_PresentVertex) && (vi_NewVertexColors[m_vi_Edges[l]] != _UNKNOWN))
+									{
+										vi_ForbiddenColors[vi_NewVertexColors[m_vi_Edges[l]]] = i_PresentVertex;
+									}
+								}
 							}
 
-							if(m_vi_VertexColors[m_vi_Edges[l]] == _UNKNOWN)
+							int i_Color = 0;
+
+							while(vi_ForbiddenColors[i_Color] == i_PresentVertex)
 							{
-								continue;
+								i_Color++;
 							}
 
-							if(m_vi_VertexColors[m_vi_Edges[l]] == m_vi_VertexColors[m_vi_Edges[j]])
-							{
-								vi_CandidateColors[m_vi_VertexColors[m_vi_Edges[k]]] = i_PresentVertex;
+							vi_NewVertexColors[i_PresentVertex] = i_Color;
 
-								break;
+							if(i_NewVertexColorCount < i_Color)
+							{
+								i_NewVertexColorCount = i_Color;
 							}
 						}
 					}
 				}
-			}
+
+				m_vi_VertexColors.swap(vi_NewVertexColors);
+
+				m_i_VertexColorCount = i_NewVertexColorCount;
+			}
+
+			if(Timer::GetWallClock() - d_StartTime >= d_TimeBudget)
+			{
+				break;
+			}
+		}
+
+		if(i_Distance == _UNKNOWN)
+		{
+			m_vi_OrderedVertices.swap(vi_InputOrderedVertices);
+
+			m_vi_VertexColors.swap(vi_BestVertexColors);
+
+			m_i_VertexColorCount = i_BestVertexColorCount;
+
+			m_s_VertexColoringVariant = s_InputColoringVariant;
+		}
+
+		return(_TRUE);
+	}
+
+
+	//Public Function 1455
+	int GraphColoring::DistanceTwoColoring()
+	{
+		/*
+                 if(CheckVertexColoring("DISTANCE TWO"))
+		{
+			return(_TRUE);
+		}
+                */
+
+		int i, j, k;
+
+		int i_PresentVertex;
+
+		int i_VertexCount;
+
+		int i_Stamp;
+
+		vector<int> & vi_CandidateColors = m_ws_Workspace.vi_CandidateColors;
+
+		m_i_VertexColorCount = _UNKNOWN;
+
+		i_VertexCount = STEP_DOWN((signed) m_vi_Vertices.size());
+
+		m_vi_VertexColors.clear();
+		m_vi_VertexColors.resize((unsigned) i_VertexCount, _UNKNOWN);
+
+		ColoringWorkspace::Reserve(vi_CandidateColors, i_VertexCount);
+
+		for(i=0; i<i_VertexCount; i++)
+		{
+			i_PresentVertex = m_vi_OrderedVertices[i];
+
+			i_Stamp = m_ws_Workspace.NextStamp();
+
+#if VERBOSE == _TRUE
+
+			cout<<"DEBUG 1455 | Distance Two Coloring | Coloring Vertex "<<STEP_UP(i_PresentVertex)<<"/"<<i_VertexCount<<endl;
+
+#endif
+			for(j=m_vi_Vertices[i_PresentVertex]; j<m_vi_Vertices[STEP_UP(i_PresentVertex)]; j++)
+			{
+/*
+				if(m_vi_VertexColors[m_vi_Edges[j]] == _UNKNOWN)
+				{
+					continue;
+				}
+				vi_CandidateColors[m_vi_VertexColors[m_vi_Edges[j]]] = i_Stamp;
+//*/
+				if(m_vi_VertexColors[m_vi_Edges[j]] != _UNKNOWN) vi_CandidateColors[m_vi_VertexColors[m_vi_Edges[j]]] = i_Stamp;
+
+				for(k=m_vi_Vertices[m_vi_Edges[j]]; k<m_vi_Vertices[STEP_UP(m_vi_Edges[j])]; k++)
+				{
+					//is this "if" statement really necessary? because the i_PresentVertex is not colored anyway
+					// say it another way, the second if statement will take care of the i_PresentVertex
+/*
+					if(m_vi_Edges[k] == i_PresentVertex)
+					{
+						continue;
+					}
+//*/
+
+					if(m_vi_VertexColors[m_vi_Edges[k]] != _UNKNOWN)
+					{
+						vi_CandidateColors[m_vi_VertexColors[m_vi_Edges[k]]] = i_Stamp;
+					}
+				}
+			}
 
 			for(j=0; j<i_VertexCount; j++)
 			{
-				if(vi_CandidateColors[j] != i_PresentVertex)
+				if(vi_CandidateColors[j] != i_Stamp)
+				{
+					m_vi_VertexColors[i_PresentVertex] = j;
+
+					if(m_i_VertexColorCount < j)
+					{
+						m_i_VertexColorCount = j;
+					}
+
+					break;
+				}
+			}
+		}
+
+		return(_TRUE);
+	}
+
+
+	//Public Function 1456
+	int GraphColoring::NaiveStarColoring()
+	{
+		//if(CheckVertexColoring("NAIVE STAR"))
+		//{
+		//	return(_TRUE);
+		//}
+
+		int i, j, k, l;
+
+		int i_PresentVertex;
+
+		int i_VertexCount;
+
+		int i_Stamp;
+
+		vector<int> & vi_CandidateColors = m_ws_Workspace.vi_CandidateColors;
+
+		m_i_VertexColorCount = _UNKNOWN;
+
+		i_VertexCount = STEP_DOWN((signed) m_vi_Vertices.size());
+
+		m_vi_VertexColors.clear();
+		m_vi_VertexColors.resize((unsigned) i_VertexCount, _UNKNOWN);
+
+		ColoringWorkspace::Reserve(vi_CandidateColors, i_VertexCount);
+
+		for(i=0; i<i_VertexCount; i++)
+		{
+			i_PresentVertex = m_vi_OrderedVertices[i];
+
+			i_Stamp = m_ws_Workspace.NextStamp();
+
+#if VERBOSE == _TRUE
+
+		cout<<"DEBUG 1456 | Naive Star Coloring | Coloring Vertex "<<STEP_UP(i_PresentVertex)<<"/"<<i_VertexCount<<endl;
+
+#endif
+
+			for(j=m_vi_Vertices[i_PresentVertex]; j<m_vi_Vertices[STEP_UP(i_PresentVertex)]; j++)
+			{
+				if(m_vi_VertexColors[m_vi_Edges[j]] != _UNKNOWN)
+				{
+					vi_CandidateColors[m_vi_VertexColors[m_vi_Edges[j]]] = i_Stamp;
+				}
+
+				for(k=m_vi_Vertices[m_vi_Edges[j]]; k<m_vi_Vertices[STEP_UP(m_vi_Edges[j])]; k++)
+				{
+					if(m_vi_Edges[k] == i_PresentVertex)
+					{
+						continue;
+					}
+
+					if(m_vi_VertexColors[m_vi_Edges[k]] == _UNKNOWN)
+					{
+						continue;
+					}
+
+					if(m_vi_VertexColors[m_vi_Edges[j]] == _UNKNOWN)
+					{
+						vi_CandidateColors[m_vi_VertexColors[m_vi_Edges[k]]] = i_Stamp;
+					}
+					else
+					{
+						for(l=m_vi_Vertices[m_vi_Edges[k]]; l<m_vi_Vertices[STEP_UP(m_vi_Edges[k])]; l++)
+						{
+							if(m_vi_Edges[l] == m_vi_Edges[j])
+							{
+								continue;
+							}
+
+							if(m_vi_VertexColors[m_vi_Edges[l]] == _UNKNOWN)
+							{
+								continue;
+							}
+
+							if(m_vi_VertexColors[m_vi_Edges[l]] == m_vi_VertexColors[m_vi_Edges[j]])
+							{
+								vi_CandidateColors[m_vi_VertexColors[m_vi_Edges[k]]] = i_Stamp;
+
+								break;
+							}
+						}
+					}
+				}
+			}
+
+			for(j=0; j<i_VertexCount; j++)
+			{
+				if(vi_CandidateColors[j] != i_Stamp)
 				{
 					m_vi_VertexColors[i_PresentVertex] = j;
 
@@ -567,7 +996,9 @@ namespace ColPack
 
 		int i_VertexCount;
 
-		vector<int> vi_CandidateColors;
+		int i_Stamp;
+
+		vector<int> & vi_CandidateColors = m_ws_Workspace.vi_CandidateColors;
 
 		m_i_VertexColorCount = _UNKNOWN;
 
@@ -576,14 +1007,15 @@ namespace ColPack
 		m_vi_VertexColors.clear();
 		m_vi_VertexColors.resize((unsigned) i_VertexCount, _UNKNOWN);
 
-		vi_CandidateColors.clear();
-		vi_CandidateColors.resize((unsigned) i_VertexCount, _UNKNOWN);
+		ColoringWorkspace::Reserve(vi_CandidateColors, i_VertexCount);
 
 		for(i=0; i<i_VertexCount; i++)
 		{
 
 			i_PresentVertex = m_vi_OrderedVertices[i];
 
+			i_Stamp = m_ws_Workspace.NextStamp();
+
 #if VERBOSE == _TRUE
 
 			cout<<"DEBUG 1457 | Restricted Star Coloring | Coloring Vertex "<<STEP_UP(i_PresentVertex)<<"/"<<i_VertexCount<<endl;
@@ -594,7 +1026,7 @@ namespace ColPack
 			{
 				if(m_vi_VertexColors[m_vi_Edges[j]] != _UNKNOWN)
 				{
-					vi_CandidateColors[m_vi_VertexColors[m_vi_Edges[j]]] = i_PresentVertex;
+					vi_CandidateColors[m_vi_VertexColors[m_vi_Edges[j]]] = i_Stamp;
 				}
 
 				for(k=m_vi_Vertices[m_vi_Edges[j]]; k<m_vi_Vertices[STEP_UP(m_vi_Edges[j])]; k++)
@@ -612,20 +1044,20 @@ namespace ColPack
 					if(m_vi_VertexColors[m_vi_Edges[j]] == _UNKNOWN)
 					{
 						//mark as forbidden
-						vi_CandidateColors[m_vi_VertexColors[m_vi_Edges[k]]] = i_PresentVertex;
+						vi_CandidateColors[m_vi_VertexColors[m_vi_Edges[k]]] = i_Stamp;
 					}
 					else
 					if(m_vi_VertexColors[m_vi_Edges[k]] < m_vi_VertexColors[m_vi_Edges[j]])
 					{
 						//mark as forbidden
-						 vi_CandidateColors[m_vi_VertexColors[m_vi_Edges[k]]] = i_PresentVertex;
+						 vi_CandidateColors[m_vi_VertexColors[m_vi_Edges[k]]] = i_Stamp;
 					}
 				}
 			}
 
 			for(j=0; j<i_VertexCount; j++)
 			{
-				if(vi_CandidateColors[j] != i_PresentVertex)
+				if(vi_CandidateColors[j] != i_Stamp)
 				{
 					m_vi_VertexColors[i_PresentVertex] = j;
 
@@ -643,57 +1075,266 @@ namespace ColPack
 
 	}
 
-	int GraphColoring::PrintVertexColorCombination(map <int, int >* VertexColorCombination) {
-		cout<<"PrintVertexColorCombination"<<endl;
-		map< int, int>::iterator mii_iter;
-		mii_iter = (*VertexColorCombination).begin();
-		for(;mii_iter != (*VertexColorCombination).end(); mii_iter++) {
-			cout<<"\t c "<<mii_iter->first<<": ";
+	int GraphColoring::DetectStarConflicts(bool b_Restricted, vector< pair<int, int> >* ConflictedEdges_Private, vector<int> & vi_ConflictCount, vector<int>* vi_ColorStamp_Private, vector<int>* vi_FirstVertex_Private) {
+		int i_VertexCount = STEP_DOWN((signed) m_vi_Vertices.size());
 
-			if( mii_iter->second > -1) {
-				cout<<" NO hub, connect to v "<<mii_iter->second<<" c "<<m_vi_VertexColors[mii_iter->second];
-			}
-			else if ( mii_iter->second == -1) {
-				cout<<" HUB";
-			}
-			else { // (*itr)[iii].second < -1
-				cout<<" LEAF of hub v "<<-(mii_iter->second+2) <<" c "<<m_vi_VertexColors[-(mii_iter->second+2)];
+		// same color edges, and 2 neighbors u, x of a vertex w with the same color c(u) = c(x) below the bound of w:
+		// c(w) for the restricted star coloring, +infinity for an uncolored w (the greedy forbids c(u) for x in that case)
+#ifdef _OPENMP
+		#pragma omp parallel for schedule(dynamic,64)
+#endif
+		for(int i=0; i<i_VertexCount; i++) {
+			int i_thread_num;
+#ifdef _OPENMP
+			i_thread_num = omp_get_thread_num();
+#else
+			i_thread_num = 0;
+#endif
+			vector<int> & vi_ColorStamp = vi_ColorStamp_Private[i_thread_num];
+			vector<int> & vi_FirstVertex = vi_FirstVertex_Private[i_thread_num];
+			int i_Color = m_vi_VertexColors[i];
+			int i_Bound = (i_Color == _UNKNOWN) ? i_VertexCount : (b_Restricted ? i_Color : _UNKNOWN);
+			for(int j=m_vi_Vertices[i]; j<m_vi_Vertices[STEP_UP(i)]; j++) {
+				int i_AdjacentVertex = m_vi_Edges[j];
+				int i_AdjacentColor = m_vi_VertexColors[i_AdjacentVertex];
+				if(i_AdjacentColor == _UNKNOWN) continue;
+				pair<int, int> pii_Conflict;
+				if(i_AdjacentColor == i_Color) {
+					if(i > i_AdjacentVertex) continue;
+					pii_Conflict = pair<int, int>(i, i_AdjacentVertex);
+				}
+				else {
+					if(i_AdjacentColor >= i_Bound) continue;
+					if(vi_ColorStamp[i_AdjacentColor] != i) {
+						vi_ColorStamp[i_AdjacentColor] = i;
+						vi_FirstVertex[i_AdjacentColor] = i_AdjacentVertex;
+						continue;
+					}
+					pii_Conflict = pair<int, int>(vi_FirstVertex[i_AdjacentColor], i_AdjacentVertex);
+				}
+				ConflictedEdges_Private[i_thread_num].push_back(pii_Conflict);
+#ifdef _OPENMP
+				#pragma omp atomic
+#endif
+				vi_ConflictCount[pii_Conflict.first]++;
+#ifdef _OPENMP
+				#pragma omp atomic
+#endif
+				vi_ConflictCount[pii_Conflict.second]++;
 			}
-			cout<<endl;
-
 		}
-		return (_TRUE);
-	}
-
-	int GraphColoring::PrintPotentialHub(map< int, int> *PotentialHub_Private, int i_thread_num, pair<int, int> pii_ColorCombination) {
-		cout<<"PrintPotentialHub - Star collection of combination "<< pii_ColorCombination.first << " "<< pii_ColorCombination.second <<endl;
-		map< int, int>::iterator mii_iter;
-		mii_iter = PotentialHub_Private[i_thread_num].begin();
-		for(;mii_iter != PotentialHub_Private[i_thread_num].end(); mii_iter++) {
-			cout<<"\t v "<<mii_iter->first<<" c "<<m_vi_VertexColors[mii_iter->first]<<":";
 
-			if( mii_iter->second > -1) {
-				cout<<" NO hub, connect to v "<<mii_iter->second<<" c "<<m_vi_VertexColors[mii_iter->second];
-			}
-			else if ( mii_iter->second == -1) {
-				cout<<" HUB";
-			}
-			else { // (*itr)[iii].second < -1
-				cout<<" LEAF of hub v "<<-(mii_iter->second+2) <<" c "<<m_vi_VertexColors[-(mii_iter->second+2)];
-			}
-			cout<<endl;
+		if(b_Restricted) return (_TRUE);
 
+		// 2-colored paths on 4 vertices
+		vector< pair<int, int> > vpii_ConflictedEdges;
+		CheckStarColoring(vpii_ConflictedEdges);
+		for(int i=0; i<(signed) vpii_ConflictedEdges.size(); i++) {
+			if(m_vi_VertexColors[vpii_ConflictedEdges[i].first] == m_vi_VertexColors[vpii_ConflictedEdges[i].second]) continue; // already listed
+			ConflictedEdges_Private[0].push_back(vpii_ConflictedEdges[i]);
+			vi_ConflictCount[vpii_ConflictedEdges[i].first]++;
+			vi_ConflictCount[vpii_ConflictedEdges[i].second]++;
 		}
+
 		return (_TRUE);
 	}
 
+	int GraphColoring::SpeculativeStarColoring(bool b_Restricted) {
+		int i_MaxNumThreads;
+#ifdef _OPENMP
+		i_MaxNumThreads = omp_get_max_threads();
+#else
+		i_MaxNumThreads = 1;
+#endif
+		int i_VertexCount = STEP_DOWN((signed) m_vi_Vertices.size());
+		m_vi_VertexColors.assign((unsigned) i_VertexCount, _UNKNOWN);
+
+		vector<int> vi_ConflictCount(i_VertexCount, 0);
+		vector<int> vi_VerticesToBeColored(m_vi_OrderedVertices.begin(), m_vi_OrderedVertices.end());
+		vector< pair<int, int> >* ConflictedEdges_Private = new vector< pair<int, int> >[i_MaxNumThreads];
+
+		// thread private markers; a color can not be larger than the number of vertices
+		vector<int>* vi_CandidateColors_Private = new vector<int>[i_MaxNumThreads];
+		vector<int>* vi_FirstVertex_Private = new vector<int>[i_MaxNumThreads];
+		vector<int>* vi_ColorStamp_Private = new vector<int>[i_MaxNumThreads];
+		vector<int>* vi_SeenColors_Private = new vector<int>[i_MaxNumThreads];
+		vector<int>* vi_RepeatedColors_Private = new vector<int>[i_MaxNumThreads];
+		vector<int> vi_Stamp_Private(i_MaxNumThreads, 0);
+		for(int i=0; i<i_MaxNumThreads; i++) {
+			vi_CandidateColors_Private[i].assign(i_VertexCount+1, _UNKNOWN);
+			vi_FirstVertex_Private[i].assign(i_VertexCount+1, _UNKNOWN);
+			vi_ColorStamp_Private[i].assign(i_VertexCount+1, _UNKNOWN);
+			if(b_Restricted) continue;
+			vi_SeenColors_Private[i].assign(i_VertexCount+1, _UNKNOWN);
+			vi_RepeatedColors_Private[i].assign(i_VertexCount+1, _UNKNOWN);
+		}
 
-	// !!! later on, remove the codes that check for conflicts (because we assume no conflict) => make this function run faster)
-	int GraphColoring::BuildStarFromColorCombination_forChecking(int i_Mode, int i_MaxNumThreads, int i_thread_num, pair<int, int> pii_ColorCombination, map< pair<int, int>, Colors2Edge_Value , lt_pii>* Colors2Edge_Private,
-							  map< int, int> * PotentialHub_Private) {
-		map< pair<int, int>, Colors2Edge_Value, lt_pii >::iterator mpii_iter;
-		map< int, int>::iterator mii_iter;
-		int i_PotentialHub=0;
+		int i_LoopCount = 0;
+		while(vi_VerticesToBeColored.size()>0) {
+			i_LoopCount++;
+			// speculative rounds are bounded, the rest is colored by one thread
+			int i_NumThreads = (i_LoopCount <= STAR_OMP_ROUNDS) ? i_MaxNumThreads : 1;
+			int i_RecolorCount = vi_VerticesToBeColored.size();
+
+			// tentative coloring, same rules as NaiveStarColoring() and RestrictedStarColoring().
+			// The naive rule only looks at paths where i_PresentVertex is an end point, which is enough when
+			// the vertices are colored one after the other but not for concurrent neighbors: a vertex is also kept
+			// off the colors of the neighbors of w when the color of w is repeated around it, so that a 2-colored
+			// path on 4 vertices found by the detect phase is broken by recoloring either end of its middle edge
+#ifdef _OPENMP
+			#pragma omp parallel for schedule(dynamic,64) num_threads(i_NumThreads)
+#endif
+			for(int i=0; i<i_RecolorCount; i++) {
+				int i_thread_num;
+#ifdef _OPENMP
+				i_thread_num = omp_get_thread_num();
+#else
+				i_thread_num = 0;
+#endif
+				int i_PresentVertex = vi_VerticesToBeColored[i];
+				int i_Stamp = vi_Stamp_Private[i_thread_num]++;
+				vector<int> & vi_CandidateColors = vi_CandidateColors_Private[i_thread_num];
+
+				if(!b_Restricted) {
+					vector<int> & vi_SeenColors = vi_SeenColors_Private[i_thread_num];
+					vector<int> & vi_RepeatedColors = vi_RepeatedColors_Private[i_thread_num];
+					for(int j=m_vi_Vertices[i_PresentVertex]; j<m_vi_Vertices[STEP_UP(i_PresentVertex)]; j++) {
+						int i_AdjacentColor = m_vi_VertexColors[m_vi_Edges[j]];
+						if(i_AdjacentColor == _UNKNOWN) continue;
+						if(vi_SeenColors[i_AdjacentColor] == i_Stamp) vi_RepeatedColors[i_AdjacentColor] = i_Stamp;
+						else vi_SeenColors[i_AdjacentColor] = i_Stamp;
+					}
+				}
+
+				for(int j=m_vi_Vertices[i_PresentVertex]; j<m_vi_Vertices[STEP_UP(i_PresentVertex)]; j++) {
+					int i_AdjacentVertex = m_vi_Edges[j];
+					int i_AdjacentColor = m_vi_VertexColors[i_AdjacentVertex];
+					if(i_AdjacentColor != _UNKNOWN) vi_CandidateColors[i_AdjacentColor] = i_Stamp;
+					bool b_RepeatedColor = !b_Restricted && i_AdjacentColor != _UNKNOWN && vi_RepeatedColors_Private[i_thread_num][i_AdjacentColor] == i_Stamp;
+
+					for(int k=m_vi_Vertices[i_AdjacentVertex]; k<m_vi_Vertices[STEP_UP(i_AdjacentVertex)]; k++) {
+						int i_DistanceOneVertex = m_vi_Edges[k];
+						if(i_DistanceOneVertex == i_PresentVertex) continue;
+						int i_DistanceOneColor = m_vi_VertexColors[i_DistanceOneVertex];
+						if(i_DistanceOneColor == _UNKNOWN) continue;
+
+						if(i_AdjacentColor == _UNKNOWN || b_RepeatedColor) {
+							vi_CandidateColors[i_DistanceOneColor] = i_Stamp;
+						}
+						else if(b_Restricted) {
+							if(i_DistanceOneColor < i_AdjacentColor) vi_CandidateColors[i_DistanceOneColor] = i_Stamp;
+						}
+						else {
+							for(int l=m_vi_Vertices[i_DistanceOneVertex]; l<m_vi_Vertices[STEP_UP(i_DistanceOneVertex)]; l++) {
+								if(m_vi_Edges[l] != i_AdjacentVertex && m_vi_VertexColors[m_vi_Edges[l]] == i_AdjacentColor) {
+									vi_CandidateColors[i_DistanceOneColor] = i_Stamp;
+									break;
+								}
+							}
+						}
+					}
+				}
+
+				int i_PotentialColor = 0;
+				while(vi_CandidateColors[i_PotentialColor] == i_Stamp) i_PotentialColor++;
+				m_vi_VertexColors[i_PresentVertex] = i_PotentialColor;
+			}
+
+			// detect the conflicts and uncolor one end point of every conflict
+			for(int i=0; i<i_MaxNumThreads; i++) ConflictedEdges_Private[i].clear();
+			fill(vi_ConflictCount.begin(), vi_ConflictCount.end(), 0);
+			DetectStarConflicts(b_Restricted, ConflictedEdges_Private, vi_ConflictCount, vi_ColorStamp_Private, vi_FirstVertex_Private);
+
+			int i_ConflictCount = 0;
+			for(int i=0; i<i_MaxNumThreads; i++) i_ConflictCount += ConflictedEdges_Private[i].size();
+			if(i_ConflictCount == 0) break;
+			PickVerticesToBeRecolored(i_MaxNumThreads, ConflictedEdges_Private, vi_ConflictCount);
+
+			vi_VerticesToBeColored.clear();
+			for(int i=0; i<i_VertexCount; i++) {
+				if(m_vi_VertexColors[m_vi_OrderedVertices[i]] == _UNKNOWN) vi_VerticesToBeColored.push_back(m_vi_OrderedVertices[i]);
+			}
+		}
+
+		int i_MaxColor = _UNKNOWN;
+		for(int i=0; i<i_VertexCount; i++) {
+			if(m_vi_VertexColors[i] > i_MaxColor) i_MaxColor = m_vi_VertexColors[i];
+		}
+		m_i_VertexColorCount = i_MaxColor;
+
+		delete[] ConflictedEdges_Private;
+		delete[] vi_CandidateColors_Private;
+		delete[] vi_FirstVertex_Private;
+		delete[] vi_ColorStamp_Private;
+		delete[] vi_SeenColors_Private;
+		delete[] vi_RepeatedColors_Private;
+
+		return(_TRUE);
+	}
+
+	//Public Function 1489
+	int GraphColoring::NaiveStarColoring_OMP()
+	{
+		return(SpeculativeStarColoring(false));
+	}
+
+	//Public Function 1490
+	int GraphColoring::RestrictedStarColoring_OMP()
+	{
+		return(SpeculativeStarColoring(true));
+	}
+
+	int GraphColoring::PrintVertexColorCombination(map <int, int >* VertexColorCombination) {
+		cout<<"PrintVertexColorCombination"<<endl;
+		map< int, int>::iterator mii_iter;
+		mii_iter = (*VertexColorCombination).begin();
+		for(;mii_iter != (*VertexColorCombination).end(); mii_iter++) {
+			cout<<"\t c "<<mii_iter->first<<": ";
+
+			if( mii_iter->second > -1) {
+				cout<<" NO hub, connect to v "<<mii_iter->second<<" c "<<m_vi_VertexColors[mii_iter->second];
+			}
+			else if ( mii_iter->second == -1) {
+				cout<<" HUB";
+			}
+			else { // (*itr)[iii].second < -1
+				cout<<" LEAF of hub v "<<-(mii_iter->second+2) <<" c "<<m_vi_VertexColors[-(mii_iter->second+2)];
+			}
+			cout<<endl;
+
+		}
+		return (_TRUE);
+	}
+
+	int GraphColoring::PrintPotentialHub(map< int, int> *PotentialHub_Private, int i_thread_num, pair<int, int> pii_ColorCombination) {
+		cout<<"PrintPotentialHub - Star collection of combination "<< pii_ColorCombination.first << " "<< pii_ColorCombination.second <<endl;
+		map< int, int>::iterator mii_iter;
+		mii_iter = PotentialHub_Private[i_thread_num].begin();
+		for(;mii_iter != PotentialHub_Private[i_thread_num].end(); mii_iter++) {
+			cout<<"\t v "<<mii_iter->first<<" c "<<m_vi_VertexColors[mii_iter->first]<<":";
+
+			if( mii_iter->second > -1) {
+				cout<<" NO hub, connect to v "<<mii_iter->second<<" c "<<m_vi_VertexColors[mii_iter->second];
+			}
+			else if ( mii_iter->second == -1) {
+				cout<<" HUB";
+			}
+			else { // (*itr)[iii].second < -1
+				cout<<" LEAF of hub v "<<-(mii_iter->second+2) <<" c "<<m_vi_VertexColors[-(mii_iter->second+2)];
+			}
+			cout<<endl;
+
+		}
+		return (_TRUE);
+	}
+
+
+	// !!! later on, remove the codes that check for conflicts (because we assume no conflict) => make this function run faster)
+	int GraphColoring::BuildStarFromColorCombination_forChecking(int i_Mode, int i_MaxNumThreads, int i_thread_num, pair<int, int> pii_ColorCombination, map< pair<int, int>, Colors2Edge_Value , lt_pii>* Colors2Edge_Private,
+							  map< int, int> * PotentialHub_Private) {
+		map< pair<int, int>, Colors2Edge_Value, lt_pii >::iterator mpii_iter;
+		map< int, int>::iterator mii_iter;
+		int i_PotentialHub=0;
 		int i_ConflictVertex=-1;
 		bool b_isConflict=false;
 		// reset PotentialHub_Private;
@@ -1939,12 +2580,6 @@ namespace ColPack
 	}
 
 	int GraphColoring::StarColoring_serial2() {
-		//if(CheckVertexColoring("STAR"))
-		//{
-		//	return(_TRUE);
-		//}
-
-		int i_MaxNumThreads = 1;
 		int i_MaxColor;
 		if(m_i_VertexColorCount>0) i_MaxColor = m_i_VertexColorCount;
 		else i_MaxColor = 3;
@@ -1952,338 +2587,471 @@ namespace ColPack
 		m_vi_VertexColors.clear();
 		m_vi_VertexColors.resize((unsigned) i_VertexCount, _UNKNOWN);
 
-		/*
-		for(int i=0; i<=i_MaxColor;i++) {
-			if(!omp_test_lock( vl_ColorLock[i] )) {
-				cout<<"Fail to lock color "<<i<<endl;
-			}
-		}
-		//*/
-
-		vector<int> vi_VerticesToBeColored;
-		vector<int>* vip_VerticesToBeRecolored_Private = new vector<int>[i_MaxNumThreads];
-		map<int, bool>* mip_ForbiddenColors = new map<int,bool>[i_MaxNumThreads];
-		map<int, int>* D1Colors = new map<int, int>[i_MaxNumThreads];
-
-		vector<  map <int, int > > *Vertex2ColorCombination = new vector<  map <int, int > >;
-		(*Vertex2ColorCombination).resize(i_VertexCount);
-
-		//Populate (vi_VerticesToBeColored)
-		for(int i=0 ; i< i_VertexCount; i++) {
-			int i_thread_num;
-			i_thread_num = 0;
-			vip_VerticesToBeRecolored_Private[i_thread_num].push_back(m_vi_OrderedVertices[i]);
-		}
-
-		int* i_StartingIndex = new int[i_MaxNumThreads];
-		i_StartingIndex[0] = 0;
-		for(int i=1; i < i_MaxNumThreads; i++) {
-			i_StartingIndex[i] =  i_StartingIndex[i-1]+vip_VerticesToBeRecolored_Private[i-1].size();
-		}
-		vi_VerticesToBeColored.resize(i_StartingIndex[i_MaxNumThreads-1]+vip_VerticesToBeRecolored_Private[i_MaxNumThreads-1].size(),_UNKNOWN);
-		for(int i=0 ; i< i_MaxNumThreads; i++) {
-			for(size_t j=0; j<vip_VerticesToBeRecolored_Private[i].size();j++) {
-				vi_VerticesToBeColored[i_StartingIndex[i]+j] = vip_VerticesToBeRecolored_Private[i][j];
-			}
-		}
-
-#if COLPACK_DEBUG_LEVEL == 0
-		int i_LoopCount = 0;
-#endif
-		while(vi_VerticesToBeColored.size()>0) {
-#if COLPACK_DEBUG_LEVEL == 0
-			i_LoopCount++;
-			//cout<<"(loop "<<i_LoopCount<<") vi_VerticesToBeColored.size()="<<vi_VerticesToBeColored.size()<<"/"<<i_VertexCount<<endl;
-			//cout<<"(loop "<<i_LoopCount<<") i_MaxColor="<<i_MaxColor<<endl;
-			//Pause();
-#endif
-			// reinitialize vip_VerticesToBeRecolored_Private
-			for(int i=0; i < i_MaxNumThreads; i++) {
-				vip_VerticesToBeRecolored_Private[i].clear();
-			}
-
-			int i_RecolorCount = vi_VerticesToBeColored.size();
-			for(int i=0; i<i_RecolorCount;i++) {
-
-				int i_thread_num = 0;
-				int i_CurrentVertex = vi_VerticesToBeColored[i];
-// 				cout<<"v"<<i_CurrentVertex<<endl<<flush;
-// 				if(i_CurrentVertex==20 || i_CurrentVertex==21) {
-// 					PrintVertex2ColorCombination(Vertex2ColorCombination);
-// 					Pause();
-// 				}
-#if COLPACK_DEBUG_LEVEL > 10
-				cout<<flush<<endl<<"Thread "<<i_thread_num<<": "<<"works on v"<<i_CurrentVertex<<endl<<flush;
-#endif
-				mip_ForbiddenColors[i_thread_num].clear();
-				D1Colors[i_thread_num].clear();
-
-#if COLPACK_DEBUG_LEVEL > 10
-				cout<<flush<<endl<<"degree of i_CurrentVertex "<<m_vi_Vertices[i_CurrentVertex+1]-m_vi_Vertices[i_CurrentVertex]<<endl;
-#endif
-				// DONE Step *: count how many D1 colors are there and mark all of them as forbidden
-				for(int ii=m_vi_Vertices[i_CurrentVertex]; ii<m_vi_Vertices[i_CurrentVertex+1];ii++) {
-					if(m_vi_VertexColors[m_vi_Edges[ii]] != _UNKNOWN) {
-					  int i_Color = m_vi_VertexColors[m_vi_Edges[ii]];
-					  if(D1Colors[i_thread_num].find(i_Color)==D1Colors[i_thread_num].end()) {
-						    D1Colors[i_thread_num][i_Color]=1;
-						    //mark forbidden color
-						    mip_ForbiddenColors[i_thread_num][i_Color] = true;
-#if COLPACK_DEBUG_LEVEL > 10
-						    cout<<flush<<endl<<"Thread "<<i_thread_num<<": "<< "D1 color="<<i_Color<<"; SET count="<< D1Colors[i_thread_num][ i_Color]<<endl;
-#endif
-					  }
-					  else {
-						    D1Colors[i_thread_num][ i_Color]++;
-#if COLPACK_DEBUG_LEVEL > 10
-						    cout<<flush<<endl<<"Thread "<<i_thread_num<<": "<< "D1 color="<<i_Color<<"; INCREASE count="<< D1Colors[i_thread_num][ i_Color]<<endl;
-#endif
-					  }
-					}
-				}
-#if COLPACK_DEBUG_LEVEL > 10
-				cout<<"after D1Colors is polulated"<<endl;
-				PrintD1Colors(D1Colors, i_thread_num);
-#endif
+		// Forbidden colors and D1 colors of the current vertex: an entry is valid if its stamp is the current stamp
+		int i_MarkerSize = (i_VertexCount > i_MaxColor ? i_VertexCount : i_MaxColor) + 2;
+		vector<int> & vi_ForbiddenColors = m_ws_Workspace.vi_CandidateColors;
+		vector<int> & vi_D1ColorStamp = m_ws_Workspace.vi_D1ColorStamp;
+		vector<int> & vi_D1ColorCount = m_ws_Workspace.vi_D1ColorCount;
+		ColoringWorkspace::Reserve(vi_ForbiddenColors, i_MarkerSize);
+		ColoringWorkspace::Reserve(vi_D1ColorStamp, i_MarkerSize);
+		ColoringWorkspace::Reserve(vi_D1ColorCount, i_MarkerSize);
+
+		/* Vertex2ColorCombination(v, c), for each color c of a neighbor of v:
+		 * - -1: v is the hub of the star of colors (color of v, c)
+		 * - < -1: v is a leaf of that star, its hub is -(value+2)
+		 * - >= 0: the star is the single edge between v and the vertex (value)
+		 */
+		Vertex2ColorCombination_Flat & Vertex2ColorCombination = m_ws_Workspace.Vertex2ColorCombination;
+		Vertex2ColorCombination.Initialize(m_vi_Vertices);
 
-/*
-				map<int, int>::iterator mib_itr2 = D1Colors[i_thread_num].begin();
-				for(;mib_itr2 != D1Colors[i_thread_num].end(); mib_itr2++) {
-					cout<<flush<<endl<<"Thread "<<i_thread_num<<": "<< "D1 color="<<mib_itr2->first<<"; count="<< mib_itr2->second<<endl;
-				}
-//*/
-#if COLPACK_DEBUG_LEVEL > 10
-				PrintD1Colors(D1Colors, i_thread_num);
-				cout<<"*Start marking forbidden color"<<endl;
-#endif
-
-				/* DONE Step *: mark forbidden color using these 2 rules:
-				 * - if vertex with color appear more than once, forbid all colors that its D1 neighbors have
-				 *    (its D1 neighbors have) => make a function for this so I can improve latter
-				 * - if vertex with color appear once and is a LEAF, forbid all of its HUBs color.
-				 */
-				// !!! could to be improved ???
-				for(int ii=m_vi_Vertices[i_CurrentVertex]; ii<m_vi_Vertices[i_CurrentVertex+1];ii++) {
-					int D1Neighbor = m_vi_Edges[ii];
-// 					if(i_CurrentVertex==31) {
-// 						cout<<"D1Neighbor="<<D1Neighbor<<" color="<< m_vi_VertexColors[D1Neighbor] <<endl;
-// 						if(D1Neighbor==20) {
-// 							for(int iii=m_vi_Vertices[D1Neighbor]; iii<m_vi_Vertices[D1Neighbor+1];iii++) {
-// 								cout<<"\t D2Neighbor="<< m_vi_Edges[iii] <<" color="<< m_vi_VertexColors[m_vi_Edges[iii]]  <<endl;
-// 							}
-//
-// 						}
-// 					}
-					if(m_vi_VertexColors[D1Neighbor] != _UNKNOWN) {
-						map <int, int >::iterator mii_iter = (*Vertex2ColorCombination)[D1Neighbor].begin();
-						if( D1Colors[i_thread_num][m_vi_VertexColors[D1Neighbor]] > 1 ) {
-							//forbid all colors that its D1 neighbors have
-							for(; mii_iter != (*Vertex2ColorCombination)[D1Neighbor].end(); mii_iter++) {
-								//mark mii_iter->first as forbidden
-								mip_ForbiddenColors[i_thread_num][mii_iter->first] = true;
-// 								if(i_CurrentVertex==31) {
-// 									cout<<"\t Forbid color "<<mii_iter->first<<" around v "<<D1Neighbor<<endl;
-// 								}
-							}
-						}
-						else {
-							// For any color combinations that this vertex is a LEAF, forbid the color of the hub (in this color combination)
-							for(; mii_iter != (*Vertex2ColorCombination)[D1Neighbor].end(); mii_iter++) {
-// 								if(i_CurrentVertex==31 && D1Neighbor==20) {
-// 									cout<<"\t mii_iter->first="<<mii_iter->first<<" mii_iter->second="<< mii_iter->second <<endl;
-// 								}
-								if(mii_iter->second < -1) { // D1Neighbor is a leaf in the combination (m_vi_VertexColors[D1Neighbor], mii_iter->first)
-									//mark mii_iter->first as forbidden
-									mip_ForbiddenColors[i_thread_num][mii_iter->first] = true;
-// 									if(i_CurrentVertex==31) {
-// 										cout<<"\t Forbid color "<<mii_iter->first<<" of v "<<-(mii_iter->second+2)<<endl;
-// 									}
-								}
-							}
-						}
-					}
-				}
-#if COLPACK_DEBUG_LEVEL > 10
-				cout<<"*After finish marking forbidden color"<<endl;
-				PrintD1Colors(D1Colors, i_thread_num);
-#endif
+		for(int i=0; i<i_VertexCount; i++) {
+			int i_CurrentVertex = m_vi_OrderedVertices[i];
+			int i_Stamp = m_ws_Workspace.NextStamp();
 
-				/* Step *: Pick a color for the current vertex:
-				 * Among the available color, test the lock of that color and see if I can lock it
-				 *      if I'm able to lock one
-				 *      if all current color are locked, allocate a new color & its lock (push into vl_ColorLock)
-				 * 		update i_MaxColor
-				 */
-				int i_PotentialColor = 0;
-				for(; i_PotentialColor<=i_MaxColor;i_PotentialColor++) {
-					if(mip_ForbiddenColors[i_thread_num].find(i_PotentialColor) == mip_ForbiddenColors[i_thread_num].end()) { // if this color is not forbidden
-						// see if we could get the lock for this color
-						break;
-					}
+			// count how many D1 colors are there and mark all of them as forbidden
+			for(int ii=m_vi_Vertices[i_CurrentVertex]; ii<m_vi_Vertices[i_CurrentVertex+1];ii++) {
+				int i_Color = m_vi_VertexColors[m_vi_Edges[ii]];
+				if(i_Color == _UNKNOWN) continue;
+				if(vi_D1ColorStamp[i_Color] != i_Stamp) {
+					vi_D1ColorStamp[i_Color] = i_Stamp;
+					vi_D1ColorCount[i_Color] = 1;
+					vi_ForbiddenColors[i_Color] = i_Stamp;
 				}
-				if(i_PotentialColor > i_MaxColor) { //we will need a new color
-					i_MaxColor = i_PotentialColor;
+				else {
+					vi_D1ColorCount[i_Color]++;
 				}
-				// Now we have a color, i.e. i_PotentialColor
-				m_vi_VertexColors[i_CurrentVertex] = i_PotentialColor;
-				//cout<<"c "<<i_PotentialColor<<" for v "<<i_CurrentVertex<<endl;
-				if(false){
-				//#pragma omp critical
-					{
-						pair<int,int> *pii_ConflictColorCombination = new pair<int,int>;
-						int i_ConflictVertex = CheckStarColoring_OMP(1, pii_ConflictColorCombination);
-						//PrintVertexAndColorAdded(i_MaxNumThreads ,vi_VertexAndColorAdded);
-						//Pause();
-
-						// !! find the 2 vertices and find the distance between them
-						if (i_ConflictVertex!=-1) {
-							//PrintVertexAndColorAdded(i_MaxNumThreads ,vi_VertexAndColorAdded);
-							cout<<"t"<<i_thread_num<<": After assign color "<<i_PotentialColor<<" to v "<<i_CurrentVertex<<endl;
-							PrintForbiddenColors(mip_ForbiddenColors, i_thread_num);
-
-							//map< int, map<int,bool> > *graph = new map< int, map<int,bool> >;
-							//BuildConnectedSubGraph(graph , i_CurrentVertex, 1);
-							//vector<int> vi_VertexColors;
-							//GetVertexColors(vi_VertexColors);
-							//displayGraph(graph, &vi_VertexColors, true, FDP);
-							//delete graph;
-
-							//graph = new map< int, map<int,bool> >;
-							//BuildSubGraph(graph , i_CurrentVertex, 0);
-							//displayGraph(graph, &vi_VertexColors, true, FDP);
-							//delete graph;
-
-							cout<<"i_ConflictVertex="<<i_ConflictVertex;
-							if(i_ConflictVertex>=0)cout<<" with color "<< m_vi_VertexColors[i_ConflictVertex];
-							cout<<endl;
-							//cout<<"i="<<i<<"/vi_VerticesToBeColored.size()="<<vi_VerticesToBeColored.size() <<"/i_VertexCount="<<i_VertexCount <<endl;
-							//displayVector(i_PotentialColor_Private,i_MaxNumThreads);
-							//displayVector(i_CurrentVertex_Private,i_MaxNumThreads);
-							cout<<"CheckStarColoring_OMP() FAILED"<<endl;
-							cout<<"conflict colors "<<(*pii_ConflictColorCombination).first<<" "<<(*pii_ConflictColorCombination).second<<endl;
-							/*
-							map<int, bool> VerticiesWithConflictColors;
-							for(int i=0; i<i_MaxNumThreads; i++) {
-								if(i_PotentialColor_Private[i]==(*pii_ConflictColorCombination).first || i_PotentialColor_Private[i]==(*pii_ConflictColorCombination).second) {
-									VerticiesWithConflictColors[ i_CurrentVertex_Private[i] ]=true;
-									PrintForbiddenColors(mip_ForbiddenColors,i);
-								}
-							}
-							cout<<"VerticiesWithConflictColors.size()="<< VerticiesWithConflictColors.size() <<endl;
-							for(map<int, bool>::iterator itr=VerticiesWithConflictColors.begin(); itr != VerticiesWithConflictColors.end(); itr++) {
-								map<int, bool>::iterator itr2 = itr;itr2++;
-								for(;  itr2 != VerticiesWithConflictColors.end(); itr2++) {
-									FindDistance(itr->first, itr2->first);
-								}
-							}
-							//*/
+			}
 
-							cout<<"-----------------------------------"<<endl;
-							Pause();
-						}
-						delete pii_ConflictColorCombination;
+			/* mark forbidden color using these 2 rules:
+			 * - if vertex with color appear more than once, forbid all colors that its D1 neighbors have
+			 * - if vertex with color appear once and is a LEAF, forbid all of its HUBs color.
+			 */
+			for(int ii=m_vi_Vertices[i_CurrentVertex]; ii<m_vi_Vertices[i_CurrentVertex+1];ii++) {
+				int D1Neighbor = m_vi_Edges[ii];
+				if(m_vi_VertexColors[D1Neighbor] == _UNKNOWN) continue;
+				int i_Begin = Vertex2ColorCombination.vi_Begin[D1Neighbor];
+				int i_End = i_Begin + Vertex2ColorCombination.vi_Count[D1Neighbor];
+				if(vi_D1ColorCount[m_vi_VertexColors[D1Neighbor]] > 1) {
+					for(int iii=i_Begin; iii<i_End; iii++) {
+						vi_ForbiddenColors[Vertex2ColorCombination.vi_Color[iii]] = i_Stamp;
 					}
 				}
-#if COLPACK_DEBUG_LEVEL > 10
-				cout<<flush<<endl<<"Thread "<<i_thread_num<<": "<<"Pick color "<< i_PotentialColor <<" for vertex "<<i_CurrentVertex<<endl<<flush;
-#endif
-
-				/* Step *: update Vertex2ColorCombination
-				 */
-				for(int ii=m_vi_Vertices[i_CurrentVertex]; ii<m_vi_Vertices[i_CurrentVertex+1];ii++) {
-					int D1Neighbor = m_vi_Edges[ii];
-					if(m_vi_VertexColors[D1Neighbor] != _UNKNOWN) {
-						if(D1Colors[i_thread_num][ m_vi_VertexColors[D1Neighbor] ] >1) {
-							//i_CurrentVertex should be a hub
-							(*Vertex2ColorCombination)[i_CurrentVertex][ m_vi_VertexColors[D1Neighbor] ] = -1; // mark i_CurrentVertex a hub of ( m_vi_VertexColors[i_CurrentVertex] , m_vi_VertexColors[D1Neighbor] ) combination
-							(*Vertex2ColorCombination)[D1Neighbor][m_vi_VertexColors[i_CurrentVertex]] = -(i_CurrentVertex+2); // mark D1Neighbor a leaf of ( m_vi_VertexColors[i_CurrentVertex] , m_vi_VertexColors[D1Neighbor] ) combination
-						}
-						// D1Colors[i_thread_num][ m_vi_VertexColors[D1Neighbor] ] == 1
-						else if ((*Vertex2ColorCombination)[D1Neighbor].find(m_vi_VertexColors[i_CurrentVertex]) != (*Vertex2ColorCombination)[D1Neighbor].end() ) {
-							int v2 = (*Vertex2ColorCombination)[D1Neighbor][m_vi_VertexColors[i_CurrentVertex]];
-							if(v2 != -1) {
-								// D1Neighbor is currently connected to a vertice v2 with the same color as i_CurrentVertex (i.e. D1Neighbor and v2 formed a non-HUB)
-								//cout<<"\t v2 "<<v2<<endl;
-								(*Vertex2ColorCombination)[v2][m_vi_VertexColors[D1Neighbor]] = -(D1Neighbor+2);
-								// D1Neighbor will become a hub now
-								(*Vertex2ColorCombination)[D1Neighbor][m_vi_VertexColors[i_CurrentVertex]] = -1;
-							} // else D1Neighbor is already a HUB of this color combination
-							(*Vertex2ColorCombination)[i_CurrentVertex][m_vi_VertexColors[D1Neighbor]] = -(D1Neighbor+2);
-						}
-						else {
-							// D1Neighbor does not connect to any other vertex with the same color as i_CurrentVertex
-							//this edge is not a part of any hub (D1Neighbor canNOT be a LEAF)
-							(*Vertex2ColorCombination)[D1Neighbor][m_vi_VertexColors[i_CurrentVertex]] = i_CurrentVertex;
-							(*Vertex2ColorCombination)[i_CurrentVertex][m_vi_VertexColors[D1Neighbor]] = D1Neighbor;
+				else {
+					for(int iii=i_Begin; iii<i_End; iii++) {
+						if(Vertex2ColorCombination.vi_Value[iii] < -1) { // D1Neighbor is a leaf in this combination
+							vi_ForbiddenColors[Vertex2ColorCombination.vi_Color[iii]] = i_Stamp;
 						}
 					}
 				}
-
 			}
 
-			//Populate (vi_VerticesToBeColored)
-			vi_VerticesToBeColored.clear();
-			for(int i=1; i < i_MaxNumThreads; i++) {
-				i_StartingIndex[i] =  i_StartingIndex[i-1]+vip_VerticesToBeRecolored_Private[i-1].size();
-				//cout<<"i_StartingIndex["<< i <<"]="<<i_StartingIndex[i]<<endl;
+			// pick the smallest color that is not forbidden
+			int i_PotentialColor = 0;
+			while(i_PotentialColor<=i_MaxColor && vi_ForbiddenColors[i_PotentialColor] == i_Stamp) i_PotentialColor++;
+			if(i_PotentialColor > i_MaxColor) { //we will need a new color
+				i_MaxColor = i_PotentialColor;
 			}
-			vi_VerticesToBeColored.resize(i_StartingIndex[i_MaxNumThreads-1]+vip_VerticesToBeRecolored_Private[i_MaxNumThreads-1].size(),_UNKNOWN);
-#if COLPACK_DEBUG_LEVEL > 10
-			cout<<"vi_VerticesToBeColored.size()="<<vi_VerticesToBeColored.size()<<endl;
-#endif
-			for(int i=0 ; i< i_MaxNumThreads; i++) {
-				for(int j=0; j<(int)vip_VerticesToBeRecolored_Private[i].size();j++) {
-					vi_VerticesToBeColored[i_StartingIndex[i]+j] = vip_VerticesToBeRecolored_Private[i][j];
+			m_vi_VertexColors[i_CurrentVertex] = i_PotentialColor;
+
+			// update Vertex2ColorCombination
+			for(int ii=m_vi_Vertices[i_CurrentVertex]; ii<m_vi_Vertices[i_CurrentVertex+1];ii++) {
+				int D1Neighbor = m_vi_Edges[ii];
+				int i_NeighborColor = m_vi_VertexColors[D1Neighbor];
+				if(i_NeighborColor == _UNKNOWN) continue;
+				if(vi_D1ColorCount[i_NeighborColor] > 1) {
+					// i_CurrentVertex is the hub, D1Neighbor a leaf
+					Vertex2ColorCombination(i_CurrentVertex, i_NeighborColor) = -1;
+					Vertex2ColorCombination(D1Neighbor, i_PotentialColor) = -(i_CurrentVertex+2);
+					continue;
+				}
+				int* ip_Value = Vertex2ColorCombination.Find(D1Neighbor, i_PotentialColor);
+				if(ip_Value != NULL) {
+					int v2 = *ip_Value;
+					if(v2 != -1) {
+						// D1Neighbor and v2 formed a single edge star, D1Neighbor becomes the hub
+						Vertex2ColorCombination(v2, i_NeighborColor) = -(D1Neighbor+2);
+						*ip_Value = -1;
+					} // else D1Neighbor is already a HUB of this color combination
+					Vertex2ColorCombination(i_CurrentVertex, i_NeighborColor) = -(D1Neighbor+2);
+				}
+				else {
+					// D1Neighbor does not connect to any other vertex with the same color as i_CurrentVertex
+					Vertex2ColorCombination(D1Neighbor, i_PotentialColor) = i_CurrentVertex;
+					Vertex2ColorCombination(i_CurrentVertex, i_NeighborColor) = D1Neighbor;
 				}
 			}
 		}
 
-		//
+		m_i_VertexColorCount=i_MaxColor;
 
-		delete Vertex2ColorCombination;
-		Vertex2ColorCombination=NULL;
-		delete[] vip_VerticesToBeRecolored_Private;
-		vip_VerticesToBeRecolored_Private = NULL;
-		delete[] mip_ForbiddenColors;
-		mip_ForbiddenColors = NULL;
-		delete[] D1Colors;
-		D1Colors=NULL;
+		return(_TRUE);
+	}
 
-		delete[] i_StartingIndex;
-		i_StartingIndex=NULL;
+	/* Add the edge (i_VertexOne, i_VertexTwo) to the stars of the current 2-color combination.
+	 * vi_PotentialHub[v] (valid if vi_HubStamp[v] == i_Stamp) has the same meaning as in DetectConflictInColorCombination():
+	 * >= 0: v is in a single edge star with that vertex, -1: v is a hub, < -1: v is a leaf of the hub -(value+2)
+	 * Return false if the edge can not be added, i.e. the edge is a conflict.
+	 */
+	static bool AddEdgeToStar(int i_VertexOne, int i_VertexTwo, int i_Stamp, vector<int> & vi_HubStamp, vector<int> & vi_PotentialHub) {
+		int i_PotentialHub = 0;
+		if(vi_HubStamp[i_VertexOne] == i_Stamp) {
+			if(vi_PotentialHub[i_VertexOne] < -1) return false;
+			i_PotentialHub += 1;
+		}
+		if(vi_HubStamp[i_VertexTwo] == i_Stamp) {
+			if(vi_PotentialHub[i_VertexTwo] < -1) return false;
+			i_PotentialHub += 2;
+		}
+		if(i_PotentialHub == 3) return false;
+
+		if(i_PotentialHub == 0) { // Both end of the vertices are seen for the first time => make them potential hubs
+			vi_HubStamp[i_VertexOne] = i_Stamp;
+			vi_HubStamp[i_VertexTwo] = i_Stamp;
+			vi_PotentialHub[i_VertexOne] = i_VertexTwo;
+			vi_PotentialHub[i_VertexTwo] = i_VertexOne;
+			return true;
+		}
+		int i_Hub = (i_PotentialHub == 1) ? i_VertexOne : i_VertexTwo;
+		int i_Leaf = (i_PotentialHub == 1) ? i_VertexTwo : i_VertexOne;
+		if(vi_PotentialHub[i_Hub] >= 0) { // single edge star => i_Hub becomes the hub, the other vertex a leaf
+			vi_PotentialHub[vi_PotentialHub[i_Hub]] = -(i_Hub+2);
+			vi_PotentialHub[i_Hub] = -1;
+		}
+		vi_HubStamp[i_Leaf] = i_Stamp;
+		vi_PotentialHub[i_Leaf] = -(i_Hub+2);
+		return true;
+	}
 
-		m_i_VertexColorCount=i_MaxColor;
+	int GraphColoring::BuildForbiddenColors(int i_CurrentVertex, int i_Stamp, vector<int> & vi_ForbiddenColors, vector<int> & vi_D1ColorStamp, vector<int> & vi_D1ColorCount, vector<int> & vi_EdgeStar, bool b_TrustSingleEdges) {
+		// count how many D1 colors are there and mark all of them as forbidden
+		for(int ii=m_vi_Vertices[i_CurrentVertex]; ii<m_vi_Vertices[i_CurrentVertex+1];ii++) {
+			int i_Color = m_vi_VertexColors[m_vi_Edges[ii]];
+			if(i_Color == _UNKNOWN) continue;
+			if(vi_D1ColorStamp[i_Color] != i_Stamp) {
+				vi_D1ColorStamp[i_Color] = i_Stamp;
+				vi_D1ColorCount[i_Color] = 1;
+				vi_ForbiddenColors[i_Color] = i_Stamp;
+			}
+			else {
+				vi_D1ColorCount[i_Color]++;
+			}
+		}
 
-		return(_TRUE);
+		/* mark forbidden color using these 2 rules:
+		 * - if vertex with color appear more than once, forbid all colors that its D1 neighbors have
+		 * - if vertex with color appear once, forbid the colors of its D1 neighbors unless it is the hub of their star
+		 *   (or the star is a single edge and b_TrustSingleEdges, the vertex then becomes a hub).
+		 *   An edge with an unknown star (colored in the current round, maybe by another thread) is not trusted.
+		 * With b_TrustSingleEdges == false, coloring the vertices one after another can not create a conflict.
+		 */
+		for(int ii=m_vi_Vertices[i_CurrentVertex]; ii<m_vi_Vertices[i_CurrentVertex+1];ii++) {
+			int D1Neighbor = m_vi_Edges[ii];
+			int i_NeighborColor = m_vi_VertexColors[D1Neighbor];
+			if(i_NeighborColor == _UNKNOWN) continue;
+			bool b_Hub = (vi_D1ColorCount[i_NeighborColor] == 1);
+			for(int iii=m_vi_Vertices[D1Neighbor]; iii<m_vi_Vertices[D1Neighbor+1]; iii++) {
+				int D2Neighbor = m_vi_Edges[iii];
+				if(D2Neighbor == i_CurrentVertex) continue;
+				int i_Color = m_vi_VertexColors[D2Neighbor];
+				if(i_Color == _UNKNOWN) continue;
+				if(b_Hub && (vi_EdgeStar[iii] == D1Neighbor || (b_TrustSingleEdges && vi_EdgeStar[iii] == -2))) continue;
+				vi_ForbiddenColors[i_Color] = i_Stamp;
+			}
+		}
+		return (_TRUE);
 	}
 
-	int GraphColoring::PrintVertex2ColorCombination (vector<  map <int, int > > *Vertex2ColorCombination) {
-		cout<<"PrintVertex2ColorCombination()"<<endl;
-		for(int i=0; i<(int) (*Vertex2ColorCombination).size(); i++) {
-			cout<<"v "<<i<<" c "<<m_vi_VertexColors[i]<<endl;
-			map<int, int>::iterator mii_iter = (*Vertex2ColorCombination)[i].begin();
-			for(; mii_iter != (*Vertex2ColorCombination)[i].end(); mii_iter++) {
-				if(mii_iter->second < -1) { // LEAF
-					cout<<"\t is a LEAF of v "<<-(mii_iter->second+2)<<" c "<<mii_iter->first<<endl;
-				}
-				else if (mii_iter->second == -1) { // HUB
-					cout<<"\t is a HUB with c "<<mii_iter->first<<endl;
+	int GraphColoring::BuildColorCombination(int i_MaxNumThreads, Colors2Edge_Flat & Colors2Edge, vector< pair<int, int> >* ConflictedEdges_Private, vector<int> & vi_ConflictCount) {
+		int i_VertexCount = m_vi_Vertices.size() - 1;
+		int i_EdgeCount = m_vi_Edges.size();
+
+		// hashed 2-color combination table: key (smaller color, larger color), filled concurrently by compare and swap
+		unsigned long long ull_Capacity = 16;
+		while(ull_Capacity < 2 * (unsigned long long)i_EdgeCount) ull_Capacity <<= 1;
+		unsigned long long ull_Mask = ull_Capacity - 1;
+		vector<long long> vll_Key(ull_Capacity, -1);
+		vector<int> vi_Combination(ull_Capacity, _UNKNOWN);
+		vector<int> vi_SlotPosition(i_EdgeCount, _UNKNOWN); // slot of m_vi_Edges -> position in the hash table
+
+#ifdef _OPENMP
+		#pragma omp parallel for schedule(dynamic,64) num_threads(i_MaxNumThreads)
+#endif
+		for(int i=0; i<i_VertexCount; i++) {
+			int i_thread_num;
+#ifdef _OPENMP
+			i_thread_num = omp_get_thread_num();
+#else
+			i_thread_num = 0;
+#endif
+			int i_Color = m_vi_VertexColors[i];
+			if(i_Color == _UNKNOWN) continue;
+			for(int j=m_vi_Vertices[i]; j<m_vi_Vertices[i+1]; j++) {
+				int i_NeighborColor = m_vi_VertexColors[m_vi_Edges[j]];
+				if(i_NeighborColor == _UNKNOWN) continue;
+				if(i_NeighborColor == i_Color) {
+					if(i < m_vi_Edges[j]) {
+						ConflictedEdges_Private[i_thread_num].push_back(pair<int, int>(i, m_vi_Edges[j]));
+#ifdef _OPENMP
+						#pragma omp atomic
+#endif
+						vi_ConflictCount[i]++;
+#ifdef _OPENMP
+						#pragma omp atomic
+#endif
+						vi_ConflictCount[m_vi_Edges[j]]++;
+					}
+					continue;
 				}
-				else { // non-HUB
-					cout<<"\t just connect with v "<<mii_iter->second<<" c "<<mii_iter->first<<" (non-HUB)"<<endl;
+				long long ll_Key = (i_Color < i_NeighborColor) ? (((long long)i_Color << 32) | i_NeighborColor) : (((long long)i_NeighborColor << 32) | i_Color);
+				unsigned long long h = (((unsigned long long)ll_Key * 0x9E3779B97F4A7C15ULL) >> 17) & ull_Mask;
+				while(true) {
+					long long ll_Seen = vll_Key[h];
+					if(ll_Seen == -1) ll_Seen = __sync_val_compare_and_swap(&vll_Key[h], -1LL, ll_Key);
+					if(ll_Seen == -1 || ll_Seen == ll_Key) break;
+					h = (h + 1) & ull_Mask;
 				}
+				vi_SlotPosition[j] = h;
+			}
+		}
+
+		// number the combinations in the order of the hash table
+		int i_CombinationCount = 0;
+		for(unsigned long long h=0; h<ull_Capacity; h++) {
+			if(vll_Key[h] != -1) vi_Combination[h] = i_CombinationCount++;
+		}
+		Colors2Edge.i_CombinationCount = i_CombinationCount;
+		Colors2Edge.vi_Begin.assign(i_CombinationCount+1, 0);
+		for(int j=0; j<i_EdgeCount; j++) {
+			if(vi_SlotPosition[j] != _UNKNOWN) Colors2Edge.vi_Begin[vi_Combination[vi_SlotPosition[j]]+1]++;
+		}
+		for(int i=0; i<i_CombinationCount; i++) {
+			Colors2Edge.vi_Begin[i+1] += Colors2Edge.vi_Begin[i];
+		}
+
+		// counting sort of the records by combination, ordered by slot inside a combination
+		vector<int> vi_Next(Colors2Edge.vi_Begin.begin(), Colors2Edge.vi_Begin.end()-1);
+		Colors2Edge.vi_Slot.resize(Colors2Edge.vi_Begin[i_CombinationCount]);
+		Colors2Edge.vi_Tail.resize(Colors2Edge.vi_Begin[i_CombinationCount]);
+		for(int i=0; i<i_VertexCount; i++) {
+			for(int j=m_vi_Vertices[i]; j<m_vi_Vertices[i+1]; j++) {
+				if(vi_SlotPosition[j] == _UNKNOWN) continue;
+				int k = vi_Next[vi_Combination[vi_SlotPosition[j]]]++;
+				Colors2Edge.vi_Slot[k] = j;
+				Colors2Edge.vi_Tail[k] = i;
 			}
 		}
 		return (_TRUE);
 	}
 
-	int GraphColoring::PrintVertex2ColorCombination_raw (vector<  map <int, int > > *Vertex2ColorCombination) {
-		cout<<"PrintVertex2ColorCombination_raw()"<<endl;
-		for(int i=0; i<(int) (*Vertex2ColorCombination).size(); i++) {
-			cout<<"v "<<i<<" c "<<m_vi_VertexColors[i]<<endl;
-			map<int, int>::iterator mii_iter = (*Vertex2ColorCombination)[i].begin();
-			for(; mii_iter != (*Vertex2ColorCombination)[i].end(); mii_iter++) {
-				cout<<"\t Vertex2ColorCombination["<< i <<"][] "<<mii_iter->second<<" c "<<mii_iter->first<<endl;
+	int GraphColoring::DetectConflictInColorCombination(int i_thread_num, int i_Combination, int i_Stamp, Colors2Edge_Flat & Colors2Edge, vector<int>* vi_HubStamp_Private, vector<int>* vi_PotentialHub_Private, vector< pair<int, int> >* ConflictedEdges_Private, vector<int> & vi_ConflictCount) {
+		for(int k=Colors2Edge.vi_Begin[i_Combination]; k<Colors2Edge.vi_Begin[i_Combination+1]; k++) {
+			int i_VertexOne = Colors2Edge.vi_Tail[k];
+			int i_VertexTwo = m_vi_Edges[Colors2Edge.vi_Slot[k]];
+			if(i_VertexOne > i_VertexTwo) continue;
+			if(!AddEdgeToStar(i_VertexOne, i_VertexTwo, i_Stamp, vi_HubStamp_Private[i_thread_num], vi_PotentialHub_Private[i_thread_num])) {
+				ConflictedEdges_Private[i_thread_num].push_back(pair<int, int>(i_VertexOne, i_VertexTwo));
+#ifdef _OPENMP
+				#pragma omp atomic
+#endif
+				vi_ConflictCount[i_VertexOne]++;
+#ifdef _OPENMP
+				#pragma omp atomic
+#endif
+				vi_ConflictCount[i_VertexTwo]++;
+			}
+		}
+		return (_TRUE);
+	}
+
+	int GraphColoring::BuildStarFromColorCombination(int i_thread_num, int i_Combination, int i_Stamp, Colors2Edge_Flat & Colors2Edge, vector<int>* vi_HubStamp_Private, vector<int>* vi_PotentialHub_Private, vector<int> & vi_EdgeStar) {
+		vector<int> & vi_HubStamp = vi_HubStamp_Private[i_thread_num];
+		vector<int> & vi_PotentialHub = vi_PotentialHub_Private[i_thread_num];
+		for(int k=Colors2Edge.vi_Begin[i_Combination]; k<Colors2Edge.vi_Begin[i_Combination+1]; k++) {
+			int i_VertexOne = Colors2Edge.vi_Tail[k];
+			int i_VertexTwo = m_vi_Edges[Colors2Edge.vi_Slot[k]];
+			if(i_VertexOne > i_VertexTwo) continue;
+			if(m_vi_VertexColors[i_VertexOne] == _UNKNOWN || m_vi_VertexColors[i_VertexTwo] == _UNKNOWN) continue;
+			if(!AddEdgeToStar(i_VertexOne, i_VertexTwo, i_Stamp, vi_HubStamp, vi_PotentialHub)) {
+				CoutLock::set();
+				cerr<<endl<<" !!! conflict detected in BuildStarFromColorCombination()"<<endl;
+				cerr<<"\t Looking at "<<i_VertexOne<<"(color "<< m_vi_VertexColors[i_VertexOne]<<")-"<<i_VertexTwo<<"(color "<< m_vi_VertexColors[i_VertexTwo]<<") "<<endl;
+				CoutLock::unset();
+			}
+		}
+
+		// write the hub of the star into both slots of every edge
+		for(int k=Colors2Edge.vi_Begin[i_Combination]; k<Colors2Edge.vi_Begin[i_Combination+1]; k++) {
+			int i_VertexOne = Colors2Edge.vi_Tail[k];
+			int i_VertexTwo = m_vi_Edges[Colors2Edge.vi_Slot[k]];
+			if(m_vi_VertexColors[i_VertexOne] == _UNKNOWN || m_vi_VertexColors[i_VertexTwo] == _UNKNOWN) continue;
+			if(vi_HubStamp[i_VertexOne] != i_Stamp || vi_HubStamp[i_VertexTwo] != i_Stamp) continue;
+			if(vi_PotentialHub[i_VertexOne] == -1) vi_EdgeStar[Colors2Edge.vi_Slot[k]] = i_VertexOne;
+			else if(vi_PotentialHub[i_VertexTwo] == -1) vi_EdgeStar[Colors2Edge.vi_Slot[k]] = i_VertexTwo;
+			else vi_EdgeStar[Colors2Edge.vi_Slot[k]] = -2;
+		}
+		return (_TRUE);
+	}
+
+	//Public Function 1484
+	int GraphColoring::StarColoring_OMP() {
+#ifndef STAR_OMP_BATCHES
+#define STAR_OMP_BATCHES 16
+#endif
+		int i_MaxNumThreads;
+#ifdef _OPENMP
+		i_MaxNumThreads = omp_get_max_threads();
+#else
+		i_MaxNumThreads = 1;
+#endif
+		if(i_MaxNumThreads == 1) return StarColoring_serial2();
+
+		int i_VertexCount = m_vi_Vertices.size() - 1;
+		int i_EdgeCount = m_vi_Edges.size();
+		m_vi_VertexColors.assign((unsigned) i_VertexCount, _UNKNOWN);
+
+		vector<int> vi_EdgeStar(i_EdgeCount, _UNKNOWN);
+		vector<int> vi_ConflictCount(i_VertexCount, 0);
+		vector<int> vi_VerticesToBeColored(m_vi_OrderedVertices.begin(), m_vi_OrderedVertices.end());
+		vector< pair<int, int> >* ConflictedEdges_Private = new vector< pair<int, int> >[i_MaxNumThreads];
+
+		// thread private markers; a color can not be larger than the number of vertices
+		vector<int>* vi_ForbiddenColors_Private = new vector<int>[i_MaxNumThreads];
+		vector<int>* vi_D1ColorStamp_Private = new vector<int>[i_MaxNumThreads];
+		vector<int>* vi_D1ColorCount_Private = new vector<int>[i_MaxNumThreads];
+		vector<int>* vi_HubStamp_Private = new vector<int>[i_MaxNumThreads];
+		vector<int>* vi_PotentialHub_Private = new vector<int>[i_MaxNumThreads];
+		vector<int> vi_Stamp_Private(i_MaxNumThreads, 0);
+		for(int i=0; i<i_MaxNumThreads; i++) {
+			vi_ForbiddenColors_Private[i].assign(i_VertexCount+1, _UNKNOWN);
+			vi_D1ColorStamp_Private[i].assign(i_VertexCount+1, _UNKNOWN);
+			vi_D1ColorCount_Private[i].assign(i_VertexCount+1, 0);
+			vi_HubStamp_Private[i].assign(i_VertexCount, _UNKNOWN);
+			vi_PotentialHub_Private[i].assign(i_VertexCount, _UNKNOWN);
+		}
+
+		// The vertices are colored in batches so that the stars of most colored neighbors are known
+		int i_BatchSize = (i_VertexCount + STAR_OMP_BATCHES - 1) / STAR_OMP_BATCHES;
+		if(i_BatchSize < 64 * i_MaxNumThreads) i_BatchSize = 64 * i_MaxNumThreads;
+
+		Colors2Edge_Flat Colors2Edge;
+		int i_StampBase = 0;
+		int i_LoopCount = 0;
+		while(vi_VerticesToBeColored.size()>0) {
+			i_LoopCount++;
+			// speculative rounds are bounded, the rest is colored by one thread without trusting the single edge stars, which can not create conflicts
+			bool b_Speculative = (i_LoopCount <= STAR_OMP_BATCHES + 100);
+			int i_NumThreads = b_Speculative ? i_MaxNumThreads : 1;
+			int i_RecolorCount = vi_VerticesToBeColored.size();
+			if(i_RecolorCount > i_BatchSize) i_RecolorCount = i_BatchSize;
+
+			// tentative coloring
+#ifdef _OPENMP
+			#pragma omp parallel for schedule(dynamic,64) num_threads(i_NumThreads)
+#endif
+			for(int i=0; i<i_RecolorCount; i++) {
+				int i_thread_num;
+#ifdef _OPENMP
+				i_thread_num = omp_get_thread_num();
+#else
+				i_thread_num = 0;
+#endif
+				int i_CurrentVertex = vi_VerticesToBeColored[i];
+				int i_Stamp = vi_Stamp_Private[i_thread_num]++;
+				vector<int> & vi_ForbiddenColors = vi_ForbiddenColors_Private[i_thread_num];
+				BuildForbiddenColors(i_CurrentVertex, i_Stamp, vi_ForbiddenColors, vi_D1ColorStamp_Private[i_thread_num], vi_D1ColorCount_Private[i_thread_num], vi_EdgeStar, b_Speculative);
+				int i_PotentialColor = 0;
+				while(vi_ForbiddenColors[i_PotentialColor] == i_Stamp) i_PotentialColor++;
+				m_vi_VertexColors[i_CurrentVertex] = i_PotentialColor;
+			}
+
+			// detect the conflicts in every 2-color combination
+			for(int i=0; i<i_MaxNumThreads; i++) ConflictedEdges_Private[i].clear();
+			fill(vi_ConflictCount.begin(), vi_ConflictCount.end(), 0);
+			BuildColorCombination(i_MaxNumThreads, Colors2Edge, ConflictedEdges_Private, vi_ConflictCount);
+#ifdef _OPENMP
+			#pragma omp parallel for schedule(dynamic,1) num_threads(i_MaxNumThreads)
+#endif
+			for(int i=0; i<Colors2Edge.i_CombinationCount; i++) {
+				int i_thread_num;
+#ifdef _OPENMP
+				i_thread_num = omp_get_thread_num();
+#else
+				i_thread_num = 0;
+#endif
+				DetectConflictInColorCombination(i_thread_num, i, i_StampBase+i, Colors2Edge, vi_HubStamp_Private, vi_PotentialHub_Private, ConflictedEdges_Private, vi_ConflictCount);
+			}
+			i_StampBase += Colors2Edge.i_CombinationCount;
+
+			int i_ConflictCount = 0;
+			for(int i=0; i<i_MaxNumThreads; i++) i_ConflictCount += ConflictedEdges_Private[i].size();
+			if(i_ConflictCount > 0) PickVerticesToBeRecolored(i_MaxNumThreads, ConflictedEdges_Private, vi_ConflictCount);
+
+			vi_VerticesToBeColored.clear();
+			for(int i=0; i<i_VertexCount; i++) {
+				if(m_vi_VertexColors[m_vi_OrderedVertices[i]] == _UNKNOWN) vi_VerticesToBeColored.push_back(m_vi_OrderedVertices[i]);
+			}
+			if(vi_VerticesToBeColored.size() == 0) break;
+
+			// rebuild the stars of the vertices that keep their color
+			fill(vi_EdgeStar.begin(), vi_EdgeStar.end(), _UNKNOWN);
+#ifdef _OPENMP
+			#pragma omp parallel for schedule(dynamic,1) num_threads(i_MaxNumThreads)
+#endif
+			for(int i=0; i<Colors2Edge.i_CombinationCount; i++) {
+				int i_thread_num;
+#ifdef _OPENMP
+				i_thread_num = omp_get_thread_num();
+#else
+				i_thread_num = 0;
+#endif
+				BuildStarFromColorCombination(i_thread_num, i, i_StampBase+i, Colors2Edge, vi_HubStamp_Private, vi_PotentialHub_Private, vi_EdgeStar);
+			}
+			i_StampBase += Colors2Edge.i_CombinationCount;
+		}
+
+		int i_MaxColor = _UNKNOWN;
+		for(int i=0; i<i_VertexCount; i++) {
+			if(m_vi_VertexColors[i] > i_MaxColor) i_MaxColor = m_vi_VertexColors[i];
+		}
+		m_i_VertexColorCount = i_MaxColor;
+
+		delete[] ConflictedEdges_Private;
+		delete[] vi_ForbiddenColors_Private;
+		delete[] vi_D1ColorStamp_Private;
+		delete[] vi_D1ColorCount_Private;
+		delete[] vi_HubStamp_Private;
+		delete[] vi_PotentialHub_Private;
+
+		return(_TRUE);
+	}
+
+	int GraphColoring::PrintVertex2ColorCombination (vector<  map <int, int > > *Vertex2ColorCombination) {
+		cout<<"PrintVertex2ColorCombination()"<<endl;
+		for(int i=0; i<(int) (*Vertex2ColorCombination).size(); i++) {
+			cout<<"v "<<i<<" c "<<m_vi_VertexColors[i]<<endl;
+			map<int, int>::iterator mii_iter = (*Vertex2ColorCombination)[i].begin();
+			for(; mii_iter != (*Vertex2ColorCombination)[i].end(); mii_iter++) {
+				if(mii_iter->second < -1) { // LEAF
+					cout<<"\t is a LEAF of v "<<-(mii_iter->second+2)<<" c "<<mii_iter->first<<endl;
+				}
+				else if (mii_iter->second == -1) { // HUB
+					cout<<"\t is a HUB with c "<<mii_iter->first<<endl;
+				}
+				else { // non-HUB
+					cout<<"\t just connect with v "<<mii_iter->second<<" c "<<mii_iter->first<<" (non-HUB)"<<endl;
+				}
+			}
+		}
+		return (_TRUE);
+	}
+
+	int GraphColoring::PrintVertex2ColorCombination_raw (vector<  map <int, int > > *Vertex2ColorCombination) {
+		cout<<"PrintVertex2ColorCombination_raw()"<<endl;
+		for(int i=0; i<(int) (*Vertex2ColorCombination).size(); i++) {
+			cout<<"v "<<i<<" c "<<m_vi_VertexColors[i]<<endl;
+			map<int, int>::iterator mii_iter = (*Vertex2ColorCombination)[i].begin();
+			for(; mii_iter != (*Vertex2ColorCombination)[i].end(); mii_iter++) {
+				cout<<"\t Vertex2ColorCombination["<< i <<"][] "<<mii_iter->second<<" c "<<mii_iter->first<<endl;
 			}
 		}
 		return (_TRUE);
@@ -2499,22 +3267,26 @@ namespace ColPack
 
 		int i_VertexOne, i_VertexTwo;
 
+		int i_Stamp;
+
 		vector<int> vi_MemberEdges;
 
-		vector<int> vi_CandidateColors;
+		vector<int> & vi_CandidateColors = m_ws_Workspace.vi_CandidateColors;
 
-		vector<int> vi_EdgeStarMap; // map an edge to a star. For example vi_EdgeStarMap[edge#1] = star#5
-		vector<int> vi_StarHubMap; // map a star to its hub (the center of 2-color star. For example vi_StarHubMap[star#5] = edge#7
+		vector<int> & vi_EdgeStarMap = m_ws_Workspace.vi_EdgeStarMap; // map an edge to a star. For example vi_EdgeStarMap[edge#1] = star#5
+		vector<int> & vi_StarHubMap = m_ws_Workspace.vi_StarHubMap; // map a star to its hub (the center of 2-color star. For example vi_StarHubMap[star#5] = edge#7
 
-		vector<int> vi_FirstTreated; // ??? what these structures are for?
+		vector<int> & vi_FirstTreated = m_ws_Workspace.vi_FirstTreated; // ??? what these structures are for?
 
 		/* The two vectors vi_FirstSeenOne, vi_FirstSeenTwo are indexed by the color ID
 		 * vi_FirstSeenOne[color a] = vertex 1 : means that color a is first seen when we are processing vertex 1 (as colored vertex w)
 		 * vi_FirstSeenTwo[color a] = vertex 2 : means that vertex 2 (connected to vertex 1) has color a and this is first seen when we were processing vertex 1
 		 * */
-		vector<int> vi_FirstSeenOne, vi_FirstSeenTwo; // ??? what these structures are for?
+		vector<int> & vi_FirstSeenOne = m_ws_Workspace.vi_FirstSeenOne; // ??? what these structures are for?
+		vector<int> & vi_FirstSeenTwo = m_ws_Workspace.vi_FirstSeenTwo;
+		vector<int> & vi_FirstSeenEdge = m_ws_Workspace.vi_FirstSeenEdge; // vi_FirstSeenEdge[color a] = the slot of the edge between vertex 1 and vertex 2
 
-		map< int, map<int, int> > mimi2_VertexEdgeMap; // map 2 vertices to its edge ID. Note that for mimi2_VertexEdgeMap[vertex#1][vertex#2]= edge#1, the id of vertex#1 must always less than vertex#2
+		vector<int> & vi_EdgeID = m_ws_Workspace.vi_EdgeID; // vi_EdgeID[j] = the ID of the edge of the slot j of m_vi_Edges, the same from both of its ends
 
 		m_i_VertexColorCount = _UNKNOWN;
 
@@ -2522,47 +3294,33 @@ namespace ColPack
 
 		i_EdgeCount = (signed) m_vi_Edges.size();
 
-		vi_EdgeStarMap.clear();
-		vi_EdgeStarMap.resize((unsigned) i_EdgeCount/2, _UNKNOWN);
+		vi_EdgeStarMap.assign((unsigned) i_EdgeCount/2, _UNKNOWN);
 
-		vi_StarHubMap.clear();
-		vi_StarHubMap.resize((unsigned) i_EdgeCount/2, _UNKNOWN);
+		vi_StarHubMap.assign((unsigned) i_EdgeCount/2, _UNKNOWN);
 
 		m_vi_VertexColors.clear();
 		m_vi_VertexColors.resize((unsigned) i_VertexCount, _UNKNOWN);
 
-		vi_CandidateColors.clear();
-		vi_CandidateColors.resize((unsigned) i_VertexCount, _UNKNOWN);
+		ColoringWorkspace::Reserve(vi_CandidateColors, i_VertexCount);
 
-		vi_FirstSeenOne.clear();
-		vi_FirstSeenOne.resize((unsigned) i_VertexCount, _UNKNOWN);
+		ColoringWorkspace::Reserve(vi_FirstSeenOne, i_VertexCount);
 
-		vi_FirstSeenTwo.clear();
-		vi_FirstSeenTwo.resize((unsigned) i_VertexCount, _UNKNOWN);
+		ColoringWorkspace::Reserve(vi_FirstSeenTwo, i_VertexCount);
+
+		ColoringWorkspace::Reserve(vi_FirstSeenEdge, i_VertexCount);
 
 	//    vi_FirstTreated.clear();
 	//    vi_FirstTreated.resize((unsigned) i_EdgeCount, _UNKNOWN);
 
-		vi_FirstTreated.clear();
-		vi_FirstTreated.resize((unsigned) i_VertexCount, _UNKNOWN);
-
-		k = _FALSE;
+		ColoringWorkspace::Reserve(vi_FirstTreated, i_VertexCount);
 
 		// label each edge
-		//populate mimi2_VertexEdgeMap[][] and vi_EdgeStarMap[]
-		for(i=0; i<i_VertexCount; i++)
-		{
-			for(j=m_vi_Vertices[i]; j<m_vi_Vertices[STEP_UP(i)]; j++)
-			{
-				if(i < m_vi_Edges[j])
-				{
-					mimi2_VertexEdgeMap[i][m_vi_Edges[j]] = k;
-
-					vi_EdgeStarMap[k] = k; // initilized vi_EdgeStarMap, just let each edge belongs to its own star
+		//populate vi_EdgeID[] and vi_EdgeStarMap[]
+		BuildEdgeIDs();
 
-					k++;
-				}
-			}
+		for(k=0; k<i_EdgeCount/2; k++)
+		{
+			vi_EdgeStarMap[k] = k; // initilized vi_EdgeStarMap, just let each edge belongs to its own star
 		}
 
 #if VERBOSE == _TRUE
@@ -2576,6 +3334,8 @@ namespace ColPack
 		{
 			i_PresentVertex = m_vi_OrderedVertices[i];
 
+			i_Stamp = m_ws_Workspace.NextStamp();
+
 #if VERBOSE == _TRUE
 
 			cout<<"DEBUG 1458 | Star Coloring | Coloring Vertex "<<STEP_UP(i_PresentVertex)<<"/"<<i_VertexCount<<endl;
@@ -2592,17 +3352,17 @@ namespace ColPack
 				}
 
 				// Line 5: forbid vertex i_PresentVertex to use color i_ColorID
-				vi_CandidateColors[i_ColorID] = i_PresentVertex;
+				vi_CandidateColors[i_ColorID] = i_Stamp;
 
 				// Line 6?
 				i_VertexOne = vi_FirstSeenOne[i_ColorID];
 				i_VertexTwo = vi_FirstSeenTwo[i_ColorID];
 
 				// Line 7-10, Algorithm 4.1
-				if(i_VertexOne == i_PresentVertex)
+				if(i_VertexOne == i_Stamp)
 				{
 					// Line 8-9, Algorithm 4.1
-					if(vi_FirstTreated[i_VertexTwo] != i_PresentVertex)
+					if(vi_FirstTreated[i_VertexTwo] != i_Stamp)
 					{
 
 						//forbid colors of neighbors of q
@@ -2618,11 +3378,11 @@ namespace ColPack
 								continue;
 							}
 
-							vi_CandidateColors[m_vi_VertexColors[m_vi_Edges[k]]] = i_PresentVertex;
+							vi_CandidateColors[m_vi_VertexColors[m_vi_Edges[k]]] = i_Stamp;
 
 						}
 
-						vi_FirstTreated[i_VertexTwo] = i_PresentVertex;
+						vi_FirstTreated[i_VertexTwo] = i_Stamp;
 					}
 
 					// Line 10, Algorithm 4.1: forbid colors of neighbors of w
@@ -2638,17 +3398,18 @@ namespace ColPack
 							continue;
 						}
 
-						vi_CandidateColors[m_vi_VertexColors[m_vi_Edges[k]]] = i_PresentVertex;
+						vi_CandidateColors[m_vi_VertexColors[m_vi_Edges[k]]] = i_Stamp;
 
 					}
 
-					vi_FirstTreated[m_vi_Edges[j]] = i_PresentVertex;
+					vi_FirstTreated[m_vi_Edges[j]] = i_Stamp;
 				}
 				// Line 11-15, Algorithm 4.1
 				else
 				{
-	      			vi_FirstSeenOne[i_ColorID] = i_PresentVertex;
+	      			vi_FirstSeenOne[i_ColorID] = i_Stamp;
 					vi_FirstSeenTwo[i_ColorID] = m_vi_Edges[j];
+					vi_FirstSeenEdge[i_ColorID] = j;
 
 					for(k=m_vi_Vertices[m_vi_Edges[j]]; k<m_vi_Vertices[STEP_UP(m_vi_Edges[j])]; k++)
 					{
@@ -2662,19 +3423,9 @@ namespace ColPack
 							continue;
 						}
 
-						if(m_vi_Edges[j] < m_vi_Edges[k])
-						{
-							if(vi_StarHubMap[vi_EdgeStarMap[mimi2_VertexEdgeMap[m_vi_Edges[j]][m_vi_Edges[k]]]] == m_vi_Edges[k])
-							{
-								vi_CandidateColors[m_vi_VertexColors[m_vi_Edges[k]]] = i_PresentVertex;
-							}
-						}
-						else
+						if(vi_StarHubMap[vi_EdgeStarMap[vi_EdgeID[k]]] == m_vi_Edges[k])
 						{
-							if(vi_StarHubMap[vi_EdgeStarMap[mimi2_VertexEdgeMap[m_vi_Edges[k]][m_vi_Edges[j]]]] == m_vi_Edges[k])
-							{
-								vi_CandidateColors[m_vi_VertexColors[m_vi_Edges[k]]] = i_PresentVertex;
-							}
+							vi_CandidateColors[m_vi_VertexColors[m_vi_Edges[k]]] = i_Stamp;
 						}
 					}
 				}
@@ -2684,7 +3435,7 @@ namespace ColPack
 			// the smallest permissible color is chosen and assigned to the vertex v (i_PresentVertex)
 			for(j=0; j<i_VertexCount; j++)
 			{
-				if(vi_CandidateColors[j] != i_PresentVertex)
+				if(vi_CandidateColors[j] != i_Stamp)
 				{
 					m_vi_VertexColors[i_PresentVertex] = j;
 					//cout<<"c "<<j<<" for v "<<i_PresentVertex<<endl;
@@ -2732,39 +3483,14 @@ namespace ColPack
 					{
 						_FOUND = _TRUE;
 
-						if(m_vi_Edges[j] < m_vi_Edges[k])
-						{
-							//find the ID of the star that includes m_vi_Edges[j] and m_vi_Edges[k]
-							i_StarID = vi_EdgeStarMap[mimi2_VertexEdgeMap[m_vi_Edges[j]][m_vi_Edges[k]]];
-
-							// m_vi_Edges[j] (D1 neighbor of v) will be the hub of the star that include i_PresentVertex, m_vi_Edges[j], m_vi_Edges[k]
-							vi_StarHubMap[i_StarID] = m_vi_Edges[j];
-
-							// add edge (i_PresentVertex, m_vi_Edges[j]) in to the star i_StarID
-							if(i_PresentVertex < m_vi_Edges[j])
-							{
-								vi_EdgeStarMap[mimi2_VertexEdgeMap[i_PresentVertex][m_vi_Edges[j]]] = i_StarID;
-							}
-							else
-							{
-								vi_EdgeStarMap[mimi2_VertexEdgeMap[m_vi_Edges[j]][i_PresentVertex]] = i_StarID;
-							}
-						}
-						else
-						{
-							i_StarID = vi_EdgeStarMap[mimi2_VertexEdgeMap[m_vi_Edges[k]][m_vi_Edges[j]]];
+						//find the ID of the star that includes m_vi_Edges[j] and m_vi_Edges[k]
+						i_StarID = vi_EdgeStarMap[vi_EdgeID[k]];
 
-							vi_StarHubMap[i_StarID] = m_vi_Edges[j];
+						// m_vi_Edges[j] (D1 neighbor of v) will be the hub of the star that include i_PresentVertex, m_vi_Edges[j], m_vi_Edges[k]
+						vi_StarHubMap[i_StarID] = m_vi_Edges[j];
 
-							if(i_PresentVertex < m_vi_Edges[j])
-							{
-								vi_EdgeStarMap[mimi2_VertexEdgeMap[i_PresentVertex][m_vi_Edges[j]]] = i_StarID;
-							}
-							else
-							{
-								vi_EdgeStarMap[mimi2_VertexEdgeMap[m_vi_Edges[j]][i_PresentVertex]] = i_StarID;
-							}
-						}
+						// add edge (i_PresentVertex, m_vi_Edges[j]) in to the star i_StarID
+						vi_EdgeStarMap[vi_EdgeID[j]] = i_StarID;
 
 						break;
 					}
@@ -2778,38 +3504,14 @@ namespace ColPack
 					i_VertexOne = vi_FirstSeenOne[m_vi_VertexColors[m_vi_Edges[j]]];
 					i_VertexTwo = vi_FirstSeenTwo[m_vi_VertexColors[m_vi_Edges[j]]];
 
-					if((i_VertexOne == i_PresentVertex) && (i_VertexTwo != m_vi_Edges[j]))
+					if((i_VertexOne == i_Stamp) && (i_VertexTwo != m_vi_Edges[j]))
 					{
-						if(i_PresentVertex < i_VertexTwo)
-						{
-							i_StarID = vi_EdgeStarMap[mimi2_VertexEdgeMap[i_PresentVertex][i_VertexTwo]];
-
-							vi_StarHubMap[i_StarID] = i_PresentVertex;
-
-							if(i_PresentVertex < m_vi_Edges[j])
-							{
-								vi_EdgeStarMap[mimi2_VertexEdgeMap[i_PresentVertex][m_vi_Edges[j]]] = i_StarID;
-							}
-							else
-							{
-								vi_EdgeStarMap[mimi2_VertexEdgeMap[m_vi_Edges[j]][i_PresentVertex]] = i_StarID;
-							}
-						}
-						else
-						{
-							i_StarID = vi_EdgeStarMap[mimi2_VertexEdgeMap[i_VertexTwo][i_PresentVertex]];
+						// the edge (i_PresentVertex, i_VertexTwo) is in the slot vi_FirstSeenEdge[] of i_PresentVertex
+						i_StarID = vi_EdgeStarMap[vi_EdgeID[vi_FirstSeenEdge[m_vi_VertexColors[m_vi_Edges[j]]]]];
 
-							vi_StarHubMap[i_StarID] = i_PresentVertex;
+						vi_StarHubMap[i_StarID] = i_PresentVertex;
 
-							if(i_PresentVertex < m_vi_Edges[j])
-							{
-								vi_EdgeStarMap[mimi2_VertexEdgeMap[i_PresentVertex][m_vi_Edges[j]]] = i_StarID;
-							}
-							else
-							{
-								vi_EdgeStarMap[mimi2_VertexEdgeMap[m_vi_Edges[j]][i_PresentVertex]] = i_StarID;
-							}
-						}
+						vi_EdgeStarMap[vi_EdgeID[j]] = i_StarID;
 					}
 				}
 			}
@@ -3428,26 +4130,137 @@ namespace ColPack
 
 
 
-	//Public Function 1461
-	int GraphColoring::AcyclicColoring()
+	// Merge the thread private conflict lists into vpii_ConflictedEdges, sorted and without duplicates
+	static int MergeConflictedEdges(int i_MaxNumThreads, vector< pair<int, int> >* ConflictedEdges_Private, vector< pair<int, int> > & vpii_ConflictedEdges) {
+		vpii_ConflictedEdges.clear();
+		for(int i=0; i<i_MaxNumThreads; i++) {
+			vpii_ConflictedEdges.insert(vpii_ConflictedEdges.end(), ConflictedEdges_Private[i].begin(), ConflictedEdges_Private[i].end());
+		}
+		sort(vpii_ConflictedEdges.begin(), vpii_ConflictedEdges.end());
+		vpii_ConflictedEdges.erase(unique(vpii_ConflictedEdges.begin(), vpii_ConflictedEdges.end()), vpii_ConflictedEdges.end());
+		return ((signed) vpii_ConflictedEdges.size());
+	}
+
+	//Public Function 1486
+	int GraphColoring::CheckStarColoring(vector< pair<int, int> > & vpii_ConflictedEdges)
 	{
-		//if(CheckVertexColoring("ACYCLIC"))
-		//{
-	//		return(_TRUE);
-	//	}
+		int i_MaxNumThreads;
+#ifdef _OPENMP
+		i_MaxNumThreads = omp_get_max_threads();
+#else
+		i_MaxNumThreads = 1;
+#endif
+		int i_VertexCount = STEP_DOWN((signed) m_vi_Vertices.size());
 
-		int i, j, k;
+		int i_MaxColor = _UNKNOWN;
+		for(int i=0; i<i_VertexCount; i++) {
+			if(m_vi_VertexColors[i] > i_MaxColor) i_MaxColor = m_vi_VertexColors[i];
+		}
 
-		int i_VertexCount, i_EdgeCount;
+		// vi_RepeatedColors[vi_RepeatedBegin[v] .. vi_RepeatedBegin[v+1]-1]: sorted colors seen on 2 or more neighbors of v
+		vector<int> vi_RepeatedBegin(i_VertexCount+1, 0);
+		vector<int> vi_RepeatedColors;
+		vector< pair<int, int> >* ConflictedEdges_Private = new vector< pair<int, int> >[i_MaxNumThreads];
+		vector<int>* vi_ColorStamp_Private = new vector<int>[i_MaxNumThreads];
+		vector<int>* vi_ColorCount_Private = new vector<int>[i_MaxNumThreads];
+		for(int i=0; i<i_MaxNumThreads; i++) {
+			vi_ColorStamp_Private[i].assign(i_MaxColor+1, _UNKNOWN);
+			vi_ColorCount_Private[i].assign(i_MaxColor+1, 0);
+		}
 
-		int i_AdjacentEdgeID, i_EdgeID, i_SetID;
+		for(int i_Pass=0; i_Pass<2; i_Pass++) {
+			if(i_Pass == 1) {
+				for(int i=0; i<i_VertexCount; i++) vi_RepeatedBegin[i+1] += vi_RepeatedBegin[i];
+				vi_RepeatedColors.resize(vi_RepeatedBegin[i_VertexCount]);
+			}
+#ifdef _OPENMP
+			#pragma omp parallel for schedule(dynamic,64)
+#endif
+			for(int i=0; i<i_VertexCount; i++) {
+				int i_thread_num;
+#ifdef _OPENMP
+				i_thread_num = omp_get_thread_num();
+#else
+				i_thread_num = 0;
+#endif
+				vector<int> & vi_ColorStamp = vi_ColorStamp_Private[i_thread_num];
+				vector<int> & vi_ColorCount = vi_ColorCount_Private[i_thread_num];
+				int i_RepeatedCount = 0;
+				for(int j=m_vi_Vertices[i]; j<m_vi_Vertices[STEP_UP(i)]; j++) {
+					int i_Color = m_vi_VertexColors[m_vi_Edges[j]];
+					if(i_Color == _UNKNOWN) continue;
+					if(vi_ColorStamp[i_Color] != i) {
+						vi_ColorStamp[i_Color] = i;
+						vi_ColorCount[i_Color] = 0;
+					}
+					if(++vi_ColorCount[i_Color] != 2) continue;
+					if(i_Pass == 0) i_RepeatedCount++;
+					else vi_RepeatedColors[vi_RepeatedBegin[i] + i_RepeatedCount++] = i_Color;
+				}
+				if(i_Pass == 0) vi_RepeatedBegin[i+1] = i_RepeatedCount;
+				else sort(vi_RepeatedColors.begin() + vi_RepeatedBegin[i], vi_RepeatedColors.begin() + vi_RepeatedBegin[i+1]);
+			}
+		}
 
-		int i_PresentVertex;
+		// edge v-w (colors a, b) is the middle edge of a 2-colored path x-v-w-y iff b is repeated around v and a around w
+#ifdef _OPENMP
+		#pragma omp parallel for schedule(dynamic,64)
+#endif
+		for(int i=0; i<i_VertexCount; i++) {
+			int i_thread_num;
+#ifdef _OPENMP
+			i_thread_num = omp_get_thread_num();
+#else
+			i_thread_num = 0;
+#endif
+			int i_Color = m_vi_VertexColors[i];
+			if(i_Color == _UNKNOWN) continue;
+			for(int j=m_vi_Vertices[i]; j<m_vi_Vertices[STEP_UP(i)]; j++) {
+				int i_AdjacentVertex = m_vi_Edges[j];
+				int i_AdjacentColor = m_vi_VertexColors[i_AdjacentVertex];
+				if(i_AdjacentVertex < i || i_AdjacentColor == _UNKNOWN) continue;
+				if(i_AdjacentColor == i_Color
+					|| (binary_search(vi_RepeatedColors.begin() + vi_RepeatedBegin[i], vi_RepeatedColors.begin() + vi_RepeatedBegin[i+1], i_AdjacentColor)
+					&& binary_search(vi_RepeatedColors.begin() + vi_RepeatedBegin[i_AdjacentVertex], vi_RepeatedColors.begin() + vi_RepeatedBegin[i_AdjacentVertex+1], i_Color))) {
+					ConflictedEdges_Private[i_thread_num].push_back(pair<int, int>(i, i_AdjacentVertex));
+				}
+			}
+		}
 
-		vector<int> vi_CandidateColors;
+		int i_ViolationCount = MergeConflictedEdges(i_MaxNumThreads, ConflictedEdges_Private, vpii_ConflictedEdges);
 
-		vector<int> vi_FirstSeenOne, vi_FirstSeenTwo, vi_FirstSeenThree;
-		vector<int> vi_FirstVisitedOne, vi_FirstVisitedTwo;
+		delete[] ConflictedEdges_Private;
+		delete[] vi_ColorStamp_Private;
+		delete[] vi_ColorCount_Private;
+
+		return(i_ViolationCount);
+	}
+
+
+	//Public Function 1461
+	int GraphColoring::AcyclicColoring()
+	{
+		//if(CheckVertexColoring("ACYCLIC"))
+		//{
+	//		return(_TRUE);
+	//	}
+
+		int i, j, k;
+
+		int i_VertexCount, i_EdgeCount;
+
+		int i_AdjacentEdgeID, i_EdgeID, i_SetID;
+
+		int i_PresentVertex;
+
+		int i_Stamp;
+
+		vector<int> & vi_CandidateColors = m_ws_Workspace.vi_CandidateColors;
+
+		vector<int> & vi_FirstSeenOne = m_ws_Workspace.vi_FirstSeenOne;
+		vector<int> & vi_FirstSeenEdge = m_ws_Workspace.vi_FirstSeenEdge;
+		vector<int> & vi_FirstVisitedOne = m_ws_Workspace.vi_FirstVisitedOne;
+		vector<int> & vi_FirstVisitedTwo = m_ws_Workspace.vi_FirstVisitedTwo;
 
 #if DISJOINT_SETS == _FALSE
 
@@ -3473,9 +4286,16 @@ namespace ColPack
 
 		i_VertexCount = STEP_DOWN((signed) m_vi_Vertices.size());
 
-		k = _FALSE;
+		//vi_EdgeID[j] is the ID of the edge of the slot j of m_vi_Edges, numbered as m_mimi2_VertexEdgeMap would be
+		BuildEdgeIDs();
 
-		m_mimi2_VertexEdgeMap.clear();
+		vector<int> & vi_EdgeID = m_ws_Workspace.vi_EdgeID;
+
+#if DEBUG == 1461
+
+		cout<<endl;
+		cout<<"DEBUG 1461 | Acyclic Coloring | Edge IDs"<<endl;
+		cout<<endl;
 
 		for(i=0; i<i_VertexCount; i++)
 		{
@@ -3483,36 +4303,11 @@ namespace ColPack
 			{
 				if(i < m_vi_Edges[j])
 				{
-					m_mimi2_VertexEdgeMap[i][m_vi_Edges[j]] = k;
-
-					k++;
+					cout<<"Edge "<<STEP_UP(vi_EdgeID[j])<<"\t"<<" : "<<STEP_UP(i)<<" - "<<STEP_UP(m_vi_Edges[j])<<endl;
 				}
 			}
 		}
 
-#if DEBUG == 1461
-
-		i_EdgeCount = (signed) v2i_EdgeVertexMap.size();
-
-		cout<<endl;
-		cout<<"DEBUG 1461 | Acyclic Coloring | Edge Vertex Map"<<endl;
-		cout<<endl;
-
-		for(i=0; i<i_EdgeCount; i++)
-		{
-			cout<<"Edge "<<STEP_UP(i)<<"\t"<<" : "<<STEP_UP(v2i_EdgeVertexMap[i][0])<<" - "<<STEP_UP(v2i_EdgeVertexMap[i][1])<<endl;
-		}
-
-		cout<<endl;
-		cout<<"DEBUG 1461 | Acyclic Coloring | Vertex Edge Map"<<endl;
-		cout<<endl;
-
-		for(i=0; i<i_EdgeCount; i++)
-		{
-			cout<<"Vertex "<<STEP_UP(v2i_EdgeVertexMap[i][0])<<" - Vertex "<<STEP_UP(v2i_EdgeVertexMap[i][1])<<"\t"<<" : "<<STEP_UP(m_mimi2_VertexEdgeMap[v2i_EdgeVertexMap[i][0]][v2i_EdgeVertexMap[i][1]])<<endl;
-
-		}
-
 		cout<<endl;
 
 #endif
@@ -3522,23 +4317,14 @@ namespace ColPack
 		m_vi_VertexColors.clear();
 		m_vi_VertexColors.resize((unsigned) i_VertexCount, _UNKNOWN);
 
-		vi_CandidateColors.clear();
-		vi_CandidateColors.resize((unsigned) i_VertexCount, _UNKNOWN);
-
-		vi_FirstSeenOne.clear();
-		vi_FirstSeenOne.resize((unsigned) i_VertexCount, _UNKNOWN);
-
-		vi_FirstSeenTwo.clear();
-		vi_FirstSeenTwo.resize((unsigned) i_VertexCount, _UNKNOWN);
-
-		vi_FirstSeenThree.clear();
-		vi_FirstSeenThree.resize((unsigned) i_VertexCount, _UNKNOWN);
+		// the marks of vi_CandidateColors, vi_FirstSeenOne and vi_FirstVisitedOne are stamps, see ColoringWorkspace
+		ColoringWorkspace::Reserve(vi_CandidateColors, i_VertexCount);
 
-		vi_FirstVisitedOne.clear();
-		vi_FirstVisitedOne.resize((unsigned) i_EdgeCount/2, _UNKNOWN);
+		ColoringWorkspace::Reserve(vi_FirstSeenOne, i_VertexCount);
+		ColoringWorkspace::Reserve(vi_FirstSeenEdge, i_VertexCount);
 
-		vi_FirstVisitedTwo.clear();
-		vi_FirstVisitedTwo.resize((unsigned) i_EdgeCount/2, _UNKNOWN);
+		ColoringWorkspace::Reserve(vi_FirstVisitedOne, i_EdgeCount/2);
+		ColoringWorkspace::Reserve(vi_FirstVisitedTwo, i_EdgeCount/2);
 
 #if DISJOINT_SETS == _FALSE
 
@@ -3572,6 +4358,8 @@ namespace ColPack
 		{
 			i_PresentVertex = m_vi_OrderedVertices[i];
 
+			i_Stamp = m_ws_Workspace.NextStamp();
+
 #if VERBOSE == _TRUE
 
 			cout<<"DEBUG 1461 | Acyclic Coloring | Coloring Vertex "<<STEP_UP(i_PresentVertex)<<"/"<<i_VertexCount<<endl;
@@ -3585,7 +4373,7 @@ namespace ColPack
 					continue;
 				}
 
-				vi_CandidateColors[m_vi_VertexColors[m_vi_Edges[j]]] = i_PresentVertex;
+				vi_CandidateColors[m_vi_VertexColors[m_vi_Edges[j]]] = i_Stamp;
 			}
 
 			for(j=m_vi_Vertices[i_PresentVertex]; j<m_vi_Vertices[STEP_UP(i_PresentVertex)]; j++)
@@ -3607,42 +4395,28 @@ namespace ColPack
 						continue;
 					}
 
-					if(vi_CandidateColors[m_vi_VertexColors[m_vi_Edges[k]]] == i_PresentVertex)
+					if(vi_CandidateColors[m_vi_VertexColors[m_vi_Edges[k]]] == i_Stamp)
 					{
 						continue;
 					}
 
 #if DISJOINT_SETS == _TRUE
 
-					if(m_vi_Edges[j] < m_vi_Edges[k])
-					{
-						i_SetID = m_ds_DisjointSets.FindAndCompress(m_mimi2_VertexEdgeMap[m_vi_Edges[j]][m_vi_Edges[k]]);
-					}
-					else
-					{
-						i_SetID = m_ds_DisjointSets.FindAndCompress(m_mimi2_VertexEdgeMap[m_vi_Edges[k]][m_vi_Edges[j]]);
-					}
+					i_SetID = m_ds_DisjointSets.FindAndCompress(vi_EdgeID[k]);
 #endif
 
 #if DISJOINT_SETS == _FALSE
 
-					if(m_vi_Edges[j] < m_vi_Edges[k])
-					{
-						i_SetID = vi_EdgeSetMap[m_mimi2_VertexEdgeMap[m_vi_Edges[j]][m_vi_Edges[k]]];
-					}
-					else
-					{
-						i_SetID = vi_EdgeSetMap[m_mimi2_VertexEdgeMap[m_vi_Edges[k]][m_vi_Edges[j]]];
-					}
+					i_SetID = vi_EdgeSetMap[vi_EdgeID[k]];
 #endif
 
-					FindCycle(i_PresentVertex, m_vi_Edges[j], m_vi_Edges[k], i_SetID, vi_CandidateColors, vi_FirstVisitedOne, vi_FirstVisitedTwo);
+					FindCycle(i_Stamp, m_vi_Edges[j], m_vi_Edges[k], i_SetID, vi_CandidateColors, vi_FirstVisitedOne, vi_FirstVisitedTwo);
 				}
 			}
 
 			for(j=0; j<i_VertexCount; j++)
 			{
-				if(vi_CandidateColors[j] != i_PresentVertex)
+				if(vi_CandidateColors[j] != i_Stamp)
 				{
 					m_vi_VertexColors[i_PresentVertex] = j;
 
@@ -3662,14 +4436,7 @@ namespace ColPack
 					continue;
 				}
 
-				if(i_PresentVertex < m_vi_Edges[j])
-				{
-					i_EdgeID = m_mimi2_VertexEdgeMap[i_PresentVertex][m_vi_Edges[j]];
-				}
-				else
-				{
-					i_EdgeID = m_mimi2_VertexEdgeMap[m_vi_Edges[j]][i_PresentVertex];
-				}
+				i_EdgeID = vi_EdgeID[j];
 
 #if DISJOINT_SETS == _FALSE
 
@@ -3680,7 +4447,7 @@ namespace ColPack
 				v2i_SetEdgeMap[vi_EdgeSetMap[i_EdgeID]].push_back(i_EdgeID);
 #endif
 
-				i_AdjacentEdgeID = UpdateSet(i_PresentVertex, m_vi_Edges[j], i_PresentVertex, m_mimi2_VertexEdgeMap, vi_FirstSeenOne, vi_FirstSeenTwo, vi_FirstSeenThree);
+				i_AdjacentEdgeID = UpdateSet(i_Stamp, m_vi_Edges[j], i_EdgeID, vi_FirstSeenOne, vi_FirstSeenEdge);
 
 				if(i_AdjacentEdgeID != _UNKNOWN)
 				{
@@ -3762,16 +4529,9 @@ namespace ColPack
 
 					if(m_vi_VertexColors[m_vi_Edges[k]] == m_vi_VertexColors[i_PresentVertex])
 					{
-						if(m_vi_Edges[j] <  m_vi_Edges[k])
-						{
-							i_AdjacentEdgeID = m_mimi2_VertexEdgeMap[m_vi_Edges[j]][m_vi_Edges[k]];
-						}
-						else
-						{
-							i_AdjacentEdgeID = m_mimi2_VertexEdgeMap[m_vi_Edges[k]][m_vi_Edges[j]];
-						}
+						i_AdjacentEdgeID = vi_EdgeID[k];
 
-						i_EdgeID = UpdateSet(i_PresentVertex, m_vi_Edges[j], m_vi_Edges[k], m_mimi2_VertexEdgeMap, vi_FirstSeenOne, vi_FirstSeenTwo, vi_FirstSeenThree);
+						i_EdgeID = UpdateSet(i_Stamp, m_vi_Edges[j], i_AdjacentEdgeID, vi_FirstSeenOne, vi_FirstSeenEdge);
 
 						if(i_EdgeID != _UNKNOWN)
 						{
@@ -3851,7 +4611,7 @@ namespace ColPack
 
 #if DISJOINT_SETS == _FALSE
 
-		i_EdgeCount = (signed) v2i_EdgeVertexMap.size();
+		i_EdgeCount = (signed) m_vi_Edges.size()/2;
 
 		cout<<endl;
 		cout<<"DEBUG 1461 | Acyclic Coloring | Edge Set Map"<<endl;
@@ -4451,6 +5211,264 @@ namespace ColPack
 		return(_TRUE);
 	}
 
+	// Find the root of i_Vertex in the thread private forest of the current 2-color combination (path halving).
+	// A vertex whose stamp is not i_Stamp has not been seen in this combination yet and is a tree by itself.
+	static int FindTreeRoot(int i_Vertex, int i_Stamp, vector<int> & vi_TreeStamp, vector<int> & vi_TreeParent) {
+		if(vi_TreeStamp[i_Vertex] != i_Stamp) {
+			vi_TreeStamp[i_Vertex] = i_Stamp;
+			vi_TreeParent[i_Vertex] = i_Vertex;
+			return i_Vertex;
+		}
+		while(vi_TreeParent[i_Vertex] != i_Vertex) {
+			vi_TreeParent[i_Vertex] = vi_TreeParent[vi_TreeParent[i_Vertex]];
+			i_Vertex = vi_TreeParent[i_Vertex];
+		}
+		return i_Vertex;
+	}
+
+	int GraphColoring::DetectCycleInColorCombination(int i_thread_num, int i_Combination, int i_Stamp, Colors2Edge_Flat & Colors2Edge, vector<int>* vi_TreeStamp_Private, vector<int>* vi_TreeParent_Private, vector< pair<int, int> >* ConflictedEdges_Private, vector<int> & vi_ConflictCount) {
+		vector<int> & vi_TreeStamp = vi_TreeStamp_Private[i_thread_num];
+		vector<int> & vi_TreeParent = vi_TreeParent_Private[i_thread_num];
+		for(int k=Colors2Edge.vi_Begin[i_Combination]; k<Colors2Edge.vi_Begin[i_Combination+1]; k++) {
+			int i_VertexOne = Colors2Edge.vi_Tail[k];
+			int i_VertexTwo = m_vi_Edges[Colors2Edge.vi_Slot[k]];
+			if(i_VertexOne > i_VertexTwo) continue;
+			int i_RootOne = FindTreeRoot(i_VertexOne, i_Stamp, vi_TreeStamp, vi_TreeParent);
+			int i_RootTwo = FindTreeRoot(i_VertexTwo, i_Stamp, vi_TreeStamp, vi_TreeParent);
+			if(i_RootOne != i_RootTwo) {
+				vi_TreeParent[i_RootTwo] = i_RootOne;
+				continue;
+			}
+			// the 2 end points are already connected by a 2-colored path: this edge closes a cycle
+			ConflictedEdges_Private[i_thread_num].push_back(pair<int, int>(i_VertexOne, i_VertexTwo));
+#ifdef _OPENMP
+			#pragma omp atomic
+#endif
+			vi_ConflictCount[i_VertexOne]++;
+#ifdef _OPENMP
+			#pragma omp atomic
+#endif
+			vi_ConflictCount[i_VertexTwo]++;
+		}
+		return (_TRUE);
+	}
+
+	int GraphColoring::UnionAcyclicSets(int i_Vertex, int i_Stamp, vector<int> & vi_FirstSeenStamp, vector<int> & vi_FirstSeenEdge, vector<int> & vi_EdgeID, DisjointSets & ds_Sets) {
+		for(int j=m_vi_Vertices[i_Vertex]; j<m_vi_Vertices[i_Vertex+1]; j++) {
+			int i_Color = m_vi_VertexColors[m_vi_Edges[j]];
+			if(i_Color == _UNKNOWN) continue;
+			if(vi_FirstSeenStamp[i_Color] != i_Stamp) {
+				vi_FirstSeenStamp[i_Color] = i_Stamp;
+				vi_FirstSeenEdge[i_Color] = vi_EdgeID[j];
+			}
+			else {
+				ds_Sets.UnionConcurrent(vi_EdgeID[j], vi_FirstSeenEdge[i_Color]);
+			}
+		}
+		return (_TRUE);
+	}
+
+	//Public Function 1485
+	int GraphColoring::AcyclicColoring_OMP() {
+		int i_MaxNumThreads;
+#ifdef _OPENMP
+		i_MaxNumThreads = omp_get_max_threads();
+#else
+		i_MaxNumThreads = 1;
+#endif
+
+		if(m_s_VertexColoringVariant.compare("ALL") != 0)
+		{
+			m_s_VertexColoringVariant = "ACYCLIC";
+		}
+
+		int i_VertexCount = m_vi_Vertices.size() - 1;
+		int i_EdgeCount = m_vi_Edges.size();
+
+		//populate m_mimi2_VertexEdgeMap, the edges are numbered as in AcyclicColoring_ForIndirectRecovery()
+		//vi_EdgeID gives the number of the edge of every slot of m_vi_Edges
+		vector<int> vi_EdgeID(i_EdgeCount, _UNKNOWN);
+		m_mimi2_VertexEdgeMap.clear();
+		int i_EdgeNumber = 0;
+		for(int i=0; i<i_VertexCount; i++) {
+			for(int j=m_vi_Vertices[i]; j<m_vi_Vertices[i+1]; j++) {
+				if(i < m_vi_Edges[j]) {
+					m_mimi2_VertexEdgeMap[i][m_vi_Edges[j]] = i_EdgeNumber;
+					vi_EdgeID[j] = i_EdgeNumber++;
+				}
+			}
+		}
+#ifdef _OPENMP
+		#pragma omp parallel for schedule(dynamic,64) num_threads(i_MaxNumThreads)
+#endif
+		for(int i=0; i<i_VertexCount; i++) {
+			for(int j=m_vi_Vertices[i]; j<m_vi_Vertices[i+1]; j++) {
+				if(i > m_vi_Edges[j]) vi_EdgeID[j] = m_mimi2_VertexEdgeMap.find(m_vi_Edges[j])->second.find(i)->second;
+			}
+		}
+
+		m_vi_VertexColors.assign((unsigned) i_VertexCount, _UNKNOWN);
+
+		// 2-colored trees, updated concurrently while coloring
+		DisjointSets ds_Sets(i_EdgeCount/2);
+
+		vector<int> vi_ConflictCount(i_VertexCount, 0);
+		vector<int> vi_VerticesToBeColored(m_vi_OrderedVertices.begin(), m_vi_OrderedVertices.end());
+		vector< pair<int, int> >* ConflictedEdges_Private = new vector< pair<int, int> >[i_MaxNumThreads];
+
+		// thread private markers; a color can not be larger than the number of vertices
+		vector<int>* vi_CandidateColors_Private = new vector<int>[i_MaxNumThreads];
+		vector<int>* vi_FirstSeenStamp_Private = new vector<int>[i_MaxNumThreads];
+		vector<int>* vi_FirstSeenEdge_Private = new vector<int>[i_MaxNumThreads];
+		vector<int>* vi_FirstVisitedOne_Private = new vector<int>[i_MaxNumThreads];
+		vector<int>* vi_FirstVisitedTwo_Private = new vector<int>[i_MaxNumThreads];
+		vector<int>* vi_TreeStamp_Private = new vector<int>[i_MaxNumThreads];
+		vector<int>* vi_TreeParent_Private = new vector<int>[i_MaxNumThreads];
+		vector<int> vi_Stamp_Private(i_MaxNumThreads, 0);
+		for(int i=0; i<i_MaxNumThreads; i++) {
+			vi_CandidateColors_Private[i].assign(i_VertexCount+1, _UNKNOWN);
+			vi_FirstSeenStamp_Private[i].assign(i_VertexCount+1, _UNKNOWN);
+			vi_FirstSeenEdge_Private[i].assign(i_VertexCount+1, _UNKNOWN);
+			vi_FirstVisitedOne_Private[i].assign(i_EdgeCount/2, _UNKNOWN);
+			vi_FirstVisitedTwo_Private[i].assign(i_EdgeCount/2, _UNKNOWN);
+			vi_TreeStamp_Private[i].assign(i_VertexCount, _UNKNOWN);
+			vi_TreeParent_Private[i].assign(i_VertexCount, _UNKNOWN);
+		}
+
+		Colors2Edge_Flat Colors2Edge;
+		int i_StampBase = 0;
+		int i_LoopCount = 0;
+		while(vi_VerticesToBeColored.size()>0) {
+			i_LoopCount++;
+			// speculative rounds are bounded, the rest is colored by one thread as in AcyclicColoring(), which can not create conflicts
+			int i_NumThreads = (i_LoopCount <= ACYCLIC_OMP_ROUNDS) ? i_MaxNumThreads : 1;
+			int i_RecolorCount = vi_VerticesToBeColored.size();
+
+			// tentative coloring
+#ifdef _OPENMP
+			#pragma omp parallel for schedule(dynamic,64) num_threads(i_NumThreads)
+#endif
+			for(int i=0; i<i_RecolorCount; i++) {
+				int i_thread_num;
+#ifdef _OPENMP
+				i_thread_num = omp_get_thread_num();
+#else
+				i_thread_num = 0;
+#endif
+				int i_PresentVertex = vi_VerticesToBeColored[i];
+				int i_Stamp = vi_Stamp_Private[i_thread_num]++;
+				vector<int> & vi_CandidateColors = vi_CandidateColors_Private[i_thread_num];
+				vector<int> & vi_FirstVisitedOne = vi_FirstVisitedOne_Private[i_thread_num];
+				vector<int> & vi_FirstVisitedTwo = vi_FirstVisitedTwo_Private[i_thread_num];
+
+				for(int j=m_vi_Vertices[i_PresentVertex]; j<m_vi_Vertices[i_PresentVertex+1]; j++) {
+					int i_Color = m_vi_VertexColors[m_vi_Edges[j]];
+					if(i_Color != _UNKNOWN) vi_CandidateColors[i_Color] = i_Stamp;
+				}
+
+				// the color of x is forbidden if x is reached through 2 different neighbors in the same 2-colored tree (see FindCycle())
+				for(int j=m_vi_Vertices[i_PresentVertex]; j<m_vi_Vertices[i_PresentVertex+1]; j++) {
+					int i_AdjacentVertex = m_vi_Edges[j];
+					if(m_vi_VertexColors[i_AdjacentVertex] == _UNKNOWN) continue;
+					for(int k=m_vi_Vertices[i_AdjacentVertex]; k<m_vi_Vertices[i_AdjacentVertex+1]; k++) {
+						int i_DistanceOneVertex = m_vi_Edges[k];
+						if(i_DistanceOneVertex == i_PresentVertex) continue;
+						int i_Color = m_vi_VertexColors[i_DistanceOneVertex];
+						if(i_Color == _UNKNOWN || vi_CandidateColors[i_Color] == i_Stamp) continue;
+						int i_SetID = ds_Sets.FindConcurrent(vi_EdgeID[k]);
+						if(vi_FirstVisitedOne[i_SetID] != i_Stamp) {
+							vi_FirstVisitedOne[i_SetID] = i_Stamp;
+							vi_FirstVisitedTwo[i_SetID] = i_AdjacentVertex;
+						}
+						else if(vi_FirstVisitedTwo[i_SetID] != i_AdjacentVertex) {
+							vi_CandidateColors[i_Color] = i_Stamp;
+						}
+					}
+				}
+
+				int i_PotentialColor = 0;
+				while(vi_CandidateColors[i_PotentialColor] == i_Stamp) i_PotentialColor++;
+				m_vi_VertexColors[i_PresentVertex] = i_PotentialColor;
+
+				// merge the trees joined by the new vertex (see UpdateSet())
+				UnionAcyclicSets(i_PresentVertex, i_Stamp, vi_FirstSeenStamp_Private[i_thread_num], vi_FirstSeenEdge_Private[i_thread_num], vi_EdgeID, ds_Sets);
+				for(int j=m_vi_Vertices[i_PresentVertex]; j<m_vi_Vertices[i_PresentVertex+1]; j++) {
+					int i_AdjacentVertex = m_vi_Edges[j];
+					if(m_vi_VertexColors[i_AdjacentVertex] == _UNKNOWN) continue;
+					for(int k=m_vi_Vertices[i_AdjacentVertex]; k<m_vi_Vertices[i_AdjacentVertex+1]; k++) {
+						if(m_vi_Edges[k] != i_PresentVertex && m_vi_VertexColors[m_vi_Edges[k]] == i_PotentialColor) {
+							ds_Sets.UnionConcurrent(vi_EdgeID[j], vi_EdgeID[k]);
+						}
+					}
+				}
+			}
+
+			// detect the same color edges and the 2-colored cycles in every 2-color combination
+			for(int i=0; i<i_MaxNumThreads; i++) ConflictedEdges_Private[i].clear();
+			fill(vi_ConflictCount.begin(), vi_ConflictCount.end(), 0);
+			BuildColorCombination(i_MaxNumThreads, Colors2Edge, ConflictedEdges_Private, vi_ConflictCount);
+#ifdef _OPENMP
+			#pragma omp parallel for schedule(dynamic,1) num_threads(i_MaxNumThreads)
+#endif
+			for(int i=0; i<Colors2Edge.i_CombinationCount; i++) {
+				int i_thread_num;
+#ifdef _OPENMP
+				i_thread_num = omp_get_thread_num();
+#else
+				i_thread_num = 0;
+#endif
+				DetectCycleInColorCombination(i_thread_num, i, i_StampBase+i, Colors2Edge, vi_TreeStamp_Private, vi_TreeParent_Private, ConflictedEdges_Private, vi_ConflictCount);
+			}
+			i_StampBase += Colors2Edge.i_CombinationCount;
+
+			int i_ConflictCount = 0;
+			for(int i=0; i<i_MaxNumThreads; i++) i_ConflictCount += ConflictedEdges_Private[i].size();
+			if(i_ConflictCount > 0) PickVerticesToBeRecolored(i_MaxNumThreads, ConflictedEdges_Private, vi_ConflictCount);
+
+			vi_VerticesToBeColored.clear();
+			for(int i=0; i<i_VertexCount; i++) {
+				if(m_vi_VertexColors[m_vi_OrderedVertices[i]] == _UNKNOWN) vi_VerticesToBeColored.push_back(m_vi_OrderedVertices[i]);
+			}
+
+			// rebuild the 2-colored trees of the vertices that keep their color; unions missed by concurrent updates are recovered here
+			ds_Sets.SetSize(i_EdgeCount/2);
+#ifdef _OPENMP
+			#pragma omp parallel for schedule(dynamic,64) num_threads(i_MaxNumThreads)
+#endif
+			for(int i=0; i<i_VertexCount; i++) {
+				int i_thread_num;
+#ifdef _OPENMP
+				i_thread_num = omp_get_thread_num();
+#else
+				i_thread_num = 0;
+#endif
+				if(m_vi_VertexColors[i] == _UNKNOWN) continue;
+				UnionAcyclicSets(i, vi_Stamp_Private[i_thread_num]++, vi_FirstSeenStamp_Private[i_thread_num], vi_FirstSeenEdge_Private[i_thread_num], vi_EdgeID, ds_Sets);
+			}
+		}
+
+		// m_ds_DisjointSets is the input of the indirect Hessian recovery, Flatten() gives it the usual (union by size) form
+		ds_Sets.Flatten();
+		m_ds_DisjointSets = ds_Sets;
+
+		int i_MaxColor = _UNKNOWN;
+		for(int i=0; i<i_VertexCount; i++) {
+			if(m_vi_VertexColors[i] > i_MaxColor) i_MaxColor = m_vi_VertexColors[i];
+		}
+		m_i_VertexColorCount = i_MaxColor;
+
+		delete[] ConflictedEdges_Private;
+		delete[] vi_CandidateColors_Private;
+		delete[] vi_FirstSeenStamp_Private;
+		delete[] vi_FirstSeenEdge_Private;
+		delete[] vi_FirstVisitedOne_Private;
+		delete[] vi_FirstVisitedTwo_Private;
+		delete[] vi_TreeStamp_Private;
+		delete[] vi_TreeParent_Private;
+
+		return(_TRUE);
+	}
+
 	//Public Function 1462
 	int GraphColoring::AcyclicColoring(vector<int> & vi_Sets, map< int, vector<int> > & mivi_VertexSets)
 	{
@@ -5009,30 +6027,21 @@ namespace ColPack
 	//Public Function 1463
 	int GraphColoring::CheckAcyclicColoring()
 	{
-		int i;
+		vector< pair<int, int> > vpii_ConflictedEdges;
 
-		int i_VertexCount;
-
-		int i_ViolationCount;
-
-		vector<int> vi_TouchedVertices;
-
-		i_VertexCount = STEP_DOWN((signed) m_vi_Vertices.size());
-
-		i_ViolationCount = _FALSE;
+		int i_ViolationCount = CheckAcyclicColoring(vpii_ConflictedEdges);
 
-		for(i=0; i<i_VertexCount; i++)
+		if(i_ViolationCount)
 		{
-			vi_TouchedVertices.clear();
-			vi_TouchedVertices.resize((unsigned) i_VertexCount, _FALSE);
-
-			vi_TouchedVertices[i] = _TRUE;
+			cout<<endl;
+			cout<<"Acyclic Coloring | Violation Check | "<<m_s_InputFile<<endl;
+			cout<<endl;
 
-			i_ViolationCount = SearchDepthFirst(i, i, i, vi_TouchedVertices);
-		}
+			for(int i=0; i<i_ViolationCount; i++)
+			{
+				cout<<"Violation "<<STEP_UP(i)<<"\t : "<<STEP_UP(vpii_ConflictedEdges[i].first)<<" ["<<STEP_UP(m_vi_VertexColors[vpii_ConflictedEdges[i].first])<<"] - "<<STEP_UP(vpii_ConflictedEdges[i].second)<<" ["<<STEP_UP(m_vi_VertexColors[vpii_ConflictedEdges[i].second])<<"]"<<endl;
+			}
 
-		if(i_ViolationCount)
-		{
 			cout<<endl;
 			cout<<"[Total Violations = "<<i_ViolationCount<<"]"<<endl;
 			cout<<endl;
@@ -5041,22 +6050,67 @@ namespace ColPack
 		return(i_ViolationCount);
 	}
 
-
-	//Public Function 1464
-	int GraphColoring::TriangularColoring()
+	//Public Function 1487
+	int GraphColoring::CheckAcyclicColoring(vector< pair<int, int> > & vpii_ConflictedEdges)
 	{
-		//if(CheckVertexColoring("TRIANGULAR"))
-		//{
-		//	return(_TRUE);
-		//}
-
-		int i, j, k, l;
-
-		int _FOUND;
+		int i_MaxNumThreads;
+#ifdef _OPENMP
+		i_MaxNumThreads = omp_get_max_threads();
+#else
+		i_MaxNumThreads = 1;
+#endif
+		int i_VertexCount = STEP_DOWN((signed) m_vi_Vertices.size());
 
-		int i_VertexCount, i_VertexDegree;
+		vector<int> vi_ConflictCount(i_VertexCount, 0);
+		vector< pair<int, int> >* ConflictedEdges_Private = new vector< pair<int, int> >[i_MaxNumThreads];
+		vector<int>* vi_TreeStamp_Private = new vector<int>[i_MaxNumThreads];
+		vector<int>* vi_TreeParent_Private = new vector<int>[i_MaxNumThreads];
+		for(int i=0; i<i_MaxNumThreads; i++) {
+			vi_TreeStamp_Private[i].assign(i_VertexCount, _UNKNOWN);
+			vi_TreeParent_Private[i].assign(i_VertexCount, _UNKNOWN);
+		}
 
-		int i_HighestVertexDegree;
+		// same color edges, then the edges closing a cycle in one of the 2-colored subgraphs
+		Colors2Edge_Flat Colors2Edge;
+		BuildColorCombination(i_MaxNumThreads, Colors2Edge, ConflictedEdges_Private, vi_ConflictCount);
+#ifdef _OPENMP
+		#pragma omp parallel for schedule(dynamic,1)
+#endif
+		for(int i=0; i<Colors2Edge.i_CombinationCount; i++) {
+			int i_thread_num;
+#ifdef _OPENMP
+			i_thread_num = omp_get_thread_num();
+#else
+			i_thread_num = 0;
+#endif
+			DetectCycleInColorCombination(i_thread_num, i, i, Colors2Edge, vi_TreeStamp_Private, vi_TreeParent_Private, ConflictedEdges_Private, vi_ConflictCount);
+		}
+
+		int i_ViolationCount = MergeConflictedEdges(i_MaxNumThreads, ConflictedEdges_Private, vpii_ConflictedEdges);
+
+		delete[] ConflictedEdges_Private;
+		delete[] vi_TreeStamp_Private;
+		delete[] vi_TreeParent_Private;
+
+		return(i_ViolationCount);
+	}
+
+
+	//Public Function 1464
+	int GraphColoring::TriangularColoring()
+	{
+		//if(CheckVertexColoring("TRIANGULAR"))
+		//{
+		//	return(_TRUE);
+		//}
+
+		int i, j, k, l;
+
+		int _FOUND;
+
+		int i_VertexCount, i_VertexDegree;
+
+		int i_HighestVertexDegree;
 
 		int i_PresentVertex;
 
@@ -5066,247 +6120,744 @@ namespace ColPack
 
 		i_VertexCount = (signed) m_vi_OrderedVertices.size();
 
-		vi_VertexHierarchy.clear();
-		vi_VertexHierarchy.resize((unsigned) i_VertexCount);
+		vi_VertexHierarchy.clear();
+		vi_VertexHierarchy.resize((unsigned) i_VertexCount);
+
+		v2i_VertexAdjacency.clear();
+		v2i_VertexAdjacency.resize((unsigned) i_VertexCount);
+
+		for(i=0; i<i_VertexCount; i++)
+		{
+			vi_VertexHierarchy[m_vi_OrderedVertices[i]] = i;
+		}
+
+		//m_vi_VertexColors.clear();
+		//m_vi_VertexColors.resize((unsigned) i_VertexCount, _UNKNOWN);
+
+		m_i_VertexColorCount = _UNKNOWN;
+
+		for(i=0; i<i_VertexCount; i++)
+		{
+			i_PresentVertex = m_vi_OrderedVertices[i];
+
+#if VERBOSE == _TRUE
+
+			cout<<"DEBUG 1464 | Triangular Coloring | Processing Vertex "<<STEP_UP(i_PresentVertex)<<"/"<<i_VertexCount<<endl;
+
+#endif
+
+			for(j=m_vi_Vertices[i_PresentVertex]; j<m_vi_Vertices[STEP_UP(i_PresentVertex)]; j++)
+			{
+				v2i_VertexAdjacency[i_PresentVertex].push_back(m_vi_Edges[j]);
+
+				for(k=m_vi_Vertices[m_vi_Edges[j]]; k<m_vi_Vertices[STEP_UP(m_vi_Edges[j])]; k++)
+				{
+					if(m_vi_Edges[k] == i_PresentVertex)
+					{
+						continue;
+					}
+
+					if((vi_VertexHierarchy[m_vi_Edges[j]] > vi_VertexHierarchy[i_PresentVertex]) && (vi_VertexHierarchy[m_vi_Edges[j]] > vi_VertexHierarchy[m_vi_Edges[k]]))
+					{
+						_FOUND = _FALSE;
+
+						for(l=m_vi_Vertices[m_vi_Edges[k]]; l<m_vi_Vertices[STEP_UP(m_vi_Edges[k])]; l++)
+						{
+							if(m_vi_Edges[l] == i_PresentVertex)
+							{
+								_FOUND = TRUE;
+
+								break;
+							}
+						}
+
+						if(_FOUND == _FALSE)
+						{
+							v2i_VertexAdjacency[i_PresentVertex].push_back(m_vi_Edges[k]);
+						}
+					}
+				}
+			}
+		}
+
+		m_vi_Vertices.clear();
+		m_vi_Edges.clear();
+
+		i_HighestVertexDegree = _UNKNOWN;
+
+		for(i=0; i<i_VertexCount; i++)
+		{
+			m_vi_Vertices.push_back((signed) m_vi_Edges.size());
+
+			i_VertexDegree = (signed) v2i_VertexAdjacency[i].size();
+
+			if(i_HighestVertexDegree < i_VertexDegree)
+			{
+				i_HighestVertexDegree = i_VertexDegree;
+			}
+
+			for(j=0; j<i_VertexDegree; j++)
+			{
+				m_vi_Edges.push_back(v2i_VertexAdjacency[i][j]);
+			}
+
+			v2i_VertexAdjacency[i].clear();
+		}
+
+		m_vi_Vertices.push_back((signed) m_vi_Edges.size());
+
+#if DEBUG == 1464
+
+		int i_EdgeCount;
+
+		cout<<endl;
+		cout<<"DEBUG 1464 | Graph Coloring | Induced Matrix"<<endl;
+		cout<<endl;
+
+		i_VertexCount = (signed) m_vi_Vertices.size();
+		i_EdgeCount = (signed) m_vi_Edges.size();
+
+		for(i=0; i<i_VertexCount; i++)
+		{
+			for(j=m_vi_Vertices[i]; j<m_vi_Vertices[STEP_UP(i)]; j++)
+			{
+				cout<<"Element["<<STEP_UP(i)<<"]["<<STEP_UP(m_vi_Edges[j])<<"] = 1"<<endl;
+			}
+		}
+
+		cout<<endl;
+		cout<<"[Induced Vertices = "<<STEP_DOWN(i_VertexCount)<<"; Induced Edges = "<<i_EdgeCount<<"]"<<endl;
+		cout<<endl;
+
+#endif
+
+		SmallestLastOrdering();
+
+		int i_ColoringStatus = DistanceOneColoring();
+
+		//CheckTriangularColoring() checks the distance one coloring of the induced graph
+		m_s_VertexColoringVariant = "TRIANGULAR";
+
+		return(i_ColoringStatus);
+	}
+
+
+
+	// forbidden colors of TriangularColor(): one bit per color, a word is valid only if its stamp is the current one
+	static inline void ForbidColor(int i_Color, int i_Stamp, vector<unsigned long long> & vull_Forbidden, vector<int> & vi_WordStamp) {
+		int i_Word = i_Color >> 6;
+		if(vi_WordStamp[i_Word] != i_Stamp) {
+			vi_WordStamp[i_Word] = i_Stamp;
+			vull_Forbidden[i_Word] = 0;
+		}
+		vull_Forbidden[i_Word] |= 1ULL << (i_Color & 63);
+	}
+
+	int GraphColoring::TriangularColor(int i_PresentVertex, int i_Stamp, const vector<int> & vi_VertexHierarchy, vector<unsigned long long> & vull_Forbidden, vector<int> & vi_WordStamp) {
+		int i_Hierarchy = vi_VertexHierarchy[i_PresentVertex];
+
+		for(int j=m_vi_Vertices[i_PresentVertex]; j<m_vi_Vertices[STEP_UP(i_PresentVertex)]; j++)
+		{
+			int i_AdjacentVertex = m_vi_Edges[j];
+
+			if(m_vi_VertexColors[i_AdjacentVertex] != _UNKNOWN)
+			{
+				ForbidColor(m_vi_VertexColors[i_AdjacentVertex], i_Stamp, vull_Forbidden, vi_WordStamp);
+			}
+
+			// the neighbors of i_AdjacentVertex only matter if it comes after i_PresentVertex
+			if(vi_VertexHierarchy[i_AdjacentVertex] < i_Hierarchy)
+			{
+				continue;
+			}
+
+			for(int k=m_vi_Vertices[i_AdjacentVertex]; k<m_vi_Vertices[STEP_UP(i_AdjacentVertex)]; k++)
+			{
+				int i_DistanceOneVertex = m_vi_Edges[k];
+				int i_DistanceOneColor = m_vi_VertexColors[i_DistanceOneVertex];
+
+				if(i_DistanceOneVertex == i_PresentVertex || i_DistanceOneColor == _UNKNOWN)
+				{
+					continue;
+				}
+
+				if(vi_VertexHierarchy[i_AdjacentVertex] > vi_VertexHierarchy[i_DistanceOneVertex])
+				{
+					ForbidColor(i_DistanceOneColor, i_Stamp, vull_Forbidden, vi_WordStamp);
+				}
+			}
+		}
+
+		// lowest color whose bit is clear; the words past the last written one are all clear
+		int i_Word = 0;
+		while(vi_WordStamp[i_Word] == i_Stamp && vull_Forbidden[i_Word] == ~0ULL)
+		{
+			i_Word++;
+		}
+
+		if(vi_WordStamp[i_Word] != i_Stamp)
+		{
+			return(i_Word << 6);
+		}
+
+		unsigned long long ull_Allowed = ~vull_Forbidden[i_Word];
+#if defined(__GNUC__)
+		return((i_Word << 6) + __builtin_ctzll(ull_Allowed));
+#else
+		int i_Bit = 0;
+		while(!(ull_Allowed & 1ULL))
+		{
+			ull_Allowed >>= 1;
+			i_Bit++;
+		}
+		return((i_Word << 6) + i_Bit);
+#endif
+	}
+
+	//Public Function 1465
+	int GraphColoring::ModifiedTriangularColoring()
+	{
+		//if(CheckVertexColoring("MODIFIED TRIANGULAR"))
+		//{
+		//	return(_TRUE);
+		//}
+
+		int i;
+
+		int i_VertexCount;
+
+		int i_HighestColor;
+
+		int i_PresentVertex;
+
+		vector<int> vi_VertexHierarchy;
+
+		i_VertexCount = (signed) m_vi_OrderedVertices.size();
+
+		vi_VertexHierarchy.clear();
+		vi_VertexHierarchy.resize((unsigned) i_VertexCount);
+
+		for(i=0; i<i_VertexCount; i++)
+		{
+			vi_VertexHierarchy[m_vi_OrderedVertices[i]] = i;
+		}
+
+		m_vi_VertexColors.clear();
+		m_vi_VertexColors.resize((unsigned) i_VertexCount, _UNKNOWN);
+
+		// bitmask of the forbidden colors, one word per 64 colors; a color is less than the number of vertices
+		vector<unsigned long long> vull_Forbidden(STEP_UP(i_VertexCount >> 6), 0);
+		vector<int> vi_WordStamp(STEP_UP(i_VertexCount >> 6), _UNKNOWN);
+
+		i_HighestColor = _UNKNOWN;
+
+		for(i=0; i<i_VertexCount; i++)
+		{
+			i_PresentVertex = m_vi_OrderedVertices[i];
+
+#if VERBOSE == _TRUE
+
+			cout<<"DEBUG 1465 | Triangular Coloring | Coloring Vertex "<<STEP_UP(i_PresentVertex)<<"/"<<i_VertexCount<<endl;
+
+#endif
+
+			m_vi_VertexColors[i_PresentVertex] = TriangularColor(i_PresentVertex, i_PresentVertex, vi_VertexHierarchy, vull_Forbidden, vi_WordStamp);
+
+			if(i_HighestColor < m_vi_VertexColors[i_PresentVertex])
+			{
+				i_HighestColor = m_vi_VertexColors[i_PresentVertex];
+			}
+		}
+
+		m_i_VertexColorCount = i_HighestColor;
+
+		m_s_VertexColoringVariant = "MODIFIED_TRIANGULAR";
+
+		return(_TRUE);
+}
+
+	//Public Function 1492
+	int GraphColoring::TriangularColoring_OMP()
+	{
+		int i_MaxNumThreads;
+#ifdef _OPENMP
+		i_MaxNumThreads = omp_get_max_threads();
+#else
+		i_MaxNumThreads = 1;
+#endif
+		int i_VertexCount = (signed) m_vi_OrderedVertices.size();
+
+		vector<int> vi_VertexHierarchy(i_VertexCount);
+		for(int i=0; i<i_VertexCount; i++) {
+			vi_VertexHierarchy[m_vi_OrderedVertices[i]] = i;
+		}
+
+		m_vi_VertexColors.assign((unsigned) i_VertexCount, _UNKNOWN);
+
+		vector<int> vi_ConflictCount(i_VertexCount, 0);
+		vector<int> vi_VerticesToBeColored(m_vi_OrderedVertices.begin(), m_vi_OrderedVertices.end());
+		vector< pair<int, int> > vpii_ConflictedEdges;
+		vector< pair<int, int> >* ConflictedEdges_Private = new vector< pair<int, int> >[i_MaxNumThreads];
+
+		// thread private bitmasks of the forbidden colors
+		vector<unsigned long long>* vull_Forbidden_Private = new vector<unsigned long long>[i_MaxNumThreads];
+		vector<int>* vi_WordStamp_Private = new vector<int>[i_MaxNumThreads];
+		vector<int> vi_Stamp_Private(i_MaxNumThreads, 0);
+		for(int i=0; i<i_MaxNumThreads; i++) {
+			vull_Forbidden_Private[i].assign(STEP_UP(i_VertexCount >> 6), 0);
+			vi_WordStamp_Private[i].assign(STEP_UP(i_VertexCount >> 6), _UNKNOWN);
+		}
+
+		int i_LoopCount = 0;
+		while(vi_VerticesToBeColored.size()>0) {
+			i_LoopCount++;
+			// speculative rounds are bounded, the rest is colored by one thread
+			int i_NumThreads = (i_LoopCount <= TRIANGULAR_OMP_ROUNDS) ? i_MaxNumThreads : 1;
+			int i_RecolorCount = vi_VerticesToBeColored.size();
+
+			// tentative coloring, same rule as ModifiedTriangularColoring()
+#ifdef _OPENMP
+			#pragma omp parallel for schedule(dynamic,64) num_threads(i_NumThreads)
+#endif
+			for(int i=0; i<i_RecolorCount; i++) {
+				int i_thread_num;
+#ifdef _OPENMP
+				i_thread_num = omp_get_thread_num();
+#else
+				i_thread_num = 0;
+#endif
+				int i_PresentVertex = vi_VerticesToBeColored[i];
+				int i_Color = TriangularColor(i_PresentVertex, vi_Stamp_Private[i_thread_num]++, vi_VertexHierarchy, vull_Forbidden_Private[i_thread_num], vi_WordStamp_Private[i_thread_num]);
+				m_vi_VertexColors[i_PresentVertex] = i_Color;
+			}
+
+			// detect the conflicts and uncolor one end point of every conflict
+			if(CheckOrderedTriangularColoring(vpii_ConflictedEdges) == 0) break;
+
+			fill(vi_ConflictCount.begin(), vi_ConflictCount.end(), 0);
+			for(int i=0; i<(signed) vpii_ConflictedEdges.size(); i++) {
+				vi_ConflictCount[vpii_ConflictedEdges[i].first]++;
+				vi_ConflictCount[vpii_ConflictedEdges[i].second]++;
+			}
+			for(int i=0; i<i_MaxNumThreads; i++) ConflictedEdges_Private[i].clear();
+			ConflictedEdges_Private[0].swap(vpii_ConflictedEdges);
+			PickVerticesToBeRecolored(i_MaxNumThreads, ConflictedEdges_Private, vi_ConflictCount);
+
+			vi_VerticesToBeColored.clear();
+			for(int i=0; i<i_VertexCount; i++) {
+				if(m_vi_VertexColors[m_vi_OrderedVertices[i]] == _UNKNOWN) vi_VerticesToBeColored.push_back(m_vi_OrderedVertices[i]);
+			}
+		}
+
+		int i_MaxColor = _UNKNOWN;
+		for(int i=0; i<i_VertexCount; i++) {
+			if(m_vi_VertexColors[i] > i_MaxColor) i_MaxColor = m_vi_VertexColors[i];
+		}
+		m_i_VertexColorCount = i_MaxColor;
+
+		m_s_VertexColoringVariant = "TRIANGULAR_OMP";
+
+		delete[] ConflictedEdges_Private;
+		delete[] vull_Forbidden_Private;
+		delete[] vi_WordStamp_Private;
+
+		return(_TRUE);
+	}
+
+	//Public Function 1466
+	int GraphColoring::CheckTriangularColoring()
+	{
+		vector< pair<int, int> > vpii_ConflictedEdges;
+
+		int i_ViolationCount = CheckTriangularColoring(vpii_ConflictedEdges);
+
+		if(i_ViolationCount)
+		{
+			cout<<endl;
+			cout<<"Triangular Coloring | Violation Check | "<<m_s_InputFile<<endl;
+			cout<<endl;
+
+			for(int i=0; i<i_ViolationCount; i++)
+			{
+				cout<<"Violation "<<STEP_UP(i)<<"\t : "<<STEP_UP(vpii_ConflictedEdges[i].first)<<" ["<<STEP_UP(m_vi_VertexColors[vpii_ConflictedEdges[i].first])<<"] - "<<STEP_UP(vpii_ConflictedEdges[i].second)<<" ["<<STEP_UP(m_vi_VertexColors[vpii_ConflictedEdges[i].second])<<"]"<<endl;
+			}
+
+			cout<<endl;
+			cout<<"[Total Violations = "<<i_ViolationCount<<"]"<<endl;
+			cout<<endl;
+		}
+
+		return(i_ViolationCount);
+	}
+
+	//Public Function 1488
+	int GraphColoring::CheckTriangularColoring(vector< pair<int, int> > & vpii_ConflictedEdges)
+	{
+		if(m_s_VertexColoringVariant.compare("TRIANGULAR") != 0)
+		{
+			return(CheckOrderedTriangularColoring(vpii_ConflictedEdges));
+		}
+
+		//TriangularColoring() replaced the graph by the induced graph and colored it with DistanceOneColoring()
+		int i_VertexCount = STEP_DOWN((signed) m_vi_Vertices.size());
+
+		vpii_ConflictedEdges.clear();
+
+		for(int i=0; i<i_VertexCount; i++)
+		{
+			for(int j=m_vi_Vertices[i]; j<m_vi_Vertices[STEP_UP(i)]; j++)
+			{
+				if((i < m_vi_Edges[j]) && (m_vi_VertexColors[i] == m_vi_VertexColors[m_vi_Edges[j]]))
+				{
+					vpii_ConflictedEdges.push_back(pair<int, int>(i, m_vi_Edges[j]));
+				}
+			}
+		}
+
+		return((signed) vpii_ConflictedEdges.size());
+	}
+
+	int GraphColoring::CheckOrderedTriangularColoring(vector< pair<int, int> > & vpii_ConflictedEdges)
+	{
+		int i_MaxNumThreads;
+#ifdef _OPENMP
+		i_MaxNumThreads = omp_get_max_threads();
+#else
+		i_MaxNumThreads = 1;
+#endif
+		int i_VertexCount = STEP_DOWN((signed) m_vi_Vertices.size());
+
+		int i_MaxColor = _UNKNOWN;
+		for(int i=0; i<i_VertexCount; i++) {
+			if(m_vi_VertexColors[i] > i_MaxColor) i_MaxColor = m_vi_VertexColors[i];
+		}
+
+		// position of every vertex in m_vi_OrderedVertices (natural order if there is no ordering)
+		vector<int> vi_VertexHierarchy(i_VertexCount);
+		for(int i=0; i<i_VertexCount; i++) {
+			vi_VertexHierarchy[i] = i;
+		}
+		if((signed) m_vi_OrderedVertices.size() == i_VertexCount) {
+			for(int i=0; i<i_VertexCount; i++) {
+				vi_VertexHierarchy[m_vi_OrderedVertices[i]] = i;
+			}
+		}
+
+		vector< pair<int, int> >* ConflictedEdges_Private = new vector< pair<int, int> >[i_MaxNumThreads];
+		vector<int>* vi_ColorStamp_Private = new vector<int>[i_MaxNumThreads];
+		vector<int>* vi_FirstVertex_Private = new vector<int>[i_MaxNumThreads];
+		for(int i=0; i<i_MaxNumThreads; i++) {
+			vi_ColorStamp_Private[i].assign(i_MaxColor+1, _UNKNOWN);
+			vi_FirstVertex_Private[i].assign(i_MaxColor+1, _UNKNOWN);
+		}
+
+		// same color edges, and 2 neighbors of a vertex w that both come before w in the ordering and have the same color
+#ifdef _OPENMP
+		#pragma omp parallel for schedule(dynamic,64)
+#endif
+		for(int i=0; i<i_VertexCount; i++) {
+			int i_thread_num;
+#ifdef _OPENMP
+			i_thread_num = omp_get_thread_num();
+#else
+			i_thread_num = 0;
+#endif
+			vector<int> & vi_ColorStamp = vi_ColorStamp_Private[i_thread_num];
+			vector<int> & vi_FirstVertex = vi_FirstVertex_Private[i_thread_num];
+			for(int j=m_vi_Vertices[i]; j<m_vi_Vertices[STEP_UP(i)]; j++) {
+				int i_AdjacentVertex = m_vi_Edges[j];
+				int i_AdjacentColor = m_vi_VertexColors[i_AdjacentVertex];
+				if(i_AdjacentColor == _UNKNOWN) continue;
+				if(i < i_AdjacentVertex && i_AdjacentColor == m_vi_VertexColors[i]) {
+					ConflictedEdges_Private[i_thread_num].push_back(pair<int, int>(i, i_AdjacentVertex));
+				}
+				if(vi_VertexHierarchy[i_AdjacentVertex] > vi_VertexHierarchy[i]) continue;
+				if(vi_ColorStamp[i_AdjacentColor] != i) {
+					vi_ColorStamp[i_AdjacentColor] = i;
+					vi_FirstVertex[i_AdjacentColor] = i_AdjacentVertex;
+				}
+				else {
+					ConflictedEdges_Private[i_thread_num].push_back(pair<int, int>(min(vi_FirstVertex[i_AdjacentColor], i_AdjacentVertex), max(vi_FirstVertex[i_AdjacentColor], i_AdjacentVertex)));
+				}
+			}
+		}
+
+		int i_ViolationCount = MergeConflictedEdges(i_MaxNumThreads, ConflictedEdges_Private, vpii_ConflictedEdges);
+
+		delete[] ConflictedEdges_Private;
+		delete[] vi_ColorStamp_Private;
+		delete[] vi_FirstVertex_Private;
+
+		return(i_ViolationCount);
+	}
+
+
+	//Public Function 1467
+	string GraphColoring::GetVertexColoringVariant()
+	{
+		return(m_s_VertexColoringVariant);
+	}
+
+	void GraphColoring::SetVertexColoringVariant(string s_VertexColoringVariant)
+	{
+		m_s_VertexColoringVariant = s_VertexColoringVariant;
+	}
+
+
+	//Public Function 1468
+	int GraphColoring::GetVertexColorCount()
+	{
+		return(STEP_UP(m_i_VertexColorCount));
+	}
+
 
-		v2i_VertexAdjacency.clear();
-		v2i_VertexAdjacency.resize((unsigned) i_VertexCount);
+	//Public Function 1469
+	void GraphColoring::GetVertexColors(vector<int> &output)
+	{
+		output = (m_vi_VertexColors);
+	}
 
-		for(i=0; i<i_VertexCount; i++)
+	//Public Function 1491
+	int GraphColoring::SetVertexColors(const vector<int> & vi_VertexColors, string s_VertexColoringVariant)
+	{
+		if(vi_VertexColors.size() != (unsigned) STEP_DOWN((signed) m_vi_Vertices.size()))
 		{
-			vi_VertexHierarchy[m_vi_OrderedVertices[i]] = i;
+			cerr<<endl<<"*ERROR: SetVertexColors(): "<<vi_VertexColors.size()<<" colors for "<<STEP_DOWN((signed) m_vi_Vertices.size())<<" vertices"<<endl;
+
+			return(_FALSE);
 		}
 
-		//m_vi_VertexColors.clear();
-		//m_vi_VertexColors.resize((unsigned) i_VertexCount, _UNKNOWN);
+		m_vi_VertexColors = vi_VertexColors;
 
 		m_i_VertexColorCount = _UNKNOWN;
 
-		for(i=0; i<i_VertexCount; i++)
+		for(int i=0; i<(signed) m_vi_VertexColors.size(); i++)
 		{
-			i_PresentVertex = m_vi_OrderedVertices[i];
+			if(m_i_VertexColorCount < m_vi_VertexColors[i]) m_i_VertexColorCount = m_vi_VertexColors[i];
+		}
 
-#if VERBOSE == _TRUE
+		m_s_VertexColoringVariant = s_VertexColoringVariant;
 
-			cout<<"DEBUG 1464 | Triangular Coloring | Processing Vertex "<<STEP_UP(i_PresentVertex)<<"/"<<i_VertexCount<<endl;
+		return(_TRUE);
+	}
 
-#endif
 
-			for(j=m_vi_Vertices[i_PresentVertex]; j<m_vi_Vertices[STEP_UP(i_PresentVertex)]; j++)
+	//Private Function 1406
+	int GraphColoring::MarkForbiddenColors(int i_Vertex, int i_Mode, int i_Stamp, vector<int> & vi_ForbiddenColors)
+	{
+		vector<int> & vi_D1ColorStamp = m_ws_Workspace.vi_D1ColorStamp;
+		vector<int> & vi_D1ColorCount = m_ws_Workspace.vi_D1ColorCount;
+
+		for(int j=m_vi_Vertices[i_Vertex]; j<m_vi_Vertices[STEP_UP(i_Vertex)]; j++)
+		{
+			int i_D1Neighbor = m_vi_Edges[j];
+			int i_D1Color = m_vi_VertexColors[i_D1Neighbor];
+
+			if(i_D1Color != _UNKNOWN)
 			{
-				v2i_VertexAdjacency[i_PresentVertex].push_back(m_vi_Edges[j]);
+				vi_ForbiddenColors[i_D1Color] = i_Stamp;
 
-				for(k=m_vi_Vertices[m_vi_Edges[j]]; k<m_vi_Vertices[STEP_UP(m_vi_Edges[j])]; k++)
+				if(i_Mode == 3)
 				{
-					if(m_vi_Edges[k] == i_PresentVertex)
+					if(vi_D1ColorStamp[i_D1Color] != i_Stamp)
 					{
-						continue;
+						vi_D1ColorStamp[i_D1Color] = i_Stamp;
+						vi_D1ColorCount[i_D1Color] = 0;
 					}
 
-					if((vi_VertexHierarchy[m_vi_Edges[j]] > vi_VertexHierarchy[i_PresentVertex]) && (vi_VertexHierarchy[m_vi_Edges[j]] > vi_VertexHierarchy[m_vi_Edges[k]]))
-					{
-						_FOUND = _FALSE;
-
-						for(l=m_vi_Vertices[m_vi_Edges[k]]; l<m_vi_Vertices[STEP_UP(m_vi_Edges[k])]; l++)
-						{
-							if(m_vi_Edges[l] == i_PresentVertex)
-							{
-								_FOUND = TRUE;
-
-								break;
-							}
-						}
-
-						if(_FOUND == _FALSE)
-						{
-							v2i_VertexAdjacency[i_PresentVertex].push_back(m_vi_Edges[k]);
-						}
-					}
+					vi_D1ColorCount[i_D1Color]++;
 				}
 			}
-		}
-
-		m_vi_Vertices.clear();
-		m_vi_Edges.clear();
-
-		i_HighestVertexDegree = _UNKNOWN;
 
-		for(i=0; i<i_VertexCount; i++)
-		{
-			m_vi_Vertices.push_back((signed) m_vi_Edges.size());
-
-			i_VertexDegree = (signed) v2i_VertexAdjacency[i].size();
-
-			if(i_HighestVertexDegree < i_VertexDegree)
+			if(i_Mode == 1)
 			{
-				i_HighestVertexDegree = i_VertexDegree;
+				continue;
 			}
 
-			for(j=0; j<i_VertexDegree; j++)
+			for(int k=m_vi_Vertices[i_D1Neighbor]; k<m_vi_Vertices[STEP_UP(i_D1Neighbor)]; k++)
 			{
-				m_vi_Edges.push_back(v2i_VertexAdjacency[i][j]);
-			}
+				int i_D2Neighbor = m_vi_Edges[k];
 
-			v2i_VertexAdjacency[i].clear();
-		}
+				if((i_D2Neighbor == i_Vertex) || (m_vi_VertexColors[i_D2Neighbor] == _UNKNOWN))
+				{
+					continue;
+				}
 
-		m_vi_Vertices.push_back((signed) m_vi_Edges.size());
+				if(i_Mode == 2)
+				{
+					vi_ForbiddenColors[m_vi_VertexColors[i_D2Neighbor]] = i_Stamp;
 
-#if DEBUG == 1464
+					continue;
+				}
 
-		int i_EdgeCount;
+				//i_Vertex at the end of the path i_Vertex-i_D1Neighbor-i_D2Neighbor-l colored c, d, c
+				if((i_D1Color == _UNKNOWN) || (vi_ForbiddenColors[m_vi_VertexColors[i_D2Neighbor]] == i_Stamp))
+				{
+					continue;
+				}
 
-		cout<<endl;
-		cout<<"DEBUG 1464 | Graph Coloring | Induced Matrix"<<endl;
-		cout<<endl;
+				for(int l=m_vi_Vertices[i_D2Neighbor]; l<m_vi_Vertices[STEP_UP(i_D2Neighbor)]; l++)
+				{
+					if((m_vi_Edges[l] != i_D1Neighbor) && (m_vi_Edges[l] != i_Vertex) && (m_vi_VertexColors[m_vi_Edges[l]] == i_D1Color))
+					{
+						vi_ForbiddenColors[m_vi_VertexColors[i_D2Neighbor]] = i_Stamp;
 
-		i_VertexCount = (signed) m_vi_Vertices.size();
-		i_EdgeCount = (signed) m_vi_Edges.size();
+						break;
+					}
+				}
+			}
+		}
 
-		for(i=0; i<i_VertexCount; i++)
+		if(i_Mode != 3)
 		{
-			for(j=m_vi_Vertices[i]; j<m_vi_Vertices[STEP_UP(i)]; j++)
-			{
-				cout<<"Element["<<STEP_UP(i)<<"]["<<STEP_UP(m_vi_Edges[j])<<"] = 1"<<endl;
-			}
+			return(_TRUE);
 		}
 
-		cout<<endl;
-		cout<<"[Induced Vertices = "<<STEP_DOWN(i_VertexCount)<<"; Induced Edges = "<<i_EdgeCount<<"]"<<endl;
-		cout<<endl;
+		//i_Vertex second on the path k-i_Vertex-i_D1Neighbor-l: the color of i_D1Neighbor is on another neighbor k
+		for(int j=m_vi_Vertices[i_Vertex]; j<m_vi_Vertices[STEP_UP(i_Vertex)]; j++)
+		{
+			int i_D1Neighbor = m_vi_Edges[j];
+			int i_D1Color = m_vi_VertexColors[i_D1Neighbor];
 
-#endif
+			if((i_D1Color == _UNKNOWN) || (vi_D1ColorCount[i_D1Color] < 2))
+			{
+				continue;
+			}
 
-		SmallestLastOrdering();
+			for(int k=m_vi_Vertices[i_D1Neighbor]; k<m_vi_Vertices[STEP_UP(i_D1Neighbor)]; k++)
+			{
+				if((m_vi_Edges[k] != i_Vertex) && (m_vi_VertexColors[m_vi_Edges[k]] != _UNKNOWN))
+				{
+					vi_ForbiddenColors[m_vi_VertexColors[m_vi_Edges[k]]] = i_Stamp;
+				}
+			}
+		}
 
-		return(DistanceOneColoring());
+		return(_TRUE);
 	}
 
 
-
-	//Public Function 1465
-	int GraphColoring::ModifiedTriangularColoring()
+	//Public Function 1494
+	int GraphColoring::UpdateColoring(const vector< pair<int, int> > & vpii_InsertedEdges, const vector< pair<int, int> > & vpii_DeletedEdges, string s_ColoringVariant)
 	{
-		//if(CheckVertexColoring("MODIFIED TRIANGULAR"))
-		//{
-		//	return(_TRUE);
-		//}
-
-		int i, j, k;
+		int i_Mode;
 
-		int i_VertexCount;
+		s_ColoringVariant = toUpper(s_ColoringVariant);
 
-		int i_HighestColor;
+		if(s_ColoringVariant.compare(0, 12, "DISTANCE_ONE") == 0)
+		{
+			i_Mode = 1;
+		}
+		else
+		if(s_ColoringVariant.compare(0, 12, "DISTANCE_TWO") == 0)
+		{
+			i_Mode = 2;
+		}
+		else
+		if(s_ColoringVariant.find("STAR") != string::npos)
+		{
+			i_Mode = 3;
+		}
+		else
+		{
+			cerr<<endl<<"*ERROR: UpdateColoring() supports DISTANCE_ONE, DISTANCE_TWO and STAR colorings, not "<<s_ColoringVariant<<endl;
 
-		int i_PresentVertex;
+			return(_UNKNOWN);
+		}
 
-		vector<int> vi_CandidateColors;
+		int i_OldVertexCount = m_vi_Vertices.empty() ? 0 : STEP_DOWN((signed) m_vi_Vertices.size());
 
-		vector<int> vi_VertexHierarchy;
+		if((signed) m_vi_VertexColors.size() != i_OldVertexCount)
+		{
+			cerr<<endl<<"*ERROR: UpdateColoring() needs a colored graph"<<endl;
 
-		i_VertexCount = (signed) m_vi_OrderedVertices.size();
+			return(_UNKNOWN);
+		}
 
-		vi_VertexHierarchy.clear();
-		vi_VertexHierarchy.resize((unsigned) i_VertexCount);
+		vector<int> vi_NewEdgeEndPoints;
 
-		for(i=0; i<i_VertexCount; i++)
+		if(UpdateEdges(vpii_InsertedEdges, vpii_DeletedEdges, vi_NewEdgeEndPoints) == _UNKNOWN)
 		{
-			vi_VertexHierarchy[m_vi_OrderedVertices[i]] = i;
+			return(_UNKNOWN);
 		}
 
-		m_vi_VertexColors.clear();
-		m_vi_VertexColors.resize((unsigned) i_VertexCount, _UNKNOWN);
-
-		vi_CandidateColors.clear();
-		vi_CandidateColors.resize((unsigned) i_VertexCount, _UNKNOWN);
+		int i_VertexCount = STEP_DOWN((signed) m_vi_Vertices.size());
 
-		i_HighestColor = _UNKNOWN;
+		m_vi_VertexColors.resize((unsigned) i_VertexCount, _UNKNOWN);
 
-		for(i=0; i<i_VertexCount; i++)
+		if((signed) m_vi_OrderedVertices.size() == i_OldVertexCount)
 		{
-			i_PresentVertex = m_vi_OrderedVertices[i];
+			for(int i=i_OldVertexCount; i<i_VertexCount; i++)
+			{
+				m_vi_OrderedVertices.push_back(i);
+			}
+		}
 
-#if VERBOSE == _TRUE
+		vector<int> & vi_ForbiddenColors = m_ws_Workspace.vi_CandidateColors;
 
-			cout<<"DEBUG 1465 | Triangular Coloring | Coloring Vertex "<<STEP_UP(i_PresentVertex)<<"/"<<i_VertexCount<<endl;
+		ColoringWorkspace::Reserve(vi_ForbiddenColors, STEP_UP(i_VertexCount));
+		ColoringWorkspace::Reserve(m_ws_Workspace.vi_D1ColorStamp, STEP_UP(i_VertexCount));
+		ColoringWorkspace::Reserve(m_ws_Workspace.vi_D1ColorCount, STEP_UP(i_VertexCount));
 
-#endif
+		//Every new violation lies on a path through a new edge and involves one of its end points; dropping the color
+		//of each end point still in violation, one after the other, leaves a valid partial coloring
+		vector<int> vi_VerticesToBeRecolored;
 
-			for(j=m_vi_Vertices[i_PresentVertex]; j<m_vi_Vertices[STEP_UP(i_PresentVertex)]; j++)
-			{
-				if(m_vi_VertexColors[m_vi_Edges[j]] != _UNKNOWN)
-				{
-					vi_CandidateColors[m_vi_VertexColors[m_vi_Edges[j]]] = i_PresentVertex;
-				}
+		for(int i=0; i<(signed) vi_NewEdgeEndPoints.size(); i++)
+		{
+			int i_PresentVertex = vi_NewEdgeEndPoints[i];
 
-				for(k=m_vi_Vertices[m_vi_Edges[j]]; k<m_vi_Vertices[STEP_UP(m_vi_Edges[j])]; k++)
-				{
-					if(m_vi_Edges[k] == i_PresentVertex)
-					{
-						continue;
-					}
+			if(m_vi_VertexColors[i_PresentVertex] == _UNKNOWN)
+			{
+				continue;
+			}
 
-					if(m_vi_VertexColors[m_vi_Edges[k]] == _UNKNOWN)
-					{
-						continue;
-					}
+			int i_Stamp = m_ws_Workspace.NextStamp();
 
-					if((vi_VertexHierarchy[m_vi_Edges[j]] > vi_VertexHierarchy[i_PresentVertex]) && (vi_VertexHierarchy[m_vi_Edges[j]] > vi_VertexHierarchy[m_vi_Edges[k]]))
-					{
-						vi_CandidateColors[m_vi_VertexColors[m_vi_Edges[k]]] = i_PresentVertex;
-					}
-				}
-			}
+			MarkForbiddenColors(i_PresentVertex, i_Mode, i_Stamp, vi_ForbiddenColors);
 
-			for(j=0; j<i_VertexCount; j++)
+			if(vi_ForbiddenColors[m_vi_VertexColors[i_PresentVertex]] == i_Stamp)
 			{
-				if(vi_CandidateColors[j] != i_PresentVertex)
-				{
-					m_vi_VertexColors[i_PresentVertex] = j;
-
-					if(i_HighestColor < j)
-					{
-						i_HighestColor = j;
-					}
+				m_vi_VertexColors[i_PresentVertex] = _UNKNOWN;
 
-					break;
-				}
+				vi_VerticesToBeRecolored.push_back(i_PresentVertex);
 			}
 		}
 
-		return(_TRUE);
-}
+		for(int i=i_OldVertexCount; i<i_VertexCount; i++)
+		{
+			vi_VerticesToBeRecolored.push_back(i);
+		}
 
-	//Public Function 1466
-	int GraphColoring::CheckTriangularColoring()
-	{
-		return(CheckAcyclicColoring());
-	}
+		for(int i=0; i<(signed) vi_VerticesToBeRecolored.size(); i++)
+		{
+			int i_PresentVertex = vi_VerticesToBeRecolored[i];
 
+			int i_Stamp = m_ws_Workspace.NextStamp();
 
-	//Public Function 1467
-	string GraphColoring::GetVertexColoringVariant()
-	{
-		return(m_s_VertexColoringVariant);
-	}
+			MarkForbiddenColors(i_PresentVertex, i_Mode, i_Stamp, vi_ForbiddenColors);
 
-	void GraphColoring::SetVertexColoringVariant(string s_VertexColoringVariant)
-	{
-		m_s_VertexColoringVariant = s_VertexColoringVariant;
-	}
+			int c = 0;
 
+			while(vi_ForbiddenColors[c] == i_Stamp)
+			{
+				c++;
+			}
 
-	//Public Function 1468
-	int GraphColoring::GetVertexColorCount()
-	{
-		return(STEP_UP(m_i_VertexColorCount));
-	}
+			m_vi_VertexColors[i_PresentVertex] = c;
 
+			if(m_i_VertexColorCount < c)
+			{
+				m_i_VertexColorCount = c;
+			}
+		}
 
-	//Public Function 1469
-	void GraphColoring::GetVertexColors(vector<int> &output)
-	{
-		output = (m_vi_VertexColors);
+		//the stars, the bicolored trees and the seed matrix of the old coloring are stale
+		m_i_ColoringUnits = _UNKNOWN;
+
+		Seed_reset();
+
+		return((signed) vi_VerticesToBeRecolored.size());
 	}
 
 
@@ -5911,7 +7462,7 @@ namespace ColPack
 
 		if(seed_available) Seed_reset();
 
-		dp2_Seed = GetSeedMatrix_unmanaged(i_SeedRowCount, i_SeedColumnCount);
+		dp2_Seed = NewSeedMatrix(i_SeedRowCount, i_SeedColumnCount, MATRIX_ALLOC_SLAB);
 		i_seed_rowCount = *i_SeedRowCount;
 		seed_available = true;
 
@@ -5919,19 +7470,23 @@ namespace ColPack
 	}
 
 	double** GraphColoring::GetSeedMatrix_unmanaged(int* i_SeedRowCount, int* i_SeedColumnCount) {
+		return NewSeedMatrix(i_SeedRowCount, i_SeedColumnCount, m_i_MatrixAllocation);
+	}
+
+	double** GraphColoring::GetSeedMatrix_contiguous(int* i_SeedRowCount, int* i_SeedColumnCount) {
+		return NewSeedMatrix(i_SeedRowCount, i_SeedColumnCount, MATRIX_ALLOC_SLAB);
+	}
+
+	double** GraphColoring::NewSeedMatrix(int* i_SeedRowCount, int* i_SeedColumnCount, int i_MatrixAllocation) {
 
 		int i_size = m_vi_VertexColors.size();
 		int i_num_of_colors = m_i_VertexColorCount + 1;
 		(*i_SeedRowCount) = i_size;
 		(*i_SeedColumnCount) = i_num_of_colors;
 		if(i_num_of_colors == 0 || i_size == 0) {return NULL;}
-		double** Seed = new double*[i_size];
 
 		// allocate and initialize Seed matrix
-		for (int i=0; i<i_size; i++) {
-			Seed[i] = new double[i_num_of_colors];
-			for(int j=0; j<i_num_of_colors; j++) Seed[i][j]=0.;
-		}
+		double** Seed = new_2DMatrix<double>(i_size, i_num_of_colors, i_MatrixAllocation);
 
 		// populate Seed matrix
 		for (int i=0; i < i_size; i++) {
@@ -5941,8 +7496,23 @@ namespace ColPack
 		return Seed;
 	}
 
+	int GraphColoring::GetSeedColors(vector<int> &output) {
+		output = m_vi_VertexColors;
+
+		return m_i_VertexColorCount + 1;
+	}
+
+	void GraphColoring::SetMatrixAllocation(int i_MatrixAllocation) {
+		m_i_MatrixAllocation = i_MatrixAllocation;
+	}
+
+	int GraphColoring::GetMatrixAllocation() {
+		return m_i_MatrixAllocation;
+	}
+
 	void GraphColoring::Seed_init() {
 		seed_available = false;
+		m_i_MatrixAllocation = MATRIX_ALLOC_ROWS;
 
 		i_seed_rowCount = 0;
 		dp2_Seed = NULL;
@@ -5952,7 +7522,7 @@ namespace ColPack
 		if(seed_available) {
 			seed_available = false;
 
-			free_2DMatrix(dp2_Seed, i_seed_rowCount);
+			free_2DMatrix_slab(dp2_Seed);
 			dp2_Seed = NULL;
 			i_seed_rowCount = 0;
 		}
@@ -7,6 +7,17 @@
 #ifndef GRAPHCOLORING_H
 #define GRAPHCOLORING_H
 
+//Speculative rounds of the OpenMP colorings, the vertices still uncolored afterwards are colored by one thread
+#ifndef STAR_OMP_ROUNDS
+#define STAR_OMP_ROUNDS 100
+#endif
+#ifndef ACYCLIC_OMP_ROUNDS
+#define ACYCLIC_OMP_ROUNDS 100
+#endif
+#ifndef TRIANGULAR_OMP_ROUNDS
+#define TRIANGULAR_OMP_ROUNDS 100
+#endif
+
 using namespace std;
 
 namespace ColPack
@@ -42,9 +53,26 @@ namespace ColPack
 		/// Same as GetSeedMatrix(), except that this Seed matrix is NOT managed by ColPack
 		/** Notes:
 		- This Seed matrix is NOT managed by ColPack. Therefore, the user should free the Seed matrix manually when the matrix is no longer needed.
+		- The Seed matrix is allocated following GetMatrixAllocation(). Free it with free_2DMatrix(Seed, rows, GetMatrixAllocation()).
 		*/
 		double** GetSeedMatrix_unmanaged(int* ip1_SeedRowCount, int* ip1_SeedColumnCount);
 
+		/// Same as GetSeedMatrix_unmanaged(), except that the Seed matrix is always allocated as MATRIX_ALLOC_SLAB
+		/** Notes:
+		- Same as SetMatrixAllocation(MATRIX_ALLOC_SLAB) followed by GetSeedMatrix_unmanaged(), kept for compatibility. Free it with free_2DMatrix_slab().
+		*/
+		double** GetSeedMatrix_contiguous(int* ip1_SeedRowCount, int* ip1_SeedColumnCount);
+
+		/// Compact form of the Seed matrix: the column of the 1 in each row
+		/** Postcondition:
+		- output[v] is the column of the Seed matrix holding the 1 of row v, i.e. the color of v.
+
+		Return value: number of columns of the Seed matrix == GetVertexColorCount().
+
+		The Seed matrix has exactly one nonzero per row, so this vector is all the recovery routines need, see the overloads of HessianRecovery taking the seed colors.
+		*/
+		int GetSeedColors(vector<int> &output);
+
 		///Quick check to see if DistanceTwoColoring() ran correctly
 		/**
 		Return value:
@@ -93,14 +121,23 @@ namespace ColPack
 
 	private:
 
-		int m_i_ColoringUnits;
-
 		//Private Function 1401
 		int FindCycle(int, int, int, int, vector<int> &, vector<int> &, vector<int> &);
 
 		//Private Function 1402
 		int UpdateSet(int, int, int, map< int, map<int, int> > &, vector<int> &, vector<int> &, vector<int> &);
 
+		//Private Function 1402
+		int UpdateSet(int i_Stamp, int i_AdjacentVertex, int i_EdgeID, vector<int> & vi_FirstSeenOne, vector<int> & vi_FirstSeenEdge);
+
+		//Private Function 1405
+		int BuildEdgeIDs();
+
+		//Private Function 1406
+		/// Set vi_ForbiddenColors[c] = i_Stamp for every color c that i_Vertex cannot take next to the colored vertices (the color of i_Vertex itself is ignored)
+		/** i_Mode: 1 distance one, 2 distance two, 3 star (no 2-colored path on 4 vertices through i_Vertex) */
+		int MarkForbiddenColors(int i_Vertex, int i_Mode, int i_Stamp, vector<int> & vi_ForbiddenColors);
+
 		//Private Function 1403
 		int SearchDepthFirst(int, int, int, vector<int> &);
 
@@ -110,6 +147,8 @@ namespace ColPack
 
 	protected:
 
+		int m_i_ColoringUnits;
+
 		int m_i_VertexColorCount;
 
 		int m_i_LargestColorClass;
@@ -120,6 +159,8 @@ namespace ColPack
 
 		double m_d_AverageColorClassSize;
 
+		double m_d_ColorBalanceTolerance;
+
 		double m_d_ColoringTime;
 		double m_d_CheckingTime;
 
@@ -133,11 +174,20 @@ namespace ColPack
 		int i_seed_rowCount;
 		double** dp2_Seed;
 
+		int m_i_MatrixAllocation;
+
 		void Seed_init();
 		void Seed_reset();
 
+		/// Seed matrix of GetSeedMatrix_unmanaged() allocated with the policy i_MatrixAllocation
+		double** NewSeedMatrix(int* ip1_SeedRowCount, int* ip1_SeedColumnCount, int i_MatrixAllocation);
+
 	public:
 
+		/// Allocation policy of the unmanaged Seed matrices: MATRIX_ALLOC_ROWS (default) or MATRIX_ALLOC_SLAB, see MatrixDeallocation.h
+		void SetMatrixAllocation(int i_MatrixAllocation);
+		int GetMatrixAllocation();
+
 		void SetStringVertexColoringVariant(string s);
 		void SetVertexColorCount(int i_VertexColorCount);
 
@@ -154,6 +204,35 @@ namespace ColPack
 		//Public Function 1454
 		int DistanceOneColoring();
 
+		//Public Function 1479
+		/// Distance one coloring that picks the least used permissible color, followed by RebalanceVertexColors()
+		int DistanceOneColoring_Balanced();
+
+		//Public Function 1480
+		/// Move vertices out of color classes larger than (1 + tolerance) * average, in parallel. The color count is kept.
+		int RebalanceVertexColors();
+
+		//Public Function 1481
+		void SetColorBalanceTolerance(double d_ColorBalanceTolerance);
+
+		//Public Function 1482
+		double GetColorBalanceTolerance();
+
+		//Public Function 1483
+		/// Try to lower the number of colors of an existing coloring by iterated greedy recoloring
+		/**
+		 * Each iteration recolors the vertices class by class, the classes taken in s_ClassOrder:
+		 * - "REVERSE": highest color first
+		 * - "LARGEST_FIRST": largest class first
+		 *
+		 * For "DISTANCE_ONE" and "DISTANCE_TWO" the pass is a first fit greedy that never increases the number of colors;
+		 * the vertices of one class are recolored in parallel (OpenMP).
+		 * For "STAR" and "RESTRICTED_STAR" the star coloring is recomputed with the vertices grouped by class
+		 * and only the best coloring is kept; the vertex ordering is restored at the end.
+		 * Iterations stop after i_MaxIterations or when d_TimeBudget seconds of wall clock time are used up.
+		 */
+		int IteratedGreedyRecoloring(string s_ColoringVariant = "DISTANCE_ONE", string s_ClassOrder = "REVERSE", double d_TimeBudget = 1.0, int i_MaxIterations = 100);
+
 		//Public Function 1455
 		int DistanceTwoColoring();
 
@@ -169,6 +248,29 @@ namespace ColPack
 		 */
 		int RestrictedStarColoring();
 
+		//Public Function 1489
+		/// Speculative parallel version of NaiveStarColoring() (OpenMP)
+		/**
+		 * Rounds of: tentative coloring of the uncolored vertices in parallel with the rules of NaiveStarColoring(),
+		 * detection of the same color edges and of the 2-colored paths on 4 vertices (see CheckStarColoring(vector< pair<int, int> > &)),
+		 * PickVerticesToBeRecolored(). After STAR_OMP_ROUNDS (100 by default) rounds the rest is colored by one thread.
+		 *
+		 * The tentative coloring has one more rule: when the color of a neighbor w is repeated around the vertex, the colors of
+		 * the neighbors of w are forbidden too. The detect phase uncolors one end of the middle edge of a 2-colored path, possibly
+		 * its middle vertex, and the naive rule alone would give that vertex its old color back. So even with one thread the colors
+		 * may differ from those of NaiveStarColoring().
+		 */
+		int NaiveStarColoring_OMP();
+
+		//Public Function 1490
+		/// Speculative parallel version of RestrictedStarColoring() (OpenMP)
+		/**
+		 * Same rounds as NaiveStarColoring_OMP(); the detect phase checks the restricted star constraint:
+		 * 2 neighbors of a vertex w with the same color must have a color larger than the color of w.
+		 * With one thread the colors are those of RestrictedStarColoring().
+		 */
+		int RestrictedStarColoring_OMP();
+
 		//Public Function 1458
 		/*
 		 * Related paper: A. Gebremedhin, A. Tarafdar, F. Manne and A. Pothen, New Acyclic and Star Coloring Algorithms with Applications to Hessian Computation, SIAM Journal on Scientific Computing, Vol 29, No 3, pp 1042--1072, 2007.
@@ -178,6 +280,17 @@ namespace ColPack
 		int StarColoring_serial();
 		int StarColoring_serial2(); // Essentially based on StarColoring_OMP() v1
 
+		//Public Function 1484
+		/// Speculative parallel version of StarColoring_serial2() (OpenMP)
+		/**
+		 * Rounds of: tentative coloring of a batch of uncolored vertices in parallel, parallel star building in every
+		 * 2-color combination to detect the violations caused by concurrent updates, PickVerticesToBeRecolored().
+		 * The batches (STAR_OMP_BATCHES per graph, 16 by default) keep the stars of most colored neighbors known;
+		 * neighbors colored in the current round are treated conservatively.
+		 * With one OpenMP thread StarColoring_serial2() is called instead, so the result is the same as StarColoring().
+		 */
+		int StarColoring_OMP();
+
 		// TO BE IMPLEMENTED
 		int StarColoring();
 
@@ -210,6 +323,113 @@ namespace ColPack
 			vector< pair<int, int> > value;
 			bool visited;
 		};
+		/// Flat replacement of vector< map<int,int> > Vertex2ColorCombination
+		/**
+		 * The entries (color, value) of vertex v are kept in the CSR aligned slots [m_vi_Vertices[v], m_vi_Vertices[v] + vi_Count[v])
+		 * of vi_Color/vi_Value (a vertex has at most one entry per neighbor). An open addressing hash on (vertex, color) gives the slot.
+		 */
+		struct Vertex2ColorCombination_Flat {
+			vector<int> vi_Begin, vi_Count, vi_Color, vi_Value;
+			vector<long long> vll_Key;
+			vector<int> vi_Slot;
+			unsigned long long ull_Mask;
+
+			void Initialize(const vector<int> & vi_Vertices) {
+				int i_VertexCount = vi_Vertices.size() - 1;
+				int i_EdgeCount = vi_Vertices[i_VertexCount];
+				unsigned long long ull_Capacity = 16;
+				while(ull_Capacity < 2 * (unsigned long long)i_EdgeCount) ull_Capacity <<= 1;
+				ull_Mask = ull_Capacity - 1;
+				vi_Begin.assign(vi_Vertices.begin(), vi_Vertices.end());
+				vi_Count.assign(i_VertexCount, 0);
+				vi_Color.assign(i_EdgeCount, _UNKNOWN);
+				vi_Value.assign(i_EdgeCount, _UNKNOWN);
+				vll_Key.assign(ull_Capacity, -1);
+				vi_Slot.assign(ull_Capacity, _UNKNOWN);
+			}
+			unsigned long long Hash(long long ll_Key) const {
+				return (((unsigned long long)ll_Key * 0x9E3779B97F4A7C15ULL) >> 17) & ull_Mask;
+			}
+			/// Return the value of (i_Vertex, i_Color) or NULL if there is no such entry
+			int* Find(int i_Vertex, int i_Color) {
+				long long ll_Key = ((long long)i_Vertex << 32) | (unsigned int)i_Color;
+				for(unsigned long long h = Hash(ll_Key); vll_Key[h] != -1; h = (h + 1) & ull_Mask) {
+					if(vll_Key[h] == ll_Key) return &vi_Value[vi_Slot[h]];
+				}
+				return NULL;
+			}
+			/// Return the value of (i_Vertex, i_Color), the entry is created if needed
+			int& operator()(int i_Vertex, int i_Color) {
+				long long ll_Key = ((long long)i_Vertex << 32) | (unsigned int)i_Color;
+				unsigned long long h = Hash(ll_Key);
+				for(; vll_Key[h] != -1; h = (h + 1) & ull_Mask) {
+					if(vll_Key[h] == ll_Key) return vi_Value[vi_Slot[h]];
+				}
+				int i_Slot = vi_Begin[i_Vertex] + vi_Count[i_Vertex]++;
+				vll_Key[h] = ll_Key;
+				vi_Slot[h] = i_Slot;
+				vi_Color[i_Slot] = i_Color;
+				return vi_Value[i_Slot];
+			}
+		};
+
+		/// Flat replacement of map< pair<int, int>, Colors2Edge_Value, lt_pii>
+		/**
+		 * Every slot j of m_vi_Edges whose 2 end points have 2 different colors is a record; the records are grouped by
+		 * 2-color combination: the records of combination i are vi_Slot[vi_Begin[i] .. vi_Begin[i+1]-1] and the owner of
+		 * slot vi_Slot[k] (i.e. the vertex whose adjacency list contains it) is vi_Tail[k].
+		 * Both directions of an edge are records; only the one with vi_Tail[k] < m_vi_Edges[vi_Slot[k]] is used to build the stars.
+		 */
+		struct Colors2Edge_Flat {
+			int i_CombinationCount;
+			vector<int> vi_Begin, vi_Slot, vi_Tail;
+		};
+
+		/// Temporaries of the serial colorings, kept by the object between calls (see GetColoringWorkspace())
+		/**
+		 * The buffers only grow, so coloring the same graph again (e.g. with another ordering) allocates nothing after the first call.
+		 * The mark buffers (vi_CandidateColors, vi_D1ColorStamp, vi_FirstSeenOne, vi_FirstVisitedOne, vi_FirstTreated) hold stamps:
+		 * an entry is set iff it equals the stamp of the vertex being colored. NextStamp() never returns a stamp used before,
+		 * so they are never reset between vertices or between calls (only when the stamp counter wraps around).
+		 * The other buffers hold values that are read only where the matching mark is set, or are refilled by each call.
+		 */
+		struct ColoringWorkspace {
+			int i_Stamp;
+			vector<int> vi_CandidateColors;
+			vector<int> vi_D1ColorStamp, vi_D1ColorCount;
+			vector<int> vi_FirstSeenOne, vi_FirstSeenTwo;
+			vector<int> vi_FirstSeenEdge;
+			vector<int> vi_FirstVisitedOne, vi_FirstVisitedTwo;
+			vector<int> vi_FirstTreated;
+			vector<int> vi_EdgeStarMap, vi_StarHubMap;
+			vector<int> vi_EdgeID, vi_LowerNeighbor, vi_LowerEdgeID, vi_LowerCount, vi_NeighborSlot;
+			Vertex2ColorCombination_Flat Vertex2ColorCombination;
+
+			ColoringWorkspace() : i_Stamp(0) {}
+			/// Grow vi_Buffer to at least i_Size entries, the new entries are _UNKNOWN. Existing entries are kept
+			static void Reserve(vector<int> & vi_Buffer, int i_Size) {
+				if((signed) vi_Buffer.size() < i_Size) vi_Buffer.resize((unsigned) i_Size, _UNKNOWN);
+			}
+			/// Return a stamp that is in none of the mark buffers
+			int NextStamp() {
+				if(i_Stamp == INT_MAX) {
+					vi_CandidateColors.assign(vi_CandidateColors.size(), _UNKNOWN);
+					vi_D1ColorStamp.assign(vi_D1ColorStamp.size(), _UNKNOWN);
+					vi_FirstSeenOne.assign(vi_FirstSeenOne.size(), _UNKNOWN);
+					vi_FirstVisitedOne.assign(vi_FirstVisitedOne.size(), _UNKNOWN);
+					vi_FirstTreated.assign(vi_FirstTreated.size(), _UNKNOWN);
+					i_Stamp = 0;
+				}
+				return ++i_Stamp;
+			}
+			/// Free the memory of all buffers
+			void Release() {
+				ColoringWorkspace ws_Empty;
+				ws_Empty.i_Stamp = i_Stamp;
+				swap(*this, ws_Empty);
+			}
+		};
+
 		/// Build the collection of 2-color star from the coloring result
 		/**
 		 * This function also helps us identify a list of vertices need to be recolored if conlict is detected
@@ -245,6 +465,29 @@ namespace ColPack
 		int BuildStarFromColorCombination_forChecking(int i_Mode, int i_MaxNumThreads, int i_thread_num, pair<int, int> pii_ColorCombination, map< pair<int, int>, Colors2Edge_Value , lt_pii>* Colors2Edge_Private,
 							  map< int, int> * PotentialHub_Private);
 		int BuildForbiddenColors(int i_MaxNumThreads, int i_thread_num, int i_CurrentVertex, map<int, bool>* mip_ForbiddenColors, map<int, int>* D1Colors, vector<  map <int, int > > *Vertex2ColorCombination);
+
+		/// Flat (thread safe) versions of the routines above, used by StarColoring_OMP()
+		/**
+		 * vi_EdgeStar is aligned with m_vi_Edges: the hub of the star that contains the edge, -2 if the edge is a star by itself
+		 * and _UNKNOWN if the star of the edge is not known (one end point was not colored when the stars were built).
+		 * The colors forbidden for i_CurrentVertex are the ones with vi_ForbiddenColors[color] == i_Stamp.
+		 */
+		int BuildForbiddenColors(int i_CurrentVertex, int i_Stamp, vector<int> & vi_ForbiddenColors, vector<int> & vi_D1ColorStamp, vector<int> & vi_D1ColorCount, vector<int> & vi_EdgeStar, bool b_TrustSingleEdges);
+		/// Group the edges by 2-color combination; edges whose end points have the same color go to ConflictedEdges_Private
+		int BuildColorCombination(int i_MaxNumThreads, Colors2Edge_Flat & Colors2Edge, vector< pair<int, int> >* ConflictedEdges_Private, vector<int> & vi_ConflictCount);
+		int DetectConflictInColorCombination(int i_thread_num, int i_Combination, int i_Stamp, Colors2Edge_Flat & Colors2Edge, vector<int>* vi_HubStamp_Private, vector<int>* vi_PotentialHub_Private, vector< pair<int, int> >* ConflictedEdges_Private, vector<int> & vi_ConflictCount);
+		int BuildStarFromColorCombination(int i_thread_num, int i_Combination, int i_Stamp, Colors2Edge_Flat & Colors2Edge, vector<int>* vi_HubStamp_Private, vector<int>* vi_PotentialHub_Private, vector<int> & vi_EdgeStar);
+		/// Used by NaiveStarColoring_OMP() and RestrictedStarColoring_OMP(): list the pairs of vertices in conflict
+		int DetectStarConflicts(bool b_Restricted, vector< pair<int, int> >* ConflictedEdges_Private, vector<int> & vi_ConflictCount, vector<int>* vi_ColorStamp_Private, vector<int>* vi_FirstVertex_Private);
+		int SpeculativeStarColoring(bool b_Restricted);
+		/// Used by ModifiedTriangularColoring() and TriangularColoring_OMP(): lowest color allowed for i_PresentVertex by the triangular rule, marks stamped with i_Stamp
+		int TriangularColor(int i_PresentVertex, int i_Stamp, const vector<int> & vi_VertexHierarchy, vector<unsigned long long> & vull_Forbidden, vector<int> & vi_WordStamp);
+		/// Used by CheckTriangularColoring() and TriangularColoring_OMP(): the triangular rule of ModifiedTriangularColoring() against m_vi_OrderedVertices
+		int CheckOrderedTriangularColoring(vector< pair<int, int> > & vpii_ConflictedEdges);
+		/// Used by AcyclicColoring_OMP(): an edge of the combination whose end points are already connected in it closes a 2-colored cycle and goes to ConflictedEdges_Private
+		int DetectCycleInColorCombination(int i_thread_num, int i_Combination, int i_Stamp, Colors2Edge_Flat & Colors2Edge, vector<int>* vi_TreeStamp_Private, vector<int>* vi_TreeParent_Private, vector< pair<int, int> >* ConflictedEdges_Private, vector<int> & vi_ConflictCount);
+		/// Used by AcyclicColoring_OMP(): union (DisjointSets::UnionConcurrent()) the edges of i_Vertex whose other end points have the same color
+		int UnionAcyclicSets(int i_Vertex, int i_Stamp, vector<int> & vi_FirstSeenStamp, vector<int> & vi_FirstSeenEdge, vector<int> & vi_EdgeID, DisjointSets & ds_Sets);
 		int PrintVertex2ColorCombination (vector<  map <int, int > > *Vertex2ColorCombination);
 		int PrintVertex2ColorCombination_raw (vector<  map <int, int > > *Vertex2ColorCombination);
 		int PrintVertexAndColorAdded(int i_MaxNumThreads, vector< pair<int, int> > *vi_VertexAndColorAdded, int i_LastNEntries = 999999999);
@@ -306,9 +549,20 @@ namespace ColPack
 		int CheckStarColoring();
 		int GetStarColoringConflicts(vector<vector<int> > &ListOfConflicts);
 
+		//Public Function 1486
+		/// Check the star coloring in O(|E| log(max degree)) time (OpenMP); vpii_ConflictedEdges gets the edges (u, v), u < v, in violation
+		/**
+		An edge is in violation if its 2 end points have the same color or if it is the middle edge of a path on 4 vertices
+		colored with 2 colors: the edge v-w is such an edge iff the color of w appears twice around v and the color of v twice around w.
+		The neighbors are grouped by color with stamp arrays. Uncolored vertices are ignored.
+		Return the number of edges in violation, i.e. 0 if the coloring is a valid star coloring.
+		*/
+		int CheckStarColoring(vector< pair<int, int> > & vpii_ConflictedEdges);
+
 		//Public Function 1461
 		/**
 		Note: This function can not be used for recovery!
+		The edges are numbered through the coloring workspace, the vertex edge map (GetVertexEdgeMap()) is not built.
 		*/
 		int AcyclicColoring();
 
@@ -323,18 +577,66 @@ namespace ColPack
 		*/
 		int AcyclicColoring_ForIndirectRecovery();
 
+		//Public Function 1485
+		/// Speculative parallel version of AcyclicColoring_ForIndirectRecovery() (OpenMP), can be used for Hessian Indirect Recovery
+		/**
+		 * The 2-colored trees are kept in a lock-free DisjointSets (FindConcurrent(), UnionConcurrent()) shared by the threads,
+		 * so every vertex sees the trees merged by the vertices colored before it, also in the same round.
+		 * Rounds of: tentative coloring of the uncolored vertices in parallel, detection of the same color edges and of the
+		 * 2-colored cycles in every 2-color combination, PickVerticesToBeRecolored(), rebuild of the trees from scratch.
+		 * After ACYCLIC_OMP_ROUNDS (100 by default) rounds the rest is colored by one thread.
+		 * With one OpenMP thread the colors are the ones of AcyclicColoring_ForIndirectRecovery().
+		 */
+		int AcyclicColoring_OMP();
+
 		//Public Function 1463
+		/// Check the acyclic coloring with CheckAcyclicColoring(vector< pair<int, int> > &) and print the violations
 		int CheckAcyclicColoring();
 
+		//Public Function 1487
+		/// Check the acyclic coloring in near linear time (OpenMP); vpii_ConflictedEdges gets the edges (u, v), u < v, in violation
+		/**
+		The edges are grouped by 2-color combination and every combination is checked with a union-find in parallel.
+		The edges in violation are the same color edges and, for every cycle of a 2-colored subgraph, one edge closing it.
+		Return the number of edges in violation, i.e. 0 if the coloring is a valid acyclic coloring.
+		*/
+		int CheckAcyclicColoring(vector< pair<int, int> > & vpii_ConflictedEdges);
+
 		//Public Function 1464
 		int TriangularColoring();
 
 		//Public Function 1465
+		/// Color the graph directly with the triangular rule, in the order m_vi_OrderedVertices: a vertex may not share a color with a neighbor, nor with a vertex k when they have a common neighbor w ordered after both of them
+		/**
+		The forbidden colors of a vertex are kept in a bitmask (one bit per color, only the words written for the vertex are read),
+		so the lowest allowed color is found without scanning a candidate array as long as the vertex count.
+		*/
 		int ModifiedTriangularColoring();
 
+		//Public Function 1492
+		/// Speculative parallel version of ModifiedTriangularColoring() (OpenMP)
+		/**
+		Rounds of: tentative coloring of the uncolored vertices in parallel, detection with the triangular rule of CheckTriangularColoring(vector< pair<int, int> > &),
+		PickVerticesToBeRecolored(). After TRIANGULAR_OMP_ROUNDS (100 by default) rounds the rest is colored by one thread.
+		With one thread the colors are those of ModifiedTriangularColoring().
+		*/
+		int TriangularColoring_OMP();
+
 		//Public Function 1466
+		/// Check the triangular coloring with CheckTriangularColoring(vector< pair<int, int> > &) and print the violations
 		int CheckTriangularColoring();
 
+		//Public Function 1488
+		/// Check the triangular coloring in linear time (OpenMP); vpii_ConflictedEdges gets the pairs (u, v), u < v, in violation
+		/**
+		After ModifiedTriangularColoring() and TriangularColoring_OMP(), the coloring is checked against m_vi_OrderedVertices: a pair is
+		in violation if u and v are adjacent, or are neighbors of a vertex w ordered after both of them, and have the same color.
+		After TriangularColoring(), which replaces the graph by the induced graph and colors it with DistanceOneColoring(),
+		a pair is in violation if u and v are adjacent in the induced graph and have the same color.
+		Return the number of pairs in violation, i.e. 0 if the coloring is a valid triangular coloring.
+		*/
+		int CheckTriangularColoring(vector< pair<int, int> > & vpii_ConflictedEdges);
+
 		//Public Function 1467
 		string GetVertexColoringVariant();
 		void SetVertexColoringVariant(string s_VertexColoringVariant);
@@ -344,8 +646,30 @@ namespace ColPack
 
 		//Public Function 1469
 		void GetVertexColors(vector<int> &output);
+
+		//Public Function 1491
+		/// Take the colors of a coloring computed elsewhere (e.g. SMPGCColoring::export_coloring()); a color is in [0, number of colors), the number of colors is their maximum plus one
+		int SetVertexColors(const vector<int> & vi_VertexColors, string s_VertexColoringVariant);
 		vector <int>* GetVertexColorsPtr(){ return &m_vi_VertexColors; }
 
+		//Public Function 1494
+		/// Apply a batch of edge deletions and insertions to the colored graph (see UpdateEdges()) and recolor only the vertices in violation
+		/**
+		 * s_ColoringVariant is the kind of the current coloring: DISTANCE_ONE, DISTANCE_TWO or STAR (any star variant).
+		 * Deleting edges never breaks these colorings, so only the end points of the new edges are checked:
+		 * the ones whose color is now forbidden lose it, then they and the new vertices are colored first fit, in that order.
+		 * The other vertices keep their colors and the number of colors only grows if a recolored vertex needs a new one.
+		 * The vertex ordering is kept, the new vertices are appended to it.
+		 * Return the number of recolored vertices, or _UNKNOWN if the graph is not colored or the update is rejected.
+		 */
+		int UpdateColoring(const vector< pair<int, int> > & vpii_InsertedEdges, const vector< pair<int, int> > & vpii_DeletedEdges, string s_ColoringVariant = "DISTANCE_ONE");
+
+		//Public Function 1493
+		/// The buffers reused by DistanceOneColoring(), DistanceTwoColoring(), NaiveStarColoring(), RestrictedStarColoring(), StarColoring() and AcyclicColoring()
+		ColoringWorkspace& GetColoringWorkspace(){ return m_ws_Workspace; }
+		/// Free the memory held by the coloring workspace; the next coloring allocates it again
+		void ReleaseColoringWorkspace(){ m_ws_Workspace.Release(); }
+
 		//Public Function 1470
 		int GetHubCount();
 
@@ -374,6 +698,10 @@ namespace ColPack
 		void PrintVertexColorClasses();
 
                 int D1_Coloring_OMP();
+
+	protected:
+
+		ColoringWorkspace m_ws_Workspace;
 	};
 }
 #endif
@@ -100,10 +100,16 @@ namespace ColPack
 		m_T_Timer.Start();
 
 		if(s_ColoringVariant == "DISTANCE_ONE") DistanceOneColoring();
+		else if (s_ColoringVariant == "DISTANCE_ONE_BALANCED") DistanceOneColoring_Balanced();
 		else if (s_ColoringVariant == "ACYCLIC") AcyclicColoring();
+		else if (s_ColoringVariant == "ACYCLIC_OMP") AcyclicColoring_OMP();
 		else if (s_ColoringVariant == "STAR") StarColoring();
+		else if (s_ColoringVariant == "STAR_OMP") StarColoring_OMP();
 		else if (s_ColoringVariant == "RESTRICTED_STAR") RestrictedStarColoring();
+		else if (s_ColoringVariant == "RESTRICTED_STAR_OMP") RestrictedStarColoring_OMP();
+		else if (s_ColoringVariant == "NAIVE_STAR_OMP") NaiveStarColoring_OMP();
 		else if (s_ColoringVariant == "DISTANCE_TWO") DistanceTwoColoring();
+		else if (s_ColoringVariant == "TRIANGULAR_OMP") TriangularColoring_OMP();
 		else {
 			cerr<<endl<<"*ERROR: Unknown Coloring Method "<<s_ColoringVariant<<". Please use a legal Coloring Method."<<endl;
 			return;
@@ -146,6 +152,37 @@ namespace ColPack
 		return;
 	}
 
+	//Public Function 1611
+	int GraphColoringInterface::DistanceOneColoring_Balanced(string s_OrderingVariant)
+	{
+		m_T_Timer.Start();
+
+		int i_OrderingStatus = OrderVertices(s_OrderingVariant);
+
+		m_T_Timer.Stop();
+
+		m_d_OrderingTime = m_T_Timer.GetWallTime();
+
+		if(i_OrderingStatus != _TRUE)
+		{
+			cerr<<endl;
+			cerr<<s_OrderingVariant<<" Ordering Failed";
+			cerr<<endl;
+
+			return(1);
+		}
+
+		m_T_Timer.Start();
+
+		int i_ColoringStatus = GraphColoring::DistanceOneColoring_Balanced();
+
+		m_T_Timer.Stop();
+
+		m_d_ColoringTime = m_T_Timer.GetWallTime();
+
+		return(i_ColoringStatus);
+	}
+
         //Public Function ????
 	int GraphColoringInterface::DistanceOneColoring_OMP(string s_OrderingVariant)
 	{
@@ -301,6 +338,68 @@ namespace ColPack
 		return(i_ColoringStatus);
 	}
 
+	//Public Function 1614
+	int GraphColoringInterface::RestrictedStarColoring_OMP(string s_OrderingVariant)
+	{
+		m_T_Timer.Start();
+
+		int i_OrderingVariant = OrderVertices(s_OrderingVariant);
+
+		m_T_Timer.Stop();
+
+		m_d_OrderingTime = m_T_Timer.GetWallTime();
+
+		if(i_OrderingVariant != _TRUE)
+		{
+			cerr<<endl;
+			cerr<<s_OrderingVariant<<" Ordering Failed";
+			cerr<<endl;
+
+			return(_TRUE);
+		}
+
+		m_T_Timer.Start();
+
+		int i_ColoringStatus = GraphColoring::RestrictedStarColoring_OMP();
+
+		m_T_Timer.Stop();
+
+		m_d_ColoringTime = m_T_Timer.GetWallTime();
+
+		return(i_ColoringStatus);
+	}
+
+	//Public Function 1613
+	int GraphColoringInterface::NaiveStarColoring_OMP(string s_OrderingVariant)
+	{
+		m_T_Timer.Start();
+
+		int i_OrderingVariant = OrderVertices(s_OrderingVariant);
+
+		m_T_Timer.Stop();
+
+		m_d_OrderingTime = m_T_Timer.GetWallTime();
+
+		if(i_OrderingVariant != _TRUE)
+		{
+			cerr<<endl;
+			cerr<<s_OrderingVariant<<" Ordering Failed";
+			cerr<<endl;
+
+			return(_TRUE);
+		}
+
+		m_T_Timer.Start();
+
+		int i_ColoringStatus = GraphColoring::NaiveStarColoring_OMP();
+
+		m_T_Timer.Stop();
+
+		m_d_ColoringTime = m_T_Timer.GetWallTime();
+
+		return(i_ColoringStatus);
+	}
+
 	//Public Function 1608
 	int GraphColoringInterface::StarColoring(string s_OrderingVariant)
 	{
@@ -332,6 +431,36 @@ namespace ColPack
 		return(i_ColoringStatus);
 	}
 
+	int GraphColoringInterface::StarColoring_OMP(string s_OrderingVariant)
+	{
+		m_T_Timer.Start();
+
+		int i_OrderingStatus = OrderVertices(s_OrderingVariant);
+
+		m_T_Timer.Stop();
+
+		m_d_OrderingTime = m_T_Timer.GetWallTime();
+
+		if(i_OrderingStatus != _TRUE)
+		{
+			cerr<<endl;
+			cerr<<s_OrderingVariant<<" Ordering Failed";
+			cerr<<endl;
+
+			return(1);
+		}
+
+		m_T_Timer.Start();
+
+		int i_ColoringStatus = GraphColoring::StarColoring_OMP();
+
+		m_T_Timer.Stop();
+
+		m_d_ColoringTime = m_T_Timer.GetWallTime();
+
+		return(i_ColoringStatus);
+	}
+
 	//Public Function 1609
 	int GraphColoringInterface::AcyclicColoring_ForIndirectRecovery(string s_OrderingVariant)
 	{
@@ -363,6 +492,36 @@ namespace ColPack
 		return(i_ColoringStatus);
 	}
 
+	int GraphColoringInterface::AcyclicColoring_OMP(string s_OrderingVariant)
+	{
+		m_T_Timer.Start();
+
+		int i_OrderingStatus = OrderVertices(s_OrderingVariant);
+
+		m_T_Timer.Stop();
+
+		m_d_OrderingTime = m_T_Timer.GetWallTime();
+
+		if(i_OrderingStatus != _TRUE)
+		{
+			cerr<<endl;
+			cerr<<s_OrderingVariant<<" Ordering Failed";
+			cerr<<endl;
+
+			return(1);
+		}
+
+		m_T_Timer.Start();
+
+		int i_ColoringStatus = GraphColoring::AcyclicColoring_OMP();
+
+		m_T_Timer.Stop();
+
+		m_d_ColoringTime = m_T_Timer.GetWallTime();
+
+		return(i_ColoringStatus);
+	}
+
 	//Public Function 1609
 	int GraphColoringInterface::AcyclicColoring(string s_OrderingVariant)
 	{
@@ -425,6 +584,36 @@ namespace ColPack
 		return(i_ColoringStatus);
 	}
 
+	int GraphColoringInterface::TriangularColoring_OMP(string s_OrderingVariant)
+	{
+		m_T_Timer.Start();
+
+		int i_OrderingStatus = OrderVertices(s_OrderingVariant);
+
+		m_T_Timer.Stop();
+
+		m_d_OrderingTime = m_T_Timer.GetWallTime();
+
+		if(i_OrderingStatus != _TRUE)
+		{
+			cerr<<endl;
+			cerr<<s_OrderingVariant<<" Ordering Failed";
+			cerr<<endl;
+
+			return(1);
+		}
+
+		m_T_Timer.Start();
+
+		int i_ColoringStatus = GraphColoring::TriangularColoring_OMP();
+
+		m_T_Timer.Stop();
+
+		m_d_ColoringTime = m_T_Timer.GetWallTime();
+
+		return(i_ColoringStatus);
+	}
+
 
 	//void GraphColoringInterface::GenerateSeedHessian(unsigned int ** uip2_HessianSparsityPattern, int i_RowCount, double*** dp3_seed, int *ip1_SeedRowCount, int *ip1_SeedColumnCount, string s_OrderingVariant, string s_ColoringVariant) {
 	void GraphColoringInterface::GenerateSeedHessian(double*** dp3_seed, int *ip1_SeedRowCount, int *ip1_SeedColumnCount, string s_OrderingVariant, string s_ColoringVariant) {
@@ -439,8 +628,12 @@ namespace ColPack
 		//Color the bipartite graph with the specified ordering
 		if (s_ColoringVariant=="DISTANCE_TWO"
 			|| s_ColoringVariant=="RESTRICTED_STAR"
+			|| s_ColoringVariant=="RESTRICTED_STAR_OMP"
+			|| s_ColoringVariant=="NAIVE_STAR_OMP"
 			|| s_ColoringVariant=="STAR"
-			|| s_ColoringVariant=="ACYCLIC_FOR_INDIRECT_RECOVERY")
+			|| s_ColoringVariant=="STAR_OMP"
+			|| s_ColoringVariant=="ACYCLIC_FOR_INDIRECT_RECOVERY"
+			|| s_ColoringVariant=="ACYCLIC_OMP")
 		{
 			Coloring(s_OrderingVariant, s_ColoringVariant);
 		}
@@ -473,8 +666,12 @@ namespace ColPack
 		//Color the bipartite graph with the specified ordering
 		if (s_ColoringVariant=="DISTANCE_TWO"
 			|| s_ColoringVariant=="RESTRICTED_STAR"
+			|| s_ColoringVariant=="RESTRICTED_STAR_OMP"
+			|| s_ColoringVariant=="NAIVE_STAR_OMP"
 			|| s_ColoringVariant=="STAR"
-			|| s_ColoringVariant=="ACYCLIC_FOR_INDIRECT_RECOVERY")
+			|| s_ColoringVariant=="STAR_OMP"
+			|| s_ColoringVariant=="ACYCLIC_FOR_INDIRECT_RECOVERY"
+			|| s_ColoringVariant=="ACYCLIC_OMP")
 		{
 			Coloring(s_OrderingVariant, s_ColoringVariant);
 		}
@@ -556,14 +753,26 @@ namespace ColPack
 			return AcyclicColoring(s_OrderingVariant);
 		} else if (s_ColoringVariant == "ACYCLIC_FOR_INDIRECT_RECOVERY") {
 			return AcyclicColoring_ForIndirectRecovery(s_OrderingVariant);
+		} else if (s_ColoringVariant == "ACYCLIC_OMP") {
+			return AcyclicColoring_OMP(s_OrderingVariant);
 		} else if (s_ColoringVariant == "STAR") {
 			return StarColoring(s_OrderingVariant);
+		} else if (s_ColoringVariant == "STAR_OMP") {
+			return StarColoring_OMP(s_OrderingVariant);
 		} else if (s_ColoringVariant == "RESTRICTED_STAR") {
 			return RestrictedStarColoring(s_OrderingVariant);
+		} else if (s_ColoringVariant == "RESTRICTED_STAR_OMP") {
+			return RestrictedStarColoring_OMP(s_OrderingVariant);
+		} else if (s_ColoringVariant == "NAIVE_STAR_OMP") {
+			return NaiveStarColoring_OMP(s_OrderingVariant);
 		} else if (s_ColoringVariant == "DISTANCE_TWO") {
 			return DistanceTwoColoring(s_OrderingVariant);
+		} else if (s_ColoringVariant == "TRIANGULAR_OMP") {
+			return TriangularColoring_OMP(s_OrderingVariant);
 		} else if (s_ColoringVariant == "DISTANCE_ONE_OMP") {
 			return DistanceOneColoring_OMP(s_OrderingVariant);
+		} else if (s_ColoringVariant == "DISTANCE_ONE_BALANCED") {
+			return DistanceOneColoring_Balanced(s_OrderingVariant);
 		} else {
 			cout<<" Unknown Coloring Method "<<s_ColoringVariant<<". Please use a legal Coloring Method."<<endl;
 			return (_FALSE);
@@ -574,4 +783,176 @@ namespace ColPack
 	int GraphColoringInterface::GetVertexColorCount(){
 		return GraphColoring::GetVertexColorCount();
 	}
+
+	// Wall clock used for the time budget of ColorBest()
+	static double PortfolioWallTime() {
+#ifdef _OPENMP
+		return omp_get_wtime();
+#else
+		return (double) clock() / CLOCKS_PER_SEC;
+#endif
+	}
+
+	// Fisher-Yates shuffle of vi_Vertices driven by a splitmix64 sequence started at ull_Seed (rand() is shared by the threads)
+	static void ShuffleVertices(vector<int> & vi_Vertices, unsigned long long ull_Seed) {
+		for(int i = (signed) vi_Vertices.size() - 1; i > 0; i--) {
+			unsigned long long z = (ull_Seed += 0x9E3779B97F4A7C15ULL);
+			z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+			z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+			z = z ^ (z >> 31);
+			swap(vi_Vertices[i], vi_Vertices[(int)(z % (unsigned long long)(i + 1))]);
+		}
+	}
+
+	//Public Function 1612
+	int GraphColoringInterface::ColorBest(vector<string> vs_OrderingVariants, string s_ColoringVariant, int i_NumThreads, double d_TimeBudget, vector<int>* vi_ColorCounts)
+	{
+		if(vs_OrderingVariants.empty()) {
+			vs_OrderingVariants.push_back("NATURAL");
+			vs_OrderingVariants.push_back("LARGEST_FIRST");
+			vs_OrderingVariants.push_back("SMALLEST_LAST");
+			vs_OrderingVariants.push_back("DYNAMIC_LARGEST_FIRST");
+			vs_OrderingVariants.push_back("RANDOM:1");
+			vs_OrderingVariants.push_back("RANDOM:2");
+			vs_OrderingVariants.push_back("RANDOM:3");
+			vs_OrderingVariants.push_back("RANDOM:4");
+		}
+		int i_VariantCount = (signed) vs_OrderingVariants.size();
+
+		// "RANDOM" is "RANDOM:<k>" for the k-th RANDOM of the list
+		vector<long long> vll_Seeds(i_VariantCount, -1);
+		int i_RandomCount = 0;
+		for(int i=0; i<i_VariantCount; i++) {
+			vs_OrderingVariants[i] = toUpper(vs_OrderingVariants[i]);
+			if(vs_OrderingVariants[i] == "RANDOM") {
+				vll_Seeds[i] = ++i_RandomCount;
+				vs_OrderingVariants[i] += ":" + itoa((int) vll_Seeds[i]);
+			}
+			else if(vs_OrderingVariants[i].compare(0, 7, "RANDOM:") == 0) {
+				vll_Seeds[i] = atoll(vs_OrderingVariants[i].c_str() + 7);
+				i_RandomCount++;
+			}
+		}
+
+		int i_MaxNumThreads;
+#ifdef _OPENMP
+		i_MaxNumThreads = (i_NumThreads > 0) ? i_NumThreads : omp_get_max_threads();
+#else
+		i_MaxNumThreads = 1;
+#endif
+		if(i_MaxNumThreads > i_VariantCount) i_MaxNumThreads = i_VariantCount;
+
+		vector<int> vi_Counts(i_VariantCount, _UNKNOWN);
+
+		// best coloring found by each thread, taken from its worker by swap
+		vector<int> vi_BestVariant_Private(i_MaxNumThreads, _UNKNOWN);
+		vector<int>* vi_BestColors_Private = new vector<int>[i_MaxNumThreads];
+		vector<int>* vi_BestOrdering_Private = new vector<int>[i_MaxNumThreads];
+		vector<int> vi_BestUnits_Private(i_MaxNumThreads, _UNKNOWN);
+		vector<double> vd_BestOrderingTime_Private(i_MaxNumThreads, _UNKNOWN);
+		vector<double> vd_BestColoringTime_Private(i_MaxNumThreads, _UNKNOWN);
+		map< int, map<int, int> >* mimi2_BestVertexEdgeMap_Private = new map< int, map<int, int> >[i_MaxNumThreads];
+		DisjointSets* ds_BestDisjointSets_Private = new DisjointSets[i_MaxNumThreads];
+
+		int i_NextVariant = 0;
+		double d_StartTime = PortfolioWallTime();
+
+#ifdef _OPENMP
+		#pragma omp parallel num_threads(i_MaxNumThreads)
+#endif
+		{
+			int i_thread_num;
+#ifdef _OPENMP
+			i_thread_num = omp_get_thread_num();
+#else
+			i_thread_num = 0;
+#endif
+			// each thread colors its own copy of the graph, the graph of this object is only read
+			GraphColoringInterface g_Worker(SRC_WAIT);
+			g_Worker.BuildGraphFromCSRFormat(m_vi_Vertices, m_vi_Edges);
+
+			while(true) {
+				int i_Variant;
+#ifdef _OPENMP
+				#pragma omp atomic capture
+#endif
+				i_Variant = i_NextVariant++;
+				if(i_Variant >= i_VariantCount) break;
+				// the first variant always runs
+				if(i_Variant > 0 && d_TimeBudget > 0 && PortfolioWallTime() - d_StartTime >= d_TimeBudget) break;
+
+				string s_OrderingVariant = vs_OrderingVariants[i_Variant];
+				if(vll_Seeds[i_Variant] >= 0) {
+					// picked up as already done by RandomOrdering()
+					g_Worker.m_vi_OrderedVertices.resize((unsigned) g_Worker.GetVertexCount());
+					for(int i=0; i<(signed) g_Worker.m_vi_OrderedVertices.size(); i++) g_Worker.m_vi_OrderedVertices[i] = i;
+					ShuffleVertices(g_Worker.m_vi_OrderedVertices, (unsigned long long) vll_Seeds[i_Variant]);
+					g_Worker.m_s_VertexOrderingVariant = "RANDOM";
+					s_OrderingVariant = "RANDOM";
+				}
+
+				if(g_Worker.Coloring(s_OrderingVariant, s_ColoringVariant) != _TRUE) continue;
+
+				int i_ColorCount = g_Worker.GetVertexColorCount();
+				vi_Counts[i_Variant] = i_ColorCount;
+
+				int i_Best = vi_BestVariant_Private[i_thread_num];
+				if(i_Best != _UNKNOWN && (vi_Counts[i_Best] < i_ColorCount || (vi_Counts[i_Best] == i_ColorCount && i_Best < i_Variant))) continue;
+
+				vi_BestVariant_Private[i_thread_num] = i_Variant;
+				vi_BestColors_Private[i_thread_num].swap(g_Worker.m_vi_VertexColors);
+				vi_BestOrdering_Private[i_thread_num].swap(g_Worker.m_vi_OrderedVertices);
+				g_Worker.m_s_VertexOrderingVariant.clear();
+				vi_BestUnits_Private[i_thread_num] = g_Worker.m_i_ColoringUnits;
+				vd_BestOrderingTime_Private[i_thread_num] = g_Worker.m_d_OrderingTime;
+				vd_BestColoringTime_Private[i_thread_num] = g_Worker.m_d_ColoringTime;
+				// needed by the Hessian recovery routines
+				if(s_ColoringVariant == "ACYCLIC_FOR_INDIRECT_RECOVERY" || s_ColoringVariant == "ACYCLIC_OMP") {
+					mimi2_BestVertexEdgeMap_Private[i_thread_num].swap(g_Worker.m_mimi2_VertexEdgeMap);
+					ds_BestDisjointSets_Private[i_thread_num] = g_Worker.m_ds_DisjointSets;
+				}
+			}
+		}
+
+		int i_BestThread = _UNKNOWN;
+		for(int i=0; i<i_MaxNumThreads; i++) {
+			int i_Variant = vi_BestVariant_Private[i];
+			if(i_Variant == _UNKNOWN) continue;
+			if(i_BestThread == _UNKNOWN) {
+				i_BestThread = i;
+				continue;
+			}
+			int i_Best = vi_BestVariant_Private[i_BestThread];
+			if(vi_Counts[i_Variant] < vi_Counts[i_Best] || (vi_Counts[i_Variant] == vi_Counts[i_Best] && i_Variant < i_Best)) i_BestThread = i;
+		}
+
+		int i_ColoringStatus = _FALSE;
+		if(i_BestThread != _UNKNOWN) {
+			int i_Best = vi_BestVariant_Private[i_BestThread];
+			Seed_reset();
+			m_vi_VertexColors.swap(vi_BestColors_Private[i_BestThread]);
+			m_vi_OrderedVertices.swap(vi_BestOrdering_Private[i_BestThread]);
+			m_i_VertexColorCount = STEP_DOWN(vi_Counts[i_Best]);
+			m_i_ColoringUnits = vi_BestUnits_Private[i_BestThread];
+			m_s_VertexColoringVariant = s_ColoringVariant;
+			// "RANDOM:<seed>" so that a later OrderVertices("RANDOM") does not take this ordering as its own
+			m_s_VertexOrderingVariant = vs_OrderingVariants[i_Best];
+			m_d_OrderingTime = vd_BestOrderingTime_Private[i_BestThread];
+			m_d_ColoringTime = vd_BestColoringTime_Private[i_BestThread];
+			if(s_ColoringVariant == "ACYCLIC_FOR_INDIRECT_RECOVERY" || s_ColoringVariant == "ACYCLIC_OMP") {
+				m_mimi2_VertexEdgeMap.swap(mimi2_BestVertexEdgeMap_Private[i_BestThread]);
+				m_ds_DisjointSets = ds_BestDisjointSets_Private[i_BestThread];
+			}
+			i_ColoringStatus = _TRUE;
+		}
+
+		if(vi_ColorCounts != NULL) (*vi_ColorCounts) = vi_Counts;
+
+		delete[] vi_BestColors_Private;
+		delete[] vi_BestOrdering_Private;
+		delete[] mimi2_BestVertexEdgeMap_Private;
+		delete[] ds_BestDisjointSets_Private;
+
+		return(i_ColoringStatus);
+	}
 }
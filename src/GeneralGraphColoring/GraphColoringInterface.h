@@ -75,17 +75,42 @@ namespace ColPack
 			- "RANDOM"
 		- s_ColoringVariant can be either
 			- "DISTANCE_ONE" (default)
+			- "DISTANCE_ONE_BALANCED" (least used color selection plus a rebalancing pass, see SetColorBalanceTolerance())
 			- "ACYCLIC"
 			- "ACYCLIC_FOR_INDIRECT_RECOVERY"
+			- "ACYCLIC_OMP" (speculative parallel acyclic coloring, can be used for indirect recovery)
 			- "STAR"
+			- "STAR_OMP" (speculative parallel star coloring, same as "STAR" with one OpenMP thread)
 			- "RESTRICTED_STAR"
+			- "RESTRICTED_STAR_OMP" (speculative parallel restricted star coloring)
+			- "NAIVE_STAR_OMP" (speculative parallel naive star coloring)
 			- "DISTANCE_TWO"
+			- "TRIANGULAR_OMP" (speculative parallel triangular coloring of the graph itself, see GraphColoring::ModifiedTriangularColoring())
 
 		Postcondition:
 		- The Graph is colored, i.e., m_vi_VertexColors will be populated.
 		*/
 		int Coloring(string s_OrderingVariant = "NATURAL", string s_ColoringVariant = "DISTANCE_ONE");
 
+		//Public Function 1612
+		/// Color the graph with every ordering of vs_OrderingVariants, i_NumThreads of them at a time, and keep the coloring with the fewest colors
+		/** Each thread colors a private copy of the graph (built once per thread) with Coloring(); this object's graph is only read.
+		The coloring, ordering, times (and, for "ACYCLIC_FOR_INDIRECT_RECOVERY"/"ACYCLIC_OMP", the data used by the recovery) of the winner
+		are moved to this object; ties go to the ordering listed first. GetVertexOrderingVariant() names the winner.
+
+		About input parameters:
+		- vs_OrderingVariants: any ordering accepted by Coloring(). "RANDOM:<seed>" is a random ordering with that seed, a plain
+		  "RANDOM" is "RANDOM:<k>" for the k-th RANDOM of the list. An empty list is NATURAL, LARGEST_FIRST, SMALLEST_LAST,
+		  DYNAMIC_LARGEST_FIRST and RANDOM with the seeds 1 to 4.
+		- s_ColoringVariant: any coloring accepted by Coloring(). The OpenMP variants run with one thread each inside the portfolio.
+		- i_NumThreads: number of orderings colored concurrently, <= 0 for omp_get_max_threads()
+		- d_TimeBudget: in seconds, <= 0 for no limit. No ordering is started after the budget is spent (the first one always runs).
+		- vi_ColorCounts: if not NULL, gets the number of colors of every ordering, _UNKNOWN (-1) for the ones not run
+
+		Return _TRUE, or _FALSE if no ordering could be colored.
+		*/
+		int ColorBest(vector<string> vs_OrderingVariants = vector<string>(), string s_ColoringVariant = "DISTANCE_ONE", int i_NumThreads = 0, double d_TimeBudget = 0, vector<int>* vi_ColorCounts = NULL);
+
 		/// Generate and return the seed matrix (OpenMP enabled for STAR coloring)
 		/**	This function will
 		- 1. Color the graph based on the specified ordering and coloring
@@ -94,8 +119,12 @@ namespace ColPack
 		About input parameters:
 		- s_ColoringVariant can be either
 			- "STAR" (default)
+			- "STAR_OMP"
 			- "RESTRICTED_STAR"
+			- "RESTRICTED_STAR_OMP"
+			- "NAIVE_STAR_OMP"
 			- "ACYCLIC_FOR_INDIRECT_RECOVERY"
+			- "ACYCLIC_OMP"
 		- s_OrderingVariant can be either
 			- "NATURAL" (default)
 			- "LARGEST_FIRST"
@@ -135,25 +164,37 @@ namespace ColPack
 		int DistanceOneColoring(string s_OrderingVariant);
 		int DistanceOneColoring_OMP(string s_OrderingVariant);
 
+		//Public Function 1611
+		int DistanceOneColoring_Balanced(string s_OrderingVariant);
+
 		//Public Function 1605
 		int DistanceTwoColoring(string s_OrderingVariant);
 
 		//Public Function 1606
 		int NaiveStarColoring(string s_OrderingVariant);
 
+		//Public Function 1613
+		int NaiveStarColoring_OMP(string s_OrderingVariant);
+
 		//Public Function 1607
 		int RestrictedStarColoring(string s_OrderingVariant);
 
+		//Public Function 1614
+		int RestrictedStarColoring_OMP(string s_OrderingVariant);
+
 		//Public Function 1608
 		int StarColoring(string s_OrderingVariant);
+		int StarColoring_OMP(string s_OrderingVariant);
 
 		//Public Function 1609
 		int AcyclicColoring(string s_OrderingVariant);
 
 		int AcyclicColoring_ForIndirectRecovery(string s_OrderingVariant);
+		int AcyclicColoring_OMP(string s_OrderingVariant);
 
 		//Public Function 1610
 		int TriangularColoring(string s_OrderingVariant);
+		int TriangularColoring_OMP(string s_OrderingVariant);
 
 		int GetVertexColorCount();
 
@@ -1298,6 +1298,160 @@ namespace ColPack
 	  return(i_HighestDegree);
 	}
 
+	int GraphInputOutput::BuildGraphFromCSRFormat(const vector<int> & vi_ia, const vector<int> & vi_ja) {
+	  int i_RowCount = vi_ia.empty() ? 0 : STEP_DOWN((signed) vi_ia.size());
+
+	  int i_HighestDegree = _UNKNOWN;
+
+	  m_vi_Vertices.clear();
+	  m_vi_Vertices.reserve(STEP_UP(i_RowCount));
+	  m_vi_Vertices.push_back(_FALSE);
+
+	  m_vi_Edges.clear();
+	  m_vi_Edges.reserve(vi_ja.size());
+
+	  for(int i=0; i<i_RowCount; i++)
+	    {
+	      for(int j=vi_ia[i]; j<vi_ia[STEP_UP(i)]; j++)
+		{
+		  if(vi_ja[j] != i) m_vi_Edges.push_back(vi_ja[j]);
+		}
+
+	      m_vi_Vertices.push_back((signed) m_vi_Edges.size());
+
+	      if(i_HighestDegree < m_vi_Vertices[STEP_UP(i)] - m_vi_Vertices[i]) i_HighestDegree = m_vi_Vertices[STEP_UP(i)] - m_vi_Vertices[i];
+	    }
+
+	  CalculateVertexDegrees();
+
+	  return(i_HighestDegree);
+	}
+
+	int GraphInputOutput::UpdateEdges(const vector< pair<int, int> > & vpii_InsertedEdges, const vector< pair<int, int> > & vpii_DeletedEdges, vector<int> & vi_NewEdgeEndPoints) {
+	  int i_OldVertexCount = m_vi_Vertices.empty() ? 0 : STEP_DOWN((signed) m_vi_Vertices.size());
+	  int i_VertexCount = i_OldVertexCount;
+
+	  vi_NewEdgeEndPoints.clear();
+
+	  for(size_t i=0; i<vpii_InsertedEdges.size(); i++)
+	    {
+	      if(vpii_InsertedEdges[i].first < 0 || vpii_InsertedEdges[i].second < 0)
+		{
+		  cerr<<endl<<"*ERROR: UpdateEdges(): negative vertex in the inserted edge ("<<vpii_InsertedEdges[i].first<<", "<<vpii_InsertedEdges[i].second<<")"<<endl;
+
+		  return(_UNKNOWN);
+		}
+
+	      if(i_VertexCount <= vpii_InsertedEdges[i].first) i_VertexCount = STEP_UP(vpii_InsertedEdges[i].first);
+	      if(i_VertexCount <= vpii_InsertedEdges[i].second) i_VertexCount = STEP_UP(vpii_InsertedEdges[i].second);
+	    }
+
+	  // both directions of every edge, bucketed by their first end point
+	  vector<int> vi_InsertedBegin(STEP_UP(i_VertexCount), _FALSE), vi_DeletedBegin(STEP_UP(i_VertexCount), _FALSE);
+	  vector<int> vi_Inserted(2 * vpii_InsertedEdges.size()), vi_Deleted(2 * vpii_DeletedEdges.size());
+
+	  for(int i_Pass=0; i_Pass<2; i_Pass++)
+	    {
+	      for(size_t i=0; i<vpii_InsertedEdges.size(); i++)
+		{
+		  int u = vpii_InsertedEdges[i].first, v = vpii_InsertedEdges[i].second;
+		  if(u == v) continue;
+		  if(i_Pass == 0) { vi_InsertedBegin[STEP_UP(u)]++; vi_InsertedBegin[STEP_UP(v)]++; }
+		  else { vi_Inserted[vi_InsertedBegin[u]++] = v; vi_Inserted[vi_InsertedBegin[v]++] = u; }
+		}
+
+	      for(size_t i=0; i<vpii_DeletedEdges.size(); i++)
+		{
+		  int u = vpii_DeletedEdges[i].first, v = vpii_DeletedEdges[i].second;
+		  if(u == v || u < 0 || v < 0 || u >= i_OldVertexCount || v >= i_OldVertexCount) continue;
+		  if(i_Pass == 0) { vi_DeletedBegin[STEP_UP(u)]++; vi_DeletedBegin[STEP_UP(v)]++; }
+		  else { vi_Deleted[vi_DeletedBegin[u]++] = v; vi_Deleted[vi_DeletedBegin[v]++] = u; }
+		}
+
+	      if(i_Pass == 0)
+		{
+		  for(int i=0; i<i_VertexCount; i++)
+		    {
+		      vi_InsertedBegin[STEP_UP(i)] += vi_InsertedBegin[i];
+		      vi_DeletedBegin[STEP_UP(i)] += vi_DeletedBegin[i];
+		    }
+		}
+	      else
+		{
+		  // the fill moved every begin one bucket up
+		  for(int i=i_VertexCount; i>0; i--)
+		    {
+		      vi_InsertedBegin[i] = vi_InsertedBegin[STEP_DOWN(i)];
+		      vi_DeletedBegin[i] = vi_DeletedBegin[STEP_DOWN(i)];
+		    }
+		  vi_InsertedBegin[0] = vi_DeletedBegin[0] = _FALSE;
+		}
+	    }
+
+	  bool b_HasValues = !m_vd_Values.empty() && m_vd_Values.size() == m_vi_Edges.size();
+
+	  vector<int> vi_Vertices, vi_Edges;
+	  vector<double> vd_Values;
+	  vi_Vertices.reserve(STEP_UP(i_VertexCount));
+	  vi_Vertices.push_back(_FALSE);
+	  vi_Edges.reserve(m_vi_Edges.size() + vi_Inserted.size());
+	  if(b_HasValues) vd_Values.reserve(m_vi_Edges.size() + vi_Inserted.size());
+
+	  // vi_Mark[w] == 3*i: the edge i-w is to be deleted, vi_Mark[w] == 3*i+1: the edge i-w is in the new graph,
+	  // vi_Mark[w] == 3*i+2: the edge i-w was in the graph and has been deleted
+	  vector<int> vi_Mark(i_VertexCount, _UNKNOWN);
+
+	  for(int i=0; i<i_VertexCount; i++)
+	    {
+	      bool b_NewEdge = false;
+
+	      for(int j=vi_DeletedBegin[i]; j<vi_DeletedBegin[STEP_UP(i)]; j++) vi_Mark[vi_Deleted[j]] = 3 * i;
+
+	      if(i < i_OldVertexCount)
+		{
+		  for(int j=m_vi_Vertices[i]; j<m_vi_Vertices[STEP_UP(i)]; j++)
+		    {
+		      int w = m_vi_Edges[j];
+		      if(vi_Mark[w] == 3 * i) { vi_Mark[w] = 3 * i + 2; continue; }
+		      if(vi_Mark[w] == 3 * i + 1 || vi_Mark[w] == 3 * i + 2) continue;
+		      vi_Mark[w] = 3 * i + 1;
+		      vi_Edges.push_back(w);
+		      if(b_HasValues) vd_Values.push_back(m_vd_Values[j]);
+		    }
+		}
+
+	      for(int j=vi_InsertedBegin[i]; j<vi_InsertedBegin[STEP_UP(i)]; j++)
+		{
+		  int w = vi_Inserted[j];
+		  if(vi_Mark[w] == 3 * i + 1) continue;
+		  // an edge of the graph deleted and inserted again in the same batch is not new,
+		  // an edge deleted while not in the graph and then inserted is
+		  if(vi_Mark[w] != 3 * i + 2) b_NewEdge = true;
+		  vi_Mark[w] = 3 * i + 1;
+		  vi_Edges.push_back(w);
+		  if(b_HasValues) vd_Values.push_back(0.);
+		}
+
+	      if(b_NewEdge) vi_NewEdgeEndPoints.push_back(i);
+
+	      vi_Vertices.push_back((signed) vi_Edges.size());
+	    }
+
+	  m_vi_Vertices.swap(vi_Vertices);
+	  m_vi_Edges.swap(vi_Edges);
+	  if(b_HasValues) m_vd_Values.swap(vd_Values);
+
+	  // the edge numbering of the map is no longer valid
+	  m_mimi2_VertexEdgeMap.clear();
+
+	  m_i_MaximumVertexDegree = _UNKNOWN;
+	  m_i_MinimumVertexDegree = _UNKNOWN;
+
+	  CalculateVertexDegrees();
+
+	  return(m_i_MaximumVertexDegree);
+	}
+
 	int GraphInputOutput::ReadAdjacencyGraph(string s_InputFile, string s_fileFormat)
 	{
 		if (s_fileFormat == "AUTO_DETECTED" || s_fileFormat == "") {
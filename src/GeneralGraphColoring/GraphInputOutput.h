@@ -32,6 +32,25 @@ namespace ColPack
 		*/
 		int BuildGraphFromRowCompressedFormat(unsigned int ** uip2_HessianSparsityPattern, int i_RowCount);
 
+		/// Build the adjacency graph of a symmetric pattern given in CSR arrays (row pointers vi_ia, column indices vi_ja), the diagonal is removed.
+		/**
+		Return value:
+		- i_HighestDegree
+		*/
+		int BuildGraphFromCSRFormat(const vector<int> & vi_ia, const vector<int> & vi_ja);
+
+		/// Delete then insert a batch of undirected edges (u, v) in the adjacency graph, in O(|V| + |E| + batch size)
+		/**
+		A vertex index past the last vertex adds vertices, self loops and deletions of missing edges are ignored.
+		The remaining neighbors keep their order and the inserted ones are appended; inserted edges get the value 0 when the graph has values.
+		Postcondition:
+		- vi_NewEdgeEndPoints holds, in increasing order, the end points of the edges that were not in the graph before
+
+		Return value:
+		- i_HighestDegree, or _UNKNOWN if an edge has a negative end point
+		*/
+		int UpdateEdges(const vector< pair<int, int> > & vpii_InsertedEdges, const vector< pair<int, int> > & vpii_DeletedEdges, vector<int> & vi_NewEdgeEndPoints);
+
 		/// Read the sparsity pattern of a symmetric matrix in the specified file format from the specified filename and build an adjacency  graph.
 		/**	This function will
 		- 1. Read the name of the matrix file and decide which matrix format the file used (based on the file extension). If the file name has no extension, the user will need to pass the 2nd parameter "fileType" explicitly to tell ColPack which matrix format is used
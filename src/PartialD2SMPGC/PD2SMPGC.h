@@ -0,0 +1,62 @@
+/******************************************************************************
+    This file is part of ColPack, which is under its License protection.
+    You should have received a copy of the License. If not, see
+    <https://github.com/CSCsw/ColPack>
+******************************************************************************/
+
+
+#ifndef PD2SMPGCDEFINE_H
+#define PD2SMPGCDEFINE_H
+#include "SMPGC.h"
+// ============================================================================
+// PD2SMPGC: Partial Distance two Shared Memory Parallel Graph Coloring
+// ----------------------------------------------------------------------------
+// **OVERVIEW**
+//
+// PD2SMPGCGraph:                    Bipartite graph data (CSR + CSC), IO
+//     |->PD2SMPGCOrdering:          Ordering of one side
+//          |-> PD2SMPGCColoring:    Partial distance two coloring of one side
+//
+// The graph is the bipartite graph of the sparsity pattern of a m x n matrix.
+// Left  (L) vertices are the m rows,    coloring them gives a row    seed.
+// Right (R) vertices are the n columns, coloring them gives a column seed.
+// Two vertices of the colored side are distance two neighbors when they share
+// a vertex of the other side, i.e. two columns (rows) having a nonzero in the
+// same row (column) get different colors.
+//
+// The orderings, partitions and algorithm constants are the ones of SMPGC.
+// ----------------------------------------------------------------------------
+// **LIST OF ALGORITHMS**
+// * GM's Algorithm: Gebremedhin and Manne[1], 3 phases and multiple phases
+// * JP's Algorithm: Jones and Plassmann[2], hybrid with GM's
+// * Net based:      Tas, Kaya and Saule[4], conflicts detected net by net
+// ----------------------------------------------------------------------------
+// **LIST OF PAPERS**
+// [1] Scalable Parallel Graph Coloring Algorithms
+// [2] A Parallel Graph Coloring Heuristic
+// [3] Parallel Distance-k Coloring Algorithms for Numerical Optimization
+// [4] Greed is Good: Parallel Algorithms for Bipartite-Graph Partial Coloring
+//     on Multicore Architectures
+// ============================================================================
+
+class PD2SMPGC : public SMPGC {
+public:
+    static const int L = 0;     // left  side, rows
+    static const int R = 1;     // right side, columns
+    static const int LEAN_NONE = -1;    // both CSR and CSC are stored
+    static const int DEDUP_RATIO = 4;   // dedup the two hop walk when it is DEDUP_RATIO times longer than the side
+
+public:
+    PD2SMPGC(){};
+    ~PD2SMPGC(){};
+public:
+    PD2SMPGC(PD2SMPGC&&)=delete;
+    PD2SMPGC(const PD2SMPGC&)=delete;
+    PD2SMPGC& operator=(PD2SMPGC&&)=delete;
+    PD2SMPGC& operator=(const PD2SMPGC&)=delete;
+};
+
+
+
+#endif
+
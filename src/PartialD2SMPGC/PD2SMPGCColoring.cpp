@@ -0,0 +1,300 @@
+/******************************************************************************
+    This file is part of ColPack, which is under its License protection.
+    You should have received a copy of the License. If not, see
+    <https://github.com/CSCsw/ColPack>
+*******************************************************************************/
+
+#include "PD2SMPGCColoring.h"
+using namespace std;
+using namespace ColPack;
+
+// ============================================================================
+// Interface
+// ============================================================================
+int PD2SMPGCColoring::Coloring(int nT, const string& method, const int side, const int switch_iter){
+    //Method follows the following pattern:
+    //
+    //"  PD2_OMP_                                                         "
+    //"          <GM3P/GMMP/SERIAL>[_<LF/SL/NT/RD/NONE>]                  "
+    //"          HBJP_<GM3P/GMMP/SERIAL>[-<LF/SL/NT/RD/NONE>]             "
+    //"          NET                                                      "
+    //
+    //For example
+    //  PD2_OMP_GM3P_LF
+    //  PD2_OMP_GMMP
+    //  PD2_OMP_HBJP_GM3P-SL
+    //  PD2_OMP_NET
+    //
+    //side is L (color the rows) or R (color the columns)
+    if(side!=L && side!=R) { printf("Error! side %d is neither L(%d) nor R(%d).\n", side, L, R); exit(1); }
+    m_method = method;
+    m_side   = side;
+    if(method.substr(0,8).compare("PD2_OMP_")!=0) {
+        printf("Error! method \"%s\" is not supported.\n", method.c_str());
+        exit(1);
+    }
+    string mthd = method.substr(8);
+    if(mthd.compare("NET")==0) {
+        if(!has_adjacency((side==L)?R:L)) { printf("Error! the graph is lean for side %d, it has no nets to color side %d.\n", get_lean(), side); exit(1); }
+        return PD2_OMP_NET(nT, m_total_num_colors, m_vertex_color, side);
+    }
+    if(get_lean()!=LEAN_NONE) {
+        printf("Error! method \"%s\" needs both CSR and CSC, the graph is lean. Use PD2_OMP_NET.\n", method.c_str());
+        exit(1);
+    }
+    if(mthd.substr(0,5).compare("HBJP_")==0) {
+        mthd = mthd.substr(5);
+        int local_order = ORDER_NONE;
+        const auto iter_dash = mthd.find('-');
+        string left = mthd.substr(0, iter_dash);
+        if(iter_dash!=string::npos){
+            const string right = mthd.substr(iter_dash+1);
+            if     (right.compare("LF")==0)   local_order=ORDER_LARGEST_FIRST;
+            else if(right.compare("SL")==0)   local_order=ORDER_SMALLEST_LAST;
+            else if(right.compare("NT")==0)   local_order=ORDER_NATURAL;
+            else if(right.compare("RD")==0)   local_order=ORDER_RANDOM;
+            else if(right.compare("NONE")==0) local_order=ORDER_NONE;
+            else { printf("Error local_order '%s' in method '%s' is not supported.\n", right.c_str(), method.c_str()); exit(1);}
+        }
+        if     (left.compare("GM3P")==0)   return PD2_OMP_HBJP(nT, m_total_num_colors, m_vertex_color, side, HYBRID_GM3P,   switch_iter, local_order);
+        else if(left.compare("GMMP")==0)   return PD2_OMP_HBJP(nT, m_total_num_colors, m_vertex_color, side, HYBRID_GMMP,   switch_iter, local_order);
+        else if(left.compare("SERIAL")==0) return PD2_OMP_HBJP(nT, m_total_num_colors, m_vertex_color, side, HYBRID_SERIAL, switch_iter, local_order);
+        printf("Error! method \"%s\" with \"%s\" is not support.\n", method.c_str(), mthd.c_str());
+        exit(1);
+    }
+
+    const auto iter_under_line = mthd.find('_');
+    string left = mthd.substr(0, iter_under_line);
+    int local_order = ORDER_NONE;
+    if(iter_under_line!=string::npos){
+        const string right = mthd.substr(iter_under_line+1);
+        if     (right.compare("LF")==0)   local_order=ORDER_LARGEST_FIRST;
+        else if(right.compare("SL")==0)   local_order=ORDER_SMALLEST_LAST;
+        else if(right.compare("NT")==0)   local_order=ORDER_NATURAL;
+        else if(right.compare("RD")==0)   local_order=ORDER_RANDOM;
+        else if(right.compare("NONE")==0) local_order=ORDER_NONE;
+        else { printf("Error! method \"%s\" in \"%s\" is not support.\n", right.c_str(), method.c_str()); exit(1); }
+    }
+    if     (left.compare("GM3P")==0)   return PD2_OMP_GM3P(nT, m_total_num_colors, m_vertex_color, side, local_order);
+    else if(left.compare("GMMP")==0)   return PD2_OMP_GMMP(nT, m_total_num_colors, m_vertex_color, side, local_order);
+    else if(left.compare("SERIAL")==0) return PD2_serial(m_total_num_colors, m_vertex_color, side, local_order);
+    printf("Error! method \"%s\" with \"%s\" is not support.\n", method.c_str(), mthd.c_str());
+    exit(1);
+} //end function
+
+// ============================================================================
+// Construction
+// ============================================================================
+PD2SMPGCColoring::PD2SMPGCColoring(const string& graph_name, const string& fmt, double* iotime, const string& glb_order, double *ordtime, const int lean)
+: PD2SMPGCOrdering(graph_name, fmt, iotime, glb_order, ordtime, lean){
+    m_total_num_colors=0;
+    m_side=R;
+    m_partition=PARTITION_EQUAL;
+}
+
+// ============================================================================
+// Construction from a zero based CSR of the sparsity pattern
+// ============================================================================
+PD2SMPGCColoring::PD2SMPGCColoring(const int rows, const int cols, const vector<int>& ia, const vector<int>& ja, const string& glb_order, double *ordtime, const int lean)
+: PD2SMPGCOrdering(rows, cols, ia, ja, glb_order, ordtime, lean){
+    m_total_num_colors=0;
+    m_side=R;
+    m_partition=PARTITION_EQUAL;
+}
+
+
+// ============================================================================
+// BipartiteGraphPartialColoringInterface view of the graph and of the last coloring
+// ----------------------------------------------------------------------------
+// g gets the bipartite graph of the CSR and the colors of the last Coloring()
+// call, as "ROW_PARTIAL_DISTANCE_TWO" (side L) or "COLUMN_PARTIAL_DISTANCE_TWO"
+// (side R). Then g.GetSeedMatrix() is the seed, and g goes to
+// JacobianRecovery1D::RecoverD2Row_* / RecoverD2Cln_* like a coloring done by
+// g.PartialDistanceTwoColoring(). g is usually created with
+// BipartiteGraphPartialColoringInterface(SRC_WAIT). A graph lean for the rows
+// has no CSR, a temporary one is made from the CSC.
+// ============================================================================
+void PD2SMPGCColoring::export_coloring(BipartiteGraphPartialColoringInterface& g) {
+    if(has_adjacency(L))
+        g.BuildBPGraphFromCSRFormat(get_CSR_ia(), get_CSR_ja(), num_cols());
+    else{
+        vector<int> ia, ja;
+        transpose(num_cols(), get_CSC_ia(), get_CSC_ja(), num_rows(), ia, ja);
+        g.BuildBPGraphFromCSRFormat(ia, ja, num_cols());
+    }
+    g.SetVertexColors(m_vertex_color, (m_side==L)?"ROW_PARTIAL_DISTANCE_TWO":"COLUMN_PARTIAL_DISTANCE_TWO");
+}
+
+
+// ============================================================================
+// check if the side is correct colored, return the number of conflict pairs
+// ----------------------------------------------------------------------------
+// without the adjacency of the side (lean graph) the nets are checked: it
+// returns the number of vertices repeating a color of their net.
+// ============================================================================
+int PD2SMPGCColoring::cnt_pd2conflict(const vector<int>& vtxColor, const int side, bool bVerbose) {
+    const int N = num_nodes(side);
+    const vector<int>& othPtr = get_other_ia(side);
+    const vector<int>& othVal = get_other_ja(side);
+    if((int)vtxColor.size()!=N){
+        if(bVerbose) printf("There are %d colors for %d vertices.\n", (int)vtxColor.size(), N);
+        return N;
+    }
+
+    int n_uncolored = 0;
+    int n_conflicts = 0;
+    if(!has_adjacency(side)){
+        const int NN = num_nodes((side==L)?R:L);
+        #pragma omp parallel for reduction(+: n_uncolored)
+        for(int v=0; v<N; v++)
+            if(vtxColor[v]<0) n_uncolored++;
+        #pragma omp parallel reduction(+: n_conflicts)
+        {
+            vector<int> Mask(N, -1);
+            #pragma omp for
+            for(int w=0; w<NN; w++){
+                for(int iu=othPtr[w]; iu!=othPtr[w+1]; iu++){
+                    const auto u  = othVal[iu];
+                    const auto uc = vtxColor[u];
+                    if(uc<0 || uc>=N) continue;
+                    if(Mask[uc]==w) {
+                        n_conflicts++;
+                        if(bVerbose)
+                            printf("conflict %d net %d color %d\n", u, w, uc);
+                    }
+                    Mask[uc]=w;
+                }
+            }
+        }
+        if(bVerbose)
+            printf("There is %d vertex uncolored\nThere is %d vertices repeating a color in a net.\n", n_uncolored, n_conflicts);
+        return n_uncolored+n_conflicts;
+    }
+
+    const vector<int>& vtxPtr = get_ia(side);
+    const vector<int>& vtxVal = get_ja(side);
+    #pragma omp parallel reduction(+: n_uncolored, n_conflicts)
+    {
+        vector<int> Seen(N, -1);
+        #pragma omp for
+        for(int v=0; v<N; v++){
+            const auto vc = vtxColor[v];
+            if(vc<0) { n_uncolored++; continue; }
+            for(int iw=vtxPtr[v]; iw!=vtxPtr[v+1]; iw++){
+                const auto w = vtxVal[iw];
+                for(int iu=othPtr[w]; iu!=othPtr[w+1]; iu++){
+                    const auto u = othVal[iu];
+                    if(u<=v || Seen[u]==v) continue;
+                    Seen[u]=v;
+                    if(vc==vtxColor[u]) {
+                        n_conflicts++;
+                        if(bVerbose)
+                            printf("conflict %d %d color %d\n", v, u, vc);
+                    }
+                }
+            }
+        }
+    }
+    if(bVerbose)
+        printf("There is %d vertex uncolored\nThere is %d pairs of vertex conflicts.\n", n_uncolored, n_conflicts);
+    return n_uncolored+n_conflicts;
+}
+
+
+// ============================================================================
+// split the global ordering of the side into nT pieces
+// ----------------------------------------------------------------------------
+// same as SMPGCColoring::partition_vertices(). The estimated work of a vertex
+// is its distance two walk: 1 + sum of the degrees of its neighbors.
+// ============================================================================
+void PD2SMPGCColoring::partition_vertices(const int nT, const int side, vector<vector<int>>&QQ){
+    const int N = num_nodes(side);
+    const vector<int>& vtxPtr = get_ia(side);
+    const vector<int>& vtxVal = get_ja(side);
+    const vector<int>& othPtr = get_other_ia(side);
+    const vector<int>& const_ordered_vertex = global_ordered_vertex(side);
+
+    QQ.assign(nT, vector<int>());
+    vector<int> disps(nT+1, 0);
+    if(m_partition==PARTITION_EQUAL){
+        vector<int> lens(nT, N/nT); for(int i=0; i<N%nT; i++) lens[i]++;
+        for(int i=1; i<nT+1; i++) disps[i]=disps[i-1]+lens[i-1];
+    }
+    else{
+        vector<long long> acc(N+1, 0);
+        #pragma omp parallel for
+        for(int i=0; i<N; i++){
+            const auto v = const_ordered_vertex[i];
+            long long w = 1;
+            for(int iw=vtxPtr[v]; iw!=vtxPtr[v+1]; iw++){
+                const auto u = vtxVal[iw];
+                w += othPtr[u+1]-othPtr[u];
+            }
+            acc[i+1]=w;
+        }
+        for(int i=0; i<N; i++) acc[i+1]+=acc[i];
+        for(int i=1; i<nT; i++)
+            disps[i] = lower_bound(acc.begin(), acc.end(), acc[N]*i/nT) - acc.begin();
+        disps[nT]=N;
+    }
+    for(int i=0; i<nT; i++){
+        QQ[i].reserve(disps[i+1]-disps[i]+16); //16-bus width
+        QQ[i].assign(const_ordered_vertex.begin()+disps[i], const_ordered_vertex.begin()+disps[i+1]);
+    }
+}
+
+// ============================================================================
+// get the next piece QQ[owner][beg,end) for thread tid to work on
+// ----------------------------------------------------------------------------
+// same as SMPGCColoring::next_chunk(); cursors must be zeroed before each phase
+// ============================================================================
+bool PD2SMPGCColoring::next_chunk(const int tid, const vector<vector<int>>&QQ, vector<int>&cursors, int&owner, int&beg, int&end){
+    const int nT    = QQ.size();
+    const bool bSteal = (m_partition==PARTITION_STEALING);
+    const int nQ    = bSteal?nT:1;
+    if(!bSteal) owner=tid;
+    for(int k=0; k<nQ; k++){
+        const int q     = (owner+k)%nT;
+        const int qsize = QQ[q].size();
+        const int chunk = bSteal?STEAL_CHUNK:max(qsize,1);
+        int b;
+        #pragma omp atomic read
+        b = cursors[q*CURSOR_PAD];
+        if(b>=qsize) continue;
+        #pragma omp atomic capture
+        { b = cursors[q*CURSOR_PAD]; cursors[q*CURSOR_PAD]+=chunk; }
+        if(b>=qsize) continue;
+        owner = q;
+        beg   = b;
+        end   = min(b+chunk, qsize);
+        return true;
+    }
+    return false;
+}
+
+// ============================================================================
+// load imbalance of the threads, max busy time over mean busy time
+// ============================================================================
+double PD2SMPGCColoring::load_imbalance(const vector<double>& busy){
+    double tmax=.0, tsum=.0;
+    for(const auto t : busy){ tmax=max(tmax,t); tsum+=t; }
+    if(tsum<=.0) return 1.0;
+    return tmax*busy.size()/tsum;
+}
+
+// ============================================================================
+// tag of the local order in the timing lines
+// ============================================================================
+const char* PD2SMPGCColoring::order_tag(const int local_order){
+    switch(local_order){
+        case ORDER_NONE:          return "NoOrder";
+        case ORDER_LARGEST_FIRST: return "LF";
+        case ORDER_SMALLEST_LAST: return "SL";
+        case ORDER_NATURAL:       return "NT";
+        case ORDER_RANDOM:        return "RD";
+        default:
+            printf("unkonw local order %d\n", local_order);
+    }
+    return "unknown";
+}
+
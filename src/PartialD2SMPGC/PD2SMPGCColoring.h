@@ -0,0 +1,108 @@
+/******************************************************************************
+    This file is part of ColPack, which is under its License protection.
+    You should have received a copy of the License. If not, see
+    <https://github.com/CSCsw/ColPack>
+*******************************************************************************/
+#ifndef PD2SMPGCColoring_H
+#define PD2SMPGCColoring_H
+#include <vector>
+#include <omp.h>
+#include "ColPackHeaders.h"
+#include "PD2SMPGCOrdering.h"
+
+using namespace std;
+
+namespace ColPack {
+
+//=============================================================================
+// Partial Distance Two Shared Memeory Parallel (Greedy)/Graph Coloring
+// ----------------------------------------------------------------------------
+//
+// Colors the rows (side L) or the columns (side R) of a sparse matrix such that
+// the vertices sharing a nonzero on the other side get different colors.
+// * GM's Algorithm: Gebremedhin and Manne[1], 3 phases (GM3P) and multiple
+//   phases (GMMP) speculative coloring
+// * JP's Algorithm: Jones and Plassmann[2] independent set rounds, then GM's
+//   algorithm on the remaining vertices (HBJP)
+// * Net based: Tas, Kaya and Saule[4], conflicts are detected walking the
+//   nets of the other side, each net once, later rounds walk only the nets
+//   of the recolored vertices (NET). It is the only algorithm for a graph
+//   built with lean=side, which then colors the first round by nets too.
+// ----------------------------------------------------------------------------
+// [1] Scalable Parallel Graph Coloring Algorithms
+// [2] A Parallel Graph Coloring Heuristic
+// [3] Parallel Distance-k Coloring Algorithms for Numerical Optimization
+// [4] Greed is Good: Parallel Algorithms for Bipartite-Graph Partial Coloring
+//     on Multicore Architectures
+//=============================================================================
+class PD2SMPGCColoring : public PD2SMPGCOrdering {
+public: // Constructions
+    PD2SMPGCColoring(const string& graph_name, const string& fmt, double*iotime=nullptr, const string&ord="NATURAL", double*ordtime=nullptr, const int lean=LEAN_NONE);
+    PD2SMPGCColoring(const int rows, const int cols, const vector<int>& ia, const vector<int>& ja, const string&ord="NATURAL", double*ordtime=nullptr, const int lean=LEAN_NONE);
+    virtual ~PD2SMPGCColoring(){}
+
+        // Deplete constructions
+        PD2SMPGCColoring(PD2SMPGCColoring&&)=delete;
+        PD2SMPGCColoring(const PD2SMPGCColoring&)=delete;
+        PD2SMPGCColoring& operator=(PD2SMPGCColoring&&)=delete;
+        PD2SMPGCColoring& operator=(const PD2SMPGCColoring&)=delete;
+
+public: // API
+    int Coloring(int nT, const string& method, const int side, const int switch_iter=0);
+
+    int  get_num_colors(){ return m_total_num_colors; }
+    int  get_side() const { return m_side; }
+    void set_partition(const int x){ m_partition = x; }
+    int  get_partition() const { return m_partition; }
+    const vector<int>& get_vertex_colors() const { return m_vertex_color; }
+    void get_vertex_colors(vector<int>& x) { x.assign(m_vertex_color.begin(), m_vertex_color.end()); }
+
+    // Algorithms, side is L (rows) or R (columns)
+    int PD2_serial  (int&colors, vector<int>&vtxColors, const int side, const int local_order=ORDER_NONE);
+    int PD2_OMP_GM3P(int nT, int&colors, vector<int>&vtxColors, const int side, const int local_order=ORDER_NONE);
+    int PD2_OMP_GMMP(int nT, int&colors, vector<int>&vtxColors, const int side, const int local_order=ORDER_NONE);
+    int PD2_OMP_HBJP(int nT, int&colors, vector<int>&vtxColors, const int side, const int option=HYBRID_GM3P, const int switch_iter=0, const int local_order=ORDER_NONE);
+    int PD2_OMP_NET (int nT, int&colors, vector<int>&vtxColors, const int side);
+
+    // BipartiteGraphPartialColoringInterface view of the graph and of the last coloring, see JacobianRecovery1D
+    void export_coloring(BipartiteGraphPartialColoringInterface& g);
+
+public: // Utilites
+    int cnt_pd2conflict(const vector<int>& vc, const int side, bool bVerbose=false);
+
+protected: // kernels (PD2SMPGCColoringGM.cpp)
+    int  pd2_buffer_size(const int side);
+    int  pd2_pick_color(const int v, const int side, const vector<int>&vtxColors, int* Mask, const int BufSize);
+    bool pd2_find_conflict(const int v, const int side, const vector<int>&vtxColors);
+    void local_ordering(vector<int>&Q, const int side, const int local_order);
+    void pd2_color_phase (const int nT, const int side, vector<int>&vtxColors, vector<vector<int>>&QQ, vector<int>&cursors, vector<double>&busy, const int local_order);
+    int  pd2_detect_phase(const int nT, const int side, vector<int>&vtxColors, vector<vector<int>>&QQ, vector<int>&cursors, vector<double>&busy);
+    void pd2_serial_phase(const int side, vector<int>&vtxColors, vector<vector<int>>&QQ);
+    int  pd2_max_color(const vector<int>&vtxColors);
+    static const char* order_tag(const int local_order);
+
+protected: // kernels (PD2SMPGCColoringNB.cpp)
+    void nb_net_color_phase(const int side, vector<int>&vtxColors, const vector<int>&nets, const int BufSize);
+    void nb_vertex_color_phase(const int side, vector<int>&vtxColors, const vector<int>&Q, const vector<int>&vtxPtr, const vector<int>&vtxVal, const int BufSize, const bool bDedup);
+    void nb_detect_phase(const int side, vector<int>&vtxColors, const vector<int>&nets, const int BufSize, vector<int>&Marked, const int round, vector<int>&Q);
+    void nb_gather_nets (const vector<int>&Q, const vector<int>&vtxPtr, const vector<int>&vtxVal, vector<int>&NetMarked, const int round, vector<int>&nets);
+    void nb_gather_adjacency(const int side, const vector<int>&Q, vector<int>&subPtr, vector<int>&subVal);
+
+protected: // scheduling for the speculative kernels
+    void   partition_vertices(const int nT, const int side, vector<vector<int>>&QQ);
+    bool   next_chunk(const int tid, const vector<vector<int>>&QQ, vector<int>&cursors, int&owner, int&beg, int&end);
+    double load_imbalance(const vector<double>& busy);
+
+protected:
+    int         m_total_num_colors;
+    vector<int> m_vertex_color;
+    string      m_method;
+    int         m_side;
+    int         m_partition;
+
+}; // end of class PD2SMPGCColoring
+
+
+}// endof namespace ColPack
+#endif
+
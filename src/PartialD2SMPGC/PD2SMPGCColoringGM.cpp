@@ -0,0 +1,506 @@
+/******************************************************************************
+    This file is part of ColPack, which is under its License protection.
+    You should have received a copy of the License. If not, see
+    <https://github.com/CSCsw/ColPack>
+*******************************************************************************/
+
+#include "PD2SMPGCColoring.h"
+#include <numeric>
+using namespace std;
+using namespace ColPack;
+
+
+// ============================================================================
+// Mask size of a first fit partial distance two coloring of the side
+// ----------------------------------------------------------------------------
+// a vertex has at most min(maxdeg*(other maxdeg-1), N-1) distance two
+// neighbors, so its first fit color is below that plus one.
+// ============================================================================
+int PD2SMPGCColoring::pd2_buffer_size(const int side){
+    const long long deg   = max_degree(side);
+    const long long odeg  = max_degree((side==L)?R:L);
+    const long long nbrs  = min(deg*max(odeg-1, 0LL), (long long)max(num_nodes(side)-1, 0));
+    return (int)nbrs+1;
+}
+
+// ============================================================================
+// first fit color of v among its colored distance two neighbors
+// ============================================================================
+int PD2SMPGCColoring::pd2_pick_color(const int v, const int side, const vector<int>&vtxColors, int* Mask, const int BufSize){
+    const vector<int>& vtxPtr = get_ia(side);
+    const vector<int>& vtxVal = get_ja(side);
+    const vector<int>& othPtr = get_other_ia(side);
+    const vector<int>& othVal = get_other_ja(side);
+    for(int iw=vtxPtr[v]; iw!=vtxPtr[v+1]; iw++){
+        const auto w = vtxVal[iw];
+        for(int iu=othPtr[w]; iu!=othPtr[w+1]; iu++){ // d2 neighbors
+            const auto u = othVal[iu];
+            if(u==v) continue;
+            const auto uc = vtxColors[u];
+            if(uc>=0) Mask[uc]=v;
+        }
+    }
+    int c=0;
+    for(; c!=BufSize; c++)
+        if(Mask[c]!=v)
+            break;
+    return c;
+}
+
+// ============================================================================
+// v has a distance two neighbor u>v of the same color
+// ============================================================================
+bool PD2SMPGCColoring::pd2_find_conflict(const int v, const int side, const vector<int>&vtxColors){
+    const vector<int>& vtxPtr = get_ia(side);
+    const vector<int>& vtxVal = get_ja(side);
+    const vector<int>& othPtr = get_other_ia(side);
+    const vector<int>& othVal = get_other_ja(side);
+    const auto vc = vtxColors[v];
+    for(int iw=vtxPtr[v]; iw!=vtxPtr[v+1]; iw++){
+        const auto w = vtxVal[iw];
+        for(int iu=othPtr[w]; iu!=othPtr[w+1]; iu++){
+            const auto u = othVal[iu];
+            if(v<u && vc==vtxColors[u]) // check conflict is little brother's job
+                return true;
+        }
+    }
+    return false;
+}
+
+// ============================================================================
+// local ordering of the vertices of Q
+// ============================================================================
+void PD2SMPGCColoring::local_ordering(vector<int>&Q, const int side, const int local_order){
+    switch(local_order){
+        case ORDER_NONE:
+            break;
+        case ORDER_LARGEST_FIRST:
+            local_largest_degree_first_ordering(Q, side); break;
+        case ORDER_SMALLEST_LAST:
+            local_smallest_degree_last_ordering(Q, side); break;
+        case ORDER_NATURAL:
+            local_natural_ordering(Q); break;
+        case ORDER_RANDOM:
+            local_random_ordering(Q); break;
+        default:
+            printf("Error! unknown local order \"%d\".\n", local_order);
+            exit(1);
+    }
+}
+
+// ============================================================================
+// phase - pseudo coloring of all the vertices of QQ
+// ============================================================================
+void PD2SMPGCColoring::pd2_color_phase(const int nT, const int side, vector<int>&vtxColors, vector<vector<int>>&QQ, vector<int>&cursors, vector<double>&tim_busy, const int local_order){
+    const int BufSize = pd2_buffer_size(side);
+    cursors.assign(nT*CURSOR_PAD, 0);
+    #pragma omp parallel
+    {
+        const int tid = omp_get_thread_num();
+        local_ordering(QQ[tid], side, local_order);
+
+        #pragma omp barrier
+
+        double tim_work = -omp_get_wtime();
+        vector<int> Mask; Mask.assign(BufSize, -1);
+        int owner=tid, beg=0, end=0;
+        while(next_chunk(tid, QQ, cursors, owner, beg, end)){
+            const vector<int>& Qo = QQ[owner];
+            for(int iv=beg; iv<end; iv++){
+                const auto v = Qo[iv];
+                vtxColors[v] = pd2_pick_color(v, side, vtxColors, Mask.data(), BufSize);
+            }
+        }
+        tim_busy[tid] += tim_work+omp_get_wtime();
+    } //end omp parallel
+}
+
+// ============================================================================
+// phase - detect conflicts, QQ becomes the uncolored vertices
+// return the number of conflicts
+// ============================================================================
+int PD2SMPGCColoring::pd2_detect_phase(const int nT, const int side, vector<int>&vtxColors, vector<vector<int>>&QQ, vector<int>&cursors, vector<double>&tim_busy){
+    int n_uncolored = 0;
+    cursors.assign(nT*CURSOR_PAD, 0);
+    #pragma omp parallel reduction(+: n_uncolored)
+    {
+        const int tid = omp_get_thread_num();
+        double tim_work = -omp_get_wtime();
+        vector<int> conflicts;
+        int owner=tid, beg=0, end=0;
+        while(next_chunk(tid, QQ, cursors, owner, beg, end)){
+            const vector<int>& Qo = QQ[owner];
+            for(int iv=beg; iv<end; iv++){
+                const auto v = Qo[iv];
+                if(pd2_find_conflict(v, side, vtxColors)){
+                    conflicts.push_back(v);
+                    vtxColors[v] = -1;
+                }
+            }
+        }
+        tim_busy[tid] += tim_work+omp_get_wtime();
+        n_uncolored = conflicts.size();
+        #pragma omp barrier
+        QQ[tid].swap(conflicts);
+    } //end omp parallel
+    return n_uncolored;
+}
+
+// ============================================================================
+// phase - serial coloring of the remaining vertices of QQ
+// ============================================================================
+void PD2SMPGCColoring::pd2_serial_phase(const int side, vector<int>&vtxColors, vector<vector<int>>&QQ){
+    const int BufSize = pd2_buffer_size(side);
+    vector<int> Mask; Mask.assign(BufSize, -1);
+    for(auto& Q : QQ)
+        for(const auto v : Q)
+            vtxColors[v] = pd2_pick_color(v, side, vtxColors, Mask.data(), BufSize);
+}
+
+// ============================================================================
+// largest color
+// ============================================================================
+int PD2SMPGCColoring::pd2_max_color(const vector<int>&vtxColors){
+    const int N = vtxColors.size();
+    int max_color=-1;
+    #pragma omp parallel for reduction(max:max_color)
+    for(int i=0; i<N; i++){
+        max_color = max(max_color, vtxColors[i]);
+    }
+    return max_color;
+}
+
+
+
+// ============================================================================
+// partial distance two serial coloring
+// ============================================================================
+int PD2SMPGCColoring::PD2_serial(int&colors, vector<int>&vtxColors, const int side, const int local_order) {
+    omp_set_num_threads(1);
+    double tim_total    =.0;
+    const int N       = num_nodes(side);
+    const int BufSize = pd2_buffer_size(side);
+    vector<int> Q(global_ordered_vertex(side));
+
+    colors=0;
+    vtxColors.assign(N, -1);
+
+    tim_total =- omp_get_wtime();
+    {
+        vector<int> Mask; Mask.assign(BufSize, -1);
+        local_ordering(Q, side, local_order);
+        for(const auto v : Q){
+            const int c = pd2_pick_color(v, side, vtxColors, Mask.data(), BufSize);
+            vtxColors[v] = c;
+            if(colors<c+1) colors=c+1;
+        }
+    }
+    tim_total  += omp_get_wtime();
+
+    printf("@PD2%s_Serial%s_c_T(lo+Color)", (side==L)?"L":"R", order_tag(local_order));
+    printf("\t%d",  colors);
+    printf("\t%lf", tim_total);
+#ifdef SMPGC_VARIFY
+    printf("\t%s", (cnt_pd2conflict(vtxColors, side)==0)?("Success"):("Failed"));
+#endif
+    printf("\n");
+    return true;
+}
+
+
+
+// ============================================================================
+// partial distance two coloring GM 3 phase
+// ----------------------------------------------------------------------------
+// speculative coloring, conflicts detection, serial recoloring of the conflicts
+// ============================================================================
+int PD2SMPGCColoring::PD2_OMP_GM3P(int nT, int&colors, vector<int>&vtxColors, const int side, const int local_order) {
+    if(nT<=0) { printf("Warning, number of threads changed from %d to 1\n",nT); nT=1; }
+    omp_set_num_threads(nT);
+
+    double tim_partition  =.0;
+    double tim_color      =.0;                     // run time
+    double tim_detect     =.0;                     // run time
+    double tim_recolor    =.0;                     // run time
+    double tim_total      =.0;                     // run time
+    double tim_maxc       =.0;
+
+    int    n_conflicts = 0;                        // Number of conflicts
+
+    const int N = num_nodes(side);
+
+    colors=0;
+    vtxColors.assign(N, -1);
+
+    vector<vector<int>> QQ(nT);
+    vector<int>    cursors(nT*CURSOR_PAD, 0);  // work stealing cursors
+    vector<double> tim_busy(nT, .0);           // per thread working time
+
+    // pre-partition the graph
+    tim_partition =- omp_get_wtime();
+    partition_vertices(nT, side, QQ);
+    tim_partition += omp_get_wtime();
+
+    // phase pseudo color
+    tim_color =- omp_get_wtime();
+    pd2_color_phase(nT, side, vtxColors, QQ, cursors, tim_busy, local_order);
+    tim_color += omp_get_wtime();
+
+    // phase conflicts detection
+    tim_detect =- omp_get_wtime();
+    n_conflicts = pd2_detect_phase(nT, side, vtxColors, QQ, cursors, tim_busy);
+    tim_detect += omp_get_wtime();
+
+    // phase serial coloring remain part
+    tim_recolor =- omp_get_wtime();
+    pd2_serial_phase(side, vtxColors, QQ);
+    tim_recolor += omp_get_wtime();
+
+    // get maximal colors
+    tim_maxc = -omp_get_wtime();
+    colors = pd2_max_color(vtxColors)+1;
+    tim_maxc += omp_get_wtime();
+
+    tim_total = tim_color+tim_detect+tim_recolor+tim_maxc;
+
+    printf("@PD2%s_GM3P%s_nT_c_T_T(lo+color)_Tdetect_Trecolor_TmaxC_nCnf_Tpart_LdImb", (side==L)?"L":"R", order_tag(local_order));
+    printf("\t%d",  nT);
+    printf("\t%d",  colors);
+    printf("\t%lf", tim_total);
+    printf("\t%lf", tim_color);
+    printf("\t%lf", tim_detect);
+    printf("\t%lf", tim_recolor);
+    printf("\t%lf", tim_maxc);
+    printf("\t%d",  n_conflicts);
+    printf("\t%lf", tim_partition);
+    printf("\t%lf", load_imbalance(tim_busy));
+#ifdef SMPGC_VARIFY
+    printf("\t%s", (cnt_pd2conflict(vtxColors, side)==0)?("Success"):("Failed"));
+#endif
+    printf("\n");
+    return true;
+}
+
+
+
+// ============================================================================
+// partial distance two coloring GM multiple phase
+// ----------------------------------------------------------------------------
+// speculative coloring and conflicts detection rounds until no conflict left
+// ============================================================================
+int PD2SMPGCColoring::PD2_OMP_GMMP(int nT, int&colors, vector<int>&vtxColors, const int side, const int local_order) {
+    if(nT<=0) { printf("Warning, number of threads changed from %d to 1\n",nT); nT=1; }
+    omp_set_num_threads(nT);
+
+    double tim_partition  =.0;
+    double tim_total      =.0;                     // run time
+    double tim_color      =.0;                     // run time
+    double tim_detect     =.0;                     // run time
+    double tim_maxc       =.0;                     // run time
+
+    int    n_loops        = 0;
+    int    n_conflicts    = 0;                     // Number of conflicts
+    int    n_uncolored    = 0;
+
+    const int N = num_nodes(side);
+
+    colors=0;
+    vtxColors.assign(N, -1);
+
+    vector<vector<int>> QQ(nT);
+    vector<int>    cursors(nT*CURSOR_PAD, 0);  // work stealing cursors
+    vector<double> tim_busy(nT, .0);           // per thread working time
+    tim_partition =- omp_get_wtime();
+    partition_vertices(nT, side, QQ);
+    tim_partition += omp_get_wtime();
+
+    n_uncolored=N;
+    while(n_uncolored!=0){
+        // phase - Pseudo Coloring
+        tim_color -= omp_get_wtime();
+        pd2_color_phase(nT, side, vtxColors, QQ, cursors, tim_busy, local_order);
+        tim_color += omp_get_wtime();
+
+        // Phase - Detect Conflicts
+        tim_detect -= omp_get_wtime();
+        n_uncolored = pd2_detect_phase(nT, side, vtxColors, QQ, cursors, tim_busy);
+        tim_detect += omp_get_wtime();
+        n_loops++;
+        n_conflicts+=n_uncolored;
+    } //end while
+
+    // get number of colors
+    tim_maxc = -omp_get_wtime();
+    colors = pd2_max_color(vtxColors)+1;
+    tim_maxc += omp_get_wtime();
+
+    tim_total = tim_color+tim_detect+tim_maxc;
+
+    printf("@PD2%s_GMMP%s_nT_c_T_T(Lo+Color)_TDetect_TMxC_nCnf_nLoop_TPart_LdImb", (side==L)?"L":"R", order_tag(local_order));
+    printf("\t%d",  nT);
+    printf("\t%d",  colors);
+    printf("\t%lf", tim_total);
+    printf("\t%lf", tim_color);
+    printf("\t%lf", tim_detect);
+    printf("\t%lf", tim_maxc);
+    printf("\t%d",  n_conflicts);
+    printf("\t%d" , n_loops);
+    printf("\t%lf", tim_partition);
+    printf("\t%lf", load_imbalance(tim_busy));
+#ifdef SMPGC_VARIFY
+    printf("\t%s", (cnt_pd2conflict(vtxColors, side)==0)?("Success"):("Failed"));
+#endif
+    printf("\n");
+    return true;
+}
+
+
+
+// ============================================================================
+// partial distance two hybrid Jones Plassmann coloring
+// ----------------------------------------------------------------------------
+// switch_iter rounds of JP: a vertex whose random weight is the largest among
+// its uncolored distance two neighbors is colored first fit. Those vertices
+// are pairwise not distance two neighbors, so the rounds make no conflicts.
+// The remaining vertices are colored by GM3P, GMMP or serially (option).
+// ============================================================================
+int PD2SMPGCColoring::PD2_OMP_HBJP(int nT, int&colors, vector<int>&vtxColors, const int side, const int option, const int switch_iter, const int local_order) {
+    if(nT<=0) { printf("Warning, number of threads changed from %d to 1\n",nT); nT=1; }
+    omp_set_num_threads(nT);
+
+    double tim_Ptt =.0;
+    double tim_Wgt =.0;    //run time
+    double tim_MIS =.0;
+    double tim_Alg2=.0;
+    double tim_MxC =.0;    //run time
+    double tim_Tot =.0;    //run time
+    int    n_loops = 0;    //Number of rounds
+    int    n_conflicts=0;
+    int    n_uncolored=0;
+
+    const int N       = num_nodes(side);
+    const int BufSize = pd2_buffer_size(side);
+    const vector<int>& vtxPtr = get_ia(side);
+    const vector<int>& vtxVal = get_ja(side);
+    const vector<int>& othPtr = get_other_ia(side);
+    const vector<int>& othVal = get_other_ja(side);
+
+    colors=0;
+    vtxColors.assign(N, -1);
+
+    vector<vector<int>> QQ(nT);
+    vector<int>    cursors(nT*CURSOR_PAD, 0);  // work stealing cursors
+    vector<double> tim_busy(nT, .0);           // per thread working time
+
+    // pre-partition the graph
+    tim_Ptt =- omp_get_wtime();
+    partition_vertices(nT, side, QQ);
+    tim_Ptt += omp_get_wtime();
+
+    // generate random numbers
+    tim_Wgt =-omp_get_wtime();
+    vector<int> WeightRnd(N);
+    iota(WeightRnd.begin(), WeightRnd.end(), 0);
+    shuffle(WeightRnd.begin(), WeightRnd.end(), mt19937(RAND_SEED));
+    tim_Wgt +=omp_get_wtime();
+
+    tim_MIS -= omp_get_wtime();
+    n_uncolored = N;
+    while(n_uncolored!=0){
+        if(n_loops>=switch_iter) break;
+        n_uncolored = 0;
+        #pragma omp parallel reduction(+ : n_uncolored)
+        {
+            const int tid = omp_get_thread_num();
+            vector<int>& Q = QQ[tid];
+            local_ordering(Q, side, local_order);
+
+            // phase find maximal indenpenent set, and color it
+            vector<int> candi;
+            int n_left = 0;
+            for(int i=0; i<(signed)Q.size(); i++){
+                const auto v  = Q[i];
+                const auto vw = WeightRnd[v];
+                bool b_visdomain = true;
+                for(int iw=vtxPtr[v]; b_visdomain && iw!=vtxPtr[v+1]; iw++){
+                    const auto w = vtxVal[iw];
+                    for(int iu=othPtr[w]; iu!=othPtr[w+1]; iu++){
+                        const auto u = othVal[iu];
+                        if(vtxColors[u]<0 && vw<WeightRnd[u]){
+                            b_visdomain = false;
+                            break;
+                        }
+                    }
+                }
+                if(b_visdomain) candi.push_back(v);
+                else            Q[n_left++]=v;
+            }
+            Q.resize(n_left);
+            n_uncolored = n_left;
+
+            // phase greedy coloring
+            #pragma omp barrier
+            vector<int> Mask(BufSize, -1);
+            for(const auto v : candi)
+                vtxColors[v] = pd2_pick_color(v, side, vtxColors, Mask.data(), BufSize);
+        } //end omp parallel
+
+        n_loops++;
+    } //end while
+    tim_MIS += omp_get_wtime();
+
+    tim_Alg2 =- omp_get_wtime();
+    switch(option){
+        case HYBRID_GM3P:
+            pd2_color_phase(nT, side, vtxColors, QQ, cursors, tim_busy, local_order);
+            n_conflicts = pd2_detect_phase(nT, side, vtxColors, QQ, cursors, tim_busy);
+            pd2_serial_phase(side, vtxColors, QQ);
+            break;
+        case HYBRID_GMMP:
+            while(n_uncolored!=0){
+                pd2_color_phase(nT, side, vtxColors, QQ, cursors, tim_busy, local_order);
+                n_uncolored = pd2_detect_phase(nT, side, vtxColors, QQ, cursors, tim_busy);
+                n_conflicts += n_uncolored;
+            }
+            break;
+        case HYBRID_SERIAL:
+            for(auto& Q : QQ) local_ordering(Q, side, local_order);
+            pd2_serial_phase(side, vtxColors, QQ);
+            break;
+        default:
+            printf("Error %d option for hybrid alg is not support!", option);
+            exit(1);
+    }
+    tim_Alg2+= omp_get_wtime();
+
+    tim_MxC = -omp_get_wtime();
+    colors = pd2_max_color(vtxColors)+1;
+    tim_MxC += omp_get_wtime();
+
+    tim_Tot = tim_Wgt + tim_MIS + tim_MxC+ tim_Alg2;
+
+    string alg_tag="unknown";
+    switch(option){
+        case HYBRID_GM3P:       alg_tag="GM3P";    break;
+        case HYBRID_GMMP:       alg_tag="GMMP";    break;
+        case HYBRID_SERIAL:     alg_tag="Serial";  break;
+    }
+
+    printf("@PD2%s_HBJP_%s_(%s)_nT_c_T_Talg1_Talg2_TMxC_switIter_nLoop_nCnf_timPTT", (side==L)?"L":"R", alg_tag.c_str(), order_tag(local_order));
+    printf("\t%d",  nT);
+    printf("\t%d",  colors);
+    printf("\t%lf", tim_Tot);
+    printf("\t%lf", tim_Wgt+tim_MIS);
+    printf("\t%lf", tim_Alg2);
+    printf("\t%lf", tim_MxC);
+    printf("\t%d",  switch_iter);
+    printf("\t%d",  n_loops);
+    printf("\t%d",  n_conflicts);
+    printf("\t%lf", tim_Ptt);
+#ifdef SMPGC_VARIFY
+    printf("\t%s", (cnt_pd2conflict(vtxColors, side)==0)?("Success"):("Failed"));
+#endif
+    printf("\n");
+    return true;
+}
+
@@ -0,0 +1,308 @@
+/******************************************************************************
+    This file is part of ColPack, which is under its License protection.
+    You should have received a copy of the License. If not, see
+    <https://github.com/CSCsw/ColPack>
+*******************************************************************************/
+
+#include "PD2SMPGCColoring.h"
+using namespace std;
+using namespace ColPack;
+
+
+// ============================================================================
+// phase - net based pseudo coloring
+// ----------------------------------------------------------------------------
+// a net (a vertex of the other side) masks the colors of its colored vertices
+// and gives first fit colors to the uncolored ones. Each net is walked once,
+// instead of once per vertex of the net.
+// ============================================================================
+void PD2SMPGCColoring::nb_net_color_phase(const int side, vector<int>&vtxColors, const vector<int>&nets, const int BufSize){
+    const vector<int>& netPtr = get_other_ia(side);
+    const vector<int>& netVal = get_other_ja(side);
+    const int NN = nets.size();
+    #pragma omp parallel
+    {
+        vector<int> Mask(BufSize, -1);
+        #pragma omp for schedule(dynamic, STEAL_CHUNK)
+        for(int in=0; in<NN; in++){
+            const auto w = nets[in];
+            for(int iu=netPtr[w]; iu!=netPtr[w+1]; iu++){
+                const auto uc = vtxColors[netVal[iu]];
+                if(uc>=0) Mask[uc]=w;
+            }
+            int c=0;
+            for(int iu=netPtr[w]; iu!=netPtr[w+1]; iu++){
+                const auto u = netVal[iu];
+                if(vtxColors[u]>=0) continue;
+                while(Mask[c]==w) c++;
+                vtxColors[u]=c;
+                Mask[c]=w;
+            }
+        }
+    } //end omp parallel
+}
+
+// ============================================================================
+// phase - net based conflicts detection
+// ----------------------------------------------------------------------------
+// in a net the vertices repeating the color of a smaller vertex of the net
+// are marked and appended to Q once. The smallest conflicting vertex is kept,
+// so every round colors at least one vertex for good.
+// ============================================================================
+void PD2SMPGCColoring::nb_detect_phase(const int side, vector<int>&vtxColors, const vector<int>&nets, const int BufSize, vector<int>&Marked, const int round, vector<int>&Q){
+    const vector<int>& netPtr = get_other_ia(side);
+    const vector<int>& netVal = get_other_ja(side);
+    const int NN = nets.size();
+    Q.clear();
+    #pragma omp parallel
+    {
+        vector<int> Mask(BufSize, -1);
+        vector<int> conflicts;
+        #pragma omp for schedule(dynamic, STEAL_CHUNK) nowait
+        for(int in=0; in<NN; in++){
+            const auto w = nets[in];
+            for(int iu=netPtr[w]; iu!=netPtr[w+1]; iu++){
+                const auto u  = netVal[iu];
+                const auto uc = vtxColors[u];
+                if(Mask[uc]!=w) { Mask[uc]=w; continue; }
+                int old;
+                #pragma omp atomic capture
+                { old = Marked[u]; Marked[u] = round; }
+                if(old!=round) conflicts.push_back(u);
+            }
+        }
+        #pragma omp critical
+        Q.insert(Q.end(), conflicts.begin(), conflicts.end());
+    } //end omp parallel
+    sort(Q.begin(), Q.end());
+}
+
+// ============================================================================
+// phase - vertex based pseudo coloring of Q
+// ----------------------------------------------------------------------------
+// vtxPtr/vtxVal are the nets of the vertices of Q. With bDedup a distance two
+// neighbor reached through several nets is looked at once, Seen holds a per
+// thread stamp by vertex so it is never reset; and once all the other N-1
+// vertices are seen the remaining nets of v have nothing new, they are skipped.
+// ============================================================================
+void PD2SMPGCColoring::nb_vertex_color_phase(const int side, vector<int>&vtxColors, const vector<int>&Q, const vector<int>&vtxPtr, const vector<int>&vtxVal, const int BufSize, const bool bDedup){
+    const vector<int>& netPtr = get_other_ia(side);
+    const vector<int>& netVal = get_other_ja(side);
+    const int N  = num_nodes(side);
+    const int NQ = Q.size();
+    #pragma omp parallel
+    {
+        vector<int> Mask(BufSize, -1);
+        vector<int> Seen(bDedup?N:0, -1);
+        #pragma omp for schedule(dynamic, STEAL_CHUNK)
+        for(int iv=0; iv<NQ; iv++){
+            const auto v = Q[iv];
+            if(bDedup){
+                int n_seen = 0;
+                Seen[v]=v;
+                for(int iw=vtxPtr[v]; iw!=vtxPtr[v+1] && n_seen!=N-1; iw++){
+                    const auto w = vtxVal[iw];
+                    for(int iu=netPtr[w]; iu!=netPtr[w+1]; iu++){
+                        const auto u = netVal[iu];
+                        if(Seen[u]==v) continue;
+                        Seen[u]=v;
+                        n_seen++;
+                        const auto uc = vtxColors[u];
+                        if(uc>=0) Mask[uc]=v;
+                    }
+                }
+            }
+            else{
+                for(int iw=vtxPtr[v]; iw!=vtxPtr[v+1]; iw++){
+                    const auto w = vtxVal[iw];
+                    for(int iu=netPtr[w]; iu!=netPtr[w+1]; iu++){
+                        const auto u = netVal[iu];
+                        if(u==v) continue;
+                        const auto uc = vtxColors[u];
+                        if(uc>=0) Mask[uc]=v;
+                    }
+                }
+            }
+            int c=0;
+            while(c!=BufSize-1 && Mask[c]==v) c++;
+            vtxColors[v]=c;
+        }
+    } //end omp parallel
+}
+
+// ============================================================================
+// the nets holding a vertex of Q, each once. Only they can have a conflict
+// after Q is recolored, the other nets are done and never walked again.
+// ============================================================================
+void PD2SMPGCColoring::nb_gather_nets(const vector<int>&Q, const vector<int>&vtxPtr, const vector<int>&vtxVal, vector<int>&NetMarked, const int round, vector<int>&nets){
+    const int NQ = Q.size();
+    nets.clear();
+    #pragma omp parallel
+    {
+        vector<int> local_nets;
+        #pragma omp for schedule(dynamic, STEAL_CHUNK) nowait
+        for(int iv=0; iv<NQ; iv++){
+            const auto v = Q[iv];
+            for(int iw=vtxPtr[v]; iw!=vtxPtr[v+1]; iw++){
+                const auto w = vtxVal[iw];
+                if(NetMarked[w]==round) continue;
+                int old;
+                #pragma omp atomic capture
+                { old = NetMarked[w]; NetMarked[w] = round; }
+                if(old!=round) local_nets.push_back(w);
+            }
+        }
+        #pragma omp critical
+        nets.insert(nets.end(), local_nets.begin(), local_nets.end());
+    } //end omp parallel
+}
+
+// ============================================================================
+// lean graph: the nets of the vertices of Q only, in the layout of get_ia()
+// ----------------------------------------------------------------------------
+// subPtr has an entry for every vertex of the side, the vertices not in Q
+// have no nets. This is the part of the transpose the recoloring needs.
+// ============================================================================
+void PD2SMPGCColoring::nb_gather_adjacency(const int side, const vector<int>&Q, vector<int>&subPtr, vector<int>&subVal){
+    const vector<int>& netPtr = get_other_ia(side);
+    const vector<int>& netVal = get_other_ja(side);
+    const int N  = num_nodes(side);
+    const int NN = num_nodes((side==L)?R:L);
+    vector<char> InQ(N, 0);
+    for(const auto v : Q) InQ[v]=1;
+
+    subPtr.assign(N+1, 0);
+    #pragma omp parallel for schedule(dynamic, STEAL_CHUNK)
+    for(int w=0; w<NN; w++){
+        for(int iu=netPtr[w]; iu!=netPtr[w+1]; iu++){
+            const auto u = netVal[iu];
+            if(!InQ[u]) continue;
+            #pragma omp atomic
+            subPtr[u+1]++;
+        }
+    }
+    for(int v=0; v<N; v++) subPtr[v+1]+=subPtr[v];
+    subVal.resize(subPtr[N]);
+    vector<int> tails(subPtr.begin(), subPtr.end()-1);
+    #pragma omp parallel for schedule(dynamic, STEAL_CHUNK)
+    for(int w=0; w<NN; w++){
+        for(int iu=netPtr[w]; iu!=netPtr[w+1]; iu++){
+            const auto u = netVal[iu];
+            if(!InQ[u]) continue;
+            int pos;
+            #pragma omp atomic capture
+            pos = tails[u]++;
+            subVal[pos]=w;
+        }
+    }
+}
+
+
+
+// ============================================================================
+// partial distance two coloring with net based conflicts detection
+// ----------------------------------------------------------------------------
+// round 1: vertex based coloring of all the vertices, a lean graph has no
+//          adjacency of the side so it does a net based coloring instead.
+//          Then net based detection on all the nets.
+// round k: vertex based recoloring of the marked vertices Q, then net based
+//          detection of the nets holding a vertex of Q only.
+// Q only shrinks, in a lean graph the nets of the first Q are gathered once.
+// The two hop walk is deduplicated when a vertex reaches each of its distance
+// two neighbors several times on average.
+// ============================================================================
+int PD2SMPGCColoring::PD2_OMP_NET(int nT, int&colors, vector<int>&vtxColors, const int side) {
+    if(nT<=0) { printf("Warning, number of threads changed from %d to 1\n",nT); nT=1; }
+    omp_set_num_threads(nT);
+
+    double tim_color   =.0;                    // run time
+    double tim_detect  =.0;                    // run time
+    double tim_recolor =.0;                    // run time
+    double tim_gather  =.0;                    // run time
+    double tim_maxc    =.0;                    // run time
+    double tim_total   =.0;                    // run time
+
+    int    n_loops     = 0;
+    int    n_conflicts = 0;                    // Number of conflicts
+
+    const int other   = (side==L)?R:L;
+    const int N       = num_nodes(side);
+    const int NN      = num_nodes(other);
+    const int BufSize = max(pd2_buffer_size(side), max_degree(other)+1);
+    const bool bLean  = !has_adjacency(side);
+    const bool bDedup = avg_degree(side)*avg_degree(other) > DEDUP_RATIO*N;
+
+    colors=0;
+    vtxColors.assign(N, -1);
+
+    vector<int> nets(global_ordered_vertex(other));
+    vector<int> Q;
+    vector<int> Marked(N, 0);
+    vector<int> NetMarked;
+    vector<int> subPtr, subVal;
+
+    // round 1, color all, walk all the nets
+    tim_color =- omp_get_wtime();
+    if(bLean){
+        nb_net_color_phase(side, vtxColors, nets, BufSize);
+        #pragma omp parallel for
+        for(int v=0; v<N; v++)
+            if(vtxColors[v]<0) vtxColors[v]=0;    // in no net
+    }
+    else
+        nb_vertex_color_phase(side, vtxColors, global_ordered_vertex(side), get_ia(side), get_ja(side), BufSize, bDedup);
+    tim_color += omp_get_wtime();
+
+    tim_detect =- omp_get_wtime();
+    nb_detect_phase(side, vtxColors, nets, BufSize, Marked, ++n_loops, Q);
+    tim_detect += omp_get_wtime();
+    n_conflicts += Q.size();
+
+    if(!Q.empty()){
+        tim_gather =- omp_get_wtime();
+        if(bLean) nb_gather_adjacency(side, Q, subPtr, subVal);
+        NetMarked.assign(NN, 0);
+        tim_gather += omp_get_wtime();
+    }
+    const vector<int>& vtxPtr = bLean?subPtr:get_ia(side);
+    const vector<int>& vtxVal = bLean?subVal:get_ja(side);
+
+    // round k, recolor Q, walk its nets only
+    while(!Q.empty()){
+        tim_recolor -= omp_get_wtime();
+        nb_vertex_color_phase(side, vtxColors, Q, vtxPtr, vtxVal, BufSize, bDedup);
+        tim_recolor += omp_get_wtime();
+
+        tim_detect -= omp_get_wtime();
+        n_loops++;
+        nb_gather_nets(Q, vtxPtr, vtxVal, NetMarked, n_loops, nets);
+        nb_detect_phase(side, vtxColors, nets, BufSize, Marked, n_loops, Q);
+        tim_detect += omp_get_wtime();
+        n_conflicts += Q.size();
+    }
+
+    // get number of colors
+    tim_maxc = -omp_get_wtime();
+    colors = pd2_max_color(vtxColors)+1;
+    tim_maxc += omp_get_wtime();
+
+    tim_total = tim_color+tim_detect+tim_recolor+tim_gather+tim_maxc;
+
+    printf("@PD2%s_NET%s%s_nT_c_T_TColor_TDetect_TRecolor_TGather_TMxC_nCnf_nLoop", (side==L)?"L":"R", bLean?"Lean":"", bDedup?"Dedup":"");
+    printf("\t%d",  nT);
+    printf("\t%d",  colors);
+    printf("\t%lf", tim_total);
+    printf("\t%lf", tim_color);
+    printf("\t%lf", tim_detect);
+    printf("\t%lf", tim_recolor);
+    printf("\t%lf", tim_gather);
+    printf("\t%lf", tim_maxc);
+    printf("\t%d",  n_conflicts);
+    printf("\t%d" , n_loops);
+#ifdef SMPGC_VARIFY
+    printf("\t%s", (cnt_pd2conflict(vtxColors, side)==0)?("Success"):("Failed"));
+#endif
+    printf("\n");
+    return true;
+}
+
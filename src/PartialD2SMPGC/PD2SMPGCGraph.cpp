@@ -0,0 +1,260 @@
+/******************************************************************************
+    This file is part of ColPack, which is under its License protection.
+    You should have received a copy of the License. If not, see
+    <https://github.com/CSCsw/ColPack>
+*******************************************************************************/
+
+#include "PD2SMPGCGraph.h"
+#include <time.h>   //clock
+using namespace std;
+using namespace ColPack;
+
+// ============================================================================
+// Construction
+// ============================================================================
+PD2SMPGCGraph::PD2SMPGCGraph(const string& graph_name, const string& format, double* iotime, const int lean) {
+    m_graph_name = graph_name;
+    m_lean = lean;
+    if(m_lean!=LEAN_NONE && m_lean!=L && m_lean!=R) { printf("Error! PD2SMPGCGraph() lean %d is neither LEAN_NONE(%d), L(%d) nor R(%d).\n", m_lean, LEAN_NONE, L, R); exit(1); }
+    if(format=="mm" || format == "MM")
+        do_read_MM_struct(m_graph_name, iotime);
+    else{
+        printf("Error! PD2SMPGCGraph() tried read graph \"%s\" with format \"%s\". But it is not supported\n", graph_name.c_str(), format.c_str());
+        exit(1);
+    }
+}
+
+// ============================================================================
+// Construction from a zero based CSR of the sparsity pattern (rows x cols)
+// ============================================================================
+PD2SMPGCGraph::PD2SMPGCGraph(const int rows, const int cols, const vector<int>& ia, const vector<int>& ja, const int lean) {
+    m_lean = lean;
+    if(m_lean!=LEAN_NONE && m_lean!=L && m_lean!=R) { printf("Error! PD2SMPGCGraph() lean %d is neither LEAN_NONE(%d), L(%d) nor R(%d).\n", m_lean, LEAN_NONE, L, R); exit(1); }
+    if(rows<0 || cols<0 || (int)ia.size()!=rows+1) {
+        printf("Error! PD2SMPGCGraph() got a CSR with %d rows but %d row pointers.\n", rows, (int)ia.size());
+        exit(1);
+    }
+    vector<int> vi, vj;
+    vi.reserve(ja.size()); vj.reserve(ja.size());
+    for(int r=0; r<rows; r++){
+        for(int k=ia[r]; k<ia[r+1]; k++){
+            if(ja[k]<0 || ja[k]>=cols){
+                printf("Error! PD2SMPGCGraph() got column %d in row %d, but there are %d columns.\n", ja[k], r, cols);
+                exit(1);
+            }
+            vi.push_back(r);
+            vj.push_back(ja[k]);
+        }
+    }
+    build_from_entries(rows, cols, vi, vj);
+}
+
+PD2SMPGCGraph::~PD2SMPGCGraph(){
+}
+
+// ============================================================================
+// Read MatrixMarket only structure into memory
+// ----------------------------------------------------------------------------
+// Note: any rectangular matrix. symmetric files are expanded to both triangles
+// ============================================================================
+void PD2SMPGCGraph::do_read_MM_struct(const string& graph_name, double* iotime) {
+    if(graph_name.empty()) { printf("Error! PD2SMPGCGraph() tried to read a graph with empty name.\n"); exit(1); }
+
+    bool bSymmetric = true;
+    int  entry_encount = 0;
+    int  entry_expect  = 0;
+    int  row_expect    = 0;
+    int  col_expect    = 0;
+    string line,word;
+    istringstream iss;
+
+    if(iotime) { *iotime=0; *(clock_t *)iotime = -clock(); }
+    ifstream in(graph_name.c_str());
+    if(!in.is_open()) { printf("Error! PD2SMPGCGraph() cannot open \"%s\".\n", graph_name.c_str()); exit(1); }
+
+    // parse head
+    getline(in, line);
+    iss.str(line);
+    if( !(iss>>word) || word!="\%\%MatrixMarket" || !(iss>>word) || word!="matrix") {
+        printf("Error! PD2SMPGCGraph() read matrix market file \"%s\". But it is not matrix market format.\n", graph_name.c_str());
+        exit(1);
+    }
+    if( !(iss>>word) || word!="coordinate") { //coordinate, array
+        printf("Error! PD2SMPGCGraph() read \"%s\" is a dense matrix. Every pair of columns shares a row, its partial distance two chromatic number is simply N.\n", graph_name.c_str());
+        exit(1);
+    }
+    if( !(iss>>word) || word=="complex") { //complex, integer, real, pattern
+        printf("Warning! PD2SMPGCGraph() graph \"%s\" is a complex matrix. Only non-zero structure will be keeped.\n", graph_name.c_str());
+    }
+    if( !(iss>>word) || word=="general") { //general, symmetric, hermitan, skew-symmetric
+        bSymmetric = false;
+    }
+
+    // parse dimension
+    while(in){
+        getline(in,line);
+        if(line==""||line[0]=='%')
+            continue;
+        break;
+    }
+    if(!in){
+        printf("Error! PD2SMPGCGraph() cannot get graph \"%s\" dimension.\n", graph_name.c_str());
+        exit(1);
+    }
+    iss.clear(); iss.str(line);
+    iss>>row_expect>>col_expect>>entry_expect;
+    if(bSymmetric && row_expect!=col_expect) {
+        printf("Error! PD2SMPGCGraph() read the file \"%s\", it is symmetric but row%d!=col%d\n", graph_name.c_str(), row_expect, col_expect);
+        exit(1);
+    }
+
+    // read entries
+    vector<int> vi, vj;
+    vi.reserve(bSymmetric?2*entry_expect:entry_expect);
+    vj.reserve(bSymmetric?2*entry_expect:entry_expect);
+    int row, col;
+    while(entry_encount<entry_expect && getline(in,line)){
+        if(line=="" || line[0]=='%')
+            continue;
+        entry_encount ++;
+        iss.clear(); iss.str(line);
+        iss>>row>>col;
+        if(row<1 || row>row_expect || col<1 || col>col_expect){
+            printf("Error! PD2SMPGCGraph() read the file \"%s\", entry out of range. %s\n", graph_name.c_str(), line.c_str());
+            exit(1);
+        }
+        row--; col--;              //1-based to 0-based
+        vi.push_back(row); vj.push_back(col);
+        if(bSymmetric && row!=col){
+            vi.push_back(col); vj.push_back(row);
+        }
+    }
+    if(entry_encount != entry_expect){
+        printf("Error! graph \"%s\" expected has %d entries, but we have found %d. Check the file.\n", graph_name.c_str(), entry_expect, entry_encount);
+        exit(1);
+    }
+
+    build_from_entries(row_expect, col_expect, vi, vj);
+
+    if(iotime) { *(clock_t*)iotime += clock(); *iotime = double(*((clock_t*)iotime))/CLOCKS_PER_SEC; }
+    return;
+}
+
+// ============================================================================
+// (vi[k],vj[k]) entries into the sorted CSR and CSC, duplicates removed
+// ----------------------------------------------------------------------------
+// lean mode builds only one of them, the CSC is then sorted from the entries
+// directly, the CSR is never made.
+// ============================================================================
+void PD2SMPGCGraph::build_from_entries(const int rows, const int cols, vector<int>&vi, vector<int>&vj) {
+    m_rows = rows;
+    m_cols = cols;
+    if(m_lean==L){
+        sort_entries(cols, vj, vi, m_tia, m_tja);
+        m_ia.clear();  m_ja.clear();
+        m_nnz = m_tja.size();
+    }
+    else{
+        sort_entries(rows, vi, vj, m_ia, m_ja);
+        m_nnz = m_ja.size();
+        if(m_lean==LEAN_NONE)
+            build_transpose();
+        else{
+            m_tia.clear(); m_tja.clear();
+        }
+    }
+    calc_degrees();
+}
+
+// ============================================================================
+// (vi[k],vj[k]) entries, 0<=vi[k]<n, into ptr/val sorted by vi then vj
+// ----------------------------------------------------------------------------
+// duplicates removed, vi and vj are released
+// ============================================================================
+void PD2SMPGCGraph::sort_entries(const int n, vector<int>&vi, vector<int>&vj, vector<int>&ptr, vector<int>&val) {
+    const int nnz = vi.size();
+
+    // counting sort by vi
+    ptr.assign(n+1, 0);
+    for(int k=0; k<nnz; k++) ptr[vi[k]+1]++;
+    for(int r=0; r<n; r++) ptr[r+1]+=ptr[r];
+    val.resize(nnz);
+    {
+        vector<int> tails(ptr.begin(), ptr.end()-1);
+        for(int k=0; k<nnz; k++) val[tails[vi[k]]++] = vj[k];
+    }
+    vector<int>().swap(vi);
+    vector<int>().swap(vj);
+
+    // sort each list and drop the duplicated entries
+    int pos=0;
+    for(int r=0; r<n; r++){
+        const int beg = ptr[r];
+        const int end = ptr[r+1];
+        sort(val.begin()+beg, val.begin()+end);
+        ptr[r]=pos;
+        for(int k=beg; k<end; k++)
+            if(k==beg || val[k]!=val[k-1])
+                val[pos++]=val[k];
+    }
+    ptr[n]=pos;
+    val.resize(pos);
+    val.shrink_to_fit();
+}
+
+// ============================================================================
+// CSC from CSR. the row indices of a column come out sorted
+// ============================================================================
+void PD2SMPGCGraph::build_transpose() {
+    transpose(m_rows, m_ia, m_ja, m_cols, m_tia, m_tja);
+}
+
+// ============================================================================
+// tptr/tval (m lists) is the transpose of ptr/val (n lists), sorted
+// ============================================================================
+void PD2SMPGCGraph::transpose(const int n, const vector<int>&ptr, const vector<int>&val, const int m, vector<int>&tptr, vector<int>&tval) {
+    const int nnz = val.size();
+    tptr.assign(m+1, 0);
+    for(int k=0; k<nnz; k++) tptr[val[k]+1]++;
+    for(int c=0; c<m; c++) tptr[c+1]+=tptr[c];
+    tval.resize(nnz);
+    vector<int> tails(tptr.begin(), tptr.end()-1);
+    for(int r=0; r<n; r++)
+        for(int k=ptr[r]; k<ptr[r+1]; k++)
+            tval[tails[val[k]]++] = r;
+}
+
+// ============================================================================
+// degree of every vertex of the side, also when its adjacency is not stored
+// ============================================================================
+void PD2SMPGCGraph::get_degrees(const int side, vector<int>& deg) const {
+    const int N = num_nodes(side);
+    deg.assign(N, 0);
+    if(has_adjacency(side)){
+        const vector<int>& vtxPtr = get_ia(side);
+        for(int v=0; v<N; v++) deg[v] = vtxPtr[v+1]-vtxPtr[v];
+    }
+    else{
+        for(const auto v : get_other_ja(side)) deg[v]++;
+    }
+}
+
+// ============================================================================
+// max and min degree of each side
+// ============================================================================
+void PD2SMPGCGraph::calc_degrees() {
+    vector<int> deg;
+    get_degrees(L, deg);
+    m_max_deg_L = 0; m_min_deg_L = m_rows?m_nnz:0;
+    for(const auto d : deg){
+        m_max_deg_L = max(m_max_deg_L, d);
+        m_min_deg_L = min(m_min_deg_L, d);
+    }
+    get_degrees(R, deg);
+    m_max_deg_R = 0; m_min_deg_R = m_cols?m_nnz:0;
+    for(const auto d : deg){
+        m_max_deg_R = max(m_max_deg_R, d);
+        m_min_deg_R = min(m_min_deg_R, d);
+    }
+}
+
@@ -0,0 +1,93 @@
+/******************************************************************************
+    This file is part of ColPack, which is under its License protection.
+    You should have received a copy of the License. If not, see
+    <https://github.com/CSCsw/ColPack>
+*******************************************************************************/
+#ifndef PD2SMPGCGRAPH_H
+#define PD2SMPGCGRAPH_H
+#include "PD2SMPGC.h"
+#include <vector>
+#include <string>
+#include <omp.h>
+#include "ColPackHeaders.h"
+
+using namespace std;
+
+namespace ColPack {
+// ============================================================================
+// Partial Distance Two Shared Memory Parallel Graph Coloring Core
+// ----------------------------------------------------------------------------
+// the bipartite graph is stored twice:
+//   CSR (ia, ja)   row    -> columns, the left  side adjacency
+//   CSC (tia, tja) column -> rows,    the right side adjacency
+// both zero based, neighbors sorted, no duplicates.
+// a, ia, ja. are names inherited from Intel MKL Api
+//
+// lean=L or lean=R keeps only the nets of that side, i.e. the adjacency of
+// the other side: CSR only for coloring the columns (R), CSC only for
+// coloring the rows (L). Then only the net based coloring works on it.
+// ============================================================================
+class PD2SMPGCGraph: public PD2SMPGC{
+public: // Constructions
+    PD2SMPGCGraph(const string& fname, const string& format, double*iotime, const int lean=LEAN_NONE);
+    PD2SMPGCGraph(const int rows, const int cols, const vector<int>& ia, const vector<int>& ja, const int lean=LEAN_NONE);
+    virtual ~PD2SMPGCGraph();
+public: // Constructions
+    PD2SMPGCGraph(PD2SMPGCGraph&&)=delete;
+    PD2SMPGCGraph(const PD2SMPGCGraph&)=delete;
+    PD2SMPGCGraph& operator=(PD2SMPGCGraph&&)=delete;
+    PD2SMPGCGraph& operator=(const PD2SMPGCGraph&)=delete;
+
+public: // APIs
+    int num_rows()  const { return m_rows; }
+    int num_cols()  const { return m_cols; }
+    int num_nnz()   const { return m_nnz;  }
+    int num_nodes(const int side)  const { return (side==L)?num_rows():num_cols(); }
+    int max_degree(const int side) const { return (side==L)?m_max_deg_L:m_max_deg_R; }
+    int min_degree(const int side) const { return (side==L)?m_min_deg_L:m_min_deg_R; }
+    double avg_degree(const int side) const { return (num_nodes(side)==0)?.0:(1.0*num_nnz()/num_nodes(side)); }
+    int  get_lean() const { return m_lean; }
+    bool has_adjacency(const int side) const { return (side==L)?(m_lean!=L):(m_lean!=R); }
+    void get_degrees(const int side, vector<int>& deg) const;
+
+    const vector<int>& get_CSR_ia() const { return m_ia;  }
+    const vector<int>& get_CSR_ja() const { return m_ja;  }
+    const vector<int>& get_CSC_ia() const { return m_tia; }
+    const vector<int>& get_CSC_ja() const { return m_tja; }
+
+    // adjacency of the side, and of the other side
+    const vector<int>& get_ia(const int side) const { return (side==L)?m_ia :m_tia; }
+    const vector<int>& get_ja(const int side) const { return (side==L)?m_ja :m_tja; }
+    const vector<int>& get_other_ia(const int side) const { return (side==L)?m_tia:m_ia; }
+    const vector<int>& get_other_ja(const int side) const { return (side==L)?m_tja:m_ja; }
+
+protected: // implements
+    virtual void do_read_MM_struct(const string& fname, double*iotime);
+    void build_from_entries(const int rows, const int cols, vector<int>&vi, vector<int>&vj);
+    void build_transpose();
+    void calc_degrees();
+    static void sort_entries(const int n, vector<int>&vi, vector<int>&vj, vector<int>&ptr, vector<int>&val);
+    static void transpose(const int n, const vector<int>&ptr, const vector<int>&val, const int m, vector<int>&tptr, vector<int>&tval);
+
+protected:
+    vector<int> m_ia;   // row    pointers; size: rows + 1
+    vector<int> m_ja;   // column indices;  size: nnz
+    vector<int> m_tia;  // column pointers; size: cols + 1
+    vector<int> m_tja;  // row indices;     size: nnz
+
+    int m_rows;
+    int m_cols;
+    int m_nnz;
+    int m_lean;         // LEAN_NONE, or the side whose own adjacency is not stored
+
+    int m_max_deg_L;
+    int m_min_deg_L;
+    int m_max_deg_R;
+    int m_min_deg_R;
+
+    string m_graph_name;
+};
+
+}
+#endif
+
@@ -0,0 +1,211 @@
+/******************************************************************************
+    This file is part of ColPack, which is under its License protection.
+    You should have received a copy of the License. If not, see
+    <https://github.com/CSCsw/ColPack>
+*******************************************************************************/
+
+#include "PD2SMPGCOrdering.h"
+#include <time.h>  //clock
+using namespace std;
+using namespace ColPack;
+
+
+// ============================================================================
+// Construction
+// ============================================================================
+PD2SMPGCOrdering::PD2SMPGCOrdering(const string& graph_name, const string& fmt, double*iotime, const string& order, double* ordtime, const int lean)
+: PD2SMPGCGraph(graph_name, fmt, iotime, lean), m_mt(SMPGC::RAND_SEED) {
+    global_ordering(order, ordtime);
+}
+
+PD2SMPGCOrdering::PD2SMPGCOrdering(const int rows, const int cols, const vector<int>& ia, const vector<int>& ja, const string& order, double* ordtime, const int lean)
+: PD2SMPGCGraph(rows, cols, ia, ja, lean), m_mt(SMPGC::RAND_SEED) {
+    global_ordering(order, ordtime);
+}
+
+PD2SMPGCOrdering::~PD2SMPGCOrdering(){}
+
+
+// ============================================================================
+// global ordering of both sides
+// ============================================================================
+void PD2SMPGCOrdering::global_ordering(const string& order, double * ordtime){
+    if(ordtime) *(time_t*)ordtime=-clock();
+
+    for(int side=L; side<=R; side++){
+        if(order == "NATURAL")
+            global_natural_ordering(side);
+        else if(order == "RANDOM")
+            global_random_ordering(side);
+        else if(order == "LARGEST_FIRST")
+            global_largest_degree_first_ordering(side);
+        else{
+            fprintf(stderr, "Err! PD2SMPGCOrdering::Unknow order %s\n",order.c_str());
+            exit(1);
+        }
+    }
+    m_global_ordered_method = order;
+    if(ordtime){ *(time_t*)ordtime+=clock(); *ordtime =(double)(*(time_t*)ordtime)/CLOCKS_PER_SEC; }
+}
+
+// ============================================================================
+// Natural is 0 1 2 3 4 5 6 7 ...
+// ============================================================================
+void PD2SMPGCOrdering::global_natural_ordering(const int side){
+    const int N = num_nodes(side);
+    vector<int>& ord = m_global_ordered_vertex[side];
+    ord.resize(N);
+    for(int i=0; i<N; i++) ord[i]=i;
+}
+
+// ============================================================================
+// Random is shuffle to natural
+// ============================================================================
+void PD2SMPGCOrdering::global_random_ordering(const int side){
+    const int N = num_nodes(side);
+    vector<int>& ord = m_global_ordered_vertex[side];
+    ord.resize(N);
+    for(int i=0; i<N; i++) ord[i]=i;
+    for(int i=0; i<N-1; i++){
+        uniform_int_distribution<int> dist(i, N-1);
+        swap(ord[i], ord[dist(m_mt)]);
+    }
+}
+
+// ============================================================================
+// Largest Degree First
+// ============================================================================
+void PD2SMPGCOrdering::global_largest_degree_first_ordering(const int side){
+    const int N = num_nodes(side);
+    const int MaxDegreeP1 = max_degree(side)+1;
+    vector<vector<int>> GroupedVertexDegree(MaxDegreeP1);
+    vector<int>& ord = m_global_ordered_vertex[side];
+    vector<int> deg;
+    get_degrees(side, deg);
+
+    for(int v=0; v<N; v++)
+        GroupedVertexDegree[deg[v]].push_back(v);
+
+    ord.clear();
+    for(int d=MaxDegreeP1-1; d>=0; d--)
+        ord.insert(ord.end(), GroupedVertexDegree[d].begin(), GroupedVertexDegree[d].end());
+}
+
+
+// ============================================================================
+// local Natural is just sort ...
+// ============================================================================
+void PD2SMPGCOrdering::local_natural_ordering(vector<int>&vtxs){
+    sort(vtxs.begin(), vtxs.end());
+}
+
+// ============================================================================
+// Random is shuffle to natural
+// ----------------------------------------------------------------------------
+// called by all the threads at once, so each call has its own generator,
+// seeded by RAND_SEED and the first vertex of the list.
+// ============================================================================
+void PD2SMPGCOrdering::local_random_ordering (vector<int>&vtxs) {
+    sort(vtxs.begin(), vtxs.end());
+    const int N=vtxs.size();
+    if(N<=1) return;
+    mt19937 mt(RAND_SEED+vtxs[0]);
+    for(int i=0; i<N-1; i++){
+        uniform_int_distribution<int> dist(i, N-1);
+        swap(vtxs[i], vtxs[dist(mt)]);
+    }
+}
+
+// ============================================================================
+// Largest Degree First
+// ============================================================================
+void PD2SMPGCOrdering::local_largest_degree_first_ordering(vector<int>& vtxs, const int side){
+    const vector<int>& verPtr = get_ia(side);
+    const int MaxDegreeP1 = max_degree(side)+1;
+
+    vector<vector<int>> GroupedVertexDegree(MaxDegreeP1);
+
+    for(const auto v : vtxs)
+        GroupedVertexDegree[verPtr[v+1]-verPtr[v]].push_back(v);
+
+    vtxs.clear();
+    for(int d=MaxDegreeP1-1; d>=0; d--)
+        vtxs.insert(vtxs.end(), GroupedVertexDegree[d].begin(), GroupedVertexDegree[d].end());
+}
+
+
+// ============================================================================
+// Smallest Degree Last
+// ----------------------------------------------------------------------------
+// Same B1b variation as SMPGCOrdering: the smallest degree vertices are picked
+// as a whole batch, only the local vertices are updated. The starting degree
+// is the number of nonzeros; removing v decreases by one the degree of every
+// local distance two neighbor of v still in the graph.
+// ============================================================================
+void PD2SMPGCOrdering::local_smallest_degree_last_ordering(vector<int>& vtxs, const int side){
+    const vector<int>& verPtr = get_ia(side);
+    const vector<int>& verVal = get_ja(side);
+    const vector<int>& othPtr = get_other_ia(side);
+    const vector<int>& othVal = get_other_ja(side);
+    const int MaxDegreeP1 = max_degree(side)+1;
+    const int N = num_nodes(side);
+    const auto Nloc = vtxs.size();
+    vector<int> Vertex2Degree(N,-1);
+    vector<int> Vertex2Index(N,-1);
+    vector<int> Visited(N,-1);
+    vector<vector<int>> GroupedVertexDegree(MaxDegreeP1);
+    int max_deg = 0;
+    int min_deg = MaxDegreeP1-1;
+    // set up environment
+    for(const auto v: vtxs){
+        const int deg = verPtr[v+1]-verPtr[v];
+        Vertex2Degree[v]=deg;
+        Vertex2Index [v]=GroupedVertexDegree[deg].size();
+        GroupedVertexDegree[deg].push_back(v);
+        if(max_deg<deg) max_deg=deg;
+        if(min_deg>deg) min_deg=deg;
+    }
+
+    vtxs.clear();
+    while(vtxs.size()!=Nloc){
+        const auto prev_vtxs_size=vtxs.size();
+
+        // picked up lowest degree vertices, move to order, remove from graph
+        for(; min_deg<=max_deg; min_deg++){
+            if(GroupedVertexDegree[min_deg].empty())
+                continue;
+            vtxs.insert(vtxs.end(), GroupedVertexDegree[min_deg].begin(), GroupedVertexDegree[min_deg].end());
+            for(auto v : GroupedVertexDegree[min_deg]){
+                Vertex2Degree[v]=-1;
+                Vertex2Index [v]=-1;
+            }
+            break;
+        }
+        GroupedVertexDegree[min_deg].clear();
+        // for all their distance two neighbors decrease degree by one, if it's local
+        for(auto vit=prev_vtxs_size; vit<vtxs.size(); vit++){
+            const auto v = vtxs[vit];
+            for(auto wit = verPtr[v]; wit<verPtr[v+1]; wit++) {
+                const int w = verVal[wit];
+                for(auto uit = othPtr[w]; uit<othPtr[w+1]; uit++) {
+                    const int u = othVal[uit];
+                    const int deg = Vertex2Degree[u];
+                    if(deg<=0 || Visited[u]==v) // <0 means u is not local, or have deleted
+                        continue;
+                    Visited[u]=v;
+                    const int degM1 = deg-1;
+                    if(min_deg > degM1) min_deg=degM1;
+                    auto tmpv = GroupedVertexDegree[deg][Vertex2Index[u]] = GroupedVertexDegree[deg].back();
+                    Vertex2Index [tmpv] = Vertex2Index[u];
+                    GroupedVertexDegree[deg].pop_back();
+                    Vertex2Degree[u] = degM1;
+                    Vertex2Index [u] = GroupedVertexDegree[degM1].size();
+                    GroupedVertexDegree[degM1].push_back(u);
+                }//end of for u
+            }//end of for w
+        }//end of for v
+
+    }//end of while
+    return;
+}
+
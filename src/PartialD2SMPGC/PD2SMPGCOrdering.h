@@ -0,0 +1,65 @@
+/******************************************************************************
+    This file is part of ColPack, which is under its License protection.
+    You should have received a copy of the License. If not, see
+    <https://github.com/CSCsw/ColPack>
+*******************************************************************************/
+#ifndef PD2SMPGCORDERING_H
+#define PD2SMPGCORDERING_H
+#include <vector>
+#include <iostream>
+#include <omp.h>
+#include "ColPackHeaders.h"
+#include "PD2SMPGCGraph.h"
+#include <random>
+#include <algorithm>
+
+using namespace std;
+
+namespace ColPack {
+
+// ============================================================================
+// Partial Distance Two Shared Memory Parallel Graph Coloring Ordering wrap
+// ----------------------------------------------------------------------------
+// the global ordering is kept for both sides, the local orderings work on
+// the vertices of one side. The degree of a vertex is its number of nonzeros.
+// The local orderings need the adjacency of the side, see has_adjacency().
+// ============================================================================
+class PD2SMPGCOrdering : public PD2SMPGCGraph {
+public: // construction
+    PD2SMPGCOrdering(const string& file_name, const string& fmt, double*iotime, const string& order, double *ordtime, const int lean=LEAN_NONE);
+    PD2SMPGCOrdering(const int rows, const int cols, const vector<int>& ia, const vector<int>& ja, const string& order, double *ordtime, const int lean=LEAN_NONE);
+    virtual ~PD2SMPGCOrdering();
+
+public: // deplete construction
+    PD2SMPGCOrdering(PD2SMPGCOrdering&&)=delete;
+    PD2SMPGCOrdering(const PD2SMPGCOrdering&)=delete;
+    PD2SMPGCOrdering& operator=(PD2SMPGCOrdering&&)=delete;
+    PD2SMPGCOrdering& operator=(const PD2SMPGCOrdering&)=delete;
+
+public: // API: global ordering
+    void global_ordering(const string& order, double*t);
+    const vector<int>& global_ordered_vertex(const int side) const { return m_global_ordered_vertex[side]; }
+    const string&      global_ordered_method() const { return m_global_ordered_method; }
+    void set_rseed(const int x){ m_mt.seed(x); }
+
+protected:
+    void global_natural_ordering(const int side);
+    void global_random_ordering(const int side);
+    void global_largest_degree_first_ordering(const int side);
+
+protected: // API: local ordering
+    void local_natural_ordering(vector<int>& vtxs);
+    void local_random_ordering (vector<int>& vtxs);
+    void local_largest_degree_first_ordering(vector<int>& vtxs, const int side);
+    void local_smallest_degree_last_ordering(vector<int>& vtxs, const int side);
+
+protected: // members
+    vector<int> m_global_ordered_vertex[2];
+    string      m_global_ordered_method;
+    mt19937     m_mt;
+};
+
+
+}// endof namespace ColPack
+#endif
+
@@ -17,54 +17,50 @@ namespace ColPack
 			return _FALSE;
 		}
 
-		int rowCount = g->GetVertexCount();
-		int colorCount = g->GetVertexColorCount();
-		//cout<<"colorCount="<<colorCount<<endl;
-		vector<int> vi_VertexColors;
-		g->GetVertexColors(vi_VertexColors);
+		vector<int> vi_SeedColors;
+		g->GetSeedColors(vi_SeedColors);
 
-		//Do (column-)color statistic for each row, i.e., see how many elements in that row has color 0, color 1 ...
-		int** colorStatistic = new int*[rowCount];	//color statistic for each row. For example, colorStatistic[0] is color statistic for row 0
-													//If row 0 has 5 columns with color 3 => colorStatistic[0][3] = 5;
-		//Allocate memory for colorStatistic[rowCount][colorCount] and initilize the matrix
-		for(unsigned int i=0; i < (unsigned int)rowCount; i++) {
-			colorStatistic[i] = new int[colorCount];
-			for(unsigned int j=0; j < (unsigned int)colorCount; j++) colorStatistic[i][j] = 0;
-		}
+		return DirectRecover_RowCompressedFormat_usermem(vi_SeedColors, dp2_CompressedMatrix, uip2_HessianSparsityPattern, dp3_HessianValue);
+	}
 
-		//populate colorStatistic
-		for(unsigned int i=0; i < (unsigned int)rowCount; i++) {
-			int numOfNonZeros = uip2_HessianSparsityPattern[i][0];
-			for(unsigned int j=1; j <= (unsigned int)numOfNonZeros; j++) {
-				//non-zero in the Hessian: [i][uip2_HessianSparsityPattern[i][j]]
-				//color of that column: vi_VertexColors[uip2_HessianSparsityPattern[i][j]]
-				colorStatistic[i][vi_VertexColors[uip2_HessianSparsityPattern[i][j]]]++;
-			}
+	int HessianRecovery::DirectRecover_RowCompressedFormat_usermem(const vector<int>& vi_SeedColors, double** dp2_CompressedMatrix, unsigned int ** uip2_HessianSparsityPattern, double*** dp3_HessianValue) {
+
+		int rowCount = vi_SeedColors.size();
+
+		int colorCount = 0;
+		for(size_t i=0; i < vi_SeedColors.size(); i++) {
+			if(colorCount <= vi_SeedColors[i]) colorCount = vi_SeedColors[i] + 1;
 		}
 
+		//(column-)color statistic of the current row only, i.e., how many elements in that row have color 0, color 1 ...
+		//it is cleared after each row, so the cost is O(nnz) instead of O(rowCount x colorCount)
+		vector<int> colorStatistic(colorCount, 0);
+
 		//Now, go to the main part, recover the values of non-zero entries in the Hessian
 		for(unsigned int i=0; i < (unsigned int)rowCount; i++) {
 			unsigned int numOfNonZeros = uip2_HessianSparsityPattern[i][0];
+			for(unsigned int j=1; j <= numOfNonZeros; j++) {
+				colorStatistic[vi_SeedColors[uip2_HessianSparsityPattern[i][j]]]++;
+			}
+
 			for(unsigned int j=1; j <= numOfNonZeros; j++) {
 				if(i == uip2_HessianSparsityPattern[i][j]) { // the non-zero is in the diagonal of the matrix
-					(*dp3_HessianValue)[i][j] = dp2_CompressedMatrix[i][vi_VertexColors[i]];
-					//printf("Recover diagonal (*dp3_HessianValue)[%d][%d] = %f from dp2_CompressedMatrix[%d][%d] \n", i, j, dp2_CompressedMatrix[i][vi_VertexColors[i]], i, vi_VertexColors[i]);
+					(*dp3_HessianValue)[i][j] = dp2_CompressedMatrix[i][vi_SeedColors[i]];
 				}
 				else {// i != uip2_HessianSparsityPattern[i][j] // the non-zero is NOT in the diagonal of the matrix
-					if(colorStatistic[i][vi_VertexColors[uip2_HessianSparsityPattern[i][j]]]==1) {
-						(*dp3_HessianValue)[i][j] = dp2_CompressedMatrix[i][vi_VertexColors[uip2_HessianSparsityPattern[i][j]]];
-						//printf("Recover (*dp3_HessianValue)[%d][%d] = %f from dp2_CompressedMatrix[%d][%d] \n", i, j, dp2_CompressedMatrix[i][vi_VertexColors[uip2_HessianSparsityPattern[i][j]]], i, vi_VertexColors[uip2_HessianSparsityPattern[i][j]]);
+					if(colorStatistic[vi_SeedColors[uip2_HessianSparsityPattern[i][j]]]==1) {
+						(*dp3_HessianValue)[i][j] = dp2_CompressedMatrix[i][vi_SeedColors[uip2_HessianSparsityPattern[i][j]]];
 					}
 					else {
-						(*dp3_HessianValue)[i][j] = dp2_CompressedMatrix[uip2_HessianSparsityPattern[i][j]][vi_VertexColors[i]];
-						//printf("Recover (*dp3_HessianValue)[%d][%d] = %f from dp2_CompressedMatrix[%d][%d] \n", i, j, dp2_CompressedMatrix[uip2_HessianSparsityPattern[i][j]][vi_VertexColors[i]], uip2_HessianSparsityPattern[i][j], vi_VertexColors[i]);
+						(*dp3_HessianValue)[i][j] = dp2_CompressedMatrix[uip2_HessianSparsityPattern[i][j]][vi_SeedColors[i]];
 					}
 				}
 			}
-		}
 
-		free_2DMatrix(colorStatistic, rowCount);
-		colorStatistic = NULL;
+			for(unsigned int j=1; j <= numOfNonZeros; j++) {
+				colorStatistic[vi_SeedColors[uip2_HessianSparsityPattern[i][j]]] = 0;
+			}
+		}
 
 		return (rowCount);
 	}
@@ -78,13 +74,7 @@ namespace ColPack
 		int rowCount = g->GetVertexCount();
 
 		//allocate memory for *dp3_HessianValue. The dp3_HessianValue and uip2_HessianSparsityPattern matrices should have the same size
-		*dp3_HessianValue = (double**) malloc(rowCount * sizeof(double*));
-		for(unsigned int i=0; i < (unsigned int)rowCount; i++) {
-			unsigned int numOfNonZeros = uip2_HessianSparsityPattern[i][0];
-			(*dp3_HessianValue)[i] = (double*) malloc( (numOfNonZeros+1) * sizeof(double) );
-			(*dp3_HessianValue)[i][0] = numOfNonZeros; //initialize value of the 1st entry
-			for(unsigned int j=1; j <= numOfNonZeros; j++) (*dp3_HessianValue)[i][j] = 0.; //initialize value of other entries
-		}
+		if(AllocateRowCompressedFormat(rowCount, uip2_HessianSparsityPattern, dp3_HessianValue) != _TRUE) return _FALSE;
 
 		return DirectRecover_RowCompressedFormat_usermem(g, dp2_CompressedMatrix, uip2_HessianSparsityPattern, dp3_HessianValue);
 	}
@@ -96,6 +86,7 @@ namespace ColPack
 		if(AF_available) reset();
 
 		AF_available = true;
+		i_AF_MatrixAllocation = i_MatrixAllocation;
 		i_AF_rowCount = g->GetVertexCount();
 		dp2_AF_Value = *dp3_HessianValue;
 
@@ -343,55 +334,55 @@ namespace ColPack
 	}
 */
 	int HessianRecovery::DirectRecover_CoordinateFormat_vectors(GraphColoringInterface* g, double** dp2_CompressedMatrix, unsigned int ** uip2_HessianSparsityPattern, vector<unsigned int> &RowIndex, vector<unsigned int> &ColumnIndex, vector<double> &HessianValue) {
-		int rowCount = g->GetVertexCount();
-		int colorCount = g->GetVertexColorCount();
-		//cout<<"colorCount="<<colorCount<<endl;
-		vector<int> vi_VertexColors;
-		g->GetVertexColors(vi_VertexColors);
 
-		//Do (column-)color statistic for each row, i.e., see how many elements in that row has color 0, color 1 ...
-		int** colorStatistic = new int*[rowCount];	//color statistic for each row. For example, colorStatistic[0] is color statistic for row 0
-													//If row 0 has 5 columns with color 3 => colorStatistic[0][3] = 5;
-		//Allocate memory for colorStatistic[rowCount][colorCount] and initilize the matrix
-		for(unsigned int i=0; i < (unsigned int)rowCount; i++) {
-			colorStatistic[i] = new int[colorCount];
-			for(unsigned int j=0; j < (unsigned int)colorCount; j++) colorStatistic[i][j] = 0;
-		}
+		vector<int> vi_SeedColors;
+		g->GetSeedColors(vi_SeedColors);
 
-		//populate colorStatistic
-		for(unsigned int i=0; i < (unsigned int)rowCount; i++) {
-			int numOfNonZeros = uip2_HessianSparsityPattern[i][0];
-			for(unsigned int j=1; j <= (unsigned int)numOfNonZeros; j++) {
-				//non-zero in the Hessian: [i][uip2_HessianSparsityPattern[i][j]]
-				//color of that column: vi_VertexColors[uip2_HessianSparsityPattern[i][j]]
-				colorStatistic[i][vi_VertexColors[uip2_HessianSparsityPattern[i][j]]]++;
-			}
+		return DirectRecover_CoordinateFormat_vectors(vi_SeedColors, dp2_CompressedMatrix, uip2_HessianSparsityPattern, RowIndex, ColumnIndex, HessianValue);
+	}
+
+	int HessianRecovery::DirectRecover_CoordinateFormat_vectors(const vector<int>& vi_SeedColors, double** dp2_CompressedMatrix, unsigned int ** uip2_HessianSparsityPattern, vector<unsigned int> &RowIndex, vector<unsigned int> &ColumnIndex, vector<double> &HessianValue) {
+
+		int rowCount = vi_SeedColors.size();
+
+		int colorCount = 0;
+		for(size_t i=0; i < vi_SeedColors.size(); i++) {
+			if(colorCount <= vi_SeedColors[i]) colorCount = vi_SeedColors[i] + 1;
 		}
 
+		//(column-)color statistic of the current row only, i.e., how many elements in that row have color 0, color 1 ...
+		//it is cleared after each row, so the cost is O(nnz) instead of O(rowCount x colorCount)
+		vector<int> colorStatistic(colorCount, 0);
+
 		//Now, go to the main part, recover the values of non-zero entries in the Hessian
 		for(unsigned int i=0; i < (unsigned int)rowCount; i++) {
 			unsigned int numOfNonZeros = uip2_HessianSparsityPattern[i][0];
+			for(unsigned int j=1; j <= numOfNonZeros; j++) {
+				colorStatistic[vi_SeedColors[uip2_HessianSparsityPattern[i][j]]]++;
+			}
+
 			for(unsigned int j=1; j <= numOfNonZeros; j++) {
 				if(uip2_HessianSparsityPattern[i][j]<i) continue;
 
 				if(i == uip2_HessianSparsityPattern[i][j]) { // the non-zero is in the diagonal of the matrix
-					HessianValue.push_back(dp2_CompressedMatrix[i][vi_VertexColors[i]]);
+					HessianValue.push_back(dp2_CompressedMatrix[i][vi_SeedColors[i]]);
 				}
 				else {// i != uip2_HessianSparsityPattern[i][j] // the non-zero is NOT in the diagonal of the matrix
-					if(colorStatistic[i][vi_VertexColors[uip2_HessianSparsityPattern[i][j]]]==1) {
-						HessianValue.push_back(dp2_CompressedMatrix[i][vi_VertexColors[uip2_HessianSparsityPattern[i][j]]]);
+					if(colorStatistic[vi_SeedColors[uip2_HessianSparsityPattern[i][j]]]==1) {
+						HessianValue.push_back(dp2_CompressedMatrix[i][vi_SeedColors[uip2_HessianSparsityPattern[i][j]]]);
 					}
 					else {
-						HessianValue.push_back(dp2_CompressedMatrix[uip2_HessianSparsityPattern[i][j]][vi_VertexColors[i]]);
+						HessianValue.push_back(dp2_CompressedMatrix[uip2_HessianSparsityPattern[i][j]][vi_SeedColors[i]]);
 					}
 				}
 				RowIndex.push_back(i);
 				ColumnIndex.push_back(uip2_HessianSparsityPattern[i][j]);
 			}
-		}
 
-		free_2DMatrix(colorStatistic, rowCount);
-		colorStatistic = NULL;
+			for(unsigned int j=1; j <= numOfNonZeros; j++) {
+				colorStatistic[vi_SeedColors[uip2_HessianSparsityPattern[i][j]]] = 0;
+			}
+		}
 
 		return (RowIndex.size());
 	}
@@ -402,13 +393,21 @@ namespace ColPack
 			return _FALSE;
 		}
 
+		vector<int> vi_SeedColors;
+		g->GetSeedColors(vi_SeedColors);
+
+		return DirectRecover_CoordinateFormat_usermem(vi_SeedColors, dp2_CompressedMatrix, uip2_HessianSparsityPattern, ip2_RowIndex, ip2_ColumnIndex, dp2_HessianValue);
+	}
+
+	int HessianRecovery::DirectRecover_CoordinateFormat_usermem(const vector<int>& vi_SeedColors, double** dp2_CompressedMatrix, unsigned int ** uip2_HessianSparsityPattern, unsigned int** ip2_RowIndex, unsigned int** ip2_ColumnIndex, double** dp2_HessianValue) {
+
 		vector<unsigned int> RowIndex;
 		vector<unsigned int> ColumnIndex;
 		vector<double> HessianValue;
 
 //		int returnValue = DirectRecover_CoordinateFormat_vectors_OMP(g, dp2_CompressedMatrix, uip2_HessianSparsityPattern, RowIndex, ColumnIndex, HessianValue);
 
-		int returnValue = DirectRecover_CoordinateFormat_vectors(g, dp2_CompressedMatrix, uip2_HessianSparsityPattern, RowIndex, ColumnIndex, HessianValue);
+		int returnValue = DirectRecover_CoordinateFormat_vectors(vi_SeedColors, dp2_CompressedMatrix, uip2_HessianSparsityPattern, RowIndex, ColumnIndex, HessianValue);
 
 		unsigned int numOfNonZeros = RowIndex.size();
 
@@ -569,6 +568,7 @@ namespace ColPack
 
 		DisjointSets ds_DisjointSets;
 		g->GetDisjointSets(ds_DisjointSets);
+		ds_DisjointSets.Flatten();
 
 		//populate vi_Sets & mivi_VertexSets
 		vi_Sets.clear();
@@ -887,13 +887,7 @@ namespace ColPack
 		int rowCount = g->GetVertexCount();
 
 		//allocate memory for *dp3_HessianValue. The dp3_HessianValue and uip2_HessianSparsityPattern matrices should have the same size
-		*dp3_HessianValue = (double**) malloc(rowCount * sizeof(double*));
-		for(unsigned int i=0; i < (unsigned int)rowCount; i++) {
-			unsigned int numOfNonZeros = uip2_HessianSparsityPattern[i][0];
-			(*dp3_HessianValue)[i] = (double*) malloc( (numOfNonZeros+1) * sizeof(double) );
-			(*dp3_HessianValue)[i][0] = numOfNonZeros; //initialize value of the 1st entry
-			for(unsigned int j=1; j <= numOfNonZeros; j++) (*dp3_HessianValue)[i][j] = 0.; //initialize value of other entries
-		}
+		if(AllocateRowCompressedFormat(rowCount, uip2_HessianSparsityPattern, dp3_HessianValue) != _TRUE) return _FALSE;
 
 		return IndirectRecover_RowCompressedFormat_usermem(g, dp2_CompressedMatrix, uip2_HessianSparsityPattern, dp3_HessianValue);
 	}
@@ -905,6 +899,7 @@ namespace ColPack
 		if(AF_available) reset();
 
 		AF_available = true;
+		i_AF_MatrixAllocation = i_MatrixAllocation;
 		i_AF_rowCount = g->GetVertexCount();
 		dp2_AF_Value = *dp3_HessianValue;
 
@@ -952,6 +947,7 @@ namespace ColPack
 
 		DisjointSets ds_DisjointSets;
 		g->GetDisjointSets(ds_DisjointSets);
+		ds_DisjointSets.Flatten();
 
 		//populate vi_Sets & mivi_VertexSets
 		vi_Sets.clear();
@@ -1382,6 +1378,7 @@ cout<<"*WriteMatrixMarket_ADOLCInput("<<s_postfix<<", 2, uip2_HessianSparsityPat
 		g->GetVertexEdgeMap(mimi2_VertexEdgeMap);
 		DisjointSets ds_DisjointSets;
 		g->GetDisjointSets(ds_DisjointSets);
+		ds_DisjointSets.Flatten();
 		//populate vi_Sets & mivi_VertexSets
 		vi_Sets.clear();
 		mivi_VertexSets.clear();
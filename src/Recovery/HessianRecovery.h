@@ -90,6 +90,13 @@ namespace ColPack
 		*/
 		int DirectRecover_RowCompressedFormat_usermem(GraphColoringInterface* g, double** dp2_CompressedMatrix, unsigned int ** uip2_HessianSparsityPattern, double*** dp3_HessianValue);
 
+		/// Same as DirectRecover_RowCompressedFormat_usermem(), except that the coloring is given in the compact form of its Seed matrix instead of the graph
+		/** Notes:
+		- vi_SeedColors comes from GraphColoring::GetSeedColors().
+		The color statistic is kept for one row at a time, so no rows x colors matrix is allocated.
+		*/
+		int DirectRecover_RowCompressedFormat_usermem(const vector<int>& vi_SeedColors, double** dp2_CompressedMatrix, unsigned int ** uip2_HessianSparsityPattern, double*** dp3_HessianValue);
+
 
 		/// A routine for recovering a Hessian from a star-coloring based compressed representation.
 		/**
@@ -124,6 +131,13 @@ namespace ColPack
 		*/
 //		int DirectRecover_CoordinateFormat_usermem_serial(GraphColoringInterface* g, double** dp2_CompressedMatrix, unsigned int ** uip2_HessianSparsityPattern, unsigned int** uip2_RowIndex, unsigned int** uip2_ColumnIndex, double** dp2_HessianValue);
 		int DirectRecover_CoordinateFormat_usermem(GraphColoringInterface* g, double** dp2_CompressedMatrix, unsigned int ** uip2_HessianSparsityPattern, unsigned int** uip2_RowIndex, unsigned int** uip2_ColumnIndex, double** dp2_HessianValue);
+
+		/// Same as DirectRecover_CoordinateFormat_usermem(), except that the coloring is given in the compact form of its Seed matrix instead of the graph
+		/** Notes:
+		- vi_SeedColors comes from GraphColoring::GetSeedColors().
+		The color statistic is kept for one row at a time, so no rows x colors matrix is allocated.
+		*/
+		int DirectRecover_CoordinateFormat_usermem(const vector<int>& vi_SeedColors, double** dp2_CompressedMatrix, unsigned int ** uip2_HessianSparsityPattern, unsigned int** uip2_RowIndex, unsigned int** uip2_ColumnIndex, double** dp2_HessianValue);
 		//int DirectRecover_CoordinateFormat_usermem_OMP(GraphColoringInterface* g, double** dp2_CompressedMatrix, unsigned int ** uip2_HessianSparsityPattern, unsigned int** uip2_RowIndex, unsigned int** uip2_ColumnIndex, double** dp2_HessianValue);
 
 
@@ -286,6 +300,7 @@ namespace ColPack
 
 	  private:
 		int DirectRecover_CoordinateFormat_vectors(GraphColoringInterface* g, double** dp2_CompressedMatrix, unsigned int ** uip2_HessianSparsityPattern, vector<unsigned int> &RowIndex, vector<unsigned int> &ColumnIndex, vector<double> &HessianValue);
+		int DirectRecover_CoordinateFormat_vectors(const vector<int>& vi_SeedColors, double** dp2_CompressedMatrix, unsigned int ** uip2_HessianSparsityPattern, vector<unsigned int> &RowIndex, vector<unsigned int> &ColumnIndex, vector<double> &HessianValue);
 //		int DirectRecover_CoordinateFormat_vectors_OMP(GraphColoringInterface* g, double** dp2_CompressedMatrix, unsigned int ** uip2_HessianSparsityPattern, vector<unsigned int> &RowIndex, vector<unsigned int> &ColumnIndex, vector<double> &HessianValue);
 		int IndirectRecover_CoordinateFormat_vectors(GraphColoringInterface* g, double** dp2_CompressedMatrix, unsigned int ** uip2_HessianSparsityPattern, vector<unsigned int> &RowIndex, vector<unsigned int> &ColumnIndex, vector<double> &HessianValue);
 	};
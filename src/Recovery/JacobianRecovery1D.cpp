@@ -18,16 +18,9 @@ namespace ColPack
 		}
 
 		int rowCount = g->GetRowVertexCount();
-		unsigned int numOfNonZeros = 0;
 
 		//allocate memory for *dp3_JacobianValue. The dp3_JacobianValue and uip2_JacobianSparsityPattern matrices should have the same size
-		*dp3_JacobianValue = (double**) malloc(rowCount * sizeof(double*));
-		for(unsigned int i=0; i < (unsigned int)rowCount; i++) {
-			numOfNonZeros = uip2_JacobianSparsityPattern[i][0];
-			(*dp3_JacobianValue)[i] = (double*) malloc( (numOfNonZeros+1) * sizeof(double) );
-			(*dp3_JacobianValue)[i][0] = numOfNonZeros; //initialize value of the 1st entry
-			for(size_t j=1; j <=  numOfNonZeros; j++) (*dp3_JacobianValue)[i][j] = 0.; //initialize value of other entries
-		}
+		if(AllocateRowCompressedFormat(rowCount, uip2_JacobianSparsityPattern, dp3_JacobianValue) != _TRUE) return _FALSE;
 
 		return RecoverD2Row_RowCompressedFormat_usermem(g, dp2_CompressedMatrix, uip2_JacobianSparsityPattern, dp3_JacobianValue);
 	}
@@ -38,25 +31,22 @@ namespace ColPack
 			return _FALSE;
 		}
 
-		int rowCount = g->GetRowVertexCount();
-		vector<int> vi_LeftVertexColors;
-		g->GetLeftVertexColors(vi_LeftVertexColors);
-		unsigned int numOfNonZeros = 0;
+		vector<int> vi_LeftSeedColors;
+		g->GetLeftSeedColors(vi_LeftSeedColors);
 
-		//allocate memory for *dp3_JacobianValue. The dp3_JacobianValue and uip2_JacobianSparsityPattern matrices should have the same size
-		//*dp3_JacobianValue = new double*[rowCount];
-		//for(unsigned int i=0; i < (unsigned int)rowCount; i++) {
-		//	numOfNonZeros = uip2_JacobianSparsityPattern[i][0];
-		//	(*dp3_JacobianValue)[i] = new double[numOfNonZeros+1];
-		//	(*dp3_JacobianValue)[i][0] = numOfNonZeros; //initialize value of the 1st entry
-		//	for(int j=1; j <= numOfNonZeros; j++) (*dp3_JacobianValue)[i][j] = 0.; //initialize value of other entries
-		//}
+		return RecoverD2Row_RowCompressedFormat_usermem(vi_LeftSeedColors, dp2_CompressedMatrix, uip2_JacobianSparsityPattern, dp3_JacobianValue);
+	}
+
+	int JacobianRecovery1D::RecoverD2Row_RowCompressedFormat_usermem(const vector<int>& vi_LeftSeedColors, double** dp2_CompressedMatrix, unsigned int ** uip2_JacobianSparsityPattern, double*** dp3_JacobianValue) {
+
+		int rowCount = vi_LeftSeedColors.size();
+		unsigned int numOfNonZeros = 0;
 
 		//Recover value of the Jacobian
 		for(unsigned int i=0; i < (unsigned int)rowCount; i++) {
 			numOfNonZeros = uip2_JacobianSparsityPattern[i][0];
 			for(size_t j=1; j <= numOfNonZeros; j++) {
-				(*dp3_JacobianValue)[i][j] = dp2_CompressedMatrix[vi_LeftVertexColors[i]][uip2_JacobianSparsityPattern[i][j]];
+				(*dp3_JacobianValue)[i][j] = dp2_CompressedMatrix[vi_LeftSeedColors[i]][uip2_JacobianSparsityPattern[i][j]];
 			}
 
 		}
@@ -70,6 +60,7 @@ namespace ColPack
 		if(AF_available) reset();
 
 		AF_available = true;
+		i_AF_MatrixAllocation = i_MatrixAllocation;
 		i_AF_rowCount = g->GetRowVertexCount();
 		dp2_AF_Value = *dp3_JacobianValue;
 
@@ -167,57 +158,30 @@ namespace ColPack
 			return _FALSE;
 		}
 
-		int rowCount = g->GetRowVertexCount();
-		vector<int> vi_LeftVertexColors;
-		g->GetLeftVertexColors(vi_LeftVertexColors);
-
-		int numOfNonZeros;
-		//vector<int>* LeftVerticesPtr = g->GetLeftVerticesPtr();
+		vector<int> vi_LeftSeedColors;
+		g->GetLeftSeedColors(vi_LeftSeedColors);
 
-		//Recover value of the Jacobian
+		return RecoverD2Row_CoordinateFormat_usermem(vi_LeftSeedColors, dp2_CompressedMatrix, uip2_JacobianSparsityPattern, ip2_RowIndex, ip2_ColumnIndex, dp2_JacobianValue);
+	}
 
-//		#pragma omp parallel for default(none) schedule(static) shared(rowCount,LeftVerticesPtr,dp2_JacobianValue, ip2_RowIndex, ip2_ColumnIndex, uip2_JacobianSparsityPattern, dp2_CompressedMatrix, vi_LeftVertexColors) private(numOfNonZeros)
-/*		for(unsigned int i=0; i < (unsigned int)rowCount; i++) {
-			numOfNonZeros = uip2_JacobianSparsityPattern[i][0];
-			for(int j=1; j <= numOfNonZeros; j++) {
-				(*dp2_JacobianValue)[(*LeftVerticesPtr)[i]+j-1] = dp2_CompressedMatrix[vi_LeftVertexColors[i]][uip2_JacobianSparsityPattern[i][j]];
-				(*ip2_RowIndex)[(*LeftVerticesPtr)[i]+j-1] = i;
-				(*ip2_ColumnIndex)[(*LeftVerticesPtr)[i]+j-1] = uip2_JacobianSparsityPattern[i][j];
+	int JacobianRecovery1D::RecoverD2Row_CoordinateFormat_usermem(const vector<int>& vi_LeftSeedColors, double** dp2_CompressedMatrix, unsigned int ** uip2_JacobianSparsityPattern, unsigned int** ip2_RowIndex, unsigned int** ip2_ColumnIndex, double** dp2_JacobianValue) {
 
-			}
-		}
-		if(numOfNonZeros_count != g->GetEdgeCount()) {
-			cout<<"**Something fishing going on"<<endl;
-			cout<<"numOfNonZeros_count="<<numOfNonZeros_count<<endl;
-			cout<<"numOfNonZeros="<<g->GetEdgeCount()<<endl;
-		}
-		else cout<<"**Good!!!"<<endl;
-		Pause();
-		//
+		int rowCount = vi_LeftSeedColors.size();
+		int numOfNonZeros;
 
-		return (*LeftVerticesPtr)[rowCount];
-*/
+		//Recover value of the Jacobian
 		unsigned int numOfNonZeros_count = 0;
 		for(unsigned int i=0; i < (unsigned int)rowCount; i++) {
 			numOfNonZeros = uip2_JacobianSparsityPattern[i][0];
 			for(int j=1; j <= numOfNonZeros; j++) {
-				(*dp2_JacobianValue)[numOfNonZeros_count] = dp2_CompressedMatrix[vi_LeftVertexColors[i]][uip2_JacobianSparsityPattern[i][j]];
+				(*dp2_JacobianValue)[numOfNonZeros_count] = dp2_CompressedMatrix[vi_LeftSeedColors[i]][uip2_JacobianSparsityPattern[i][j]];
 				(*ip2_RowIndex)[numOfNonZeros_count] = i;
 				(*ip2_ColumnIndex)[numOfNonZeros_count] = uip2_JacobianSparsityPattern[i][j];
 				numOfNonZeros_count++;
 			}
 		}
-		/*
-		if(numOfNonZeros_count != g->GetEdgeCount()) {
-			cout<<"**Something fishing going on"<<endl;
-			cout<<"numOfNonZeros_count="<<numOfNonZeros_count<<endl;
-			cout<<"numOfNonZeros="<<g->GetEdgeCount()<<endl;
-		}
-		else cout<<"**Good!!!"<<endl;
-		Pause();
-		// */
-		return numOfNonZeros_count;
 
+		return numOfNonZeros_count;
 	}
 /*
 	int JacobianRecovery1D::RecoverD2Row_CoordinateFormat_usermem_serial(BipartiteGraphPartialColoringInterface* g, double** dp2_CompressedMatrix, unsigned int ** uip2_JacobianSparsityPattern, unsigned int** ip2_RowIndex, unsigned int** ip2_ColumnIndex, double** dp2_JacobianValue) {
@@ -363,22 +327,26 @@ namespace ColPack
 			return _FALSE;
 		}
 
-		int rowCount = g->GetRowVertexCount();
-		vector<int> vi_RightVertexColors;
-		g->GetRightVertexColors(vi_RightVertexColors);
+		vector<int> vi_RightSeedColors;
+		g->GetRightSeedColors(vi_RightSeedColors);
+
+		return RecoverD2Cln_RowCompressedFormat_usermem(g->GetRowVertexCount(), vi_RightSeedColors, dp2_CompressedMatrix, uip2_JacobianSparsityPattern, dp3_JacobianValue);
+	}
+
+	int JacobianRecovery1D::RecoverD2Cln_RowCompressedFormat_usermem(int i_RowCount, const vector<int>& vi_RightSeedColors, double** dp2_CompressedMatrix, unsigned int ** uip2_JacobianSparsityPattern, double*** dp3_JacobianValue) {
+
 		unsigned int numOfNonZeros = 0;
 
 		//Recover value of the Jacobian
-		//cout<<"Recover value of the Jacobian"<<endl;
-		for(unsigned int i=0; i < (unsigned int)rowCount; i++) {
+		for(unsigned int i=0; i < (unsigned int)i_RowCount; i++) {
 			numOfNonZeros = uip2_JacobianSparsityPattern[i][0];
 			for(unsigned int j=1; j <= numOfNonZeros; j++) {
-				(*dp3_JacobianValue)[i][j] = dp2_CompressedMatrix[i][vi_RightVertexColors[uip2_JacobianSparsityPattern[i][j]]];
+				(*dp3_JacobianValue)[i][j] = dp2_CompressedMatrix[i][vi_RightSeedColors[uip2_JacobianSparsityPattern[i][j]]];
 			}
 
 		}
 
-		return rowCount;
+		return i_RowCount;
 	}
 
 	int JacobianRecovery1D::RecoverD2Cln_RowCompressedFormat_unmanaged(BipartiteGraphPartialColoringInterface* g, double** dp2_CompressedMatrix, unsigned int ** uip2_JacobianSparsityPattern, double*** dp3_JacobianValue) {
@@ -388,18 +356,9 @@ namespace ColPack
 		}
 
 		int rowCount = g->GetRowVertexCount();
-		unsigned int numOfNonZeros = 0;
 
 		//allocate memory for *dp3_JacobianValue. The dp3_JacobianValue and uip2_JacobianSparsityPattern matrices should have the same size
-		//cout<<"allocate memory for *dp3_JacobianValue rowCount="<<rowCount<<endl;
-		*dp3_JacobianValue = (double**) malloc(rowCount * sizeof(double*));
-		for(unsigned int i=0; i < (unsigned int)rowCount; i++) {
-			numOfNonZeros = uip2_JacobianSparsityPattern[i][0];
-			//printf("i=%d\tnumOfNonZeros=%d \n", i, numOfNonZeros);
-			(*dp3_JacobianValue)[i] = (double*) malloc( (numOfNonZeros+1) * sizeof(double) );
-			(*dp3_JacobianValue)[i][0] = numOfNonZeros; //initialize value of the 1st entry
-			for(unsigned int j=1; j <= numOfNonZeros; j++) (*dp3_JacobianValue)[i][j] = 0.; //initialize value of other entries
-		}
+		if(AllocateRowCompressedFormat(rowCount, uip2_JacobianSparsityPattern, dp3_JacobianValue) != _TRUE) return _FALSE;
 
 		return RecoverD2Cln_RowCompressedFormat_usermem(g, dp2_CompressedMatrix, uip2_JacobianSparsityPattern, dp3_JacobianValue);
 	}
@@ -410,6 +369,7 @@ namespace ColPack
 		if(AF_available) reset();
 
 		AF_available = true;
+		i_AF_MatrixAllocation = i_MatrixAllocation;
 		i_AF_rowCount = g->GetRowVertexCount();
 		dp2_AF_Value = *dp3_JacobianValue;
 
@@ -507,32 +467,22 @@ namespace ColPack
 			return _FALSE;
 		}
 
-		int rowCount = g->GetRowVertexCount();
-		vector<int> vi_RightVertexColors;
-		g->GetRightVertexColors(vi_RightVertexColors);
+		vector<int> vi_RightSeedColors;
+		g->GetRightSeedColors(vi_RightSeedColors);
+
+		return RecoverD2Cln_CoordinateFormat_usermem(g->GetRowVertexCount(), vi_RightSeedColors, dp2_CompressedMatrix, uip2_JacobianSparsityPattern, ip2_RowIndex, ip2_ColumnIndex, dp2_JacobianValue);
+	}
+
+	int JacobianRecovery1D::RecoverD2Cln_CoordinateFormat_usermem(int i_RowCount, const vector<int>& vi_RightSeedColors, double** dp2_CompressedMatrix, unsigned int ** uip2_JacobianSparsityPattern, unsigned int** ip2_RowIndex, unsigned int** ip2_ColumnIndex, double** dp2_JacobianValue) {
+
 		unsigned int numOfNonZeros = 0;
-//		vector<int>* LeftVerticesPtr = g->GetLeftVerticesPtr();
 
 		//Recover value of the Jacobian
-		//cout<<"Recover value of the Jacobian"<<endl;
-//		#pragma omp parallel for default(none) schedule(static) shared(rowCount,LeftVerticesPtr,dp2_JacobianValue, ip2_RowIndex, ip2_ColumnIndex, uip2_JacobianSparsityPattern, dp2_CompressedMatrix, vi_RightVertexColors) private(numOfNonZeros)
-/*		for(unsigned int i=0; i < (unsigned int)rowCount; i++) {
-			numOfNonZeros = uip2_JacobianSparsityPattern[i][0];
-			for(unsigned int j=1; j <= numOfNonZeros; j++) {
-				(*dp2_JacobianValue)[(*LeftVerticesPtr)[i]+j-1] = dp2_CompressedMatrix[i][vi_RightVertexColors[uip2_JacobianSparsityPattern[i][j]]];
-				(*ip2_RowIndex)[(*LeftVerticesPtr)[i]+j-1] = i;
-				(*ip2_ColumnIndex)[(*LeftVerticesPtr)[i]+j-1] = uip2_JacobianSparsityPattern[i][j];
-			}
-		}
-
-		return (*LeftVerticesPtr)[rowCount];
-*/
 		unsigned int numOfNonZeros_count = 0;
-		//unsigned int ll=0;
-		for(unsigned int i=0; i < (unsigned int)rowCount; i++) {
+		for(unsigned int i=0; i < (unsigned int)i_RowCount; i++) {
 			numOfNonZeros = uip2_JacobianSparsityPattern[i][0];
 			for(unsigned int j=1; j <= numOfNonZeros; j++) {
-				(*dp2_JacobianValue)[numOfNonZeros_count] = dp2_CompressedMatrix[i][vi_RightVertexColors[uip2_JacobianSparsityPattern[i][j]]];
+				(*dp2_JacobianValue)[numOfNonZeros_count] = dp2_CompressedMatrix[i][vi_RightSeedColors[uip2_JacobianSparsityPattern[i][j]]];
 				(*ip2_RowIndex)[numOfNonZeros_count] = i;
 				(*ip2_ColumnIndex)[numOfNonZeros_count] = uip2_JacobianSparsityPattern[i][j];
 				numOfNonZeros_count++;
@@ -540,7 +490,6 @@ namespace ColPack
 		}
 
 		return numOfNonZeros_count;
-
 	}
 /*
 	int JacobianRecovery1D::RecoverD2Cln_CoordinateFormat_usermem_serial(BipartiteGraphPartialColoringInterface* g, double** dp2_CompressedMatrix, unsigned int ** uip2_JacobianSparsityPattern, unsigned int** ip2_RowIndex, unsigned int** ip2_ColumnIndex, double** dp2_JacobianValue) {
@@ -71,6 +71,12 @@ namespace ColPack
 		*/
 		int RecoverD2Row_RowCompressedFormat_usermem(BipartiteGraphPartialColoringInterface* g, double** dp2_CompressedMatrix, unsigned int ** uip2_JacobianSparsityPattern, double*** dp3_JacobianValue);
 
+		/// Same as RecoverD2Row_RowCompressedFormat_usermem(), except that the coloring is given in the compact form of its Seed matrix instead of the graph
+		/** Notes:
+		- vi_LeftSeedColors comes from BipartiteGraphPartialColoring::GetLeftSeedColors(). The graph does not need to be kept around for the recovery.
+		*/
+		int RecoverD2Row_RowCompressedFormat_usermem(const vector<int>& vi_LeftSeedColors, double** dp2_CompressedMatrix, unsigned int ** uip2_JacobianSparsityPattern, double*** dp3_JacobianValue);
+
 
 		/// A routine for recovering a Jacobian from a "Row-wise Distance 2 coloring"-based compressed representation.
 		/**
@@ -138,6 +144,12 @@ namespace ColPack
 		*/
 //		int RecoverD2Row_CoordinateFormat_usermem_serial(BipartiteGraphPartialColoringInterface* g, double** dp2_CompressedMatrix, unsigned int ** uip2_JacobianSparsityPattern, unsigned int** ip2_RowIndex, unsigned int** ip2_ColumnIndex, double** dp2_JacobianValue);
 		int RecoverD2Row_CoordinateFormat_usermem(BipartiteGraphPartialColoringInterface* g, double** dp2_CompressedMatrix, unsigned int ** uip2_JacobianSparsityPattern, unsigned int** ip2_RowIndex, unsigned int** ip2_ColumnIndex, double** dp2_JacobianValue);
+
+		/// Same as RecoverD2Row_CoordinateFormat_usermem(), except that the coloring is given in the compact form of its Seed matrix instead of the graph
+		/** Notes:
+		- vi_LeftSeedColors comes from BipartiteGraphPartialColoring::GetLeftSeedColors(). The graph does not need to be kept around for the recovery.
+		*/
+		int RecoverD2Row_CoordinateFormat_usermem(const vector<int>& vi_LeftSeedColors, double** dp2_CompressedMatrix, unsigned int ** uip2_JacobianSparsityPattern, unsigned int** ip2_RowIndex, unsigned int** ip2_ColumnIndex, double** dp2_JacobianValue);
 		//int RecoverD2Row_CoordinateFormat_usermem_OMP(BipartiteGraphPartialColoringInterface* g, double** dp2_CompressedMatrix, unsigned int ** uip2_JacobianSparsityPattern, unsigned int** ip2_RowIndex, unsigned int** ip2_ColumnIndex, double** dp2_JacobianValue);
 
 
@@ -196,6 +208,12 @@ namespace ColPack
 		*/
 		int RecoverD2Cln_RowCompressedFormat_usermem(BipartiteGraphPartialColoringInterface* g, double** dp2_CompressedMatrix, unsigned int ** uip2_JacobianSparsityPattern, double*** dp3_JacobianValue);
 
+		/// Same as RecoverD2Cln_RowCompressedFormat_usermem(), except that the coloring is given in the compact form of its Seed matrix instead of the graph
+		/** Notes:
+		- vi_RightSeedColors comes from BipartiteGraphPartialColoring::GetRightSeedColors() and i_RowCount is the number of rows of the Jacobian. The graph does not need to be kept around for the recovery.
+		*/
+		int RecoverD2Cln_RowCompressedFormat_usermem(int i_RowCount, const vector<int>& vi_RightSeedColors, double** dp2_CompressedMatrix, unsigned int ** uip2_JacobianSparsityPattern, double*** dp3_JacobianValue);
+
 
 		/// A routine for recovering a Jacobian from a "Column-wise Distance 2 coloring"-based compressed representation.
 		/**
@@ -263,6 +281,12 @@ namespace ColPack
 		*/
 //		int RecoverD2Cln_CoordinateFormat_usermem_serial(BipartiteGraphPartialColoringInterface* g, double** dp2_CompressedMatrix, unsigned int ** uip2_JacobianSparsityPattern, unsigned int** ip2_RowIndex, unsigned int** ip2_ColumnIndex, double** dp2_JacobianValue);
 		int RecoverD2Cln_CoordinateFormat_usermem(BipartiteGraphPartialColoringInterface* g, double** dp2_CompressedMatrix, unsigned int ** uip2_JacobianSparsityPattern, unsigned int** ip2_RowIndex, unsigned int** ip2_ColumnIndex, double** dp2_JacobianValue);
+
+		/// Same as RecoverD2Cln_CoordinateFormat_usermem(), except that the coloring is given in the compact form of its Seed matrix instead of the graph
+		/** Notes:
+		- vi_RightSeedColors comes from BipartiteGraphPartialColoring::GetRightSeedColors() and i_RowCount is the number of rows of the Jacobian. The graph does not need to be kept around for the recovery.
+		*/
+		int RecoverD2Cln_CoordinateFormat_usermem(int i_RowCount, const vector<int>& vi_RightSeedColors, double** dp2_CompressedMatrix, unsigned int ** uip2_JacobianSparsityPattern, unsigned int** ip2_RowIndex, unsigned int** ip2_ColumnIndex, double** dp2_JacobianValue);
 		//int RecoverD2Cln_CoordinateFormat_usermem_OMP(BipartiteGraphPartialColoringInterface* g, double** dp2_CompressedMatrix, unsigned int ** uip2_JacobianSparsityPattern, unsigned int** ip2_RowIndex, unsigned int** ip2_ColumnIndex, double** dp2_JacobianValue);
 
 		// Compare 2 matrices in Coordinate Format. Return 1 if they are the same, return 0 if they are different
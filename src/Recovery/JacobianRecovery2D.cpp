@@ -17,64 +17,48 @@ namespace ColPack
 			return _FALSE;
 		}
 
-		int rowCount = g->GetRowVertexCount();
+		vector<int> vi_LeftSeedColors, vi_RightSeedColors;
+		g->GetLeftSeedColors(vi_LeftSeedColors);
+		g->GetRightSeedColors(vi_RightSeedColors);
 
-		vector<int> vi_LeftVertexColors;
-		g->GetLeftVertexColors(vi_LeftVertexColors);
+		return DirectRecover_RowCompressedFormat_usermem(vi_LeftSeedColors, vi_RightSeedColors, dp2_RowCompressedMatrix, dp2_ColumnCompressedMatrix, uip2_JacobianSparsityPattern, dp3_JacobianValue);
+	}
 
-		vector<int> RightVertexColors_Transformed;
-		g->GetRightVertexColors_Transformed(RightVertexColors_Transformed);
+	int JacobianRecovery2D::DirectRecover_RowCompressedFormat_usermem(const vector<int>& vi_LeftSeedColors, const vector<int>& vi_RightSeedColors, double** dp2_RowCompressedMatrix, double** dp2_ColumnCompressedMatrix, unsigned int ** uip2_JacobianSparsityPattern, double*** dp3_JacobianValue) {
 
-		int i_ColumnColorCount = g->GetRightVertexColorCount();
-		if (g->GetRightVertexDefaultColor() == 1) i_ColumnColorCount--; //color ID 0 is used, ignore it
+		int rowCount = vi_LeftSeedColors.size();
 
-		//Do (column-)color statistic for each row, i.e., see how many elements in that row has color 0, color 1 ...
-		int** colorStatistic = new int*[rowCount];	//color statistic for each row. For example, colorStatistic[0] is color statistic for row 0
-													//If row 0 has 5 columns with color 3 => colorStatistic[0][3] = 5;
-		//Allocate memory for colorStatistic[rowCount][colorCount] and initilize the matrix
-		for(unsigned int i=0; i < (unsigned int)rowCount; i++) {
-			colorStatistic[i] = new int[i_ColumnColorCount];
-			for(unsigned int j=0; j < (unsigned int)i_ColumnColorCount; j++) colorStatistic[i][j] = 0;
+		int i_ColumnColorCount = 0;
+		for(size_t i=0; i < vi_RightSeedColors.size(); i++) {
+			if(i_ColumnColorCount <= vi_RightSeedColors[i]) i_ColumnColorCount = vi_RightSeedColors[i] + 1;
 		}
 
-		//populate colorStatistic for right (column) vertices
-		for(unsigned int i=0; i < (unsigned int)rowCount; i++) {
-			int numOfNonZeros = uip2_JacobianSparsityPattern[i][0];
-			for(unsigned int j=1; j <= (unsigned int)numOfNonZeros; j++) {
-				//non-zero in the Jacobian: [i][uip2_JacobianSparsityPattern[i][j]]
-				//color of that column: RightVertexColors_Transformed[uip2_JacobianSparsityPattern[i][j]]-1
-				if (RightVertexColors_Transformed[uip2_JacobianSparsityPattern[i][j]] > 0) {
-					colorStatistic[i][RightVertexColors_Transformed[uip2_JacobianSparsityPattern[i][j]]-1]++;
-				}
-			}
-		}
+		//(column-)color statistic of the current row only, i.e., how many elements in that row have color 0, color 1 ...
+		//it is cleared after each row, so the cost is O(nnz) instead of O(rowCount x i_ColumnColorCount)
+		vector<int> colorStatistic(i_ColumnColorCount, 0);
 
-		//Recover value of the Jacobian from dp2_ColumnCompressedMatrix (priority) and dp2_RowCompressedMatrix
-//cout<<"Recover value of the Jacobian from dp2_ColumnCompressedMatrix (priority) and dp2_RowCompressedMatrix"<<endl;
 		for(unsigned int i=0; i < (unsigned int)rowCount; i++) {
 			unsigned int numOfNonZeros = uip2_JacobianSparsityPattern[i][0];
 			for(unsigned int j=1; j <= numOfNonZeros; j++) {
-//printf("Recover uip2_JacobianSparsityPattern[%d][%d] = %d \n", i, j, uip2_JacobianSparsityPattern[i][j]);
+				if (vi_RightSeedColors[uip2_JacobianSparsityPattern[i][j]] != _UNKNOWN) colorStatistic[vi_RightSeedColors[uip2_JacobianSparsityPattern[i][j]]]++;
+			}
+
+			//Recover value of the Jacobian from dp2_ColumnCompressedMatrix (priority) and dp2_RowCompressedMatrix
+			for(unsigned int j=1; j <= numOfNonZeros; j++) {
+				int i_ColumnColor = vi_RightSeedColors[uip2_JacobianSparsityPattern[i][j]];
 				// Check and see if we can recover the value from dp2_ColumnCompressedMatrix first
-				if (RightVertexColors_Transformed[uip2_JacobianSparsityPattern[i][j]] > 0 &&
-					colorStatistic[i][RightVertexColors_Transformed[uip2_JacobianSparsityPattern[i][j]] - 1]==1
-					) {
-//printf("\t from COLUMN [%d][%d] = %7.2f \n",i, RightVertexColors_Transformed[uip2_JacobianSparsityPattern[i][j]]-1, dp2_ColumnCompressedMatrix[i][RightVertexColors_Transformed[uip2_JacobianSparsityPattern[i][j]]-1]);
-//printf("\t from COLUMN [%d][%d] \n",i, RightVertexColors_Transformed[uip2_JacobianSparsityPattern[i][j]]-1);
-					(*dp3_JacobianValue)[i][j] = dp2_ColumnCompressedMatrix[i][RightVertexColors_Transformed[uip2_JacobianSparsityPattern[i][j]]-1];
+				if (i_ColumnColor != _UNKNOWN && colorStatistic[i_ColumnColor]==1) {
+					(*dp3_JacobianValue)[i][j] = dp2_ColumnCompressedMatrix[i][i_ColumnColor];
 				}
 				else { // If not, then use dp2_RowCompressedMatrix
-//printf("\t from ROW [%d][%d] = %7.2f \n",m_vi_LeftVertexColors[i]-1, uip2_JacobianSparsityPattern[i][j], dp2_RowCompressedMatrix[m_vi_LeftVertexColors[i]-1][uip2_JacobianSparsityPattern[i][j]]);
-//printf("\t from ROW [%d][%d] \n",m_vi_LeftVertexColors[i]-1, uip2_JacobianSparsityPattern[i][j]);
-					(*dp3_JacobianValue)[i][j] = dp2_RowCompressedMatrix[vi_LeftVertexColors[i]-1][uip2_JacobianSparsityPattern[i][j]];
+					(*dp3_JacobianValue)[i][j] = dp2_RowCompressedMatrix[vi_LeftSeedColors[i]][uip2_JacobianSparsityPattern[i][j]];
 				}
 			}
 
+			for(unsigned int j=1; j <= numOfNonZeros; j++) {
+				if (vi_RightSeedColors[uip2_JacobianSparsityPattern[i][j]] != _UNKNOWN) colorStatistic[vi_RightSeedColors[uip2_JacobianSparsityPattern[i][j]]] = 0;
+			}
 		}
-//cout<<"DONE"<<endl;
-
-		free_2DMatrix(colorStatistic, rowCount);
-		colorStatistic = NULL;
 
 		return rowCount;
 	}
@@ -88,14 +72,7 @@ namespace ColPack
 		int rowCount = g->GetRowVertexCount();
 
 		//allocate memory for *dp3_JacobianValue. The dp3_JacobianValue and uip2_JacobianSparsityPattern matrices should have the same size
-//cout<<"allocate memory for *dp3_JacobianValue"<<endl;
-		*dp3_JacobianValue = (double**) malloc(rowCount * sizeof(double*));
-		for(int i=0; i < rowCount; i++) {
-			int numOfNonZeros = uip2_JacobianSparsityPattern[i][0];
-			(*dp3_JacobianValue)[i] = (double*) malloc( (numOfNonZeros+1) * sizeof(double) );
-			(*dp3_JacobianValue)[i][0] = numOfNonZeros; //initialize value of the 1st entry
-			for(int j=1; j <= numOfNonZeros; j++) (*dp3_JacobianValue)[i][j] = 0.; //initialize value of other entries
-		}
+		if(AllocateRowCompressedFormat(rowCount, uip2_JacobianSparsityPattern, dp3_JacobianValue) != _TRUE) return _FALSE;
 
 		return DirectRecover_RowCompressedFormat_usermem(g, dp2_RowCompressedMatrix, dp2_ColumnCompressedMatrix, uip2_JacobianSparsityPattern, dp3_JacobianValue);
 	}
@@ -110,6 +87,7 @@ namespace ColPack
 
 
 		AF_available = true;
+		i_AF_MatrixAllocation = i_MatrixAllocation;
 		i_AF_rowCount = g->GetRowVertexCount();
 		dp2_AF_Value = *dp3_JacobianValue;
 
@@ -265,68 +243,52 @@ namespace ColPack
 			return _FALSE;
 		}
 
-		int rowCount = g->GetRowVertexCount();
+		vector<int> vi_LeftSeedColors, vi_RightSeedColors;
+		g->GetLeftSeedColors(vi_LeftSeedColors);
+		g->GetRightSeedColors(vi_RightSeedColors);
 
-		vector<int> vi_LeftVertexColors;
-		g->GetLeftVertexColors(vi_LeftVertexColors);
+		return DirectRecover_CoordinateFormat_usermem(vi_LeftSeedColors, vi_RightSeedColors, dp2_RowCompressedMatrix, dp2_ColumnCompressedMatrix, uip2_JacobianSparsityPattern, ip2_RowIndex, ip2_ColumnIndex, dp2_JacobianValue);
+	}
 
-		vector<int> RightVertexColors_Transformed;
-		g->GetRightVertexColors_Transformed(RightVertexColors_Transformed);
+	int JacobianRecovery2D::DirectRecover_CoordinateFormat_usermem(const vector<int>& vi_LeftSeedColors, const vector<int>& vi_RightSeedColors, double** dp2_RowCompressedMatrix, double** dp2_ColumnCompressedMatrix, unsigned int ** uip2_JacobianSparsityPattern, unsigned int** ip2_RowIndex, unsigned int** ip2_ColumnIndex, double** dp2_JacobianValue) {
 
-		int i_ColumnColorCount = g->GetRightVertexColorCount();
-		if (g->GetRightVertexDefaultColor() == 1) i_ColumnColorCount--; //color ID 0 is used, ignore it
+		int rowCount = vi_LeftSeedColors.size();
 
-		//Do (column-)color statistic for each row, i.e., see how many elements in that row has color 0, color 1 ...
-		int** colorStatistic = new int*[rowCount];	//color statistic for each row. For example, colorStatistic[0] is color statistic for row 0
-													//If row 0 has 5 columns with color 3 => colorStatistic[0][3] = 5;
-		//Allocate memory for colorStatistic[rowCount][colorCount] and initilize the matrix
-		for(unsigned int i=0; i < (unsigned int)rowCount; i++) {
-			colorStatistic[i] = new int[i_ColumnColorCount];
-			for(unsigned int j=0; j < (unsigned int)i_ColumnColorCount; j++) colorStatistic[i][j] = 0;
+		int i_ColumnColorCount = 0;
+		for(size_t i=0; i < vi_RightSeedColors.size(); i++) {
+			if(i_ColumnColorCount <= vi_RightSeedColors[i]) i_ColumnColorCount = vi_RightSeedColors[i] + 1;
 		}
 
-		//populate colorStatistic for right (column) vertices
-		for(unsigned int i=0; i < (unsigned int)rowCount; i++) {
-			int numOfNonZeros = uip2_JacobianSparsityPattern[i][0];
-			for(unsigned int j=1; j <= (unsigned int)numOfNonZeros; j++) {
-				//non-zero in the Jacobian: [i][uip2_JacobianSparsityPattern[i][j]]
-				//color of that column: m_vi_RightVertexColors[uip2_JacobianSparsityPattern[i][j]]-1
-				if (RightVertexColors_Transformed[uip2_JacobianSparsityPattern[i][j]] > 0) {
-					colorStatistic[i][RightVertexColors_Transformed[uip2_JacobianSparsityPattern[i][j]]-1]++;
-				}
-			}
-		}
+		//(column-)color statistic of the current row only, i.e., how many elements in that row have color 0, color 1 ...
+		//it is cleared after each row, so the cost is O(nnz) instead of O(rowCount x i_ColumnColorCount)
+		vector<int> colorStatistic(i_ColumnColorCount, 0);
 
-		//Recover value of the Jacobian from dp2_ColumnCompressedMatrix (priority) and dp2_RowCompressedMatrix
-//cout<<"Recover value of the Jacobian from dp2_ColumnCompressedMatrix (priority) and dp2_RowCompressedMatrix"<<endl;
 		unsigned int numOfNonZeros_count = 0;
 		for(unsigned int i=0; i < (unsigned int)rowCount; i++) {
 			unsigned int numOfNonZeros = uip2_JacobianSparsityPattern[i][0];
 			for(unsigned int j=1; j <= numOfNonZeros; j++) {
-//printf("Recover uip2_JacobianSparsityPattern[%d][%d] = %d \n", i, j, uip2_JacobianSparsityPattern[i][j]);
+				if (vi_RightSeedColors[uip2_JacobianSparsityPattern[i][j]] != _UNKNOWN) colorStatistic[vi_RightSeedColors[uip2_JacobianSparsityPattern[i][j]]]++;
+			}
+
+			//Recover value of the Jacobian from dp2_ColumnCompressedMatrix (priority) and dp2_RowCompressedMatrix
+			for(unsigned int j=1; j <= numOfNonZeros; j++) {
+				int i_ColumnColor = vi_RightSeedColors[uip2_JacobianSparsityPattern[i][j]];
 				// Check and see if we can recover the value from dp2_ColumnCompressedMatrix first
-				if (RightVertexColors_Transformed[uip2_JacobianSparsityPattern[i][j]] > 0 &&
-					colorStatistic[i][RightVertexColors_Transformed[uip2_JacobianSparsityPattern[i][j]] - 1]==1
-					) {
-//printf("\t from COLUMN [%d][%d] = %7.2f \n",i, RightVertexColors_Transformed[uip2_JacobianSparsityPattern[i][j]]-1, dp2_ColumnCompressedMatrix[i][RightVertexColors_Transformed[uip2_JacobianSparsityPattern[i][j]]-1]);
-//printf("\t from COLUMN [%d][%d] \n",i, RightVertexColors_Transformed[uip2_JacobianSparsityPattern[i][j]]-1);
-					(*dp2_JacobianValue)[numOfNonZeros_count] = dp2_ColumnCompressedMatrix[i][RightVertexColors_Transformed[uip2_JacobianSparsityPattern[i][j]]-1];
+				if (i_ColumnColor != _UNKNOWN && colorStatistic[i_ColumnColor]==1) {
+					(*dp2_JacobianValue)[numOfNonZeros_count] = dp2_ColumnCompressedMatrix[i][i_ColumnColor];
 				}
 				else { // If not, then use dp2_RowCompressedMatrix
-//printf("\t from ROW [%d][%d] = %7.2f \n",m_vi_LeftVertexColors[i]-1, uip2_JacobianSparsityPattern[i][j], dp2_RowCompressedMatrix[m_vi_LeftVertexColors[i]-1][uip2_JacobianSparsityPattern[i][j]]);
-//printf("\t from ROW [%d][%d] \n",m_vi_LeftVertexColors[i]-1, uip2_JacobianSparsityPattern[i][j]);
-					(*dp2_JacobianValue)[numOfNonZeros_count] = dp2_RowCompressedMatrix[vi_LeftVertexColors[i]-1][uip2_JacobianSparsityPattern[i][j]];
+					(*dp2_JacobianValue)[numOfNonZeros_count] = dp2_RowCompressedMatrix[vi_LeftSeedColors[i]][uip2_JacobianSparsityPattern[i][j]];
 				}
 				(*ip2_RowIndex)[numOfNonZeros_count] = i;
 				(*ip2_ColumnIndex)[numOfNonZeros_count] = uip2_JacobianSparsityPattern[i][j];
 				numOfNonZeros_count++;
 			}
 
+			for(unsigned int j=1; j <= numOfNonZeros; j++) {
+				if (vi_RightSeedColors[uip2_JacobianSparsityPattern[i][j]] != _UNKNOWN) colorStatistic[vi_RightSeedColors[uip2_JacobianSparsityPattern[i][j]]] = 0;
+			}
 		}
-//cout<<"DONE"<<endl;
-
-		free_2DMatrix(colorStatistic, rowCount);
-		colorStatistic = NULL;
 
 		return numOfNonZeros_count;
 	}
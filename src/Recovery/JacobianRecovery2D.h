@@ -78,6 +78,13 @@ namespace ColPack
 		*/
 		int DirectRecover_RowCompressedFormat_usermem(BipartiteGraphBicoloringInterface* g, double** dp2_RowCompressedMatrix, double** dp2_ColumnCompressedMatrix, unsigned int ** uip2_JacobianSparsityPattern, double*** dp3_JacobianValue);
 
+		/// Same as DirectRecover_RowCompressedFormat_usermem(), except that the bicoloring is given in the compact form of its Seed matrices instead of the graph
+		/** Notes:
+		- vi_LeftSeedColors and vi_RightSeedColors come from BipartiteGraphBicoloring::GetLeftSeedColors() and GetRightSeedColors().
+		The color statistic is kept for one row at a time, so no rows x colors matrix is allocated.
+		*/
+		int DirectRecover_RowCompressedFormat_usermem(const vector<int>& vi_LeftSeedColors, const vector<int>& vi_RightSeedColors, double** dp2_RowCompressedMatrix, double** dp2_ColumnCompressedMatrix, unsigned int ** uip2_JacobianSparsityPattern, double*** dp3_JacobianValue);
+
 
 		/// A routine for recovering a Jacobian from a Star-Bicoloring based compressed representation.
 		/**
@@ -109,6 +116,13 @@ namespace ColPack
 		*/
 		int DirectRecover_CoordinateFormat_usermem(BipartiteGraphBicoloringInterface* g, double** dp2_RowCompressedMatrix, double** dp2_ColumnCompressedMatrix, unsigned int ** uip2_JacobianSparsityPattern, unsigned int** ip2_RowIndex, unsigned int** ip2_ColumnIndex, double** dp2_JacobianValue);
 
+		/// Same as DirectRecover_CoordinateFormat_usermem(), except that the bicoloring is given in the compact form of its Seed matrices instead of the graph
+		/** Notes:
+		- vi_LeftSeedColors and vi_RightSeedColors come from BipartiteGraphBicoloring::GetLeftSeedColors() and GetRightSeedColors().
+		The color statistic is kept for one row at a time, so no rows x colors matrix is allocated.
+		*/
+		int DirectRecover_CoordinateFormat_usermem(const vector<int>& vi_LeftSeedColors, const vector<int>& vi_RightSeedColors, double** dp2_RowCompressedMatrix, double** dp2_ColumnCompressedMatrix, unsigned int ** uip2_JacobianSparsityPattern, unsigned int** ip2_RowIndex, unsigned int** ip2_ColumnIndex, double** dp2_JacobianValue);
+
 
 		/// A routine for recovering a Jacobian from a Star-Bicoloring based compressed representation.
 		/**
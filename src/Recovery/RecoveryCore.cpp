@@ -17,6 +17,9 @@ namespace ColPack
 		AF_available = false;
 		i_AF_rowCount = 0;
 		dp2_AF_Value = NULL;
+		i_AF_MatrixAllocation = MATRIX_ALLOC_ROWS;
+
+		i_MatrixAllocation = MATRIX_ALLOC_ROWS;
 
 		//for Sparse Solvers Format (SSF)
 		SSF_available = false;
@@ -37,11 +40,7 @@ namespace ColPack
 
 		//for ADOL-C Format (AF)
 		if (AF_available) {
-			//free_2DMatrix(dp2_AF_Value, i_AF_rowCount);
-			for( int i=0; i < i_AF_rowCount; i++ ) {
-			    free( dp2_AF_Value[i] );
-			}
-			free( dp2_AF_Value );
+			FreeRowCompressedFormat(dp2_AF_Value, i_AF_rowCount, i_AF_MatrixAllocation);
 
 			dp2_AF_Value = NULL;
 			AF_available = false;
@@ -87,12 +86,7 @@ namespace ColPack
 		//for ADOL-C Format (AF)
 		if (AF_available) {
 			//do something
-			//free_2DMatrix(dp2_AF_Value, i_AF_rowCount);
-
-			for( int i=0; i < i_AF_rowCount; i++ ) {
-			    free( dp2_AF_Value[i] );
-			}
-			free( dp2_AF_Value );
+			FreeRowCompressedFormat(dp2_AF_Value, i_AF_rowCount, i_AF_MatrixAllocation);
 		}
 
 		//for Sparse Solvers Format (SSF)
@@ -117,4 +111,52 @@ namespace ColPack
 			free(dp_CF_Value);
 		}
 	}
+
+	void RecoveryCore::SetMatrixAllocation(int i_MatrixAllocation) {
+		this->i_MatrixAllocation = i_MatrixAllocation;
+	}
+
+	int RecoveryCore::GetMatrixAllocation() {
+		return i_MatrixAllocation;
+	}
+
+	int RecoveryCore::AllocateRowCompressedFormat(int rowCount, unsigned int ** uip2_SparsityPattern, double*** dp3_Value) {
+		if(i_MatrixAllocation == MATRIX_ALLOC_SLAB) {
+			vector<unsigned int> vui_RowLength(rowCount);
+			for(int i=0; i < rowCount; i++) vui_RowLength[i] = uip2_SparsityPattern[i][0] + 1;
+
+			//the slab is zeroed, only the 1st entry of each row is set
+			*dp3_Value = new_2DMatrix_slab<double>(rowCount, rowCount ? &vui_RowLength[0] : NULL);
+			if(rowCount > 0 && *dp3_Value == NULL) {
+				cerr<<"*ERROR: AllocateRowCompressedFormat(): the slab of "<<rowCount<<" rows could not be allocated"<<endl;
+				return _FALSE;
+			}
+			for(int i=0; i < rowCount; i++) (*dp3_Value)[i][0] = uip2_SparsityPattern[i][0];
+			return _TRUE;
+		}
+
+		*dp3_Value = (double**) malloc(rowCount * sizeof(double*));
+		for(int i=0; i < rowCount; i++) {
+			unsigned int numOfNonZeros = uip2_SparsityPattern[i][0];
+			(*dp3_Value)[i] = (double*) malloc( (numOfNonZeros+1) * sizeof(double) );
+			(*dp3_Value)[i][0] = numOfNonZeros; //initialize value of the 1st entry
+			for(unsigned int j=1; j <= numOfNonZeros; j++) (*dp3_Value)[i][j] = 0.; //initialize value of other entries
+		}
+
+		return _TRUE;
+	}
+
+	void RecoveryCore::FreeRowCompressedFormat(double** dp2_Value, int rowCount, int i_ValueAllocation) {
+		if(dp2_Value == NULL) return;
+
+		if(i_ValueAllocation == MATRIX_ALLOC_SLAB) {
+			free_2DMatrix_slab(dp2_Value);
+			return;
+		}
+
+		for( int i=0; i < rowCount; i++ ) {
+		    free( dp2_Value[i] );
+		}
+		free( dp2_Value );
+	}
 }
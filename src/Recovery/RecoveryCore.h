@@ -36,12 +36,20 @@ namespace ColPack
 	 * 		// we assume that the user have a new graph, so clean up old matrices is necessary.
 	 * 		// Note: DO NOT call the same recovery function twice unless you have a new graph!!!
 	 * 		jr1d.RecoverD2Row_CoordinateFormat(graph2 , ...);
+	 *
+	 * The RowCompressedFormat outputs (managed and *_unmanaged) are allocated following SetMatrixAllocation():
+	 * one malloc() per row (MATRIX_ALLOC_ROWS, default) or a single aligned slab (MATRIX_ALLOC_SLAB).
+	 * An unmanaged slab must be freed with free_2DMatrix_slab(), NOT row by row.
 	 */
 	class  RecoveryCore
 	{
 	public: // !!!NEED DOCUMENT
 		RecoveryCore();
 		~RecoveryCore();
+
+		/// Allocation policy of the RowCompressedFormat outputs: MATRIX_ALLOC_ROWS (default) or MATRIX_ALLOC_SLAB, see MatrixDeallocation.h
+		void SetMatrixAllocation(int i_MatrixAllocation);
+		int GetMatrixAllocation();
 	protected:
 		//string formatType; //At this point, could be either: "RowCompressedFormat," "CoordinateFormat," or "SparseSolversFormat"
 
@@ -49,6 +57,15 @@ namespace ColPack
 		bool AF_available;
 		int i_AF_rowCount;
 		double** dp2_AF_Value;
+		int i_AF_MatrixAllocation; //the allocation policy dp2_AF_Value was allocated with
+
+		int i_MatrixAllocation;
+
+		/// Allocate a RowCompressedFormat output shaped like uip2_SparsityPattern, (*dp3_Value)[i][0] = number of nonzeros of row i, the values are 0
+		/** Return value: _FALSE and (*dp3_Value) == NULL if the slab could not be allocated, _TRUE otherwise
+		*/
+		int AllocateRowCompressedFormat(int rowCount, unsigned int ** uip2_SparsityPattern, double*** dp3_Value);
+		void FreeRowCompressedFormat(double** dp2_Value, int rowCount, int i_ValueAllocation);
 
 		//for Sparse Solvers Format (SSF)
 		bool SSF_available;
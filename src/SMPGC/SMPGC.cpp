@@ -25,3 +25,10 @@ const int SMPGC::HYBRID_GMMP        ;
 const int SMPGC::HYBRID_SERIAL      ;
 const int SMPGC::HYBRID_STREAM      ;
 
+const int SMPGC::PARTITION_EQUAL    ;
+const int SMPGC::PARTITION_DEGREE   ;
+const int SMPGC::PARTITION_STEALING ;
+const int SMPGC::STEAL_CHUNK        ;
+const int SMPGC::CURSOR_PAD         ;
+
+const double SMPGC::BALANCE_TOLERANCE = 0.05;
@@ -70,6 +70,14 @@ public:
     static const int HYBRID_SERIAL       = 3;
     static const int HYBRID_STREAM       = 4;
 
+    static const int PARTITION_EQUAL     = 0;   // equal number of vertices per thread
+    static const int PARTITION_DEGREE    = 1;   // equal estimated work per thread
+    static const int PARTITION_STEALING  = 2;   // degree weighted, plus work stealing 
+    static const int STEAL_CHUNK         = 64;  // vertices taken per steal
+    static const int CURSOR_PAD          = 16;  // ints per cursor, avoid false sharing
+
+    static const double BALANCE_TOLERANCE;      // allowed excess of a color class over the average size
+
 
 public:
     SMPGC(){};
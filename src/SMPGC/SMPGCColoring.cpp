@@ -18,16 +18,20 @@ int SMPGCColoring::Coloring(int nT, const string& method, const int switch_iter=
     //Method follows the following pattern:
     //
     //"  DISTANCE_ONE_OMP_                                                "
-    //"                   <GM3P/GMMP/SERIAL/JP/MTJP>[_<LF/SL/NT/RD/NONE>] "
-    //"                   HB[MT]JP_<GM3P/GMMP/SERIAL>[_<LF/SL/NT/RD/NONE>]"
+    //"                   <GM3P/GMMP/SERIAL/JP/MTJP/BAL>[_<LF/SL/NT/RD/NONE>] "
+    //"                   HB[MT]JP_<GM3P/GMMP/SERIAL/STREAM>[-<LF/SL/NT/RD/NONE>]"
     //"  DISTANCE_TWO_OMP_                                                "
     //"                   <GM3P/GMMP/SERIAL>[_<LF/SL/NT/RD/NONE>]         "
+    //"  STAR_OMP_                                                        "
+    //"                   <GM3P/GMMP>[_<LF/SL/NT/RD/NONE>]                "
     //
     //For example
     //  DISTANCE_ONE_OMP_GM3P_RD
     //  DISTANCE_ONE_HBMTJP_SERIAL
     //  DISTANCE_TWO_GM3P
+    //  STAR_OMP_GMMP_SL
     //
+    m_method = method;
     if     (method.substr(0,7).compare("D1_OMP_")==0) {
         // distance one coloring algorithms
         const string mthd = method.substr(7);
@@ -38,6 +42,7 @@ int SMPGCColoring::Coloring(int nT, const string& method, const int switch_iter=
             else if(mthd.compare("JP")  ==0) return D1_OMP_JP  (nT, m_total_num_colors, m_vertex_color, ORDER_NONE);
             else if(mthd.compare("MTJP")==0) return D1_OMP_MTJP(nT, m_total_num_colors, m_vertex_color, ORDER_NONE);
             else if(mthd.compare("SERIAL")==0) return D1_serial(m_total_num_colors, m_vertex_color, ORDER_NONE);
+            else if(mthd.compare("BAL")==0)  return D1_OMP_BAL (nT, m_total_num_colors, m_vertex_color, m_balance_tolerance, ORDER_NONE);
         }
         else{
             // local ordered algs or hybird algs,
@@ -78,6 +83,13 @@ int SMPGCColoring::Coloring(int nT, const string& method, const int switch_iter=
                 else if(right.compare("RD")==0)   return D1_OMP_LB(nT, m_total_num_colors, m_vertex_color, ORDER_RANDOM);
                 else if(right.compare("NONE")==0) return D1_OMP_LB(nT, m_total_num_colors, m_vertex_color, ORDER_NONE);
             }
+            else if(left.compare("BAL_")==0) {
+                if     (right.compare("LF")==0)   return D1_OMP_BAL(nT, m_total_num_colors, m_vertex_color, m_balance_tolerance, ORDER_LARGEST_FIRST);
+                else if(right.compare("SL")==0)   return D1_OMP_BAL(nT, m_total_num_colors, m_vertex_color, m_balance_tolerance, ORDER_SMALLEST_LAST);
+                else if(right.compare("NT")==0)   return D1_OMP_BAL(nT, m_total_num_colors, m_vertex_color, m_balance_tolerance, ORDER_NATURAL);
+                else if(right.compare("RD")==0)   return D1_OMP_BAL(nT, m_total_num_colors, m_vertex_color, m_balance_tolerance, ORDER_RANDOM);
+                else if(right.compare("NONE")==0) return D1_OMP_BAL(nT, m_total_num_colors, m_vertex_color, m_balance_tolerance, ORDER_NONE);
+            }
             else if(left.compare("SERIAL_")==0) {
                 if     (right.compare("LF")==0)   return D1_serial(m_total_num_colors, m_vertex_color, ORDER_LARGEST_FIRST);
                 else if(right.compare("SL")==0)   return D1_serial(m_total_num_colors, m_vertex_color, ORDER_SMALLEST_LAST);
@@ -103,9 +115,10 @@ int SMPGCColoring::Coloring(int nT, const string& method, const int switch_iter=
                     else if(right.compare("NONE")==0) local_order=ORDER_NONE;
                     else { printf("Error local_order '%s' in method '%s' is not supported.\n", right.c_str(), method.c_str()); exit(1);}
                 }
-                if     (left.compare("GM3P")==0) return D1_OMP_HBJP(nT, m_total_num_colors, m_vertex_color, local_order, HYBRID_GM3P, switch_iter);
-                else if(left.compare("GMMP")==0) return D1_OMP_HBJP(nT, m_total_num_colors, m_vertex_color, local_order, HYBRID_GMMP, switch_iter);
-                else if(left.compare("SERIAL")==0) return D1_OMP_HBJP(nT, m_total_num_colors, m_vertex_color, local_order, HYBRID_GMMP, switch_iter);
+                if     (left.compare("GM3P")==0) return D1_OMP_HBJP(nT, m_total_num_colors, m_vertex_color, HYBRID_GM3P, switch_iter, local_order);
+                else if(left.compare("GMMP")==0) return D1_OMP_HBJP(nT, m_total_num_colors, m_vertex_color, HYBRID_GMMP, switch_iter, local_order);
+                else if(left.compare("SERIAL")==0) return D1_OMP_HBJP(nT, m_total_num_colors, m_vertex_color, HYBRID_GMMP, switch_iter, local_order);
+                else if(left.compare("STREAM")==0) return D1_OMP_HBJP(nT, m_total_num_colors, m_vertex_color, HYBRID_STREAM, switch_iter, local_order);
             }
             else if(left.compare("HBMTJP_")==0) {
                 int local_order=ORDER_NONE;
@@ -128,6 +141,7 @@ int SMPGCColoring::Coloring(int nT, const string& method, const int switch_iter=
                 if     (left.compare("GM3P"  )==0) return D1_OMP_HBMTJP(nT, m_total_num_colors, m_vertex_color, HYBRID_GM3P, switch_iter, local_order);
                 else if(left.compare("GMMP"  )==0) return D1_OMP_HBMTJP(nT, m_total_num_colors, m_vertex_color, HYBRID_GMMP, switch_iter, local_order);
                 else if(left.compare("SERIAL")==0) return D1_OMP_HBMTJP(nT, m_total_num_colors, m_vertex_color, HYBRID_GMMP, switch_iter, local_order);
+                else if(left.compare("STREAM")==0) return D1_OMP_HBMTJP(nT, m_total_num_colors, m_vertex_color, HYBRID_STREAM, switch_iter, local_order);
            
             }
         }
@@ -163,6 +177,26 @@ int SMPGCColoring::Coloring(int nT, const string& method, const int switch_iter=
         printf("Error! method \"%s\" with \"%s\" is not support.\n", method.c_str(), mthd.c_str());
         exit(1);
     }
+    else if(method.substr(0,9).compare("STAR_OMP_")==0) {
+        // star coloring algorithms
+        const string mthd = method.substr(9);
+        const auto iter_under_line = mthd.find('_');
+        string left = mthd.substr(0, iter_under_line);
+        int local_order = ORDER_NONE;
+        if(iter_under_line!=string::npos){
+            string right= mthd.substr(iter_under_line+1);
+            if     (right.compare("LF")==0)   local_order=ORDER_LARGEST_FIRST;
+            else if(right.compare("SL")==0)   local_order=ORDER_SMALLEST_LAST;
+            else if(right.compare("NT")==0)   local_order=ORDER_NATURAL;
+            else if(right.compare("RD")==0)   local_order=ORDER_RANDOM;
+            else if(right.compare("NONE")==0) local_order=ORDER_NONE;
+            else { printf("Error! method \"%s\" in \"%s\" is not support.\n", right.c_str(), method.c_str()); exit(1); }
+        }
+        if     (left.compare("GM3P")==0) return STAR_OMP_GM3P(nT, m_total_num_colors, m_vertex_color, local_order);
+        else if(left.compare("GMMP")==0) return STAR_OMP_GMMP(nT, m_total_num_colors, m_vertex_color, local_order);
+        printf("Error! method \"%s\" with \"%s\" is not support.\n", method.c_str(), mthd.c_str());
+        exit(1);
+    }
     else{
         printf("Error! method \"%s\" is not supported.\n", method.c_str());
         exit(1);
@@ -176,6 +210,8 @@ SMPGCColoring::SMPGCColoring(const string& graph_name)
 : SMPGCOrdering(graph_name, FORMAT_MM, nullptr, "NATURAL", nullptr) {
     m_vertex_color.reserve(num_nodes());
     m_total_num_colors=0;
+    m_partition=PARTITION_EQUAL;
+    m_balance_tolerance=BALANCE_TOLERANCE;
 }
 
 // ============================================================================
@@ -185,6 +221,8 @@ SMPGCColoring::SMPGCColoring(const string& graph_name, const string& fmt, double
 : SMPGCOrdering(graph_name, fmt, iotime, glb_order, ordtime){
     m_vertex_color.reserve(num_nodes());
     m_total_num_colors=0;
+    m_partition=PARTITION_EQUAL;
+    m_balance_tolerance=BALANCE_TOLERANCE;
 }
 
 
@@ -208,18 +246,17 @@ int SMPGCColoring::cnt_d1conflict(const vector<int>& vtxColorConst, bool bVerbos
                 n_uncolored++;
                 continue;
             }
-            for(int iw=vtxPtr[v]; iw!=vtxPtr[v+1]; iw++) {
-                const int w = vtxVal[iw];
-                if(v>=w) continue; // only check one side
-                if(vc == vtxColor[w] ) {
-                    vtxColor[w]=-1; // prevent further conflicts, however, since no synchronize used. May count more conflicts than actual.
-                    n_conflicts++;
-                    break;  
-                }
+            const int w = simd_find_conflict(vtxVal.data()+vtxPtr[v], vtxPtr[v+1]-vtxPtr[v], vtxColor.data(), vc, v); // only check one side, w>v
+            if(w!=-1) {
+                vtxColor[w]=-1; // prevent further conflicts, however, since no synchronize used. May count more conflicts than actual.
+                n_conflicts++;
             }
         }
     }
     if(bVerbose && n_uncolored) printf("There are %d vertex uncolored\nThere are %d vertex has conflicts with other nodes.\n",n_uncolored, n_conflicts);
+#ifdef SMPGC_VARIFY
+    n_conflicts += cnt_simd_mismatch(vtxColorConst, bVerbose);
+#endif
     return n_uncolored+n_conflicts;
 }
 
@@ -339,3 +376,91 @@ int SMPGCColoring::cnt_d2conflict(const vector<int>&vtxColorConst, bool bVerbose
 
 
 
+
+
+// ============================================================================
+// pre-partition the global ordered vertices into nT queues
+// ----------------------------------------------------------------------------
+// PARTITION_EQUAL gives each thread the same number of vertices.
+// PARTITION_DEGREE/STEALING give each thread the same estimated work, which
+// is deg(v)+1 for distance one and the length of v's two-hop walk for
+// distance two coloring.
+// ============================================================================
+void SMPGCColoring::partition_vertices(const int nT, vector<vector<int>>&QQ, const int distance){
+    const int N = num_nodes();
+    const vector<int>& vtxPtr = get_CSR_ia();
+    const vector<int>& vtxVal = get_CSR_ja();
+    const vector<int>& const_ordered_vertex = global_ordered_vertex();
+    
+    QQ.assign(nT, vector<int>());
+    vector<int> disps(nT+1, 0);
+    if(m_partition==PARTITION_EQUAL){
+        vector<int> lens(nT, N/nT); for(int i=0; i<N%nT; i++) lens[i]++;
+        for(int i=1; i<nT+1; i++) disps[i]=disps[i-1]+lens[i-1];
+    }
+    else{
+        vector<long long> acc(N+1, 0);
+        #pragma omp parallel for
+        for(int i=0; i<N; i++){
+            const auto v = const_ordered_vertex[i];
+            long long w = vtxPtr[v+1]-vtxPtr[v]+1;
+            if(distance==2){
+                for(int iw=vtxPtr[v]; iw!=vtxPtr[v+1]; iw++){
+                    const auto u = vtxVal[iw];
+                    w += vtxPtr[u+1]-vtxPtr[u];
+                }
+            }
+            acc[i+1]=w;
+        }
+        for(int i=0; i<N; i++) acc[i+1]+=acc[i];
+        for(int i=1; i<nT; i++)
+            disps[i] = lower_bound(acc.begin(), acc.end(), acc[N]*i/nT) - acc.begin();
+        disps[nT]=N;
+    }
+    for(int i=0; i<nT; i++){
+        QQ[i].reserve(disps[i+1]-disps[i]+16); //16-bus width
+        QQ[i].assign(const_ordered_vertex.begin()+disps[i], const_ordered_vertex.begin()+disps[i+1]);
+    }
+}
+
+// ============================================================================
+// get the next piece QQ[owner][beg,end) for thread tid to work on
+// ----------------------------------------------------------------------------
+// cursors holds one (padded) counter per queue and must be zeroed before
+// each parallel phase. Without stealing a thread takes its own queue in one
+// piece. With stealing it takes STEAL_CHUNK vertices at a time, from its own
+// queue first and then from the other threads' queues.
+// ============================================================================
+bool SMPGCColoring::next_chunk(const int tid, const vector<vector<int>>&QQ, vector<int>&cursors, int&owner, int&beg, int&end){
+    const int nT    = QQ.size();
+    const bool bSteal = (m_partition==PARTITION_STEALING);
+    const int nQ    = bSteal?nT:1;
+    if(!bSteal) owner=tid;
+    for(int k=0; k<nQ; k++){
+        const int q     = (owner+k)%nT;
+        const int qsize = QQ[q].size();
+        const int chunk = bSteal?STEAL_CHUNK:max(qsize,1);
+        int b;
+        #pragma omp atomic read
+        b = cursors[q*CURSOR_PAD];
+        if(b>=qsize) continue;
+        #pragma omp atomic capture
+        { b = cursors[q*CURSOR_PAD]; cursors[q*CURSOR_PAD]+=chunk; }
+        if(b>=qsize) continue;
+        owner = q;
+        beg   = b;
+        end   = min(b+chunk, qsize);
+        return true;
+    }
+    return false;
+}
+
+// ============================================================================
+// load imbalance of the threads, max busy time over mean busy time
+// ============================================================================
+double SMPGCColoring::load_imbalance(const vector<double>& busy){
+    double tmax=.0, tsum=.0;
+    for(const auto t : busy){ tmax=max(tmax,t); tsum+=t; }
+    if(tsum<=.0) return 1.0;
+    return tmax*busy.size()/tsum;
+}
@@ -51,6 +51,10 @@ public: // API
     int Coloring(int nT, const string& method, const int switch_iter);
     
     int get_num_colors(){ return m_total_num_colors; } 
+    void set_partition(const int x){ m_partition = x; }
+    int  get_partition() const { return m_partition; }
+    void   set_balance_tolerance(const double x){ m_balance_tolerance = x; }
+    double get_balance_tolerance() const { return m_balance_tolerance; }
     const vector<int>& get_vertex_colors() const { return m_vertex_color; }
     void get_vertex_colors(vector<int>& x) { x.assign(m_vertex_color.begin(), m_vertex_color.end()); }
 
@@ -71,6 +75,10 @@ public: // API
 
     int D1_OMP_GM3P_BIT(int nT, int&color, vector<int>&vtxColors, const int local_order=ORDER_NONE);
     int D1_OMP_GMMP_BIT(int nT, int&color, vector<int>&vtxColors, const int local_order=ORDER_NONE);
+
+    // color balanced distance one coloring: least used color + parallel rebalance
+    int D1_OMP_BAL(int nT, int&color, vector<int>&vtxColors, const double tolerance=BALANCE_TOLERANCE, const int local_order=ORDER_NONE);
+    int D1_OMP_rebalance(int nT, const int colors, vector<int>&vtxColors, const double tolerance=BALANCE_TOLERANCE);
    
 
 
@@ -80,15 +88,38 @@ public: // API
     int D2_OMP_GM3P   (int nT, int&color, vector<int>&vtxColors, const int local_order=ORDER_NONE);
     int D2_OMP_GMMP   (int nT, int&color, vector<int>&vtxColors, const int local_order=ORDER_NONE);
     
+    // Algorithm for star coloring (distance 1.5), see export_coloring() for the Hessian recovery
+    int STAR_OMP_GM3P (int nT, int&color, vector<int>&vtxColors, const int local_order=ORDER_NONE);
+    int STAR_OMP_GMMP (int nT, int&color, vector<int>&vtxColors, const int local_order=ORDER_NONE);
+    void export_coloring(GraphColoringInterface& g);
+
     // inner Algorithm for Hybird 
     inline void hybrid_GM3P(const int nT, vector<int>&vtxColors, vector<vector<int>>&Q, const int local_order=ORDER_NONE); 
     inline void hybrid_GMMP(const int nT, vector<int>&vtxColors, vector<vector<int>>&Q, const int local_order=ORDER_NONE); 
     inline void hybrid_Serial(vector<int>&vtxColors, vector<vector<int>>&Q, const int local_order=ORDER_NONE); 
+    inline void hybrid_Stream(const int nT, vector<int>&vtxColors, vector<vector<int>>&Q, const int local_order=ORDER_NONE); 
     
 
 public: // Utilites
     int cnt_d1conflict(const vector<int>& vc, bool bVerbose=false);
     int cnt_d2conflict(const vector<int>& vc, bool bVerbose=false);
+    int cnt_star_conflict(const vector<int>& vc, bool bVerbose=false);
+    int max_color_class(const int colors, const vector<int>& vc);
+    int cnt_simd_mismatch(const vector<int>& vc, bool bVerbose=false);
+    static const char* simd_kernel_name();
+
+protected: // neighbor scans, AVX2/AVX-512 when the cpu has them (SMPGCColoringSIMD.cpp)
+    static int  simd_find_conflict(const int* nbr, const int n, const int* vtxColors, const int c, const int v);
+    static void simd_mark_colors  (const int* nbr, const int n, const int* vtxColors, int* Mask, const int v);
+
+protected: // star coloring kernels (SMPGCColoringStar.cpp)
+    int  star_pick_color(const int v, const vector<int>&vtxColors, int* Mask, int* Seen, int* Rep, const int BufSize);
+    bool star_find_conflict(const int v, const vector<int>&vtxColors, int* Seen, int* Rep);
+
+protected: // scheduling for the speculative kernels
+    void   partition_vertices(const int nT, vector<vector<int>>&QQ, const int distance);
+    bool   next_chunk(const int tid, const vector<vector<int>>&QQ, vector<int>&cursors, int&owner, int&beg, int&end);
+    double load_imbalance(const vector<double>& busy);
 
 private:
 
@@ -110,6 +141,8 @@ protected:
     int         m_total_num_colors;
     vector<int> m_vertex_color;
     string      m_method;
+    int         m_partition;
+    double      m_balance_tolerance;
 
 }; // end of class SMPGCColoring
 
@@ -0,0 +1,230 @@
+/******************************************************************************
+    This file is part of ColPack, which is under its License protection.
+    You should have received a copy of the License. If not, see
+    <https://github.com/CSCsw/ColPack>
+*******************************************************************************/
+#include "SMPGCColoring.h"
+#include <algorithm>
+using namespace std;
+using namespace ColPack;
+
+
+
+// ============================================================================
+// Balanced distance one coloring
+// ----------------------------------------------------------------------------
+// Speculative coloring (GMMP style rounds) where every vertex takes the least
+// used permissible color among the colors opened so far, and opens a new
+// color only when all of them are forbidden. The result is then passed to
+// D1_OMP_rebalance to drain the classes larger than (1+tolerance)*N/colors.
+// Least used selection spreads every neighborhood over the whole palette, so
+// it opens more colors than first fit unless a LF/SL local order is used. To
+// keep a first fit color count, run D1_OMP_GM3P/GMMP and D1_OMP_rebalance.
+// ============================================================================
+int SMPGCColoring::D1_OMP_BAL(int nT, int&colors, vector<int>&vtxColors, const double tolerance, const int local_order) {
+    if(nT<=0) { printf("Warning, number of threads changed from %d to 1\n",nT); nT=1; }
+    omp_set_num_threads(nT);
+
+    double tim_partition  =.0;
+    double tim_total      =.0;
+    double tim_color      =.0;
+    double tim_detect     =.0;
+    double tim_balance    =.0;
+    int    n_loops        = 0;                     // number of iteration
+    int    n_conflicts    = 0;                     // number of conflicts
+    int    n_moved        = 0;                     // vertices moved by rebalance
+    int    uncolored_nodes= 0;
+    int    max_class      = 0;                     // largest class before rebalance
+    int    n_palette      = 0;                     // number of colors opened so far
+    const int N                = num_nodes();                    // number of vertex
+    const int BufSize          = max_degree()+1;         // maxDegree
+    const vector<int>& vtxPtr  = get_CSR_ia();     // ia of csr
+    const vector<int>& vtxVal  = get_CSR_ja();     // ja of csr
+
+    colors=0;
+    vtxColors.assign(N, -1);
+
+    vector<vector<int>> QQ(nT);
+    vector<int>    cursors(nT*CURSOR_PAD, 0);  // work stealing cursors
+    vector<double> tim_busy(nT, .0);           // per thread working time
+    vector<int>    class_size(BufSize, 0);     // current size of each color class
+
+    // pre-partition the graph
+    tim_partition =- omp_get_wtime();
+    partition_vertices(nT, QQ, 1);
+    tim_partition += omp_get_wtime();
+
+    // phase local order
+    tim_color -= omp_get_wtime();
+    #pragma omp parallel
+    {
+        vector<int>& Q = QQ[omp_get_thread_num()];
+        switch(local_order){
+            case ORDER_NONE:
+                break;
+            case ORDER_LARGEST_FIRST:
+                local_largest_degree_first_ordering(Q); break;
+            case ORDER_SMALLEST_LAST:
+                local_smallest_degree_last_ordering(Q); break;
+            case ORDER_NATURAL:
+                local_natural_ordering(Q); break;
+            case ORDER_RANDOM:
+                local_random_ordering(Q); break;
+            default:
+                printf("Error! unknown local order \"%d\".\n", local_order);
+                exit(1);
+        }
+    }
+    tim_color += omp_get_wtime();
+
+    uncolored_nodes=N;
+    while(uncolored_nodes!=0){
+        // phase psedue color
+        tim_color -= omp_get_wtime();
+        cursors.assign(nT*CURSOR_PAD, 0);
+        #pragma omp parallel
+        {
+            const int tid = omp_get_thread_num();
+            double tim_work = -omp_get_wtime();
+            vector<int> Mark; Mark.assign(BufSize,-1);
+            int owner=tid, beg=0, end=0;
+            while(next_chunk(tid, QQ, cursors, owner, beg, end)){
+                const vector<int>& Qo = QQ[owner];
+                for(int iv=beg; iv<end; iv++){
+                    const auto v = Qo[iv];
+                    simd_mark_colors(vtxVal.data()+vtxPtr[v], vtxPtr[v+1]-vtxPtr[v], vtxColors.data(), Mark.data(), v);
+                    int P;
+                    #pragma omp atomic read
+                    P = n_palette;
+                    // least used permissible color of the palette
+                    int c=-1;
+                    for(int k=0; k<P; k++){
+                        if(Mark[k]==v) continue;
+                        if(c==-1 || class_size[k]<class_size[c]) c=k;
+                    }
+                    // all forbidden, open a new color. P<=deg(v) here, so c<BufSize
+                    if(c==-1){
+                        for(c=P; c!=BufSize; c++)
+                            if(Mark[c]!=v)
+                                break;
+                        #pragma omp critical(SMPGC_BAL_PALETTE)
+                        {
+                            if(n_palette<c+1){
+                                #pragma omp atomic write
+                                n_palette=c+1;
+                            }
+                        }
+                    }
+                    vtxColors[v] = c;
+                    #pragma omp atomic
+                    class_size[c]++;
+                }
+            }
+            tim_busy[tid] += tim_work+omp_get_wtime();
+        } //end omp parallel
+        tim_color += omp_get_wtime();
+
+        //phase Detect Conflicts:
+        tim_detect -= omp_get_wtime();
+        uncolored_nodes=0;
+        cursors.assign(nT*CURSOR_PAD, 0);
+        #pragma omp parallel reduction(+:uncolored_nodes)
+        {
+            const int tid = omp_get_thread_num();
+            double tim_work = -omp_get_wtime();
+            vector<int> conflicts;
+            int owner=tid, beg=0, end=0;
+            while(next_chunk(tid, QQ, cursors, owner, beg, end)){
+                const vector<int>& Qo = QQ[owner];
+                for(int i=beg; i<end; i++){
+                    const auto v = Qo[i];
+                    const auto vc= vtxColors[v];
+                    if(simd_find_conflict(vtxVal.data()+vtxPtr[v], vtxPtr[v+1]-vtxPtr[v], vtxColors.data(), vc, v)!=-1){
+                        conflicts.push_back(v);
+                        vtxColors[v] = -1;
+                        #pragma omp atomic
+                        class_size[vc]--;
+                    }
+                }
+            }
+            tim_busy[tid] += tim_work+omp_get_wtime();
+            uncolored_nodes = conflicts.size();
+            #pragma omp barrier
+            QQ[tid].swap(conflicts);
+        }
+        n_conflicts += uncolored_nodes;
+        n_loops++;
+        tim_detect += omp_get_wtime();
+    }
+    colors = n_palette;
+    for(int c=0; c<colors; c++)
+        max_class = max(max_class, class_size[c]);
+
+    // phase rebalance
+    tim_balance = -omp_get_wtime();
+    n_moved = D1_OMP_rebalance(nT, colors, vtxColors, tolerance);
+    tim_balance += omp_get_wtime();
+
+    tim_total = tim_color+tim_detect+tim_balance;
+
+    string order_tag="unkonwn";
+    switch(local_order){
+        case ORDER_NONE:
+            order_tag="NoOrder"; break;
+        case ORDER_LARGEST_FIRST:
+            order_tag="LF"; break;
+        case ORDER_SMALLEST_LAST:
+            order_tag="SL"; break;
+        case ORDER_NATURAL:
+            order_tag="NT"; break;
+        case ORDER_RANDOM:
+            order_tag="RD"; break;
+        default:
+            printf("unkonw local order %d\n", local_order);
+    }
+
+    printf("@BAL%s_nT_c_T_T(Lo+Color)_TDetect_TBal_nCnf_nLoop_Tpart_LdImb_MaxCls_nMoved_MaxClsBal", order_tag.c_str());
+    printf("\t%d",  nT);
+    printf("\t%d",  colors);
+    printf("\t%lf", tim_total);
+    printf("\t%lf", tim_color);
+    printf("\t%lf", tim_detect);
+    printf("\t%lf", tim_balance);
+    printf("\t%d",  n_conflicts);
+    printf("\t%d",  n_loops);
+    printf("\t%lf", tim_partition);
+    printf("\t%lf", load_imbalance(tim_busy));
+    printf("\t%d",  max_class);
+    printf("\t%d",  n_moved);
+    printf("\t%d",  max_color_class(colors, vtxColors));
+#ifdef SMPGC_VARIFY
+    printf("\t%s", (cnt_d1conflict(vtxColors)==0)?("Success"):("Failed"));
+#endif
+    printf("\n");
+    return true;
+}
+
+
+
+// ============================================================================
+// Parallel rebalance of a distance one coloring, see RebalanceColorClasses()
+// return the number of moved vertices.
+// ============================================================================
+int SMPGCColoring::D1_OMP_rebalance(int nT, const int colors, vector<int>&vtxColors, const double tolerance) {
+    if(nT<=0) { printf("Warning, number of threads changed from %d to 1\n",nT); nT=1; }
+    omp_set_num_threads(nT);
+    return RebalanceColorClasses(get_CSR_ia(), get_CSR_ja(), colors, tolerance, vtxColors);
+}
+
+
+
+// ============================================================================
+// size of the largest color class
+// ============================================================================
+int SMPGCColoring::max_color_class(const int colors, const vector<int>& vtxColors){
+    vector<int> class_size(max(colors,1), 0);
+    for(const auto c : vtxColors)
+        if(c>=0 && c<colors) class_size[c]++;
+    return *max_element(class_size.begin(), class_size.end());
+}
+
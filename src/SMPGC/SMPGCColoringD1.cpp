@@ -115,24 +115,17 @@ int SMPGCColoring::D1_OMP_GM3P(int nT, int&colors, vector<int>&vtxColors, const
     const int BufSize         = max_degree()+1;
     const vector<int>& vtxPtr = get_CSR_ia();
     const vector<int>& vtxVal = get_CSR_ja();
-    const vector<int>& const_ordered_vertex = global_ordered_vertex(); 
 
     colors=0;                       
     vtxColors.assign(N, -1);
 
     vector<vector<int>> QQ(nT); 
-    for(int i=0; i<nT; i++)
-        QQ[i].reserve(N/nT+1+16); //1-odd/even, 16-bus width
+    vector<int>    cursors(nT*CURSOR_PAD, 0);  // work stealing cursors
+    vector<double> tim_busy(nT, .0);           // per thread working time
 
     // pre-partition the graph
     tim_partition =- omp_get_wtime();
-    {
-        vector<int> lens(nT, N/nT); for(int i=0; i<N%nT; i++) lens[i]++;
-        vector<int> disps(nT+1, 0); for(int i=1; i<nT+1; i++) disps[i]=disps[i-1]+lens[i-1];
-        for(int i=0; i<nT; i++)
-            QQ[i].insert(QQ[i].end(), const_ordered_vertex.begin()+disps[i], 
-                    const_ordered_vertex.begin()+disps[i+1]);
-    }
+    partition_vertices(nT, QQ, 1);
     tim_partition += omp_get_wtime();
     
 
@@ -159,42 +152,50 @@ int SMPGCColoring::D1_OMP_GM3P(int nT, int&colors, vector<int>&vtxColors, const
                 exit(1);
         }
 
+        #pragma omp barrier
+
+        double tim_work = -omp_get_wtime();
         vector<int> Mask; Mask.assign(BufSize,-1);
-        for(const auto v : Q){
-            for(int iw=vtxPtr[v]; iw!=vtxPtr[v+1]; iw++) {
-                const auto wc=vtxColors[vtxVal[iw]];
-                if( wc >= 0) 
-                    Mask[wc] = v;
-            } 
-            int c=0;
-            for (; c!=BufSize; c++)
-                if(Mask[c]!=v)
-                    break;
-            vtxColors[v] = c;
+        int owner=tid, beg=0, end=0;
+        while(next_chunk(tid, QQ, cursors, owner, beg, end)){
+            const vector<int>& Qo = QQ[owner];
+            for(int iv=beg; iv<end; iv++){
+                const auto v = Qo[iv];
+                simd_mark_colors(vtxVal.data()+vtxPtr[v], vtxPtr[v+1]-vtxPtr[v], vtxColors.data(), Mask.data(), v);
+                int c=0;
+                for (; c!=BufSize; c++)
+                    if(Mask[c]!=v)
+                        break;
+                vtxColors[v] = c;
+            }
         }
+        tim_busy[tid] += tim_work+omp_get_wtime();
     } //end omp parallel
     tim_color  += omp_get_wtime();    
 
     // phase conflicts detection
     tim_detect =- omp_get_wtime();
+    cursors.assign(nT*CURSOR_PAD, 0);
     #pragma omp parallel
     {
-        int qsize = 0;
         const int tid=omp_get_thread_num();
-        vector<int>& Q = QQ[tid];
-        for(int iv=0; iv<(signed)Q.size(); iv++) {
-            const auto v  = Q[iv];
-            const auto vc = vtxColors[v];
-            for(int iw=vtxPtr[v]; iw!=vtxPtr[v+1]; iw++){ 
-                const auto w = vtxVal[iw];
-                if(v<w && vc == vtxColors[w]) {
-                    Q[qsize++] = v;
+        double tim_work = -omp_get_wtime();
+        vector<int> conflicts;
+        int owner=tid, beg=0, end=0;
+        while(next_chunk(tid, QQ, cursors, owner, beg, end)){
+            const vector<int>& Qo = QQ[owner];
+            for(int iv=beg; iv<end; iv++) {
+                const auto v  = Qo[iv];
+                const auto vc = vtxColors[v];
+                if(simd_find_conflict(vtxVal.data()+vtxPtr[v], vtxPtr[v+1]-vtxPtr[v], vtxColors.data(), vc, v)!=-1) {
+                    conflicts.push_back(v);
                     vtxColors[v] = -1;  //Will prevent v from being in conflict in another pairing
-                    break;
-                } 
-            } 
+                }
+            }
         }
-        Q.resize(qsize);
+        tim_busy[tid] += tim_work+omp_get_wtime();
+        #pragma omp barrier
+        QQ[tid].swap(conflicts);
     } //end omp parallel
     tim_detect  += omp_get_wtime();
    
@@ -247,7 +248,7 @@ int SMPGCColoring::D1_OMP_GM3P(int nT, int&colors, vector<int>&vtxColors, const
     }
 
   
-    printf("@GM3P%s_nT_c_T_T(lo+color)_Tdetect_Trecolor_TmaxC_nCnf_Tpart", order_tag.c_str());
+    printf("@GM3P%s_nT_c_T_T(lo+color)_Tdetect_Trecolor_TmaxC_nCnf_Tpart_LdImb", order_tag.c_str());
     printf("\t%d",  nT);    
     printf("\t%d",  colors);    
     printf("\t%lf", tim_total);
@@ -259,6 +260,7 @@ int SMPGCColoring::D1_OMP_GM3P(int nT, int&colors, vector<int>&vtxColors, const
     for(int i=0; i<nT; i++) n_conflicts+=QQ[i].size();
     printf("\t%d", n_conflicts);
     printf("\t%lf", tim_partition);
+    printf("\t%lf", load_imbalance(tim_busy));
 #ifdef SMPGC_VARIFY
     printf("\t%s", (cnt_d1conflict(vtxColors, true)==0)?("Success"):("Failed"));
 #endif
@@ -290,24 +292,17 @@ int SMPGCColoring::D1_OMP_GMMP(int nT, int&colors, vector<int>&vtxColors, const
     const int BufSize          = max_degree()+1;         // maxDegree
     const vector<int>& vtxPtr  = get_CSR_ia();     // ia of csr
     const vector<int>& vtxVal  = get_CSR_ja();     // ja of csr
-    const vector<int>& const_ordered_vertex = global_ordered_vertex(); 
     
     colors=0;
     vtxColors.assign(N, -1);
 
     vector<vector<int>> QQ(nT);
-    for(int i=0; i<nT;i++) 
-        QQ[i].reserve(N/nT+1+16); //1-odd/even, 16-bus width
+    vector<int>    cursors(nT*CURSOR_PAD, 0);  // work stealing cursors
+    vector<double> tim_busy(nT, .0);           // per thread working time
 
     // pre-partition the graph
     tim_partition =- omp_get_wtime();
-    {
-        vector<int> lens(nT, N/nT); for(int i=0; i<N%nT; i++) lens[i]++;
-        vector<int> disps(nT+1, 0); for(int i=1; i<nT+1; i++) disps[i]=disps[i-1]+lens[i-1];
-        for(int i=0; i<nT; i++)
-            QQ[i].insert(QQ[i].end(), const_ordered_vertex.begin()+disps[i], 
-                    const_ordered_vertex.begin()+disps[i+1]);
-    }
+    partition_vertices(nT, QQ, 1);
     tim_partition += omp_get_wtime();
 
 
@@ -315,6 +310,7 @@ int SMPGCColoring::D1_OMP_GMMP(int nT, int&colors, vector<int>&vtxColors, const
     while(uncolored_nodes!=0){
         // phase psedue color
         tim_color -= omp_get_wtime();
+        cursors.assign(nT*CURSOR_PAD, 0);
         #pragma omp parallel
         {
             const int tid = omp_get_thread_num();
@@ -335,43 +331,52 @@ int SMPGCColoring::D1_OMP_GMMP(int nT, int&colors, vector<int>&vtxColors, const
                     printf("Error! unknown local order \"%d\".\n", local_order);
                     exit(1);
             }
+            #pragma omp barrier
+
+            double tim_work = -omp_get_wtime();
             vector<int> Mark; Mark.assign(BufSize,-1);
-            for(const auto v : Q){
-                for(int iw = vtxPtr[v]; iw!=vtxPtr[v+1]; iw++) {
-                    const auto w = vtxVal[iw];
-                    const auto wc= vtxColors[w];
-                    if(wc>=0) 
-                        Mark[wc]=v;
+            int owner=tid, beg=0, end=0;
+            while(next_chunk(tid, QQ, cursors, owner, beg, end)){
+                const vector<int>& Qo = QQ[owner];
+                for(int iv=beg; iv<end; iv++){
+                    const auto v = Qo[iv];
+                    simd_mark_colors(vtxVal.data()+vtxPtr[v], vtxPtr[v+1]-vtxPtr[v], vtxColors.data(), Mark.data(), v);
+                    int c=0;
+                    for(; c!=BufSize; c++)
+                        if(Mark[c]!=v)
+                            break;
+                    vtxColors[v] = c;
                 }
-                int c=0;
-                for(; c!=BufSize; c++)
-                    if(Mark[c]!=v)
-                        break;
-                vtxColors[v] = c;
             } 
+            tim_busy[tid] += tim_work+omp_get_wtime();
         } //end omp parallel
         tim_color += omp_get_wtime();
         
         //phase Detect Conflicts:
         tim_detect -= omp_get_wtime();
         uncolored_nodes=0;
+        cursors.assign(nT*CURSOR_PAD, 0);
         #pragma omp parallel reduction(+:uncolored_nodes)
         {
             const int tid = omp_get_thread_num();
-            vector<int>& Q = QQ[tid];
-            for(int i=0; i<(signed)Q.size(); i++){
-                const auto v = Q[i];
-                const auto vc= vtxColors[v];
-                for(int iw=vtxPtr[v]; iw!=vtxPtr[v+1]; iw++) {
-                    const auto w = vtxVal[iw];
-                    if(v<w && vc==vtxColors[w]){
-                        Q[uncolored_nodes++]=v;
+            double tim_work = -omp_get_wtime();
+            vector<int> conflicts;
+            int owner=tid, beg=0, end=0;
+            while(next_chunk(tid, QQ, cursors, owner, beg, end)){
+                const vector<int>& Qo = QQ[owner];
+                for(int i=beg; i<end; i++){
+                    const auto v = Qo[i];
+                    const auto vc= vtxColors[v];
+                    if(simd_find_conflict(vtxVal.data()+vtxPtr[v], vtxPtr[v+1]-vtxPtr[v], vtxColors.data(), vc, v)!=-1){
+                        conflicts.push_back(v);
                         vtxColors[v] = -1;
-                        break;
                     }
                 }
             }
-            Q.resize(uncolored_nodes);
+            tim_busy[tid] += tim_work+omp_get_wtime();
+            uncolored_nodes = conflicts.size();
+            #pragma omp barrier
+            QQ[tid].swap(conflicts);
         }
         n_conflicts += uncolored_nodes;
         n_loops++;
@@ -406,7 +411,7 @@ int SMPGCColoring::D1_OMP_GMMP(int nT, int&colors, vector<int>&vtxColors, const
             printf("unkonw local order %d\n", local_order);
     }
 
-    printf("@GMMP%s_nT_c_T_T(Lo+Color)_TDetect_TMaxC_nCnf_nLoop", order_tag.c_str());
+    printf("@GMMP%s_nT_c_T_T(Lo+Color)_TDetect_TMaxC_nCnf_nLoop_Tpart_LdImb", order_tag.c_str());
     printf("\t%d",  nT);    
     printf("\t%d",  colors);    
     printf("\t%lf", tim_total);
@@ -417,6 +422,7 @@ int SMPGCColoring::D1_OMP_GMMP(int nT, int&colors, vector<int>&vtxColors, const
     printf("\t%d",  n_conflicts);  
     printf("\t%d",  n_loops);
     printf("\t%lf", tim_partition);
+    printf("\t%lf", load_imbalance(tim_busy));
 #ifdef SMPGC_VARIFY
     printf("\t%s", (cnt_d1conflict(vtxColors)==0)?("Success"):("Failed"));
 #endif
@@ -118,21 +118,15 @@ int SMPGCColoring::D2_OMP_GM3P(int nT, int &colors, vector<int>& vtxColors, cons
     const int BufSize = min( max_degree()*(max_degree()-1)+1, N); //maxDegree
     const vector<int>& vtxPtr = get_CSR_ia();
     const vector<int>& vtxVal = get_CSR_ja();
-    const vector<int>& const_ordered_vertex = global_ordered_vertex(); 
     
     colors=0;                       
     vtxColors.assign(N, -1);
 
     vector<vector<int>> QQ(nT);
+    vector<int>    cursors(nT*CURSOR_PAD, 0);  // work stealing cursors
+    vector<double> tim_busy(nT, .0);           // per thread working time
     tim_partition =- omp_get_wtime();
-    {
-        vector<int> lens (nT, N/nT); for(int i=0; i<N%nT; i++) lens[i]++;
-        vector<int> disps(nT+1,0);   for(int i=1; i<=nT; i++)  disps[i]=disps[i-1]+lens[i-1];
-        for(int i=0; i<nT; i++){
-            QQ[i].reserve(N/nT+1+16);
-            QQ[i].assign(const_ordered_vertex.begin()+disps[i], const_ordered_vertex.begin()+disps[i+1]); 
-        }
-    }
+    partition_vertices(nT, QQ, 2);
     tim_partition += omp_get_wtime();
 
     // phase - Pseudo Coloring
@@ -159,68 +153,84 @@ int SMPGCColoring::D2_OMP_GM3P(int nT, int &colors, vector<int>& vtxColors, cons
                 exit(1);
         }
 
-        for(const auto v : Q){
-            for(int iw=vtxPtr[v]; iw!=vtxPtr[v+1]; iw++) {  
-                const auto w  = vtxVal[iw];
-                const auto wc = vtxColors[w];
-                if(wc<0) continue;
-                Mask[wc] = v;
-            }
-            for(int iw=vtxPtr[v]; iw!=vtxPtr[v+1]; iw++) {
-                const auto w = vtxVal[iw];
-                for(int iu=vtxPtr[w]; iu!=vtxPtr[w+1]; iu++) { // d2 neighbors
-                    const auto u = vtxVal[iu];
-                    if(v==u) continue;
-                    const auto uc = vtxColors[u];
-                    if(uc<0) continue;
-                    Mask[uc] = v;
+        #pragma omp barrier
+
+        double tim_work = -omp_get_wtime();
+        int owner=tid, beg=0, end=0;
+        while(next_chunk(tid, QQ, cursors, owner, beg, end)){
+            const vector<int>& Qo = QQ[owner];
+            for(int iv=beg; iv<end; iv++){
+                const auto v = Qo[iv];
+                for(int iw=vtxPtr[v]; iw!=vtxPtr[v+1]; iw++) {  
+                    const auto w  = vtxVal[iw];
+                    const auto wc = vtxColors[w];
+                    if(wc<0) continue;
+                    Mask[wc] = v;
                 }
-            }
-            int c=0;
-            for (; c!=BufSize; c++)
-                if(Mask[c]!=v)
-                    break;
-            vtxColors[v] = c;
-        } //end for
+                for(int iw=vtxPtr[v]; iw!=vtxPtr[v+1]; iw++) {
+                    const auto w = vtxVal[iw];
+                    for(int iu=vtxPtr[w]; iu!=vtxPtr[w+1]; iu++) { // d2 neighbors
+                        const auto u = vtxVal[iu];
+                        if(v==u) continue;
+                        const auto uc = vtxColors[u];
+                        if(uc<0) continue;
+                        Mask[uc] = v;
+                    }
+                }
+                int c=0;
+                for (; c!=BufSize; c++)
+                    if(Mask[c]!=v)
+                        break;
+                vtxColors[v] = c;
+            } //end for
+        }
+        tim_busy[tid] += tim_work+omp_get_wtime();
     }//end of omp parallel
     tim_color  += omp_get_wtime();    
 
     // Phase - Detect Conflicts
     tim_detect =- omp_get_wtime();
+    cursors.assign(nT*CURSOR_PAD, 0);
     #pragma omp parallel
     {
-        int num_uncolored=0;
         const int tid=omp_get_thread_num();
-        vector<int>& Q = QQ[tid];
-        for(int iv=0; iv<(signed)Q.size(); iv++){
-            const auto v  = Q[iv];
-            const auto vc = vtxColors[v];
-            bool b_vis_conflict=false;
-            for(int iw=vtxPtr[v]; iw!=vtxPtr[v+1]; iw++) { // d1 neighbors
-                const auto w = vtxVal[iw];
-                if(v >= w) continue;   // check conflict is little brother's job
-                if(vc == vtxColors[w]) {
-                    Q[num_uncolored++]=v;
-                    vtxColors[v]=-1;
-                    b_vis_conflict=true;
-                    break;
-                }
-            }
-            for(int iw=vtxPtr[v]; b_vis_conflict==false && iw!=vtxPtr[v+1]; iw++) {
-                const auto w = vtxVal[iw];
-                for(int iu=vtxPtr[w]; iu!=vtxPtr[w+1]; iu++) { // d2 neighbors
-                    const auto u = vtxVal[iu];
-                    if(v >= u) continue; // check conflict is little brother's job
-                    if(vc == vtxColors[u]) {
-                        Q[num_uncolored++]=v;
+        double tim_work = -omp_get_wtime();
+        vector<int> conflicts;
+        int owner=tid, beg=0, end=0;
+        while(next_chunk(tid, QQ, cursors, owner, beg, end)){
+            const vector<int>& Qo = QQ[owner];
+            for(int iv=beg; iv<end; iv++){
+                const auto v  = Qo[iv];
+                const auto vc = vtxColors[v];
+                bool b_vis_conflict=false;
+                for(int iw=vtxPtr[v]; iw!=vtxPtr[v+1]; iw++) { // d1 neighbors
+                    const auto w = vtxVal[iw];
+                    if(v >= w) continue;   // check conflict is little brother's job
+                    if(vc == vtxColors[w]) {
+                        conflicts.push_back(v);
                         vtxColors[v]=-1;
                         b_vis_conflict=true;
                         break;
                     }
                 }
-            } 
-        } //end for vertex v
-        Q.resize(num_uncolored);
+                for(int iw=vtxPtr[v]; b_vis_conflict==false && iw!=vtxPtr[v+1]; iw++) {
+                    const auto w = vtxVal[iw];
+                    for(int iu=vtxPtr[w]; iu!=vtxPtr[w+1]; iu++) { // d2 neighbors
+                        const auto u = vtxVal[iu];
+                        if(v >= u) continue; // check conflict is little brother's job
+                        if(vc == vtxColors[u]) {
+                            conflicts.push_back(v);
+                            vtxColors[v]=-1;
+                            b_vis_conflict=true;
+                            break;
+                        }
+                    }
+                } 
+            } //end for vertex v
+        }
+        tim_busy[tid] += tim_work+omp_get_wtime();
+        #pragma omp barrier
+        QQ[tid].swap(conflicts);
     } //end omp parallel 
     tim_detect  += omp_get_wtime();
    
@@ -283,7 +293,7 @@ int SMPGCColoring::D2_OMP_GM3P(int nT, int &colors, vector<int>& vtxColors, cons
             printf("unkonw local order %d\n", local_order);
     }
 
-    printf("@D2GM3P%s_nT_c_T_T(lo+Color)_TDetect_TRecolor_TMxC_nCnf_Tpart\t", order_tag.c_str());
+    printf("@D2GM3P%s_nT_c_T_T(lo+Color)_TDetect_TRecolor_TMxC_nCnf_Tpart_LdImb\t", order_tag.c_str());
     printf("\t%d",  nT);    
     printf("\t%d",  colors);    
     printf("\t%lf", tim_total);
@@ -294,6 +304,7 @@ int SMPGCColoring::D2_OMP_GM3P(int nT, int &colors, vector<int>& vtxColors, cons
     for(int i=0; i<nT; i++) n_conflicts+=QQ[i].size();
     printf("\t%d", n_conflicts);
     printf("\t%lf", tim_partition);
+    printf("\t%lf", load_imbalance(tim_busy));
 #ifdef SMPGC_VARIFY
     printf("\t%s", (cnt_d2conflict(vtxColors)==0)?("Success"):("Failed"));
 #endif
@@ -324,21 +335,15 @@ int SMPGCColoring::D2_OMP_GMMP(int nT, int &colors, vector<int>&vtxColors, int l
     const int BufSize = min( max_degree()*(max_degree()-1)+1, N); //maxDegree
     const vector<int>& vtxPtr = get_CSR_ia();
     const vector<int>& vtxVal = get_CSR_ja();
-    const vector<int>& const_ordered_vertex = global_ordered_vertex(); 
     
     colors=0;                       
     vtxColors.assign(N, -1);
 
     vector<vector<int>> QQ(nT);
+    vector<int>    cursors(nT*CURSOR_PAD, 0);  // work stealing cursors
+    vector<double> tim_busy(nT, .0);           // per thread working time
     tim_partition =- omp_get_wtime();
-    {
-        vector<int> lens (nT, N/nT); for(int i=0; i<N%nT; i++) lens[i]++;
-        vector<int> disps(nT+1,0);   for(int i=1; i<=nT; i++)  disps[i]=disps[i-1]+lens[i-1];
-        for(int i=0; i<nT; i++){
-            QQ[i].reserve(N/nT+1+16);
-            QQ[i].assign(const_ordered_vertex.begin()+disps[i], const_ordered_vertex.begin()+disps[i+1]); 
-        }
-    }
+    partition_vertices(nT, QQ, 2);
     tim_partition += omp_get_wtime();
 
 
@@ -346,6 +351,7 @@ int SMPGCColoring::D2_OMP_GMMP(int nT, int &colors, vector<int>&vtxColors, int l
     while(n_uncolored!=0){
         // phase - Pseudo Coloring
         tim_color -= omp_get_wtime();
+        cursors.assign(nT*CURSOR_PAD, 0);
         #pragma omp parallel
         {
             const int tid = omp_get_thread_num();
@@ -368,67 +374,85 @@ int SMPGCColoring::D2_OMP_GMMP(int nT, int &colors, vector<int>&vtxColors, int l
                     exit(1);
             }
 
-            for(const auto v : Q) {
-                for(int iw=vtxPtr[v]; iw!=vtxPtr[v+1]; iw++ ) {  // d1 neighbors
-                    const auto wc = vtxColors[ vtxVal[iw] ];
-                    if(wc<0) continue;
-                    Mask[wc] = v;
-                }
-                for(int iw=vtxPtr[v]; iw!=vtxPtr[v+1]; iw++) {
-                    const auto w = vtxVal[iw];
-                    for(int iu=vtxPtr[w]; iu!=vtxPtr[w+1]; iu++) { // d2 neighbors
-                        const auto u = vtxVal[iu];
-                        if(v==u) continue;
-                        const auto uc = vtxColors[u];
-                        if(uc<0) continue;
-                        Mask[uc] = v;
+            #pragma omp barrier
+
+            double tim_work = -omp_get_wtime();
+            int owner=tid, beg=0, end=0;
+            while(next_chunk(tid, QQ, cursors, owner, beg, end)){
+                const vector<int>& Qo = QQ[owner];
+                for(int iv=beg; iv<end; iv++) {
+                    const auto v = Qo[iv];
+                    for(int iw=vtxPtr[v]; iw!=vtxPtr[v+1]; iw++ ) {  // d1 neighbors
+                        const auto wc = vtxColors[ vtxVal[iw] ];
+                        if(wc<0) continue;
+                        Mask[wc] = v;
                     }
-                }
-                int c=0;
-                for(; c!=BufSize; c++)
-                    if(Mask[c]!=v)
-                        break;
-                vtxColors[v] = c;
-            } //end for
+                    for(int iw=vtxPtr[v]; iw!=vtxPtr[v+1]; iw++) {
+                        const auto w = vtxVal[iw];
+                        for(int iu=vtxPtr[w]; iu!=vtxPtr[w+1]; iu++) { // d2 neighbors
+                            const auto u = vtxVal[iu];
+                            if(v==u) continue;
+                            const auto uc = vtxColors[u];
+                            if(uc<0) continue;
+                            Mask[uc] = v;
+                        }
+                    }
+                    int c=0;
+                    for(; c!=BufSize; c++)
+                        if(Mask[c]!=v)
+                            break;
+                    vtxColors[v] = c;
+                } //end for
+            }
+            tim_busy[tid] += tim_work+omp_get_wtime();
         }//end of omp parallel
         tim_color  += omp_get_wtime();    
 
         // Phase - Detect Conflicts
         tim_detect -= omp_get_wtime();
         n_uncolored=0;        
+        cursors.assign(nT*CURSOR_PAD, 0);
         #pragma omp parallel reduction(+: n_uncolored)
         {
             const int tid=omp_get_thread_num();
-            vector<int>& Q = QQ[tid];
-            for(int i=0; i<(signed)Q.size(); i++){
-                const auto v = Q[i];
-                const auto vc= vtxColors[v];
-                bool b_vis_conflict=false;
-                for(int iw=vtxPtr[v]; iw!=vtxPtr[v+1]; iw++){
-                    const auto w = vtxVal[iw];
-                    if( v >= w ) continue;
-                    if( vc== vtxColors[w]) {
-                        Q[n_uncolored++] = v;
-                        vtxColors[v] = -1;
-                        b_vis_conflict=true;
-                        break;
-                    }
-                }
-                for(int iw=vtxPtr[v]; b_vis_conflict==false && iw!=vtxPtr[v+1]; iw++) {
-                    const auto w = vtxVal[iw];
-                    for(int iu=vtxPtr[w]; iu!=vtxPtr[w+1]; iu++){
-                        const auto u = vtxVal[iu];
-                        if(v>=u) continue;
-                        if(vc == vtxColors[u]) {
-                            Q[n_uncolored++]=v;
-                            vtxColors[v]=-1;
+            double tim_work = -omp_get_wtime();
+            vector<int> conflicts;
+            int owner=tid, beg=0, end=0;
+            while(next_chunk(tid, QQ, cursors, owner, beg, end)){
+                const vector<int>& Qo = QQ[owner];
+                for(int i=beg; i<end; i++){
+                    const auto v = Qo[i];
+                    const auto vc= vtxColors[v];
+                    bool b_vis_conflict=false;
+                    for(int iw=vtxPtr[v]; iw!=vtxPtr[v+1]; iw++){
+                        const auto w = vtxVal[iw];
+                        if( v >= w ) continue;
+                        if( vc== vtxColors[w]) {
+                            conflicts.push_back(v);
+                            vtxColors[v] = -1;
                             b_vis_conflict=true;
                             break;
                         }
                     }
+                    for(int iw=vtxPtr[v]; b_vis_conflict==false && iw!=vtxPtr[v+1]; iw++) {
+                        const auto w = vtxVal[iw];
+                        for(int iu=vtxPtr[w]; iu!=vtxPtr[w+1]; iu++){
+                            const auto u = vtxVal[iu];
+                            if(v>=u) continue;
+                            if(vc == vtxColors[u]) {
+                                conflicts.push_back(v);
+                                vtxColors[v]=-1;
+                                b_vis_conflict=true;
+                                break;
+                            }
+                        }
+                    }
                 }
             }
-            Q.resize(n_uncolored);
+            tim_busy[tid] += tim_work+omp_get_wtime();
+            n_uncolored = conflicts.size();
+            #pragma omp barrier
+            QQ[tid].swap(conflicts);
         } //end of omp parallel
         tim_detect  += omp_get_wtime();
         n_loops++;
@@ -463,7 +487,7 @@ int SMPGCColoring::D2_OMP_GMMP(int nT, int &colors, vector<int>&vtxColors, int l
             printf("unkonw local order %d\n", local_order);
     }
 
-    printf("@D2GMMP%s_nT_c_T_T(Lo+Color)_TDetect_TMxC_nCnf_nLoop_TPart", order_tag.c_str());
+    printf("@D2GMMP%s_nT_c_T_T(Lo+Color)_TDetect_TMxC_nCnf_nLoop_TPart_LdImb", order_tag.c_str());
     printf("\t%d",  nT);    
     printf("\t%d",  colors);    
     printf("\t%lf", tim_total);
@@ -473,6 +497,7 @@ int SMPGCColoring::D2_OMP_GMMP(int nT, int &colors, vector<int>&vtxColors, int l
     printf("\t%d",  n_conflicts);
     printf("\t%d" , n_loops);
     printf("\t%lf", tim_partition);
+    printf("\t%lf", load_imbalance(tim_busy));
 #ifdef SMPGC_VARIFY
     printf("\t%s", (cnt_d2conflict(vtxColors)==0)?("Success"):("Failed"));
 #endif
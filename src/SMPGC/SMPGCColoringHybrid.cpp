@@ -137,7 +137,7 @@ int SMPGCColoring::D1_OMP_HBJP(int nT, int&colors, vector<int>& vtxColors, const
         case HYBRID_GM3P:      hybrid_GM3P  (nT, vtxColors, QQ, local_order); break;
         case HYBRID_GMMP:      hybrid_GMMP  (nT, vtxColors, QQ, local_order); break;
         case HYBRID_SERIAL:    hybrid_Serial(vtxColors, QQ, local_order); break;
-        case HYBRID_STREAM:
+        case HYBRID_STREAM:    hybrid_Stream(nT, vtxColors, QQ, local_order); break;
         default:
             printf("Error %d option for hybrid alg is not support!", option);
             exit(1);
@@ -162,7 +162,7 @@ int SMPGCColoring::D1_OMP_HBJP(int nT, int&colors, vector<int>& vtxColors, const
         case HYBRID_GM3P:       alg_tag="GM3P";    break;
         case HYBRID_GMMP:       alg_tag="GMMP";    break;
         case HYBRID_SERIAL:     alg_tag="Serial";  break;
-        case HYBRID_STREAM:
+        case HYBRID_STREAM:     alg_tag="Stream";  break;
         default:               printf("Error %d option for hybrid alg is not support!", option);
     }
     
@@ -236,7 +236,7 @@ int SMPGCColoring::D1_OMP_HBMTJP(int nT, int&colors, vector<int>& vtxColors,  co
     tim_MIS -= omp_get_wtime();
     uncolored_nodes = N;
     while(uncolored_nodes!=0){
-        if(switch_iter>=n_loops)
+        if(n_loops>=switch_iter)
             break;
         uncolored_nodes=0;
 
@@ -300,11 +300,11 @@ int SMPGCColoring::D1_OMP_HBMTJP(int nT, int&colors, vector<int>& vtxColors,  co
                 vtxColors[ candi_nodes_color[i] ] = candi_nodes_color[i+1];
             }
         } //end omp parallel
-        tim_MIS += omp_get_wtime();
     
         n_loops++;
         n_conflicts+=uncolored_nodes;
     } //end while
+    tim_MIS += omp_get_wtime();
 
     tim_Alg2 =- omp_get_wtime();
     switch(option)
@@ -312,7 +312,7 @@ int SMPGCColoring::D1_OMP_HBMTJP(int nT, int&colors, vector<int>& vtxColors,  co
         case HYBRID_GM3P:      hybrid_GM3P  (nT, vtxColors, QQ, local_order ); break;
         case HYBRID_GMMP:      hybrid_GMMP  (nT, vtxColors, QQ, local_order ); break;
         case HYBRID_SERIAL:    hybrid_Serial(vtxColors, QQ, local_order ); break;
-        case HYBRID_STREAM:
+        case HYBRID_STREAM:    hybrid_Stream(nT, vtxColors, QQ, local_order ); break;
         default:
             printf("Error %d option for hybrid alg is not support!", option);
             exit(1);
@@ -336,7 +336,7 @@ int SMPGCColoring::D1_OMP_HBMTJP(int nT, int&colors, vector<int>& vtxColors,  co
         case HYBRID_GM3P:       alg_tag="GM3P";    break;
         case HYBRID_GMMP:       alg_tag="GMMP";    break;
         case HYBRID_SERIAL:     alg_tag="Serial";  break;
-        case HYBRID_STREAM:
+        case HYBRID_STREAM:     alg_tag="Stream";  break;
         default:               printf("Error %d option for hybrid alg is not support!", option);
     }
    
@@ -591,3 +591,121 @@ void SMPGCColoring::hybrid_Serial(vector<int>&vtxColors, vector<vector<int>>&QQ,
 
 
 
+
+
+// ============================================================================
+// streaming coloring the remaining part
+// ----------------------------------------------------------------------------
+// Instead of rounds separated by barriers, the remaining vertices are colored
+// asynchronously in Jones-Plassmann order. A vertex becomes ready once all its
+// remaining neighbors with higher (hash) priority are colored. Ready vertices
+// are pushed into a shared queue, and each thread keeps popping and greedy
+// coloring them. The result is conflict free, no detect phase is needed.
+// ============================================================================
+void SMPGCColoring::hybrid_Stream(const int nT, vector<int>&vtxColors, vector<vector<int>>&QQ, const int local_order){
+    const int N                = num_nodes();
+    const int BufSize          = max_degree()+1;         // maxDegree
+    const vector<int>& vtxPtr  = get_CSR_ia();     // ia of csr
+    const vector<int>& vtxVal  = get_CSR_ja();     // ja of csr
+
+    int n_remain=0;
+    for(int tid=0; tid<nT; tid++) n_remain+=QQ[tid].size();
+    if(n_remain==0) return;
+
+    vector<char> b_remain(N, 0);       // remaining vertex flags
+    vector<int>  n_preds(N, 0);        // number of uncolored higher priority neighbors
+    vector<int>  ready(n_remain, -1);  // the stream queue
+    int q_head = 0;
+    int q_tail = 0;
+
+    #pragma omp parallel
+    {
+        const int tid = omp_get_thread_num();
+        vector<int>& Q = QQ[tid];
+        switch(local_order){
+            case ORDER_NONE:
+                break;
+            case ORDER_LARGEST_FIRST:
+                local_largest_degree_first_ordering(Q); break;
+            case ORDER_SMALLEST_LAST:
+                local_smallest_degree_last_ordering(Q); break;
+            case ORDER_NATURAL:
+                local_natural_ordering(Q); break;
+            case ORDER_RANDOM:
+                local_random_ordering(Q); break;
+            default:
+                printf("Error! unknown local order \"%d\".\n", local_order);
+                exit(1);
+        }
+        for(const auto v : Q) b_remain[v]=1;
+        #pragma omp barrier
+
+        // phase count predecessors, ties broken by vertex id
+        for(const auto v : Q){
+            const auto vw = mhash(v, HASH_SEED);
+            int cnt=0;
+            for(int iw=vtxPtr[v]; iw!=vtxPtr[v+1]; iw++){
+                const auto w = vtxVal[iw];
+                if(!b_remain[w]) continue;
+                const auto ww = mhash(w, HASH_SEED);
+                if(vw<ww || (vw==ww && v<w)) cnt++;
+            }
+            n_preds[v]=cnt;
+        }
+        #pragma omp barrier
+
+        // phase seed the stream with local roots
+        for(const auto v : Q){
+            if(n_preds[v]!=0) continue;
+            int pos;
+            #pragma omp atomic capture seq_cst
+            pos = q_tail++;
+            #pragma omp atomic write seq_cst
+            ready[pos] = v;
+        }
+        #pragma omp barrier
+
+        // phase pop, color and release successors
+        vector<int> Mask(BufSize, -1);
+        while(true){
+            int pos;
+            #pragma omp atomic capture seq_cst
+            pos = q_head++;
+            if(pos>=n_remain) break;
+            int v=-1;
+            while(v<0){
+                #pragma omp atomic read seq_cst
+                v = ready[pos];
+            }
+            for(int iw=vtxPtr[v]; iw!=vtxPtr[v+1]; iw++){
+                const auto wc = vtxColors[vtxVal[iw]];
+                if(wc>=0 && wc<BufSize)    // MTJP colors may exceed the buffer, they never clash
+                    Mask[wc]=v;
+            }
+            int c=0;
+            for(; c!=BufSize; c++)
+                if(Mask[c]!=v)
+                    break;
+            #pragma omp atomic write seq_cst
+            vtxColors[v] = c;
+            
+            const auto vw = mhash(v, HASH_SEED);
+            for(int iw=vtxPtr[v]; iw!=vtxPtr[v+1]; iw++){
+                const auto w = vtxVal[iw];
+                if(!b_remain[w]) continue;
+                const auto ww = mhash(w, HASH_SEED);
+                if(!(ww<vw || (ww==vw && w<v))) continue;
+                int left;
+                #pragma omp atomic capture seq_cst
+                left = --n_preds[w];
+                if(left!=0) continue;
+                int wpos;
+                #pragma omp atomic capture seq_cst
+                wpos = q_tail++;
+                #pragma omp atomic write seq_cst
+                ready[wpos] = w;
+            }
+        }
+    } //end omp parallel
+    return;
+}
@@ -0,0 +1,205 @@
+/******************************************************************************
+    This file is part of ColPack, which is under its License protection.
+    You should have received a copy of the License. If not, see
+    <https://github.com/CSCsw/ColPack>
+*******************************************************************************/
+#include "SMPGCColoring.h"
+using namespace std;
+using namespace ColPack;
+
+// ============================================================================
+// Vectorized neighbor scans for the speculative kernels
+// ----------------------------------------------------------------------------
+// The detection phase and the forbidden color mask both read the colors of
+// all neighbors of a vertex, i.e. a gather of vtxColors through the ja array.
+// AVX2/AVX-512 versions gather 8/16 colors per step and compare them at once.
+// The instruction set is picked once at load time from the running CPU, so
+// the library itself is still compiled for the generic target. Define
+// SMPGC_NO_SIMD to build the scalar kernels only. With SMPGC_VARIFY the
+// coloring checks also compare them with the scalar kernels, see
+// cnt_simd_mismatch().
+// ============================================================================
+#if !defined(SMPGC_NO_SIMD) && defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define SMPGC_X86_SIMD
+#include <immintrin.h>
+#endif
+
+namespace {
+
+typedef int  (*find_conflict_fn)(const int*, int, const int*, int, int);
+typedef void (*mark_colors_fn)  (const int*, int, const int*, int*, int);
+
+// ----------------------------------------------------------------------------
+// scalar
+// ----------------------------------------------------------------------------
+int find_conflict_scalar(const int* nbr, int n, const int* vtxColors, int c, int v){
+    for(int i=0; i<n; i++){
+        const int w = nbr[i];
+        if(v<w && c==vtxColors[w])
+            return w;
+    }
+    return -1;
+}
+
+void mark_colors_scalar(const int* nbr, int n, const int* vtxColors, int* Mask, int v){
+    for(int i=0; i<n; i++){
+        const int wc = vtxColors[nbr[i]];
+        if(wc>=0) Mask[wc]=v;
+    }
+}
+
+#ifdef SMPGC_X86_SIMD
+// ----------------------------------------------------------------------------
+// AVX2: 8 lanes gather, no scatter
+// ----------------------------------------------------------------------------
+__attribute__((target("avx2")))
+int find_conflict_avx2(const int* nbr, int n, const int* vtxColors, int c, int v){
+    const __m256i cc = _mm256_set1_epi32(c);
+    const __m256i vv = _mm256_set1_epi32(v);
+    int i=0;
+    for(; i+8<=n; i+=8){
+        const __m256i w  = _mm256_loadu_si256((const __m256i*)(nbr+i));
+        const __m256i wc = _mm256_i32gather_epi32(vtxColors, w, 4);
+        const __m256i hit= _mm256_and_si256(_mm256_cmpeq_epi32(wc, cc), _mm256_cmpgt_epi32(w, vv));
+        const int bits = _mm256_movemask_ps(_mm256_castsi256_ps(hit));
+        if(bits) return nbr[i+__builtin_ctz(bits)];
+    }
+    return find_conflict_scalar(nbr+i, n-i, vtxColors, c, v);
+}
+
+__attribute__((target("avx2")))
+void mark_colors_avx2(const int* nbr, int n, const int* vtxColors, int* Mask, int v){
+    alignas(32) int wc[8];
+    int i=0;
+    for(; i+8<=n; i+=8){
+        const __m256i w = _mm256_loadu_si256((const __m256i*)(nbr+i));
+        _mm256_store_si256((__m256i*)wc, _mm256_i32gather_epi32(vtxColors, w, 4));
+        for(int k=0; k<8; k++)
+            if(wc[k]>=0) Mask[wc[k]]=v;
+    }
+    mark_colors_scalar(nbr+i, n-i, vtxColors, Mask, v);
+}
+
+// ----------------------------------------------------------------------------
+// AVX-512: 16 lanes gather, masked compare and masked scatter
+// ----------------------------------------------------------------------------
+__attribute__((target("avx512f")))
+int find_conflict_avx512(const int* nbr, int n, const int* vtxColors, int c, int v){
+    const __m512i cc = _mm512_set1_epi32(c);
+    const __m512i vv = _mm512_set1_epi32(v);
+    int i=0;
+    for(; i+16<=n; i+=16){
+        const __m512i w  = _mm512_loadu_si512((const void*)(nbr+i));
+        const __m512i wc = _mm512_mask_i32gather_epi32(_mm512_set1_epi32(-1), (__mmask16)0xFFFF, w, (const void*)vtxColors, 4);
+        const __mmask16 hit = _mm512_mask_cmpeq_epi32_mask(_mm512_cmpgt_epi32_mask(w, vv), wc, cc);
+        if(hit) return nbr[i+__builtin_ctz((unsigned)hit)];
+    }
+    if(i<n){
+        const __mmask16 tail = (__mmask16)((1u<<(n-i))-1);
+        const __m512i w  = _mm512_maskz_loadu_epi32(tail, (const void*)(nbr+i));
+        const __m512i wc = _mm512_mask_i32gather_epi32(_mm512_set1_epi32(-1), tail, w, (const void*)vtxColors, 4);
+        const __mmask16 hit = _mm512_mask_cmpeq_epi32_mask(_mm512_mask_cmpgt_epi32_mask(tail, w, vv), wc, cc);
+        if(hit) return nbr[i+__builtin_ctz((unsigned)hit)];
+    }
+    return -1;
+}
+
+__attribute__((target("avx512f")))
+void mark_colors_avx512(const int* nbr, int n, const int* vtxColors, int* Mask, int v){
+    const __m512i vv   = _mm512_set1_epi32(v);
+    const __m512i zero = _mm512_setzero_si512();
+    int i=0;
+    for(; i<n; i+=16){
+        const __mmask16 lanes = (n-i>=16)?((__mmask16)0xFFFF):((__mmask16)((1u<<(n-i))-1));
+        const __m512i w  = _mm512_maskz_loadu_epi32(lanes, (const void*)(nbr+i));
+        const __m512i wc = _mm512_mask_i32gather_epi32(_mm512_set1_epi32(-1), lanes, w, (const void*)vtxColors, 4);
+        // lanes hitting the same color all write v, so scatter conflicts are harmless
+        _mm512_mask_i32scatter_epi32((void*)Mask, _mm512_mask_cmpge_epi32_mask(lanes, wc, zero), wc, vv, 4);
+    }
+}
+#endif //SMPGC_X86_SIMD
+
+// ----------------------------------------------------------------------------
+// runtime dispatch
+// ----------------------------------------------------------------------------
+int simd_level(){
+#ifdef SMPGC_X86_SIMD
+    __builtin_cpu_init();
+    if(__builtin_cpu_supports("avx512f")) return 2;
+    if(__builtin_cpu_supports("avx2"))    return 1;
+#endif
+    return 0;
+}
+
+const int g_simd_level = simd_level();
+
+#ifdef SMPGC_X86_SIMD
+const find_conflict_fn g_find_conflict = (g_simd_level==2)?find_conflict_avx512:((g_simd_level==1)?find_conflict_avx2:find_conflict_scalar);
+const mark_colors_fn   g_mark_colors   = (g_simd_level==2)?mark_colors_avx512  :((g_simd_level==1)?mark_colors_avx2  :mark_colors_scalar);
+#else
+const find_conflict_fn g_find_conflict = find_conflict_scalar;
+const mark_colors_fn   g_mark_colors   = mark_colors_scalar;
+#endif
+
+} // end of anonymous namespace
+
+
+
+// ============================================================================
+// first neighbor w>v of nbr[0,n) colored c, -1 if none
+// ============================================================================
+int SMPGCColoring::simd_find_conflict(const int* nbr, const int n, const int* vtxColors, const int c, const int v){
+    return g_find_conflict(nbr, n, vtxColors, c, v);
+}
+
+// ============================================================================
+// Mask[color(w)] = v for every colored w of nbr[0,n)
+// ============================================================================
+void SMPGCColoring::simd_mark_colors(const int* nbr, const int n, const int* vtxColors, int* Mask, const int v){
+    g_mark_colors(nbr, n, vtxColors, Mask, v);
+}
+
+// ============================================================================
+// number of vertices where the picked kernels differ from the scalar ones
+// ----------------------------------------------------------------------------
+// Serial, on a finished coloring: vtxColors is not written while it is read,
+// so the answer is deterministic.
+// ============================================================================
+int SMPGCColoring::cnt_simd_mismatch(const vector<int>& vtxColors, bool bVerbose){
+    const int N = num_nodes();
+    const vector<int>& vtxPtr = get_CSR_ia();
+    const vector<int>& vtxVal = get_CSR_ja();
+    int maxc=-1;
+    for(int v=0; v<N; v++) maxc=max(maxc, vtxColors[v]);
+    vector<int> Mask(maxc+1, -1), MaskScalar(maxc+1, -1);
+
+    int n_mismatch=0;
+    for(int v=0; v<N; v++){
+        const int* nbr = vtxVal.data()+vtxPtr[v];
+        const int  n   = vtxPtr[v+1]-vtxPtr[v];
+        bool bDiffer = false;
+        if(vtxColors[v]>=0 && g_find_conflict(nbr, n, vtxColors.data(), vtxColors[v], v)!=find_conflict_scalar(nbr, n, vtxColors.data(), vtxColors[v], v))
+            bDiffer = true;
+        g_mark_colors(nbr, n, vtxColors.data(), Mask.data(), v);
+        mark_colors_scalar(nbr, n, vtxColors.data(), MaskScalar.data(), v);
+        for(int i=0; i<n && !bDiffer; i++){
+            const int wc = vtxColors[nbr[i]];
+            if(wc>=0 && Mask[wc]!=MaskScalar[wc]) bDiffer = true;
+        }
+        if(bDiffer) n_mismatch++;
+    }
+    if(bVerbose && n_mismatch) printf("There are %d vertex where the %s kernels differ from the scalar ones.\n", n_mismatch, simd_kernel_name());
+    return n_mismatch;
+}
+
+// ============================================================================
+// name of the kernels picked for this CPU
+// ============================================================================
+const char* SMPGCColoring::simd_kernel_name(){
+    switch(g_simd_level){
+        case 2: return "AVX512";
+        case 1: return "AVX2";
+        default: return "SCALAR";
+    }
+}
+
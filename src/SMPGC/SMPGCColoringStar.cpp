@@ -0,0 +1,434 @@
+/******************************************************************************
+    This file is part of ColPack, which is under its License protection.
+    You should have received a copy of the License. If not, see
+    <https://github.com/CSCsw/ColPack>
+*******************************************************************************/
+#include "SMPGCColoring.h"
+using namespace std;
+using namespace ColPack;
+
+
+
+// ============================================================================
+// Star (distance 1.5) coloring
+// ----------------------------------------------------------------------------
+// A distance one coloring where every path on 4 vertices uses at least 3
+// colors. The color of v is picked with the rules of the serial
+// GraphColoring::NaiveStarColoring, plus: when the color of a neighbor w
+// repeats around v, all colors around w are forbidden as well (v would be the
+// middle of a 2-colored path otherwise). With these rules the serial greedy is
+// a star coloring, and a vertex uncolored by the detection does not fall back
+// into the same conflict.
+// Mask, Seen and Rep have BufSize entries, stamps are v.
+// ============================================================================
+int SMPGCColoring::star_pick_color(const int v, const vector<int>&vtxColors, int* Mask, int* Seen, int* Rep, const int BufSize){
+    const vector<int>& vtxPtr = get_CSR_ia();
+    const vector<int>& vtxVal = get_CSR_ja();
+    for(int iw=vtxPtr[v]; iw!=vtxPtr[v+1]; iw++){
+        const auto wc = vtxColors[vtxVal[iw]];
+        if(wc<0) continue;
+        Mask[wc]=v;
+        if(Seen[wc]==v) Rep[wc]=v;
+        else            Seen[wc]=v;
+    }
+    for(int iw=vtxPtr[v]; iw!=vtxPtr[v+1]; iw++){
+        const auto w  = vtxVal[iw];
+        const auto wc = vtxColors[w];
+        const bool b_all = (wc<0) || (Rep[wc]==v);
+        for(int iu=vtxPtr[w]; iu!=vtxPtr[w+1]; iu++){
+            const auto u = vtxVal[iu];
+            if(u==v) continue;
+            const auto uc = vtxColors[u];
+            if(uc<0 || Mask[uc]==v) continue;
+            if(b_all) { Mask[uc]=v; continue; }
+            for(int ix=vtxPtr[u]; ix!=vtxPtr[u+1]; ix++){  // u-x colored wc, x!=w
+                const auto x = vtxVal[ix];
+                if(x!=w && vtxColors[x]==wc) { Mask[uc]=v; break; }
+            }
+        }
+    }
+    int c=0;
+    for(; c!=BufSize; c++)
+        if(Mask[c]!=v)
+            break;
+    return c;
+}
+
+// ============================================================================
+// is v the smaller end of a conflicted edge (v,w)
+// ----------------------------------------------------------------------------
+// same color, or middle edge of a 2-colored path on 4 vertices: the color of w
+// repeats around v and the color of v repeats around w. Uncolored vertices
+// never conflict. Seen and Rep have BufSize entries, stamps are v.
+// ============================================================================
+bool SMPGCColoring::star_find_conflict(const int v, const vector<int>&vtxColors, int* Seen, int* Rep){
+    const vector<int>& vtxPtr = get_CSR_ia();
+    const vector<int>& vtxVal = get_CSR_ja();
+    const auto vc = vtxColors[v];
+    if(vc<0) return false;
+    if(simd_find_conflict(vtxVal.data()+vtxPtr[v], vtxPtr[v+1]-vtxPtr[v], vtxColors.data(), vc, v)!=-1)
+        return true;
+    for(int iw=vtxPtr[v]; iw!=vtxPtr[v+1]; iw++){
+        const auto wc = vtxColors[vtxVal[iw]];
+        if(wc<0) continue;
+        if(Seen[wc]==v) Rep[wc]=v;
+        else            Seen[wc]=v;
+    }
+    for(int iw=vtxPtr[v]; iw!=vtxPtr[v+1]; iw++){
+        const auto w  = vtxVal[iw];
+        const auto wc = vtxColors[w];
+        if(v>=w || wc<0 || Rep[wc]!=v) continue;
+        for(int iu=vtxPtr[w]; iu!=vtxPtr[w+1]; iu++){
+            const auto u = vtxVal[iu];
+            if(u!=v && vtxColors[u]==vc) return true;
+        }
+    }
+    return false;
+}
+
+
+
+// ============================================================================
+// Star coloring, GM 3 phase: speculative coloring, detection, serial recolor
+// ============================================================================
+int SMPGCColoring::STAR_OMP_GM3P(int nT, int &colors, vector<int>& vtxColors, const int local_order) {
+    if(nT<=0) { printf("Warning, number of threads changed from %d to 1\n",nT); nT=1; }
+    omp_set_num_threads(nT);
+
+    double tim_partition=.0;
+    double tim_total    =.0;                     // run time
+    double tim_color    =.0;                     // run time
+    double tim_detect   =.0;                     // run time
+    double tim_recolor  =.0;                     // run time
+    double tim_maxc     =.0;                     // run time
+
+    int   n_conflicts = 0;                       // Number of conflicts
+
+    const int N = num_nodes();                   //number of vertex
+    const int BufSize = (int)min( (long long)max_degree()*max_degree()+1, (long long)max(N,1)); // d2 neighbors
+
+    colors=0;
+    vtxColors.assign(N, -1);
+
+    vector<vector<int>> QQ(nT);
+    vector<int>    cursors(nT*CURSOR_PAD, 0);  // work stealing cursors
+    vector<double> tim_busy(nT, .0);           // per thread working time
+    tim_partition =- omp_get_wtime();
+    partition_vertices(nT, QQ, 2);
+    tim_partition += omp_get_wtime();
+
+    // phase - Pseudo Coloring
+    tim_color =- omp_get_wtime();
+    #pragma omp parallel
+    {
+        const int tid = omp_get_thread_num();
+        vector<int> &Q = QQ[tid];
+        vector<int> Mask(BufSize, -1), Seen(BufSize, -1), Rep(BufSize, -1);
+
+        switch(local_order){
+            case ORDER_NONE:
+                break;
+            case ORDER_LARGEST_FIRST:
+                local_largest_degree_first_ordering(Q); break;
+            case ORDER_SMALLEST_LAST:
+                local_smallest_degree_last_ordering(Q); break;
+            case ORDER_NATURAL:
+                local_natural_ordering(Q); break;
+            case ORDER_RANDOM:
+                local_random_ordering(Q); break;
+            default:
+                printf("Error! unknown local order \"%d\".\n", local_order);
+                exit(1);
+        }
+
+        #pragma omp barrier
+
+        double tim_work = -omp_get_wtime();
+        int owner=tid, beg=0, end=0;
+        while(next_chunk(tid, QQ, cursors, owner, beg, end)){
+            const vector<int>& Qo = QQ[owner];
+            for(int iv=beg; iv<end; iv++){
+                const auto v = Qo[iv];
+                vtxColors[v] = star_pick_color(v, vtxColors, Mask.data(), Seen.data(), Rep.data(), BufSize);
+            }
+        }
+        tim_busy[tid] += tim_work+omp_get_wtime();
+    }//end of omp parallel
+    tim_color  += omp_get_wtime();
+
+    // Phase - Detect Conflicts
+    tim_detect =- omp_get_wtime();
+    cursors.assign(nT*CURSOR_PAD, 0);
+    #pragma omp parallel
+    {
+        const int tid=omp_get_thread_num();
+        double tim_work = -omp_get_wtime();
+        vector<int> conflicts;
+        vector<int> Seen(BufSize, -1), Rep(BufSize, -1);
+        int owner=tid, beg=0, end=0;
+        while(next_chunk(tid, QQ, cursors, owner, beg, end)){
+            const vector<int>& Qo = QQ[owner];
+            for(int iv=beg; iv<end; iv++){
+                const auto v = Qo[iv];
+                if(star_find_conflict(v, vtxColors, Seen.data(), Rep.data())){
+                    conflicts.push_back(v);
+                    vtxColors[v]=-1;
+                }
+            }
+        }
+        tim_busy[tid] += tim_work+omp_get_wtime();
+        #pragma omp barrier
+        QQ[tid].swap(conflicts);
+    } //end omp parallel
+    tim_detect  += omp_get_wtime();
+
+    // Phase - Resolve Conflicts
+    tim_recolor =- omp_get_wtime();
+    {
+        vector<int> Mask(BufSize, -1), Seen(BufSize, -1), Rep(BufSize, -1);
+        for(int tid=0; tid<nT; tid++){
+            for(const auto v: QQ[tid])
+                vtxColors[v] = star_pick_color(v, vtxColors, Mask.data(), Seen.data(), Rep.data(), BufSize);
+        }
+    }
+    tim_recolor += omp_get_wtime();
+
+    // get number of colors
+    tim_maxc = -omp_get_wtime();
+    int max_color=0;
+    #pragma omp parallel for reduction(max:max_color)
+    for(int i=0; i<N; i++){
+        max_color = max(max_color, vtxColors[i]);
+    }
+    colors=max_color+1; //number of colors,
+    tim_maxc += omp_get_wtime();
+
+    tim_total = tim_color+tim_detect+tim_recolor+tim_maxc;
+
+    string order_tag="unknown";
+    switch(local_order){
+        case ORDER_NONE:
+            order_tag="NoOrder"; break;
+        case ORDER_LARGEST_FIRST:
+            order_tag="LF"; break;
+        case ORDER_SMALLEST_LAST:
+            order_tag="SL"; break;
+        case ORDER_NATURAL:
+            order_tag="NT"; break;
+        case ORDER_RANDOM:
+            order_tag="RD"; break;
+        default:
+            printf("unkonw local order %d\n", local_order);
+    }
+
+    printf("@STARGM3P%s_nT_c_T_T(lo+Color)_TDetect_TRecolor_TMxC_nCnf_Tpart_LdImb\t", order_tag.c_str());
+    printf("\t%d",  nT);
+    printf("\t%d",  colors);
+    printf("\t%lf", tim_total);
+    printf("\t%lf", tim_color);
+    printf("\t%lf", tim_detect);
+    printf("\t%lf", tim_recolor);
+    printf("\t%lf", tim_maxc);
+    for(int i=0; i<nT; i++) n_conflicts+=QQ[i].size();
+    printf("\t%d", n_conflicts);
+    printf("\t%lf", tim_partition);
+    printf("\t%lf", load_imbalance(tim_busy));
+#ifdef SMPGC_VARIFY
+    printf("\t%s", (cnt_star_conflict(vtxColors)==0)?("Success"):("Failed"));
+#endif
+    printf("\n");
+    return true;
+}
+
+
+
+// ============================================================================
+// Star coloring, GM multiple phase: color and detect until no conflict left
+// ============================================================================
+int SMPGCColoring::STAR_OMP_GMMP(int nT, int &colors, vector<int>&vtxColors, const int local_order){
+    if(nT<=0) { printf("Warning, number of threads changed from %d to 1\n",nT); nT=1; }
+    omp_set_num_threads(nT);
+
+    double tim_partition  =.0;
+    double tim_total      =.0;                     // run time
+    double tim_color      =.0;                     // run time
+    double tim_detect     =.0;                     // run time
+    double tim_maxc       =.0;                     // run time
+
+    int    n_loops        = 0;
+    int    n_conflicts    = 0;                     // Number of conflicts
+    int    n_uncolored    = 0;
+
+    const int N = num_nodes();                     //number of vertex
+    const int BufSize = (int)min( (long long)max_degree()*max_degree()+1, (long long)max(N,1)); // d2 neighbors
+
+    colors=0;
+    vtxColors.assign(N, -1);
+
+    vector<vector<int>> QQ(nT);
+    vector<int>    cursors(nT*CURSOR_PAD, 0);  // work stealing cursors
+    vector<double> tim_busy(nT, .0);           // per thread working time
+    tim_partition =- omp_get_wtime();
+    partition_vertices(nT, QQ, 2);
+    tim_partition += omp_get_wtime();
+
+    n_uncolored=N;
+    while(n_uncolored!=0){
+        // phase - Pseudo Coloring
+        tim_color -= omp_get_wtime();
+        cursors.assign(nT*CURSOR_PAD, 0);
+        #pragma omp parallel
+        {
+            const int tid = omp_get_thread_num();
+            vector<int> &Q = QQ[tid];
+            vector<int> Mask(BufSize, -1), Seen(BufSize, -1), Rep(BufSize, -1);
+
+            switch(local_order){
+                case ORDER_NONE:
+                    break;
+                case ORDER_LARGEST_FIRST:
+                    local_largest_degree_first_ordering(Q); break;
+                case ORDER_SMALLEST_LAST:
+                    local_smallest_degree_last_ordering(Q); break;
+                case ORDER_NATURAL:
+                    local_natural_ordering(Q); break;
+                case ORDER_RANDOM:
+                    local_random_ordering(Q); break;
+                default:
+                    printf("Error! unknown local order \"%d\".\n", local_order);
+                    exit(1);
+            }
+
+            #pragma omp barrier
+
+            double tim_work = -omp_get_wtime();
+            int owner=tid, beg=0, end=0;
+            while(next_chunk(tid, QQ, cursors, owner, beg, end)){
+                const vector<int>& Qo = QQ[owner];
+                for(int iv=beg; iv<end; iv++) {
+                    const auto v = Qo[iv];
+                    vtxColors[v] = star_pick_color(v, vtxColors, Mask.data(), Seen.data(), Rep.data(), BufSize);
+                }
+            }
+            tim_busy[tid] += tim_work+omp_get_wtime();
+        }//end of omp parallel
+        tim_color  += omp_get_wtime();
+
+        // Phase - Detect Conflicts
+        tim_detect -= omp_get_wtime();
+        n_uncolored=0;
+        cursors.assign(nT*CURSOR_PAD, 0);
+        #pragma omp parallel reduction(+: n_uncolored)
+        {
+            const int tid=omp_get_thread_num();
+            double tim_work = -omp_get_wtime();
+            vector<int> conflicts;
+            vector<int> Seen(BufSize, -1), Rep(BufSize, -1);
+            int owner=tid, beg=0, end=0;
+            while(next_chunk(tid, QQ, cursors, owner, beg, end)){
+                const vector<int>& Qo = QQ[owner];
+                for(int i=beg; i<end; i++){
+                    const auto v = Qo[i];
+                    if(star_find_conflict(v, vtxColors, Seen.data(), Rep.data())){
+                        conflicts.push_back(v);
+                        vtxColors[v] = -1;
+                    }
+                }
+            }
+            tim_busy[tid] += tim_work+omp_get_wtime();
+            n_uncolored = conflicts.size();
+            #pragma omp barrier
+            QQ[tid].swap(conflicts);
+        } //end of omp parallel
+        tim_detect  += omp_get_wtime();
+        n_loops++;
+        n_conflicts+=n_uncolored;
+    } //end while
+
+    // get number of colors
+    tim_maxc = -omp_get_wtime();
+    int max_color=0;
+    #pragma omp parallel for reduction(max:max_color)
+    for(int i=0; i<N; i++){
+        max_color = max(max_color, vtxColors[i]);
+    }
+    colors=max_color+1; //number of colors,
+    tim_maxc += omp_get_wtime();
+
+    tim_total = tim_color+tim_detect+tim_maxc;
+
+    string order_tag="unknown";
+    switch(local_order){
+        case ORDER_NONE:
+            order_tag="NoOrder"; break;
+        case ORDER_LARGEST_FIRST:
+            order_tag="LF"; break;
+        case ORDER_SMALLEST_LAST:
+            order_tag="SL"; break;
+        case ORDER_NATURAL:
+            order_tag="NT"; break;
+        case ORDER_RANDOM:
+            order_tag="RD"; break;
+        default:
+            printf("unkonw local order %d\n", local_order);
+    }
+
+    printf("@STARGMMP%s_nT_c_T_T(Lo+Color)_TDetect_TMxC_nCnf_nLoop_TPart_LdImb", order_tag.c_str());
+    printf("\t%d",  nT);
+    printf("\t%d",  colors);
+    printf("\t%lf", tim_total);
+    printf("\t%lf", tim_color);
+    printf("\t%lf", tim_detect);
+    printf("\t%lf", tim_maxc);
+    printf("\t%d",  n_conflicts);
+    printf("\t%d" , n_loops);
+    printf("\t%lf", tim_partition);
+    printf("\t%lf", load_imbalance(tim_busy));
+#ifdef SMPGC_VARIFY
+    printf("\t%s", (cnt_star_conflict(vtxColors)==0)?("Success"):("Failed"));
+#endif
+    printf("\n");
+    return true;
+}
+
+
+
+// ============================================================================
+// number of vertices that are uncolored or the smaller end of a conflicted edge
+// ============================================================================
+int SMPGCColoring::cnt_star_conflict(const vector<int>& vtxColors, bool bVerbose){
+    const int N = num_nodes();
+    const int BufSize = (int)min( (long long)max_degree()*max_degree()+1, (long long)max(N,1));
+    int n_uncolored=0;
+    int n_conflicts=0;
+    #pragma omp parallel reduction(+:n_conflicts), reduction(+:n_uncolored)
+    {
+        vector<int> Seen(BufSize, -1), Rep(BufSize, -1);
+        #pragma omp for
+        for(int v=0; v<N; v++){
+            if(vtxColors[v]<0) { n_uncolored++; continue; }
+            if(star_find_conflict(v, vtxColors, Seen.data(), Rep.data())) n_conflicts++;
+        }
+    }
+    if(bVerbose && (n_uncolored || n_conflicts)) printf("There are %d vertex uncolored\nThere are %d vertex has star conflicts with other nodes.\n",n_uncolored, n_conflicts);
+#ifdef SMPGC_VARIFY
+    n_conflicts += cnt_simd_mismatch(vtxColors, bVerbose);
+#endif
+    return n_uncolored+n_conflicts;
+}
+
+
+
+// ============================================================================
+// GraphColoringInterface view of the graph and of the last coloring
+// ----------------------------------------------------------------------------
+// g gets the adjacency graph of the CSR (diagonal removed) and the colors of
+// the last Coloring() call, so that HessianRecovery can use it like a
+// GraphColoringInterface colored with "STAR": a STAR_OMP_* coloring goes to
+// HessianRecovery::DirectRecover_*, and the seed matrix is g.GetSeedMatrix().
+// g is usually created with GraphColoringInterface(SRC_WAIT).
+// ============================================================================
+void SMPGCColoring::export_coloring(GraphColoringInterface& g) {
+    g.BuildGraphFromCSRFormat(get_CSR_ia(), get_CSR_ja());
+    g.SetVertexColors(m_vertex_color, m_method);
+}
@@ -0,0 +1,184 @@
+/*******************************************************************************
+    This file is part of ColPack, which is under its License protection.
+    You should have received a copy of the License. If not, see
+    <https://github.com/CSCsw/ColPack>
+*******************************************************************************/
+
+#include "ColPackHeaders.h"
+
+using namespace std;
+
+namespace ColPack
+{
+	int RebalanceColorClasses(const vector<int>& vi_Vertices, const vector<int>& vi_Edges, int i_ColorCount, double d_Tolerance, vector<int>& vi_VertexColors)
+	{
+		int i_VertexCount = STEP_DOWN((signed) vi_Vertices.size());
+
+		if((i_ColorCount <= 1) || (i_VertexCount <= 0) || ((signed) vi_VertexColors.size() != i_VertexCount))
+		{
+			return(0);
+		}
+
+		//A color class may hold at most (1 + tolerance) times the average class size
+		double d_TargetClassSize = (1.0 + d_Tolerance) * i_VertexCount / i_ColorCount;
+
+		int i_TargetClassSize = (int) d_TargetClassSize;
+
+		if(i_TargetClassSize < d_TargetClassSize)
+		{
+			i_TargetClassSize++;
+		}
+
+		vector<int> vi_ColorClassSizes(i_ColorCount, 0);
+
+		vector<int> vi_ColorClassStart(STEP_UP(i_ColorCount), 0);
+
+		vector<int> vi_ColorClassMembers(i_VertexCount);
+
+		for(int i=0; i<i_VertexCount; i++)
+		{
+			vi_ColorClassSizes[vi_VertexColors[i]]++;
+		}
+
+		for(int i=0; i<i_ColorCount; i++)
+		{
+			vi_ColorClassStart[STEP_UP(i)] = vi_ColorClassStart[i] + vi_ColorClassSizes[i];
+		}
+
+		{
+			vector<int> vi_ColorClassTail(vi_ColorClassStart.begin(), vi_ColorClassStart.end() - 1);
+
+			for(int i=0; i<i_VertexCount; i++)
+			{
+				vi_ColorClassMembers[vi_ColorClassTail[vi_VertexColors[i]]++] = i;
+			}
+		}
+
+		//A class below the target only grows up to the target, so the oversized classes are known up front
+		vector<int> vi_OversizedColors;
+
+		for(int i=0; i<i_ColorCount; i++)
+		{
+			if(vi_ColorClassSizes[i] > i_TargetClassSize)
+			{
+				vi_OversizedColors.push_back(i);
+			}
+		}
+
+		int i_MovedVertexCount = 0;
+
+#ifdef _OPENMP
+		#pragma omp parallel reduction(+:i_MovedVertexCount)
+#endif
+		{
+			vector<int> vi_ForbiddenColors(i_ColorCount, _UNKNOWN);
+
+			for(int l=0; l<(signed) vi_OversizedColors.size(); l++)
+			{
+				int i_Color = vi_OversizedColors[l];
+
+#ifdef _OPENMP
+				#pragma omp for schedule(dynamic, 64)
+#endif
+				for(int k=vi_ColorClassStart[i_Color]; k<vi_ColorClassStart[STEP_UP(i_Color)]; k++)
+				{
+					int i_PresentVertex = vi_ColorClassMembers[k];
+
+					int i_ClassSize;
+
+					//Reserve the removal from the oversized class first
+#ifdef _OPENMP
+					#pragma omp atomic capture
+#endif
+					i_ClassSize = vi_ColorClassSizes[i_Color]--;
+
+					if(i_ClassSize <= i_TargetClassSize)
+					{
+#ifdef _OPENMP
+						#pragma omp atomic
+#endif
+						vi_ColorClassSizes[i_Color]++;
+
+						continue;
+					}
+
+					for(int j=vi_Vertices[i_PresentVertex]; j<vi_Vertices[STEP_UP(i_PresentVertex)]; j++)
+					{
+						vi_ForbiddenColors[vi_VertexColors[vi_Edges[j]]] = i_PresentVertex;
+					}
+
+					//Start from the least used permissible color
+					int i_LeastUsedColor = 0;
+
+					int i_LeastUsedSize = i_TargetClassSize;
+
+					for(int j=0; j<i_ColorCount; j++)
+					{
+						if((j == i_Color) || (vi_ForbiddenColors[j] == i_PresentVertex))
+						{
+							continue;
+						}
+
+#ifdef _OPENMP
+						#pragma omp atomic read
+#endif
+						i_ClassSize = vi_ColorClassSizes[j];
+
+						if(i_ClassSize < i_LeastUsedSize)
+						{
+							i_LeastUsedColor = j;
+
+							i_LeastUsedSize = i_ClassSize;
+						}
+					}
+
+					//Other threads fill the classes meanwhile, so every permissible class is tried in turn
+					int i_SelectedColor = _UNKNOWN;
+
+					for(int t=0; t<i_ColorCount; t++)
+					{
+						int j = (i_LeastUsedColor + t) % i_ColorCount;
+
+						if((j == i_Color) || (vi_ForbiddenColors[j] == i_PresentVertex))
+						{
+							continue;
+						}
+
+#ifdef _OPENMP
+						#pragma omp atomic capture
+#endif
+						i_ClassSize = ++vi_ColorClassSizes[j];
+
+						if(i_ClassSize <= i_TargetClassSize)
+						{
+							i_SelectedColor = j;
+
+							break;
+						}
+
+#ifdef _OPENMP
+						#pragma omp atomic
+#endif
+						vi_ColorClassSizes[j]--;
+					}
+
+					if(i_SelectedColor == _UNKNOWN)
+					{
+#ifdef _OPENMP
+						#pragma omp atomic
+#endif
+						vi_ColorClassSizes[i_Color]++;
+					}
+					else
+					{
+						vi_VertexColors[i_PresentVertex] = i_SelectedColor;
+
+						i_MovedVertexCount++;
+					}
+				}
+			}
+		}
+
+		return(i_MovedVertexCount);
+	}
+}
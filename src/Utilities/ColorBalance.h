@@ -0,0 +1,28 @@
+/*******************************************************************************
+    This file is part of ColPack, which is under its License protection.
+    You should have received a copy of the License. If not, see
+    <https://github.com/CSCsw/ColPack>
+*******************************************************************************/
+
+#ifndef COLORBALANCE_H
+#define COLORBALANCE_H
+
+using namespace std;
+
+namespace ColPack
+{
+	/// Rebalance a distance one coloring of the graph (vi_Vertices, vi_Edges) in CSR format
+	/** Moves vertices out of the color classes larger than ceil((1 + d_Tolerance) * N / i_ColorCount)
+	into permissible classes that are still below that size. The least used permissible class is tried
+	first, then every other permissible class in turn. The number of colors never grows.
+
+	The oversized classes are drained one after another with all the OpenMP threads: the members of a class
+	are pairwise non adjacent and the colors of their neighbors do not change meanwhile.
+	Class sizes are reserved by atomic capture, so the bound is exact.
+
+	Return value: the number of moved vertices
+	*/
+	int RebalanceColorClasses(const vector<int>& vi_Vertices, const vector<int>& vi_Edges, int i_ColorCount, double d_Tolerance, vector<int>& vi_VertexColors);
+}
+
+#endif
@@ -6,6 +6,7 @@
 
 #include <iostream>
 #include <vector>
+#include <utility>
 
 using namespace std;
 
@@ -102,14 +103,12 @@ namespace ColPack
 	//Public Function 4257
 	int DisjointSets::Find(int li_Node)
 	{
-		if(p_vi_Nodes[li_Node] < _FALSE)
+		while(p_vi_Nodes[li_Node] >= _FALSE)
 		{
-			return(li_Node);
-		}
-		else
-		{
-			return(Find(p_vi_Nodes[li_Node]));
+			li_Node = p_vi_Nodes[li_Node];
 		}
+
+		return(li_Node);
 	}
 
 
@@ -117,14 +116,23 @@ namespace ColPack
 	//Public Function 4258
 	int DisjointSets::FindAndCompress(int li_Node)
 	{
-		if(p_vi_Nodes[li_Node] < _FALSE)
-		{
-			return(li_Node);
-		}
-		else
+		int li_Parent, li_GrandParent;
+
+		while((li_Parent = p_vi_Nodes[li_Node]) >= _FALSE)
 		{
-			return(p_vi_Nodes[li_Node] = FindAndCompress(p_vi_Nodes[li_Node]));
+			li_GrandParent = p_vi_Nodes[li_Parent];
+
+			if(li_GrandParent < _FALSE)
+			{
+				return(li_Parent);
+			}
+
+			p_vi_Nodes[li_Node] = li_GrandParent;
+
+			li_Node = li_GrandParent;
 		}
+
+		return(li_Node);
 	}
 
 	/* Written by Duc Nguyen
@@ -211,4 +219,142 @@ namespace ColPack
 		return(_TRUE);
 	}
 
+
+	//Public Function 4262
+	int DisjointSets::FindConcurrent(int li_Node)
+	{
+		int li_Parent, li_GrandParent;
+
+		while(true)
+		{
+			li_Parent = p_vi_Nodes[li_Node];
+
+			if(li_Parent < _FALSE)
+			{
+				return(li_Node);
+			}
+
+			li_GrandParent = p_vi_Nodes[li_Parent];
+
+			if(li_GrandParent < _FALSE)
+			{
+				return(li_Parent);
+			}
+
+			__sync_bool_compare_and_swap(&p_vi_Nodes[li_Node], li_Parent, li_GrandParent);
+
+			li_Node = li_Parent;
+		}
+	}
+
+
+	//Public Function 4263
+	int DisjointSets::UnionConcurrent(int li_NodeOne, int li_NodeTwo)
+	{
+		int li_SetOne, li_SetTwo, li_RootValue;
+
+		while(true)
+		{
+			li_SetOne = FindConcurrent(li_NodeOne);
+			li_SetTwo = FindConcurrent(li_NodeTwo);
+
+			if(li_SetOne == li_SetTwo)
+			{
+				return(li_SetOne);
+			}
+
+			if(li_SetOne > li_SetTwo)
+			{
+				int li_Temp = li_SetOne;
+				li_SetOne = li_SetTwo;
+				li_SetTwo = li_Temp;
+			}
+
+			li_RootValue = p_vi_Nodes[li_SetTwo];
+
+			if(li_RootValue < _FALSE && __sync_bool_compare_and_swap(&p_vi_Nodes[li_SetTwo], li_RootValue, li_SetOne))
+			{
+				return(li_SetOne);
+			}
+		}
+	}
+
+
+
+	//Public Function 4264
+	int DisjointSets::UnionEdges(const pair<int, int> * pii_Pairs, int li_PairCount)
+	{
+#ifdef _OPENMP
+		#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+		for(int i=0; i<li_PairCount; i++)
+		{
+			UnionConcurrent(pii_Pairs[i].first, pii_Pairs[i].second);
+		}
+
+		return(Flatten());
+	}
+
+
+	//Public Function 4265
+	int DisjointSets::UnionEdges(const vector< pair<int, int> > & vpii_Pairs)
+	{
+		if(vpii_Pairs.empty())
+		{
+			return(Flatten());
+		}
+
+		return(UnionEdges(&vpii_Pairs[0], (signed) vpii_Pairs.size()));
+	}
+
+
+	//Public Function 4266
+	int DisjointSets::Flatten()
+	{
+		int li_SetSize = (signed) p_vi_Nodes.size();
+
+		int li_HeadCount = _FALSE;
+
+		vector<int> vi_Roots((unsigned) li_SetSize);
+		vector<int> vi_Sizes((unsigned) li_SetSize, _FALSE);
+
+#ifdef _OPENMP
+		#pragma omp parallel for schedule(static)
+#endif
+		for(int i=0; i<li_SetSize; i++)
+		{
+			vi_Roots[i] = FindConcurrent(i);
+		}
+
+#ifdef _OPENMP
+		#pragma omp parallel for schedule(static)
+#endif
+		for(int i=0; i<li_SetSize; i++)
+		{
+#ifdef _OPENMP
+			#pragma omp atomic
+#endif
+			vi_Sizes[vi_Roots[i]]++;
+		}
+
+#ifdef _OPENMP
+		#pragma omp parallel for schedule(static) reduction(+:li_HeadCount)
+#endif
+		for(int i=0; i<li_SetSize; i++)
+		{
+			if(vi_Roots[i] == i)
+			{
+				p_vi_Nodes[i] = -vi_Sizes[i];
+
+				li_HeadCount++;
+			}
+			else
+			{
+				p_vi_Nodes[i] = vi_Roots[i];
+			}
+		}
+
+		return(li_HeadCount);
+	}
+
 }
@@ -54,7 +54,10 @@ namespace ColPack
 		int Find(int);
 
 		//Public Function 4258
-		/// Find the Set ID of this element, also shorten the tree by updating all elements with its new SetID
+		/// Find the Set ID of this element, also shorten the tree on the way (path halving, every other element is linked to its grandparent)
+		/**
+		Both Find() and FindAndCompress() are iterative, so long chains do not grow the call stack.
+		*/
 		int FindAndCompress(int);
 
 		//Public Function 4259
@@ -87,6 +90,45 @@ namespace ColPack
 		*/
 		int UnionBySize(int li_SetOne, int li_SetTwo);
 
+		//Public Function 4262
+		/// Find the Set ID of this element, safe to call while other threads call FindConcurrent() or UnionConcurrent()
+		/**
+		Lock-free: path splitting, every visited element is redirected to its grandparent by compare and swap.
+		*/
+		int FindConcurrent(int li_Node);
+
+		//Public Function 4263
+		/// Union the sets containing li_NodeOne and li_NodeTwo, safe to call concurrently with FindConcurrent() and UnionConcurrent()
+		/**
+		Lock-free: the root with the larger ID is linked to the root with the smaller ID by compare and swap
+		(retried if another thread changed that root meanwhile), so the Set ID is always the smallest element of the set.
+		Return the SetID of the new set.
+
+		Note: the value held by a root is not maintained (no size or rank). Do not mix with UnionByRank() or UnionBySize()
+		on the same object.
+		*/
+		int UnionConcurrent(int li_NodeOne, int li_NodeTwo);
+
+		//Public Function 4264
+		/// Union the 2 elements of every pair in parallel (OpenMP, UnionConcurrent()), then Flatten()
+		/**
+		Return the number of sets.
+		*/
+		int UnionEdges(const pair<int, int> * pii_Pairs, int li_PairCount);
+
+		//Public Function 4265
+		/// Same as UnionEdges(const pair<int, int> *, int)
+		int UnionEdges(const vector< pair<int, int> > & vpii_Pairs);
+
+		//Public Function 4266
+		/// Link every element directly to its root, in parallel (OpenMP)
+		/**
+		Afterwards the roots hold the negate of their set size, as with UnionBySize(), and Find() and FindAndCompress()
+		answer in constant time until the next union. Also restores the sizes after UnionConcurrent().
+		Return the number of sets.
+		*/
+		int Flatten();
+
 	};
 }
 #endif
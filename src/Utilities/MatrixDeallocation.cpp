@@ -6,6 +6,8 @@
 
 #include "MatrixDeallocation.h"
 
+#include <cstring>
+
 int MatrixDeallocation_SparseSolversFormat(unsigned int **ip2_RowIndex, unsigned int **ip2_ColumnIndex, double **dp2_JacobianValue) {
   //Deallocate the arrays
   delete[] (*ip2_RowIndex);
@@ -26,6 +28,13 @@ int MatrixDeallocation_RowCompressedFormat(double ***dp3_HessianValue, unsigned
 	return _TRUE;
 }
 
+int MatrixDeallocation_RowCompressedFormat(double ***dp3_HessianValue, unsigned int i_numOfRows, int i_MatrixAllocation) {
+  //Deallocate the 2D Matrix
+	free_2DMatrix(*dp3_HessianValue, i_numOfRows, i_MatrixAllocation);
+	delete dp3_HessianValue;
+	return _TRUE;
+}
+
 
 int MatrixDeallocation_CoordinateFormat(unsigned int **ip2_RowIndex, unsigned int **ip2_ColumnIndex, double **dp2_HessianValue) {
   //Deallocate the arrays
@@ -41,3 +50,24 @@ int MatrixDeallocation_CoordinateFormat(unsigned int **ip2_RowIndex, unsigned in
   return _TRUE;
 }
 
+
+void* allocate_2DMatrix_slab(unsigned int i_numOfRows, size_t i_numOfBytes, void** vpp_Slab) {
+  //the row pointers, then up to SLAB_ALIGNMENT - 1 bytes of padding, then the slab: one free() releases all of them
+  size_t i_numOfRowPointerBytes = (size_t)i_numOfRows * sizeof(void*);
+  char* cp_Base = (char*) malloc(i_numOfRowPointerBytes + SLAB_ALIGNMENT - 1 + i_numOfBytes);
+  if(cp_Base == NULL) return NULL;
+  char* cp_Slab = (char*)(((size_t)(cp_Base + i_numOfRowPointerBytes) + SLAB_ALIGNMENT - 1) & ~(size_t)(SLAB_ALIGNMENT - 1));
+  memset(cp_Slab, 0, i_numOfBytes);
+
+  *vpp_Slab = cp_Slab;
+
+  return cp_Base;
+}
+
+int free_2DMatrix_slab(void* dp2_2DMatrix) {
+  if(dp2_2DMatrix == NULL) return _FALSE;
+
+  free(dp2_2DMatrix);
+
+  return _TRUE;
+}
@@ -4,6 +4,9 @@
     <https://github.com/CSCsw/ColPack>
 *******************************************************************************/
 
+#include <cstddef>
+#include <cstdlib>
+
 #include "Definitions.h"
 
 #ifndef MATRIXDEALLOCATION_H
@@ -21,6 +24,11 @@ int MatrixDeallocation_SparseSolversFormat(unsigned int **ip2_RowIndex, unsigned
 */
 int MatrixDeallocation_RowCompressedFormat(double ***dp3_HessianValue, unsigned int i_numOfRows);
 
+/// Same as MatrixDeallocation_RowCompressedFormat(dp3_HessianValue, i_numOfRows) for a matrix allocated with the policy i_MatrixAllocation
+/** The 2-argument version frees row by row, so it must not be used for a MATRIX_ALLOC_SLAB matrix.
+*/
+int MatrixDeallocation_RowCompressedFormat(double ***dp3_HessianValue, unsigned int i_numOfRows, int i_MatrixAllocation);
+
 /** Deallocate all the memory reserved for a matrix presented in Coordinate Format
     Postcondition:
     - ip2_RowIndex, ip2_ColumnIndex, dp2_HessianValue become dangling pointers. So for safety reasons, please set ip2_RowIndex, ip2_ColumnIndex, dp2_HessianValue to NULL after calling this function.
@@ -28,6 +36,81 @@ int MatrixDeallocation_RowCompressedFormat(double ***dp3_HessianValue, unsigned
 int MatrixDeallocation_CoordinateFormat(unsigned int **ip2_RowIndex, unsigned int **ip2_ColumnIndex, double **dp2_HessianValue);
 
 
+/// Allocation policy of the 2D matrices (double**) returned by ColPack: seed, compressed and recovered matrices
+/** MATRIX_ALLOC_ROWS: one allocation per row, the rows can be freed one by one (default)
+    MATRIX_ALLOC_SLAB: a single allocation, the row pointer array followed by the rows aligned on SLAB_ALIGNMENT bytes, see new_2DMatrix_slab()
+    A matrix must be freed by the function of its policy: free_2DMatrix() or free_2DMatrix_slab(), or free_2DMatrix(..., i_MatrixAllocation).
+*/
+#define MATRIX_ALLOC_ROWS 0
+#define MATRIX_ALLOC_SLAB 1
+
+#define SLAB_ALIGNMENT 64
+
+/// Allocate i_numOfRows row pointers followed by i_numOfBytes zeroed bytes aligned on SLAB_ALIGNMENT, (*vpp_Slab) is set to these bytes
+/** Used by new_2DMatrix_slab(), there is no need to call it directly.
+    Return value: the row pointer array, NULL if the allocation failed
+*/
+void* allocate_2DMatrix_slab(unsigned int i_numOfRows, size_t i_numOfBytes, void** vpp_Slab);
+
+/// Deallocate a matrix allocated by new_2DMatrix_slab(), NULL is ignored
+int free_2DMatrix_slab(void* dp2_2DMatrix);
+
+/// Allocate a i_numOfRows x i_numOfColumns matrix initialized to 0 as a single slab, the rows point into that slab
+/** Postcondition:
+    - the rows are aligned on SLAB_ALIGNMENT bytes as a whole, row i starts at i*i_numOfColumns.
+    - free it with free_2DMatrix_slab(), NOT free_2DMatrix() or row by row.
+
+    Return value: the matrix, NULL if i_numOfRows is 0 or if the allocation failed
+*/
+template<typename T>
+T** new_2DMatrix_slab(unsigned int i_numOfRows, unsigned int i_numOfColumns) {
+  if(i_numOfRows == 0) return NULL;
+  void* vp_Slab = NULL;
+  T** dp2_2DMatrix = (T**) allocate_2DMatrix_slab(i_numOfRows, (size_t)i_numOfRows * i_numOfColumns * sizeof(T), &vp_Slab);
+  if(dp2_2DMatrix == NULL) return NULL;
+  T* dp1_Slab = (T*) vp_Slab;
+  for(unsigned int i=0; i< i_numOfRows; i++) {
+    dp2_2DMatrix[i] = dp1_Slab + (size_t)i * i_numOfColumns;
+  }
+
+  return dp2_2DMatrix;
+}
+
+/// Same as new_2DMatrix_slab(i_numOfRows, i_numOfColumns), except that row i has uip_RowLength[i] entries
+template<typename T>
+T** new_2DMatrix_slab(unsigned int i_numOfRows, const unsigned int* uip_RowLength) {
+  if(i_numOfRows == 0) return NULL;
+  size_t i_numOfEntries = 0;
+  for(unsigned int i=0; i< i_numOfRows; i++) i_numOfEntries += uip_RowLength[i];
+
+  void* vp_Slab = NULL;
+  T** dp2_2DMatrix = (T**) allocate_2DMatrix_slab(i_numOfRows, i_numOfEntries * sizeof(T), &vp_Slab);
+  if(dp2_2DMatrix == NULL) return NULL;
+  T* dp1_Slab = (T*) vp_Slab;
+  for(unsigned int i=0; i< i_numOfRows; i++) {
+    dp2_2DMatrix[i] = dp1_Slab;
+    dp1_Slab += uip_RowLength[i];
+  }
+
+  return dp2_2DMatrix;
+}
+
+/// Allocate a i_numOfRows x i_numOfColumns matrix initialized to 0 following the allocation policy i_MatrixAllocation
+/** MATRIX_ALLOC_ROWS rows are allocated by new[]. Free it with free_2DMatrix(dp2_2DMatrix, i_numOfRows, i_MatrixAllocation).
+*/
+template<typename T>
+T** new_2DMatrix(unsigned int i_numOfRows, unsigned int i_numOfColumns, int i_MatrixAllocation) {
+  if(i_MatrixAllocation == MATRIX_ALLOC_SLAB) return new_2DMatrix_slab<T>(i_numOfRows, i_numOfColumns);
+
+  T** dp2_2DMatrix = new T*[i_numOfRows];
+  for(unsigned int i=0; i< i_numOfRows; i++) {
+    dp2_2DMatrix[i] = new T[i_numOfColumns]();
+  }
+
+  return dp2_2DMatrix;
+}
+
+/// Deallocate a 2D matrix allocated row by row by new[]
 template<typename T>
 int free_2DMatrix(T **dp2_2DMatrix, unsigned int i_numOfRows) {
   for(unsigned int i=0; i< i_numOfRows; i++) {
@@ -46,4 +129,26 @@ int free_2DMatrix(T ***dp3_2DMatrix, unsigned int i_numOfRows) {
   return _TRUE;
 }
 
+/// Deallocate a 2D matrix allocated by new_2DMatrix() with the allocation policy i_MatrixAllocation
+template<typename T>
+int free_2DMatrix(T **dp2_2DMatrix, unsigned int i_numOfRows, int i_MatrixAllocation) {
+  if(i_MatrixAllocation == MATRIX_ALLOC_SLAB) return free_2DMatrix_slab(dp2_2DMatrix);
+
+  return free_2DMatrix(dp2_2DMatrix, i_numOfRows);
+}
+
+/// Deprecated, same as new_2DMatrix_slab(i_numOfRows, i_numOfColumns)
+template<typename T>
+T** new_2DMatrix_contiguous(unsigned int i_numOfRows, unsigned int i_numOfColumns) {
+  return new_2DMatrix_slab<T>(i_numOfRows, i_numOfColumns);
+}
+
+/// Deprecated, same as free_2DMatrix_slab(dp2_2DMatrix)
+template<typename T>
+int free_2DMatrix_contiguous(T **dp2_2DMatrix) {
+  free_2DMatrix_slab(dp2_2DMatrix);
+
+  return _TRUE;
+}
+
 #endif
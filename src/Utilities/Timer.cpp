@@ -10,6 +10,12 @@
 
 #include "Timer.h"
 
+#include <ctime>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 namespace ColPack
 {
 	//Public Constructor 4351
@@ -128,4 +134,14 @@ namespace ColPack
 #endif
 
 	}
+
+	//Public Function 4360
+	double Timer::GetWallClock()
+	{
+#ifdef _OPENMP
+		return omp_get_wtime();
+#else
+		return (double) clock() / CLOCKS_PER_SEC;
+#endif
+	}
 }
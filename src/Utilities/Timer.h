@@ -80,6 +80,10 @@ Time in seconds = # of clock-ticks / CLOCKS_PER_SEC => max Time in seconds = 2,1
 
 		//Public Function 4359
 		double GetSystemProcessorTime();
+
+		//Public Function 4360
+		/// Seconds on the wall clock (omp_get_wtime()), or processor seconds (clock()) when built without OpenMP; only differences are meaningful
+		static double GetWallClock();
 	};
 }
 #endif
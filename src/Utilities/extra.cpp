@@ -1202,18 +1202,13 @@ int ConvertMatrixMarketFormat2RowCompressedFormat(string s_InputFile, unsigned i
 	return(0);
 }
 
-int MatrixMultiplication_VxS__usingVertexPartialColors(std::list<std::set<int> > &lsi_SparsityPattern, std::list<std::vector<double> > &lvd_Value, int columnCount, vector<int> &vi_VertexPartialColors, int colorCount, double*** dp3_CompressedMatrix) {
+int MatrixMultiplication_VxS__usingVertexPartialColors(std::list<std::set<int> > &lsi_SparsityPattern, std::list<std::vector<double> > &lvd_Value, int columnCount, vector<int> &vi_VertexPartialColors, int colorCount, double*** dp3_CompressedMatrix, int i_MatrixAllocation) {
 	unsigned int rowCount = lsi_SparsityPattern.size();
 
 	//Allocate memory for (*dp3_CompressedMatrix)[rowCount][colorCount]
 	//cout<<"Allocate memory for (*dp3_CompressedMatrix)[rowCount][colorCount]"<<endl;
-	(*dp3_CompressedMatrix) = new double*[rowCount];
-	for(unsigned int i=0; i < rowCount; i++) {
-		(*dp3_CompressedMatrix)[i] = new double[colorCount];
-		for(unsigned int j=0; j < (unsigned int)colorCount; j++) {
-			(*dp3_CompressedMatrix)[i][j] = 0.;
-		}
-	}
+	(*dp3_CompressedMatrix) = new_2DMatrix<double>(rowCount, colorCount, i_MatrixAllocation);
+	if((*dp3_CompressedMatrix) == NULL && rowCount > 0) return 1;
 
 	//do the multiplication
 	//cout<<"Do the multiplication"<<endl;
@@ -1230,19 +1225,14 @@ int MatrixMultiplication_VxS__usingVertexPartialColors(std::list<std::set<int> >
 	return 0;
 }
 
-int MatrixMultiplication_VxS(unsigned int ** uip3_SparsityPattern, double** dp3_Value, int rowCount, int columnCount, double** dp2_seed, int colorCount, double*** dp3_CompressedMatrix) {
+int MatrixMultiplication_VxS(unsigned int ** uip3_SparsityPattern, double** dp3_Value, int rowCount, int columnCount, double** dp2_seed, int colorCount, double*** dp3_CompressedMatrix, int i_MatrixAllocation) {
 
 	//Allocate memory for (*dp3_CompressedMatrix)[rowCount][colorCount]
 #if DEBUG == 2
 	cout<<"Allocate memory for (*dp3_CompressedMatrix)[rowCount][colorCount]"<<endl;
 #endif
-	(*dp3_CompressedMatrix) = new double*[rowCount];
-	for(unsigned int i=0; i < (unsigned int)rowCount; i++) {
-		(*dp3_CompressedMatrix)[i] = new double[colorCount];
-		for(unsigned int j=0; j < (unsigned int)colorCount; j++) {
-			(*dp3_CompressedMatrix)[i][j] = 0.;
-		}
-	}
+	(*dp3_CompressedMatrix) = new_2DMatrix<double>(rowCount, colorCount, i_MatrixAllocation);
+	if((*dp3_CompressedMatrix) == NULL && rowCount > 0) return 1;
 
 	//do the multiplication
 #if DEBUG == 2
@@ -1268,17 +1258,12 @@ int MatrixMultiplication_VxS(unsigned int ** uip3_SparsityPattern, double** dp3_
 	return 0;
 }
 
-int MatrixMultiplication_SxV(unsigned int ** uip3_SparsityPattern, double** dp3_Value, int rowCount, int columnCount, double** dp2_seed, int colorCount, double*** dp3_CompressedMatrix) {
+int MatrixMultiplication_SxV(unsigned int ** uip3_SparsityPattern, double** dp3_Value, int rowCount, int columnCount, double** dp2_seed, int colorCount, double*** dp3_CompressedMatrix, int i_MatrixAllocation) {
 
 	//Allocate memory for (*dp3_CompressedMatrix)[colorCount][columnCount]
 	//cout<<"Allocate memory for (*dp3_CompressedMatrix)[colorCount][columnCount]"<<endl;
-	(*dp3_CompressedMatrix) = new double*[colorCount];
-	for(unsigned int i=0; i < (unsigned int)colorCount; i++) {
-		(*dp3_CompressedMatrix)[i] = new double[columnCount];
-		for(unsigned int j=0; j < (unsigned int)columnCount; j++) {
-			(*dp3_CompressedMatrix)[i][j] = 0.;
-		}
-	}
+	(*dp3_CompressedMatrix) = new_2DMatrix<double>(colorCount, columnCount, i_MatrixAllocation);
+	if((*dp3_CompressedMatrix) == NULL && colorCount > 0) return 1;
 
 	//do the multiplication
 	//cout<<"Do the multiplication"<<endl;
@@ -1294,6 +1279,74 @@ int MatrixMultiplication_SxV(unsigned int ** uip3_SparsityPattern, double** dp3_
 
 	return 0;
 }
+
+int MatrixMultiplication_VxS__usingSeedColors(unsigned int ** uip3_SparsityPattern, double** dp3_Value, int rowCount, const vector<int> &vi_SeedColors, int colorCount, double*** dp3_CompressedMatrix, int i_MatrixAllocation) {
+
+	//Allocate memory for (*dp3_CompressedMatrix)[rowCount][colorCount]
+	(*dp3_CompressedMatrix) = new_2DMatrix<double>(rowCount, colorCount, i_MatrixAllocation);
+	if((*dp3_CompressedMatrix) == NULL && rowCount > 0) return 1;
+
+	//do the multiplication, each row of the compressed matrix only depends on the same row of the original matrix
+#ifdef _OPENMP
+	#pragma omp parallel for schedule(dynamic, 64)
+#endif
+	for(int i=0; i < rowCount; i++) {
+		double* dp_CompressedRow = (*dp3_CompressedMatrix)[i];
+		unsigned int numOfNonZeros = uip3_SparsityPattern[i][0];
+		for(unsigned int j=1; j <= numOfNonZeros; j++) {
+			int color = vi_SeedColors[uip3_SparsityPattern[i][j]];
+			if(color == _UNKNOWN) continue;
+			dp_CompressedRow[color] += dp3_Value[i][j];
+		}
+	}
+
+	return 0;
+}
+
+int MatrixMultiplication_SxV__usingSeedColors(unsigned int ** uip3_SparsityPattern, double** dp3_Value, int rowCount, int columnCount, const vector<int> &vi_SeedColors, int colorCount, double*** dp3_CompressedMatrix, int i_MatrixAllocation) {
+
+	//Allocate memory for (*dp3_CompressedMatrix)[colorCount][columnCount]
+	(*dp3_CompressedMatrix) = new_2DMatrix<double>(colorCount, columnCount, i_MatrixAllocation);
+	if((*dp3_CompressedMatrix) == NULL && colorCount > 0) return 1;
+
+	//group the rows by color, so that each row of the compressed matrix is written by one thread only
+	vector<int> vi_ColorClassBegin(colorCount + 1, 0), vi_ColorClassRows(rowCount);
+	for(int i=0; i < rowCount; i++) {
+		if(vi_SeedColors[i] != _UNKNOWN) vi_ColorClassBegin[vi_SeedColors[i] + 1]++;
+	}
+	for(int k=0; k < colorCount; k++) vi_ColorClassBegin[k+1] += vi_ColorClassBegin[k];
+	vector<int> vi_ColorClassEnd(vi_ColorClassBegin.begin(), vi_ColorClassBegin.end() - 1);
+	for(int i=0; i < rowCount; i++) {
+		if(vi_SeedColors[i] != _UNKNOWN) vi_ColorClassRows[vi_ColorClassEnd[vi_SeedColors[i]]++] = i;
+	}
+
+	//do the multiplication
+#ifdef _OPENMP
+	#pragma omp parallel for schedule(dynamic, 1)
+#endif
+	for(int k=0; k < colorCount; k++) {
+		double* dp_CompressedRow = (*dp3_CompressedMatrix)[k];
+		for(int it=vi_ColorClassBegin[k]; it < vi_ColorClassBegin[k+1]; it++) {
+			int i = vi_ColorClassRows[it];
+			unsigned int numOfNonZeros = uip3_SparsityPattern[i][0];
+			for(unsigned int j=1; j <= numOfNonZeros; j++) {
+				dp_CompressedRow[uip3_SparsityPattern[i][j]] += dp3_Value[i][j];
+			}
+		}
+	}
+
+	return 0;
+}
+
+int MatrixMultiplication_Bidirectional__usingSeedColors(unsigned int ** uip3_SparsityPattern, double** dp3_Value, int rowCount, int columnCount, const vector<int> &vi_LeftSeedColors, int i_LeftColorCount, const vector<int> &vi_RightSeedColors, int i_RightColorCount, double*** dp3_RowCompressedMatrix, double*** dp3_ColumnCompressedMatrix, int i_MatrixAllocation) {
+	(*dp3_RowCompressedMatrix) = NULL;
+	(*dp3_ColumnCompressedMatrix) = NULL;
+
+	if(i_LeftColorCount > 0 && MatrixMultiplication_SxV__usingSeedColors(uip3_SparsityPattern, dp3_Value, rowCount, columnCount, vi_LeftSeedColors, i_LeftColorCount, dp3_RowCompressedMatrix, i_MatrixAllocation) != 0) return 1;
+	if(i_RightColorCount > 0 && MatrixMultiplication_VxS__usingSeedColors(uip3_SparsityPattern, dp3_Value, rowCount, vi_RightSeedColors, i_RightColorCount, dp3_ColumnCompressedMatrix, i_MatrixAllocation) != 0) return 1;
+
+	return 0;
+}
 bool ADICMatricesAreEqual(std::list<std::vector<double> >& lvd_Value, std::list<std::vector<double> >& lvd_NewValue, bool compare_exact, bool print_all) {
 	double ratio = 1.;
 	int none_equal_count = 0;
@@ -174,15 +174,38 @@ int ConvertRowCompressedFormat2ADIC(unsigned int ** uip2_SparsityPattern_RowComp
 
 /// Multiply the original sparse matrix (uip3_SparsityPattern,dp3_Value) (in compress sparse row format) with the seed matrix dp2_seed and store the result in "dp3_CompressedMatrix"
 /** (*dp3_CompressedMatrix) = (*dp3_Value) * dp2_seed
+(*dp3_CompressedMatrix) is allocated following i_MatrixAllocation (MATRIX_ALLOC_ROWS or MATRIX_ALLOC_SLAB), free it with free_2DMatrix(..., i_MatrixAllocation). Return 1 if it could not be allocated, 0 otherwise
 */
-int MatrixMultiplication_VxS(unsigned int ** uip3_SparsityPattern, double** dp3_Value, int rowCount, int columnCount, double** dp2_seed, int colorCount, double*** dp3_CompressedMatrix);
+int MatrixMultiplication_VxS(unsigned int ** uip3_SparsityPattern, double** dp3_Value, int rowCount, int columnCount, double** dp2_seed, int colorCount, double*** dp3_CompressedMatrix, int i_MatrixAllocation = MATRIX_ALLOC_ROWS);
 
-int MatrixMultiplication_VxS__usingVertexPartialColors(std::list<std::set<int> > &lsi_SparsityPattern, std::list<std::vector<double> > &lvd_Value, int columnCount, vector<int> &vi_VertexPartialColors, int colorCount, double*** dp3_CompressedMatrix);
+int MatrixMultiplication_VxS__usingVertexPartialColors(std::list<std::set<int> > &lsi_SparsityPattern, std::list<std::vector<double> > &lvd_Value, int columnCount, vector<int> &vi_VertexPartialColors, int colorCount, double*** dp3_CompressedMatrix, int i_MatrixAllocation = MATRIX_ALLOC_ROWS);
 
 /// Multiply the seed matrix dp2_seed with the original sparse matrix (uip3_SparsityPattern,dp3_Value) (in compress sparse row format) and store the result in "dp3_CompressedMatrix"
 /** (*dp3_CompressedMatrix) = dp2_seed * (*dp3_Value)
+(*dp3_CompressedMatrix) is allocated following i_MatrixAllocation (MATRIX_ALLOC_ROWS or MATRIX_ALLOC_SLAB), free it with free_2DMatrix(..., i_MatrixAllocation). Return 1 if it could not be allocated, 0 otherwise
 */
-int MatrixMultiplication_SxV(unsigned int ** uip3_SparsityPattern, double** dp3_Value, int rowCount, int columnCount, double** dp2_seed, int colorCount, double*** dp3_CompressedMatrix);
+int MatrixMultiplication_SxV(unsigned int ** uip3_SparsityPattern, double** dp3_Value, int rowCount, int columnCount, double** dp2_seed, int colorCount, double*** dp3_CompressedMatrix, int i_MatrixAllocation = MATRIX_ALLOC_ROWS);
+
+/// Same as MatrixMultiplication_VxS(), except that the seed matrix is given by its seed colors (see GetSeedColors())
+/** vi_SeedColors[j] is the column of the seed matrix holding the 1 of row j, or _UNKNOWN if row j is zero.
+Each nonzero is visited once: O(nnz) instead of O(nnz*colorCount). The rows are compressed in parallel.
+(*dp3_CompressedMatrix) is rowCount x colorCount, allocated following i_MatrixAllocation, free it with free_2DMatrix(..., i_MatrixAllocation). Return 1 if it could not be allocated, 0 otherwise
+*/
+int MatrixMultiplication_VxS__usingSeedColors(unsigned int ** uip3_SparsityPattern, double** dp3_Value, int rowCount, const vector<int> &vi_SeedColors, int colorCount, double*** dp3_CompressedMatrix, int i_MatrixAllocation = MATRIX_ALLOC_SLAB);
+
+/// Same as MatrixMultiplication_SxV(), except that the seed matrix is given by its seed colors (see GetSeedColors())
+/** vi_SeedColors[i] is the row of the seed matrix holding the 1 of column i, or _UNKNOWN if column i is zero.
+Each nonzero is visited once: O(nnz) instead of O(nnz*colorCount). The color classes are compressed in parallel.
+(*dp3_CompressedMatrix) is colorCount x columnCount, allocated following i_MatrixAllocation, free it with free_2DMatrix(..., i_MatrixAllocation). Return 1 if it could not be allocated, 0 otherwise
+*/
+int MatrixMultiplication_SxV__usingSeedColors(unsigned int ** uip3_SparsityPattern, double** dp3_Value, int rowCount, int columnCount, const vector<int> &vi_SeedColors, int colorCount, double*** dp3_CompressedMatrix, int i_MatrixAllocation = MATRIX_ALLOC_SLAB);
+
+/// Bidirectional compression from the left and right seed colors of a bicoloring (see BipartiteGraphBicoloring::GetLeftSeedColors() and GetRightSeedColors())
+/** (*dp3_RowCompressedMatrix) = MatrixMultiplication_SxV__usingSeedColors() with the left seed colors, NULL if i_LeftColorCount == 0
+(*dp3_ColumnCompressedMatrix) = MatrixMultiplication_VxS__usingSeedColors() with the right seed colors, NULL if i_RightColorCount == 0
+Both are the inputs of JacobianRecovery2D.
+*/
+int MatrixMultiplication_Bidirectional__usingSeedColors(unsigned int ** uip3_SparsityPattern, double** dp3_Value, int rowCount, int columnCount, const vector<int> &vi_LeftSeedColors, int i_LeftColorCount, const vector<int> &vi_RightSeedColors, int i_RightColorCount, double*** dp3_RowCompressedMatrix, double*** dp3_ColumnCompressedMatrix, int i_MatrixAllocation = MATRIX_ALLOC_SLAB);
 
 ///Compare dp3_Value with dp3_NewValue and see if all the values are equal.
 /**